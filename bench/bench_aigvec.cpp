@@ -0,0 +1,87 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * This file is part of Bitwuzla.
+ *
+ * Copyright (C) 2007-2022 by the authors listed in the AUTHORS file.
+ *
+ * See COPYING for more information on using this software.
+ */
+
+#include <benchmark/benchmark.h>
+
+extern "C" {
+#include "bzlaaig.h"
+#include "bzlaaigvec.h"
+#include "bzlacore.h"
+}
+
+typedef BzlaAIGVec *(*AigvecBinFun)(BzlaAIGVecMgr *,
+                                    BzlaAIGVec *,
+                                    BzlaAIGVec *);
+
+static void
+aigvec_widths(benchmark::internal::Benchmark *b)
+{
+  for (int64_t width : {8, 16, 32, 64})
+  {
+    b->Arg(width);
+  }
+}
+
+/**
+ * Bit-blast a binary operator on two fresh variables of width 'width'.
+ * Reports the number of AND gates created per bit-blasted operation and the
+ * number of clauses of their Tseitin encoding (three clauses per AND gate).
+ */
+static void
+bench_aigvec_binary(benchmark::State &state, AigvecBinFun fun)
+{
+  uint32_t width = state.range(0);
+  uint64_t num_aigs = 0;
+  Bzla *bzla;
+  BzlaAIGVecMgr *avmgr;
+  BzlaAIGVec *a, *b, *res;
+
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    bzla  = bzla_new();
+    avmgr = bzla_aigvec_mgr_new(bzla);
+    a     = bzla_aigvec_var(avmgr, width);
+    b     = bzla_aigvec_var(avmgr, width);
+    state.ResumeTiming();
+
+    res = fun(avmgr, a, b);
+    benchmark::DoNotOptimize(res);
+
+    state.PauseTiming();
+    num_aigs = bzla_aigvec_get_aig_mgr(avmgr)->cur_num_aigs;
+    bzla_aigvec_release_delete(avmgr, res);
+    bzla_aigvec_release_delete(avmgr, a);
+    bzla_aigvec_release_delete(avmgr, b);
+    bzla_aigvec_mgr_delete(avmgr);
+    bzla_delete(bzla);
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.counters["aigs"]    = num_aigs;
+  state.counters["clauses"] = 3 * num_aigs;
+}
+
+BENCHMARK_CAPTURE(bench_aigvec_binary, and, bzla_aigvec_and)
+    ->Apply(aigvec_widths);
+BENCHMARK_CAPTURE(bench_aigvec_binary, eq, bzla_aigvec_eq)
+    ->Apply(aigvec_widths);
+BENCHMARK_CAPTURE(bench_aigvec_binary, ult, bzla_aigvec_ult)
+    ->Apply(aigvec_widths);
+BENCHMARK_CAPTURE(bench_aigvec_binary, add, bzla_aigvec_add)
+    ->Apply(aigvec_widths);
+BENCHMARK_CAPTURE(bench_aigvec_binary, mul, bzla_aigvec_mul)
+    ->Apply(aigvec_widths);
+BENCHMARK_CAPTURE(bench_aigvec_binary, udiv, bzla_aigvec_udiv)
+    ->Apply(aigvec_widths);
+BENCHMARK_CAPTURE(bench_aigvec_binary, urem, bzla_aigvec_urem)
+    ->Apply(aigvec_widths);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,162 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * This file is part of Bitwuzla.
+ *
+ * Copyright (C) 2007-2022 by the authors listed in the AUTHORS file.
+ *
+ * See COPYING for more information on using this software.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+extern "C" {
+#include "bzlabv.h"
+#include "utils/bzlamem.h"
+#include "utils/bzlarng.h"
+}
+
+/* Number of operand pairs per iteration. */
+#define BENCH_BV_NUM_OPS 64
+
+typedef BzlaBitVector *(*BvUnFun)(BzlaMemMgr *, const BzlaBitVector *);
+typedef BzlaBitVector *(*BvBinFun)(BzlaMemMgr *,
+                                   const BzlaBitVector *,
+                                   const BzlaBitVector *);
+
+static void
+bv_widths(benchmark::internal::Benchmark *b)
+{
+  for (int64_t width : {1, 8, 16, 32, 64, 128, 256})
+  {
+    b->Arg(width);
+  }
+}
+
+static std::vector<BzlaBitVector *>
+new_random_operands(BzlaMemMgr *mm, BzlaRNG *rng, uint32_t width)
+{
+  std::vector<BzlaBitVector *> res;
+  for (uint32_t i = 0; i < BENCH_BV_NUM_OPS; ++i)
+  {
+    res.push_back(bzla_bv_new_random(mm, rng, width));
+  }
+  return res;
+}
+
+static void
+free_operands(BzlaMemMgr *mm, std::vector<BzlaBitVector *> &operands)
+{
+  for (BzlaBitVector *bv : operands)
+  {
+    bzla_bv_free(mm, bv);
+  }
+}
+
+static void
+bench_bv_unary(benchmark::State &state, BvUnFun fun)
+{
+  uint32_t width = state.range(0);
+  BzlaMemMgr *mm = bzla_mem_mgr_new();
+  BzlaRNG *rng   = bzla_rng_new(mm, 42);
+  BzlaBitVector *res;
+
+  std::vector<BzlaBitVector *> a = new_random_operands(mm, rng, width);
+
+  for (auto _ : state)
+  {
+    for (BzlaBitVector *bv : a)
+    {
+      res = fun(mm, bv);
+      benchmark::DoNotOptimize(res);
+      bzla_bv_free(mm, res);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * BENCH_BV_NUM_OPS);
+
+  free_operands(mm, a);
+  bzla_rng_delete(rng);
+  bzla_mem_mgr_delete(mm);
+}
+
+static void
+bench_bv_binary(benchmark::State &state, BvBinFun fun)
+{
+  uint32_t width = state.range(0);
+  BzlaMemMgr *mm = bzla_mem_mgr_new();
+  BzlaRNG *rng   = bzla_rng_new(mm, 42);
+  BzlaBitVector *res;
+
+  std::vector<BzlaBitVector *> a = new_random_operands(mm, rng, width);
+  std::vector<BzlaBitVector *> b = new_random_operands(mm, rng, width);
+
+  for (auto _ : state)
+  {
+    for (size_t i = 0; i < BENCH_BV_NUM_OPS; ++i)
+    {
+      res = fun(mm, a[i], b[i]);
+      benchmark::DoNotOptimize(res);
+      bzla_bv_free(mm, res);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * BENCH_BV_NUM_OPS);
+
+  free_operands(mm, a);
+  free_operands(mm, b);
+  bzla_rng_delete(rng);
+  bzla_mem_mgr_delete(mm);
+}
+
+static void
+bench_bv_compare(benchmark::State &state)
+{
+  uint32_t width = state.range(0);
+  BzlaMemMgr *mm = bzla_mem_mgr_new();
+  BzlaRNG *rng   = bzla_rng_new(mm, 42);
+  int32_t res;
+
+  std::vector<BzlaBitVector *> a = new_random_operands(mm, rng, width);
+  std::vector<BzlaBitVector *> b = new_random_operands(mm, rng, width);
+
+  for (auto _ : state)
+  {
+    for (size_t i = 0; i < BENCH_BV_NUM_OPS; ++i)
+    {
+      res = bzla_bv_compare(a[i], b[i]);
+      benchmark::DoNotOptimize(res);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * BENCH_BV_NUM_OPS);
+
+  free_operands(mm, a);
+  free_operands(mm, b);
+  bzla_rng_delete(rng);
+  bzla_mem_mgr_delete(mm);
+}
+
+BENCHMARK_CAPTURE(bench_bv_unary, not, bzla_bv_not)->Apply(bv_widths);
+BENCHMARK_CAPTURE(bench_bv_unary, neg, bzla_bv_neg)->Apply(bv_widths);
+BENCHMARK_CAPTURE(bench_bv_unary, inc, bzla_bv_inc)->Apply(bv_widths);
+
+BENCHMARK_CAPTURE(bench_bv_binary, add, bzla_bv_add)->Apply(bv_widths);
+BENCHMARK_CAPTURE(bench_bv_binary, sub, bzla_bv_sub)->Apply(bv_widths);
+BENCHMARK_CAPTURE(bench_bv_binary, and, bzla_bv_and)->Apply(bv_widths);
+BENCHMARK_CAPTURE(bench_bv_binary, or, bzla_bv_or)->Apply(bv_widths);
+BENCHMARK_CAPTURE(bench_bv_binary, xor, bzla_bv_xor)->Apply(bv_widths);
+BENCHMARK_CAPTURE(bench_bv_binary, eq, bzla_bv_eq)->Apply(bv_widths);
+BENCHMARK_CAPTURE(bench_bv_binary, ult, bzla_bv_ult)->Apply(bv_widths);
+BENCHMARK_CAPTURE(bench_bv_binary, slt, bzla_bv_slt)->Apply(bv_widths);
+BENCHMARK_CAPTURE(bench_bv_binary, sll, bzla_bv_sll)->Apply(bv_widths);
+BENCHMARK_CAPTURE(bench_bv_binary, srl, bzla_bv_srl)->Apply(bv_widths);
+BENCHMARK_CAPTURE(bench_bv_binary, mul, bzla_bv_mul)->Apply(bv_widths);
+BENCHMARK_CAPTURE(bench_bv_binary, udiv, bzla_bv_udiv)->Apply(bv_widths);
+BENCHMARK_CAPTURE(bench_bv_binary, urem, bzla_bv_urem)->Apply(bv_widths);
+BENCHMARK_CAPTURE(bench_bv_binary, sdiv, bzla_bv_sdiv)->Apply(bv_widths);
+BENCHMARK_CAPTURE(bench_bv_binary, srem, bzla_bv_srem)->Apply(bv_widths);
+BENCHMARK_CAPTURE(bench_bv_binary, concat, bzla_bv_concat)->Apply(bv_widths);
+
+BENCHMARK(bench_bv_compare)->Apply(bv_widths);
+
+BENCHMARK_MAIN();
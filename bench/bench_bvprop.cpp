@@ -0,0 +1,131 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * This file is part of Bitwuzla.
+ *
+ * Copyright (C) 2007-2022 by the authors listed in the AUTHORS file.
+ *
+ * See COPYING for more information on using this software.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+extern "C" {
+#include "bzlabv.h"
+#include "bzlabvdomain.h"
+#include "bzlabvprop.h"
+#include "utils/bzlamem.h"
+#include "utils/bzlarng.h"
+}
+
+/* Number of domain triples per iteration. */
+#define BENCH_BVPROP_NUM_OPS 32
+
+typedef bool (*BvPropFun)(BzlaMemMgr *,
+                          BzlaBvDomain *,
+                          BzlaBvDomain *,
+                          BzlaBvDomain *,
+                          BzlaBvDomain **,
+                          BzlaBvDomain **,
+                          BzlaBvDomain **);
+
+/* Propagators for ult and shifts assume widths that fit into 64 bits. */
+static void
+bvprop_widths(benchmark::internal::Benchmark *b)
+{
+  for (int64_t width : {8, 16, 32, 64})
+  {
+    b->Arg(width);
+  }
+}
+
+/**
+ * Create a random domain of width 'width' where each bit is fixed with
+ * probability 1/2.
+ */
+static BzlaBvDomain *
+new_random_domain(BzlaMemMgr *mm, BzlaRNG *rng, uint32_t width)
+{
+  BzlaBitVector *val, *fixed, *not_fixed, *lo, *hi;
+  BzlaBvDomain *res;
+
+  val       = bzla_bv_new_random(mm, rng, width);
+  fixed     = bzla_bv_new_random(mm, rng, width);
+  not_fixed = bzla_bv_not(mm, fixed);
+  lo        = bzla_bv_and(mm, val, fixed);
+  hi        = bzla_bv_or(mm, lo, not_fixed);
+  res       = bzla_bvdomain_new(mm, lo, hi);
+  bzla_bv_free(mm, val);
+  bzla_bv_free(mm, fixed);
+  bzla_bv_free(mm, not_fixed);
+  bzla_bv_free(mm, lo);
+  bzla_bv_free(mm, hi);
+  return res;
+}
+
+static void
+bench_bvprop_binary(benchmark::State &state, BvPropFun fun, bool is_pred)
+{
+  uint32_t width = state.range(0);
+  BzlaMemMgr *mm = bzla_mem_mgr_new();
+  BzlaRNG *rng   = bzla_rng_new(mm, 42);
+  BzlaBvDomain *res_x, *res_y, *res_z;
+  bool res;
+  std::vector<BzlaBvDomain *> d_x, d_y, d_z;
+
+  for (uint32_t i = 0; i < BENCH_BVPROP_NUM_OPS; ++i)
+  {
+    d_x.push_back(new_random_domain(mm, rng, width));
+    d_y.push_back(new_random_domain(mm, rng, width));
+    d_z.push_back(new_random_domain(mm, rng, is_pred ? 1 : width));
+  }
+
+  for (auto _ : state)
+  {
+    for (size_t i = 0; i < BENCH_BVPROP_NUM_OPS; ++i)
+    {
+      res = fun(mm, d_x[i], d_y[i], d_z[i], &res_x, &res_y, &res_z);
+      benchmark::DoNotOptimize(res);
+      bzla_bvdomain_free(mm, res_x);
+      bzla_bvdomain_free(mm, res_y);
+      bzla_bvdomain_free(mm, res_z);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * BENCH_BVPROP_NUM_OPS);
+
+  for (size_t i = 0; i < BENCH_BVPROP_NUM_OPS; ++i)
+  {
+    bzla_bvdomain_free(mm, d_x[i]);
+    bzla_bvdomain_free(mm, d_y[i]);
+    bzla_bvdomain_free(mm, d_z[i]);
+  }
+  bzla_rng_delete(rng);
+  bzla_mem_mgr_delete(mm);
+}
+
+BENCHMARK_CAPTURE(bench_bvprop_binary, eq, bzla_bvprop_eq, true)
+    ->Apply(bvprop_widths);
+BENCHMARK_CAPTURE(bench_bvprop_binary, ult, bzla_bvprop_ult, true)
+    ->Apply(bvprop_widths);
+BENCHMARK_CAPTURE(bench_bvprop_binary, and, bzla_bvprop_and, false)
+    ->Apply(bvprop_widths);
+BENCHMARK_CAPTURE(bench_bvprop_binary, or, bzla_bvprop_or, false)
+    ->Apply(bvprop_widths);
+BENCHMARK_CAPTURE(bench_bvprop_binary, xor, bzla_bvprop_xor, false)
+    ->Apply(bvprop_widths);
+BENCHMARK_CAPTURE(bench_bvprop_binary, sll, bzla_bvprop_sll, false)
+    ->Apply(bvprop_widths);
+BENCHMARK_CAPTURE(bench_bvprop_binary, srl, bzla_bvprop_srl, false)
+    ->Apply(bvprop_widths);
+BENCHMARK_CAPTURE(bench_bvprop_binary, add, bzla_bvprop_add, false)
+    ->Apply(bvprop_widths);
+BENCHMARK_CAPTURE(bench_bvprop_binary, mul, bzla_bvprop_mul, false)
+    ->Apply(bvprop_widths);
+BENCHMARK_CAPTURE(bench_bvprop_binary, udiv, bzla_bvprop_udiv, false)
+    ->Apply(bvprop_widths);
+BENCHMARK_CAPTURE(bench_bvprop_binary, urem, bzla_bvprop_urem, false)
+    ->Apply(bvprop_widths);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,153 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * This file is part of Bitwuzla.
+ *
+ * Copyright (C) 2007-2022 by the authors listed in the AUTHORS file.
+ *
+ * See COPYING for more information on using this software.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+extern "C" {
+#include "utils/bzlahashint.h"
+#include "utils/bzlahashptr.h"
+#include "utils/bzlamem.h"
+#include "utils/bzlarng.h"
+}
+
+static void
+hash_sizes(benchmark::internal::Benchmark *b)
+{
+  for (int64_t n : {64, 1024, 16384})
+  {
+    b->Arg(n);
+  }
+}
+
+static std::vector<int32_t>
+new_random_keys(BzlaMemMgr *mm, uint32_t n)
+{
+  std::vector<int32_t> res;
+  BzlaRNG *rng = bzla_rng_new(mm, 42);
+  for (uint32_t i = 0; i < n; ++i)
+  {
+    /* key 0 is reserved by the int hash tables */
+    res.push_back(bzla_rng_pick_rand(rng, 1, INT32_MAX));
+  }
+  bzla_rng_delete(rng);
+  return res;
+}
+
+static void
+bench_hashint_table(benchmark::State &state)
+{
+  uint32_t n     = state.range(0);
+  BzlaMemMgr *mm = bzla_mem_mgr_new();
+  std::vector<int32_t> keys = new_random_keys(mm, n);
+
+  for (auto _ : state)
+  {
+    BzlaIntHashTable *t = bzla_hashint_table_new(mm);
+    for (int32_t k : keys)
+    {
+      if (!bzla_hashint_table_contains(t, k))
+      {
+        bzla_hashint_table_add(t, k);
+      }
+    }
+    for (int32_t k : keys)
+    {
+      benchmark::DoNotOptimize(bzla_hashint_table_contains(t, k));
+    }
+    for (int32_t k : keys)
+    {
+      if (bzla_hashint_table_contains(t, k))
+      {
+        bzla_hashint_table_remove(t, k);
+      }
+    }
+    bzla_hashint_table_delete(t);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+
+  bzla_mem_mgr_delete(mm);
+}
+
+static void
+bench_hashint_map(benchmark::State &state)
+{
+  uint32_t n     = state.range(0);
+  BzlaMemMgr *mm = bzla_mem_mgr_new();
+  std::vector<int32_t> keys = new_random_keys(mm, n);
+
+  for (auto _ : state)
+  {
+    BzlaIntHashTable *t = bzla_hashint_map_new(mm);
+    for (int32_t k : keys)
+    {
+      if (!bzla_hashint_map_contains(t, k))
+      {
+        bzla_hashint_map_add(t, k)->as_int = k;
+      }
+    }
+    for (int32_t k : keys)
+    {
+      benchmark::DoNotOptimize(bzla_hashint_map_get(t, k));
+    }
+    bzla_hashint_map_delete(t);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+
+  bzla_mem_mgr_delete(mm);
+}
+
+static void
+bench_hashptr_table(benchmark::State &state)
+{
+  uint32_t n     = state.range(0);
+  BzlaMemMgr *mm = bzla_mem_mgr_new();
+  std::vector<int32_t> keys = new_random_keys(mm, n);
+  std::vector<void *> ptrs;
+
+  for (int32_t k : keys)
+  {
+    ptrs.push_back((void *) (size_t) k);
+  }
+
+  for (auto _ : state)
+  {
+    BzlaPtrHashTable *t = bzla_hashptr_table_new(mm, 0, 0);
+    for (void *p : ptrs)
+    {
+      if (!bzla_hashptr_table_get(t, p))
+      {
+        bzla_hashptr_table_add(t, p);
+      }
+    }
+    for (void *p : ptrs)
+    {
+      benchmark::DoNotOptimize(bzla_hashptr_table_get(t, p));
+    }
+    for (void *p : ptrs)
+    {
+      if (bzla_hashptr_table_get(t, p))
+      {
+        bzla_hashptr_table_remove(t, p, 0, 0);
+      }
+    }
+    bzla_hashptr_table_delete(t);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+
+  bzla_mem_mgr_delete(mm);
+}
+
+BENCHMARK(bench_hashint_table)->Apply(hash_sizes);
+BENCHMARK(bench_hashint_map)->Apply(hash_sizes);
+BENCHMARK(bench_hashptr_table)->Apply(hash_sizes);
+
+BENCHMARK_MAIN();
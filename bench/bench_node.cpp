@@ -0,0 +1,128 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * This file is part of Bitwuzla.
+ *
+ * Copyright (C) 2007-2022 by the authors listed in the AUTHORS file.
+ *
+ * See COPYING for more information on using this software.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+extern "C" {
+#include "bzlacore.h"
+#include "bzlaexp.h"
+#include "bzlanode.h"
+#include "bzlasort.h"
+}
+
+typedef BzlaNode *(*NodeBinFun)(Bzla *, BzlaNode *, BzlaNode *);
+
+static void
+node_counts(benchmark::internal::Benchmark *b)
+{
+  for (int64_t n : {64, 512, 4096})
+  {
+    b->Arg(n);
+  }
+}
+
+static std::vector<BzlaNode *>
+new_vars(Bzla *bzla, uint32_t n)
+{
+  std::vector<BzlaNode *> res;
+  BzlaSortId sort = bzla_sort_bv(bzla, 32);
+  for (uint32_t i = 0; i < n; ++i)
+  {
+    res.push_back(bzla_exp_var(bzla, sort, 0));
+  }
+  bzla_sort_release(bzla, sort);
+  return res;
+}
+
+static void
+release_nodes(Bzla *bzla, std::vector<BzlaNode *> &nodes)
+{
+  for (BzlaNode *n : nodes)
+  {
+    bzla_node_release(bzla, n);
+  }
+  nodes.clear();
+}
+
+/**
+ * Create n binary nodes over pairwise distinct operands. All nodes are
+ * released at the end of each iteration, hence every creation inserts a new
+ * node into the unique table.
+ */
+static void
+bench_node_create(benchmark::State &state, NodeBinFun fun)
+{
+  uint32_t n = state.range(0);
+  Bzla *bzla = bzla_new();
+  std::vector<BzlaNode *> vars = new_vars(bzla, n + 1);
+  std::vector<BzlaNode *> nodes;
+
+  for (auto _ : state)
+  {
+    for (uint32_t i = 0; i < n; ++i)
+    {
+      nodes.push_back(fun(bzla, vars[i], vars[i + 1]));
+    }
+    release_nodes(bzla, nodes);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+
+  release_nodes(bzla, vars);
+  bzla_delete(bzla);
+}
+
+/**
+ * Create n binary nodes that already exist, i.e., every creation is a hit
+ * in the unique table.
+ */
+static void
+bench_node_lookup(benchmark::State &state, NodeBinFun fun)
+{
+  uint32_t n = state.range(0);
+  Bzla *bzla = bzla_new();
+  std::vector<BzlaNode *> vars = new_vars(bzla, n + 1);
+  std::vector<BzlaNode *> existing, nodes;
+
+  for (uint32_t i = 0; i < n; ++i)
+  {
+    existing.push_back(fun(bzla, vars[i], vars[i + 1]));
+  }
+
+  for (auto _ : state)
+  {
+    for (uint32_t i = 0; i < n; ++i)
+    {
+      nodes.push_back(fun(bzla, vars[i], vars[i + 1]));
+    }
+    release_nodes(bzla, nodes);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+
+  release_nodes(bzla, existing);
+  release_nodes(bzla, vars);
+  bzla_delete(bzla);
+}
+
+BENCHMARK_CAPTURE(bench_node_create, and, bzla_exp_bv_and)
+    ->Apply(node_counts);
+BENCHMARK_CAPTURE(bench_node_create, add, bzla_exp_bv_add)
+    ->Apply(node_counts);
+BENCHMARK_CAPTURE(bench_node_create, mul, bzla_exp_bv_mul)
+    ->Apply(node_counts);
+BENCHMARK_CAPTURE(bench_node_lookup, and, bzla_exp_bv_and)
+    ->Apply(node_counts);
+BENCHMARK_CAPTURE(bench_node_lookup, add, bzla_exp_bv_add)
+    ->Apply(node_counts);
+BENCHMARK_CAPTURE(bench_node_lookup, mul, bzla_exp_bv_mul)
+    ->Apply(node_counts);
+
+BENCHMARK_MAIN();
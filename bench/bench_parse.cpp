@@ -0,0 +1,94 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * This file is part of Bitwuzla.
+ *
+ * Copyright (C) 2007-2022 by the authors listed in the AUTHORS file.
+ *
+ * See COPYING for more information on using this software.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstdio>
+#include <iomanip>
+#include <sstream>
+#include <string>
+
+extern "C" {
+#include "bitwuzla.h"
+}
+
+static void
+parse_sizes(benchmark::internal::Benchmark *b)
+{
+  for (int64_t n : {100, 1000, 10000})
+  {
+    b->Arg(n);
+  }
+}
+
+/**
+ * Generate an SMT-LIB2 input with 'n' assertions over bit-vector constants.
+ * The input does not contain a check-sat command, only parsing and term
+ * construction are measured.
+ */
+static std::string
+gen_smt2(uint32_t n)
+{
+  static const char *ops[] = {"bvadd", "bvmul", "bvand", "bvxor", "bvudiv"};
+  std::stringstream ss;
+
+  ss << "(set-logic QF_BV)\n";
+  for (uint32_t i = 0; i <= n; ++i)
+  {
+    ss << "(declare-const x" << i << " (_ BitVec 32))\n";
+  }
+  for (uint32_t i = 0; i < n; ++i)
+  {
+    ss << "(assert (let ((t (" << ops[i % 5] << " x" << i << " x" << i + 1
+       << "))) (distinct t (bvnot (bvsub t #x" << std::hex << std::setw(8)
+       << std::setfill('0') << (i << 24) << std::dec << ")))))\n";
+  }
+  ss << "(exit)\n";
+  return ss.str();
+}
+
+static void
+bench_parse_smt2(benchmark::State &state)
+{
+  std::string input = gen_smt2(state.range(0));
+  FILE *outfile     = fopen("/dev/null", "w");
+  BitwuzlaResult status;
+  char *err;
+
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    Bitwuzla *bzla = bitwuzla_new();
+    FILE *infile   = fmemopen((void *) input.data(), input.size(), "r");
+    state.ResumeTiming();
+
+    bitwuzla_parse_format(
+        bzla, "smt2", infile, "bench.smt2", outfile, &err, &status);
+    if (err)
+    {
+      state.SkipWithError(err);
+      fclose(infile);
+      bitwuzla_delete(bzla);
+      break;
+    }
+
+    state.PauseTiming();
+    fclose(infile);
+    bitwuzla_delete(bzla);
+    state.ResumeTiming();
+  }
+  state.SetBytesProcessed(state.iterations() * input.size());
+
+  fclose(outfile);
+}
+
+BENCHMARK(bench_parse_smt2)->Apply(parse_sizes)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
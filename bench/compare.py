@@ -0,0 +1,98 @@
+#!/usr/bin/env python3
+###
+# Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+#
+# This file is part of Bitwuzla.
+#
+# Copyright (C) 2007-2022 by the authors listed in the AUTHORS file.
+#
+# See COPYING for more information on using this software.
+##
+
+# Compare two sets of Google Benchmark JSON results (as produced by the
+# 'bench' target) and report regressions.
+#
+# Usage: compare.py [--threshold T] [--metric real_time|cpu_time] BASE NEW
+#
+# BASE and NEW are either JSON result files or directories containing JSON
+# result files. Benchmarks are matched by name. Exits with 1 if any benchmark
+# in NEW is slower than in BASE by more than the given relative threshold.
+
+import argparse
+import json
+import os
+import sys
+
+def load(path):
+    if os.path.isdir(path):
+        files = sorted(os.path.join(path, f)
+                       for f in os.listdir(path) if f.endswith('.json'))
+    else:
+        files = [path]
+    results = {}
+    for fname in files:
+        with open(fname) as f:
+            data = json.load(f)
+        for b in data.get('benchmarks', []):
+            # Skip aggregates (mean, median, stddev) of repeated runs.
+            if b.get('run_type') == 'aggregate':
+                continue
+            results[b['name']] = b
+    return results
+
+def main():
+    ap = argparse.ArgumentParser(
+            description='Compare Google Benchmark results.')
+    ap.add_argument('base', help='baseline result file or directory')
+    ap.add_argument('new', help='contender result file or directory')
+    ap.add_argument('--threshold', type=float, default=0.05,
+                    help='relative slowdown reported as regression '
+                         '(default: 0.05)')
+    ap.add_argument('--metric', choices=['real_time', 'cpu_time'],
+                    default='cpu_time',
+                    help='time metric to compare (default: cpu_time)')
+    args = ap.parse_args()
+
+    base = load(args.base)
+    new = load(args.new)
+
+    names = [n for n in base if n in new]
+    if not names:
+        print('no common benchmarks', file=sys.stderr)
+        return 2
+
+    width = max(len(n) for n in names)
+    print('{:<{w}}  {:>14}  {:>14}  {:>8}'.format(
+        'benchmark', 'base', 'new', 'ratio', w=width))
+    print('-' * (width + 42))
+
+    regressions = []
+    for name in names:
+        b = base[name]
+        n = new[name]
+        tb = b[args.metric]
+        tn = n[args.metric]
+        ratio = tn / tb if tb else float('inf')
+        mark = ''
+        if ratio > 1.0 + args.threshold:
+            regressions.append(name)
+            mark = '  REGRESSION'
+        elif ratio < 1.0 - args.threshold:
+            mark = '  improved'
+        print('{:<{w}}  {:>11.1f} {:<2}  {:>11.1f} {:<2}  {:>8.3f}{}'.format(
+            name, tb, b.get('time_unit', 'ns'), tn, n.get('time_unit', 'ns'),
+            ratio, mark, w=width))
+
+    for name in sorted(set(base) - set(new)):
+        print('{}: missing in new results'.format(name), file=sys.stderr)
+    for name in sorted(set(new) - set(base)):
+        print('{}: missing in base results'.format(name), file=sys.stderr)
+
+    if regressions:
+        print('\n{} regression(s) above {:.1%}'.format(
+            len(regressions), args.threshold))
+        return 1
+    return 0
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,66 @@
+###
+# Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+#
+# This file is part of Bitwuzla.
+#
+# Copyright (C) 2007-2022 by the authors listed in the AUTHORS file.
+#
+# See COPYING for more information on using this software.
+##
+# Find Google Benchmark
+#
+# GoogleBenchmark_FOUND - Found Google Benchmark
+# benchmark::benchmark - Google Benchmark library
+
+find_package(benchmark 1.5.0 QUIET)
+
+if(NOT benchmark_FOUND OR NOT TARGET benchmark::benchmark)
+  include(ExternalProject)
+
+  set(GoogleBenchmark_VERSION "1.7.1")
+
+  ExternalProject_Add(
+    GoogleBenchmark-EP
+    PREFIX "${CMAKE_BINARY_DIR}/deps"
+    URL https://github.com/google/benchmark/archive/refs/tags/v${GoogleBenchmark_VERSION}.tar.gz
+    DOWNLOAD_NAME benchmark.tar.gz
+    CMAKE_ARGS
+      -DCMAKE_INSTALL_PREFIX=<INSTALL_DIR>
+      -DCMAKE_BUILD_TYPE=Release
+      -DBENCHMARK_ENABLE_TESTING=OFF
+      -DBENCHMARK_ENABLE_GTEST_TESTS=OFF
+    BUILD_COMMAND ${CMAKE_COMMAND} --build .
+    BUILD_BYPRODUCTS <INSTALL_DIR>/lib/libbenchmark.a
+    LOG_DOWNLOAD ON
+    LOG_UPDATE ON
+    LOG_CONFIGURE ON
+    LOG_BUILD ON
+    LOG_INSTALL ON
+    LOG_OUTPUT_ON_FAILURE TRUE
+  )
+
+  set(GoogleBenchmark_INCLUDE_DIR "${CMAKE_BINARY_DIR}/deps/include/")
+  set(GoogleBenchmark_LIBRARY "${CMAKE_BINARY_DIR}/deps/lib/libbenchmark.a")
+  file(MAKE_DIRECTORY "${GoogleBenchmark_INCLUDE_DIR}")
+
+  set(THREADS_PREFER_PTHREAD_FLAG ON)
+  find_package(Threads REQUIRED)
+
+  add_library(benchmark::benchmark STATIC IMPORTED GLOBAL)
+  set_target_properties(benchmark::benchmark
+    PROPERTIES
+      IMPORTED_LOCATION "${GoogleBenchmark_LIBRARY}"
+      INTERFACE_INCLUDE_DIRECTORIES "${GoogleBenchmark_INCLUDE_DIR}"
+      INTERFACE_LINK_LIBRARIES Threads::Threads
+  )
+  add_dependencies(benchmark::benchmark GoogleBenchmark-EP)
+  message(STATUS
+    "Building Google Benchmark ${GoogleBenchmark_VERSION}: "
+    "${GoogleBenchmark_LIBRARY}")
+
+  mark_as_advanced(GoogleBenchmark_INCLUDE_DIR)
+  mark_as_advanced(GoogleBenchmark_LIBRARY)
+endif()
+
+set(GoogleBenchmark_FOUND TRUE)
+mark_as_advanced(GoogleBenchmark_FOUND)
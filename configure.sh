@@ -38,8 +38,10 @@ gcov=no
 gprof=no
 python=no
 timestats=no
+compactparents=no
 
 docs=no
+bench=no
 
 ninja=no
 
@@ -80,11 +82,13 @@ Options:
 
   --python          compile python API
   --time-stats      compile with time statistics
+  --compact-parents store node parents as compact vectors of ids
 
   --testing         enable unit and regression testing
   --no-testing      disable unit and regression testing
 
   --docs            build API documentation
+  --bench           build micro-benchmarks (requires Google Benchmark)
 
 By default all supported SAT solvers available are used and linked.
 If explicitly enabled, configuration will fail if the SAT solver library
@@ -165,11 +169,13 @@ do
 
     --python)     python=yes;;
     --time-stats) timestats=yes;;
+    --compact-parents) compactparents=yes;;
 
     --testing) testing=yes;;
     --no-testing) testing=no;;
 
     --docs) docs=yes;;
+    --bench) bench=yes;;
 
     --no-cadical)   cadical=no;;
     --no-cms)       cms=no;;
@@ -237,8 +243,10 @@ cmake_opts="$CMAKE_OPTS"
 
 [ $python = yes ] && cmake_opts="$cmake_opts -DPYTHON=ON"
 [ $timestats = yes ] && cmake_opts="$cmake_opts -DTIME_STATS=ON"
+[ $compactparents = yes ] && cmake_opts="$cmake_opts -DCOMPACT_PARENTS=ON"
 
 [ $docs = yes ] && cmake_opts="$cmake_opts -DDOCS=ON"
+[ $bench = yes ] && cmake_opts="$cmake_opts -DBENCHMARKS=ON"
 
 [ -n "$flags" ] && cmake_opts="$cmake_opts -DFLAGS=$flags"
 
@@ -0,0 +1,256 @@
+#!/usr/bin/env python3
+###
+# Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+#
+# This file is part of Bitwuzla.
+#
+# Copyright (C) 2007-2022 by the authors listed in the AUTHORS file.
+#
+# See COPYING for more information on using this software.
+##
+
+# End-to-end benchmark driver.
+#
+# Run a bitwuzla binary on all .smt2/.btor/.btor2 files in a directory:
+#
+#   bzlabench.py run <bitwuzla> <dir> -o results.json [-t 60] [-- <options>]
+#
+# Per file, the result, wall clock time, peak resident set size and the
+# per-phase timings and memory statistics written by 'bitwuzla --stats-json'
+# are recorded. The parse, solve, simplify, rewrite, sat and model generation
+# timings are always available, all other phases require a build with time
+# statistics enabled (configure.sh --time-stats). The 'total' entry of the
+# JSON statistics is the wall clock time of the solver, 'total_cpu' its CPU
+# time (all threads); both are excluded from the per-phase totals.
+#
+# Compare the results of two runs (e.g., of two builds):
+#
+#   bzlabench.py compare base.json new.json [--threshold 0.1]
+#
+# Exits with 1 if the new run solves fewer files or is slower than the base
+# run by more than the given relative threshold.
+
+import argparse
+import json
+import os
+import signal
+import subprocess
+import sys
+import tempfile
+import time
+
+SUFFIXES = ('.smt2', '.btor', '.btor2')
+
+def collect_files(directory):
+    files = []
+    for root, _, names in os.walk(directory):
+        for name in names:
+            if name.endswith(SUFFIXES):
+                files.append(os.path.join(root, name))
+    return sorted(files)
+
+def run_file(binary, path, timeout, options):
+    fd, stats_file = tempfile.mkstemp(suffix='.json')
+    os.close(fd)
+    cmd = [binary, '--stats-json', stats_file] + options + [path]
+    outfile = tempfile.TemporaryFile()
+    start = time.monotonic()
+    proc = subprocess.Popen(cmd,
+                            stdout=outfile,
+                            stderr=subprocess.DEVNULL,
+                            start_new_session=True)
+    timed_out = False
+    # Poll with wait4 to get the resource usage of this child only.
+    while True:
+        pid, status, rusage = os.wait4(proc.pid, os.WNOHANG)
+        if pid != 0:
+            break
+        if time.monotonic() - start > timeout:
+            timed_out = True
+            os.killpg(proc.pid, signal.SIGKILL)
+            pid, status, rusage = os.wait4(proc.pid, 0)
+            break
+        time.sleep(0.01)
+    wall = time.monotonic() - start
+    proc.returncode = status
+    outfile.seek(0)
+    out = outfile.read().decode(errors='replace').split()
+    outfile.close()
+
+    if timed_out:
+        result = 'timeout'
+    elif 'sat' in out:
+        result = 'sat'
+    elif 'unsat' in out:
+        result = 'unsat'
+    elif 'unknown' in out:
+        result = 'unknown'
+    else:
+        result = 'error'
+
+    stats = None
+    try:
+        with open(stats_file) as f:
+            stats = json.load(f)
+    except (OSError, ValueError):
+        pass
+    os.remove(stats_file)
+
+    return {
+        'result': result,
+        'wall_time': wall,
+        'cpu_time': rusage.ru_utime + rusage.ru_stime,
+        'max_rss_kb': rusage.ru_maxrss,
+        'stats': stats,
+    }
+
+def cmd_run(args):
+    files = collect_files(args.directory)
+    if not files:
+        print('no benchmark files found in {}'.format(args.directory),
+              file=sys.stderr)
+        return 2
+
+    results = {}
+    for i, path in enumerate(files):
+        name = os.path.relpath(path, args.directory)
+        r = run_file(args.binary, path, args.timeout, args.options)
+        results[name] = r
+        print('[{}/{}] {:<8} {:8.2f}s {:8.1f}MB  {}'.format(
+            i + 1, len(files), r['result'], r['wall_time'],
+            r['max_rss_kb'] / 1024, name), flush=True)
+        if r['stats'] and not r['stats'].get('time_statistics', True) \
+                and i == 0:
+            print('warning: binary built without time statistics, '
+                  'only coarse per-phase timings are available',
+                  file=sys.stderr)
+
+    with open(args.output, 'w') as f:
+        json.dump({
+            'binary': os.path.abspath(args.binary),
+            'options': args.options,
+            'timeout': args.timeout,
+            'results': results,
+        }, f, indent=2)
+    return 0
+
+def solved(r):
+    return r['result'] in ('sat', 'unsat')
+
+# Entries of the JSON time statistics that are not phases.
+TIME_TOTALS = ('total', 'total_cpu')
+
+def phase_totals(results, names):
+    totals = {}
+    for name in names:
+        stats = results[name]['stats']
+        if not stats:
+            continue
+        for phase, t in stats['time'].items():
+            if phase in TIME_TOTALS:
+                continue
+            totals[phase] = totals.get(phase, 0.0) + t
+    return totals
+
+def cmd_compare(args):
+    with open(args.base) as f:
+        base = json.load(f)['results']
+    with open(args.new) as f:
+        new = json.load(f)['results']
+
+    names = sorted(n for n in base if n in new)
+    regressions = 0
+
+    # Disagreeing results are always reported.
+    for name in names:
+        b, n = base[name]['result'], new[name]['result']
+        if solved(base[name]) and solved(new[name]) and b != n:
+            print('{}: result mismatch ({} vs. {})'.format(name, b, n))
+            regressions += 1
+
+    nbase = sum(1 for n in names if solved(base[n]))
+    nnew = sum(1 for n in names if solved(new[n]))
+    print('solved: {} (base) {} (new) of {}'.format(nbase, nnew, len(names)))
+    if nnew < nbase:
+        regressions += 1
+
+    # Time and memory are only compared on files solved by both runs.
+    common = [n for n in names if solved(base[n]) and solved(new[n])]
+    print('\n{:<40} {:>10} {:>10} {:>8}'.format(
+        'per file (solved by both)', 'base', 'new', 'ratio'))
+    print('-' * 71)
+    tbase = tnew = 0.0
+    for name in common:
+        tb = base[name]['wall_time']
+        tn = new[name]['wall_time']
+        tbase += tb
+        tnew += tn
+        ratio = tn / tb if tb else float('inf')
+        mark = ''
+        if ratio > 1.0 + args.threshold and tn - tb > args.min_time:
+            mark = '  REGRESSION'
+            regressions += 1
+        print('{:<40} {:>9.2f}s {:>9.2f}s {:>8.3f}{}'.format(
+            name[-40:], tb, tn, ratio, mark))
+    print('{:<40} {:>9.2f}s {:>9.2f}s {:>8.3f}'.format(
+        'total', tbase, tnew, tnew / tbase if tbase else 0.0))
+
+    pbase = phase_totals(base, common)
+    pnew = phase_totals(new, common)
+    if pbase and pnew:
+        print('\n{:<40} {:>10} {:>10} {:>8}'.format(
+            'phase (total over solved by both)', 'base', 'new', 'ratio'))
+        print('-' * 71)
+        for phase in pbase:
+            if phase not in pnew:
+                continue
+            tb, tn = pbase[phase], pnew[phase]
+            print('{:<40} {:>9.2f}s {:>9.2f}s {:>8}'.format(
+                phase, tb, tn, '{:.3f}'.format(tn / tb) if tb else '-'))
+
+    mbase = max((base[n]['max_rss_kb'] for n in common), default=0)
+    mnew = max((new[n]['max_rss_kb'] for n in common), default=0)
+    print('\npeak memory: {:.1f}MB (base) {:.1f}MB (new)'.format(
+        mbase / 1024, mnew / 1024))
+
+    if regressions:
+        print('\n{} regression(s)'.format(regressions))
+        return 1
+    return 0
+
+def main():
+    ap = argparse.ArgumentParser(description='End-to-end benchmark driver.')
+    sub = ap.add_subparsers(dest='command', required=True)
+
+    ap_run = sub.add_parser('run', help='run binary on benchmark directory')
+    ap_run.add_argument('binary', help='bitwuzla binary')
+    ap_run.add_argument('directory', help='directory with benchmark files')
+    ap_run.add_argument('-o', '--output', required=True,
+                        help='output file for results (JSON)')
+    ap_run.add_argument('-t', '--timeout', type=float, default=60,
+                        help='time limit per file in seconds (default: 60)')
+
+    ap_cmp = sub.add_parser('compare', help='compare results of two runs')
+    ap_cmp.add_argument('base', help='baseline results')
+    ap_cmp.add_argument('new', help='new results')
+    ap_cmp.add_argument('--threshold', type=float, default=0.1,
+                        help='relative slowdown per file reported as '
+                             'regression (default: 0.1)')
+    ap_cmp.add_argument('--min-time', type=float, default=0.1,
+                        help='ignore slowdowns below given seconds '
+                             '(default: 0.1)')
+
+    # Everything after '--' is passed to the binary.
+    argv = sys.argv[1:]
+    options = []
+    if '--' in argv:
+        i = argv.index('--')
+        argv, options = argv[:i], argv[i + 1:]
+    args = ap.parse_args(argv)
+    args.options = options
+    if args.command == 'run':
+        return cmd_run(args)
+    return cmd_compare(args)
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -42,4 +42,4 @@ fi
 ./configure ${EXTRA_FLAGS}
 make -j${NPROC}
 install_lib build/libcadical.a
-install_include src/ccadical.h
+install_include src/cadical.hpp
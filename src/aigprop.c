@@ -498,7 +498,7 @@ update_cone(BzlaAIGProp *aprop, BzlaAIG *aig, int32_t assignment)
 
   int32_t aleft, aright, ass, leftid, rightid;
   uint32_t i;
-  double start, delta, sleft, sright, s;
+  double start, delta, now, sleft, sright, s;
   BzlaIntHashTable *cache;
   BzlaHashTableData *d;
   BzlaAIGPtrStack stack, cone;
@@ -565,7 +565,10 @@ update_cone(BzlaAIGProp *aprop, BzlaAIG *aig, int32_t assignment)
   BZLA_RELEASE_STACK(stack);
   bzla_hashint_table_delete(cache);
 
-  aprop->time.update_cone_reset += bzla_util_time_stamp() - start;
+  /* consecutive phases share time stamps */
+  now = bzla_util_time_stamp();
+  aprop->time.update_cone_reset += now - start;
+  delta = now;
 
   /* update assignment and score of 'aig' --------------------------------- */
   /* update model */
@@ -594,8 +597,6 @@ update_cone(BzlaAIGProp *aprop, BzlaAIG *aig, int32_t assignment)
 
   /* update model of cone ------------------------------------------------- */
 
-  delta = bzla_util_time_stamp();
-
   for (i = 0; i < BZLA_COUNT_STACK(cone); i++)
   {
     cur = BZLA_PEEK_STACK(cone, i);
@@ -620,14 +621,14 @@ update_cone(BzlaAIGProp *aprop, BzlaAIG *aig, int32_t assignment)
     d->as_int = ass;
   }
 
-  aprop->time.update_cone_model_gen += bzla_util_time_stamp() - delta;
-  delta = bzla_util_time_stamp();
+  now = bzla_util_time_stamp();
+  aprop->time.update_cone_model_gen += now - delta;
+  delta = now;
 
   /* update score of cone ------------------------------------------------- */
 
   if (aprop->score)
   {
-    delta = bzla_util_time_stamp();
     for (i = 0; i < BZLA_COUNT_STACK(cone); i++)
     {
       cur = BZLA_PEEK_STACK(cone, i);
@@ -665,7 +666,8 @@ update_cone(BzlaAIGProp *aprop, BzlaAIG *aig, int32_t assignment)
       assert(s >= 0.0 && s <= 1.0);
       bzla_hashint_map_get(aprop->score, -cur->id)->as_dbl = s;
     }
-    aprop->time.update_cone_compute_score += bzla_util_time_stamp() - delta;
+    now = bzla_util_time_stamp();
+    aprop->time.update_cone_compute_score += now - delta;
   }
 
   BZLA_RELEASE_STACK(cone);
@@ -700,7 +702,7 @@ update_cone(BzlaAIGProp *aprop, BzlaAIG *aig, int32_t assignment)
   }
 #endif
 
-  aprop->time.update_cone += bzla_util_time_stamp() - start;
+  aprop->time.update_cone += now - start;
 }
 
 /*------------------------------------------------------------------------*/
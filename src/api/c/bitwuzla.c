@@ -16,6 +16,7 @@
 #include "bzlamodel.h"
 #include "bzlaparse.h"
 #include "bzlaprintmodel.h"
+#include "bzlastate.h"
 #include "bzlasubst.h"
 #include "dumper/bzladumpaig.h"
 #include "dumper/bzladumpbtor.h"
@@ -83,6 +84,7 @@ static BzlaOption bzla_options[BITWUZLA_OPT_NUM_OPTS] = {
     [BITWUZLA_OPT_AIGPROP_NPROPS]          = BZLA_OPT_AIGPROP_NPROPS,
     [BITWUZLA_OPT_AIGPROP_USE_BANDIT]      = BZLA_OPT_AIGPROP_USE_BANDIT,
     [BITWUZLA_OPT_AIGPROP_USE_RESTARTS]    = BZLA_OPT_AIGPROP_USE_RESTARTS,
+    [BITWUZLA_OPT_BMC_KMAX]                = BZLA_OPT_BMC_KMAX,
     [BITWUZLA_OPT_CHECK_MODEL]             = BZLA_OPT_CHECK_MODEL,
     [BITWUZLA_OPT_CHECK_UNCONSTRAINED]     = BZLA_OPT_CHECK_UNCONSTRAINED,
     [BITWUZLA_OPT_CHECK_UNSAT_ASSUMPTIONS] = BZLA_OPT_CHECK_UNSAT_ASSUMPTIONS,
@@ -97,15 +99,18 @@ static BzlaOption bzla_options[BITWUZLA_OPT_NUM_OPTS] = {
     [BITWUZLA_OPT_FUN_LAZY_SYNTHESIZE]     = BZLA_OPT_FUN_LAZY_SYNTHESIZE,
     [BITWUZLA_OPT_FUN_PREPROP]             = BZLA_OPT_FUN_PREPROP,
     [BITWUZLA_OPT_FUN_PRESLS]              = BZLA_OPT_FUN_PRESLS,
+    [BITWUZLA_OPT_FUN_SAT_PHASES]          = BZLA_OPT_FUN_SAT_PHASES,
     [BITWUZLA_OPT_FUN_STORE_LAMBDAS]       = BZLA_OPT_FUN_STORE_LAMBDAS,
     [BITWUZLA_OPT_INCREMENTAL]             = BZLA_OPT_INCREMENTAL,
     [BITWUZLA_OPT_INPUT_FORMAT]            = BZLA_OPT_INPUT_FORMAT,
     [BITWUZLA_OPT_LOGLEVEL]                = BZLA_OPT_LOGLEVEL,
+    [BITWUZLA_OPT_LS_SHARE_CONST_BITS]     = BZLA_OPT_LS_SHARE_CONST_BITS,
     [BITWUZLA_OPT_LS_SHARE_SAT]            = BZLA_OPT_LS_SHARE_SAT,
     [BITWUZLA_OPT_OUTPUT_FORMAT]           = BZLA_OPT_OUTPUT_FORMAT,
     [BITWUZLA_OPT_OUTPUT_NUMBER_FORMAT]    = BZLA_OPT_OUTPUT_NUMBER_FORMAT,
     [BITWUZLA_OPT_PARSE_INTERACTIVE]       = BZLA_OPT_PARSE_INTERACTIVE,
     [BITWUZLA_OPT_PP_ACKERMANN]            = BZLA_OPT_PP_ACKERMANN,
+    [BITWUZLA_OPT_PP_ACKERMANN_SPARSE]     = BZLA_OPT_PP_ACKERMANN_SPARSE,
     [BITWUZLA_OPT_PP_BETA_REDUCE]          = BZLA_OPT_PP_BETA_REDUCE,
     [BITWUZLA_OPT_PP_ELIMINATE_EXTRACTS]   = BZLA_OPT_PP_ELIMINATE_EXTRACTS,
     [BITWUZLA_OPT_PP_ELIMINATE_ITES]       = BZLA_OPT_PP_ELIMINATE_ITES,
@@ -116,15 +121,16 @@ static BzlaOption bzla_options[BITWUZLA_OPT_NUM_OPTS] = {
     [BITWUZLA_OPT_PP_SKELETON_PREPROC]     = BZLA_OPT_PP_SKELETON_PREPROC,
     [BITWUZLA_OPT_PP_UNCONSTRAINED_OPTIMIZATION] =
         BZLA_OPT_PP_UNCONSTRAINED_OPTIMIZATION,
-    [BITWUZLA_OPT_PP_VAR_SUBST]        = BZLA_OPT_PP_VAR_SUBST,
-    [BITWUZLA_OPT_PRETTY_PRINT]        = BZLA_OPT_PRETTY_PRINT,
-    [BITWUZLA_OPT_PRINT_DIMACS]        = BZLA_OPT_PRINT_DIMACS,
-    [BITWUZLA_OPT_PRODUCE_MODELS]      = BZLA_OPT_PRODUCE_MODELS,
-    [BITWUZLA_OPT_PRODUCE_UNSAT_CORES] = BZLA_OPT_PRODUCE_UNSAT_CORES,
-    [BITWUZLA_OPT_PROP_ASHR]           = BZLA_OPT_PROP_ASHR,
-    [BITWUZLA_OPT_PROP_CONST_BITS]     = BZLA_OPT_PROP_CONST_BITS,
-    [BITWUZLA_OPT_PROP_CONST_DOMAINS]  = BZLA_OPT_PROP_CONST_DOMAINS,
-    [BITWUZLA_OPT_PROP_ENTAILED]       = BZLA_OPT_PROP_ENTAILED,
+    [BITWUZLA_OPT_PP_VAR_SUBST]             = BZLA_OPT_PP_VAR_SUBST,
+    [BITWUZLA_OPT_PRETTY_PRINT]             = BZLA_OPT_PRETTY_PRINT,
+    [BITWUZLA_OPT_PRINT_DIMACS]             = BZLA_OPT_PRINT_DIMACS,
+    [BITWUZLA_OPT_PRODUCE_MODELS]           = BZLA_OPT_PRODUCE_MODELS,
+    [BITWUZLA_OPT_PRODUCE_UNSAT_CORES]      = BZLA_OPT_PRODUCE_UNSAT_CORES,
+    [BITWUZLA_OPT_PROP_ASHR]                = BZLA_OPT_PROP_ASHR,
+    [BITWUZLA_OPT_PROP_CONST_BITS]          = BZLA_OPT_PROP_CONST_BITS,
+    [BITWUZLA_OPT_PROP_CONST_DOMAINS]       = BZLA_OPT_PROP_CONST_DOMAINS,
+    [BITWUZLA_OPT_PROP_CONST_DOMAINS_LIMIT] = BZLA_OPT_PROP_CONST_DOMAINS_LIMIT,
+    [BITWUZLA_OPT_PROP_ENTAILED]            = BZLA_OPT_PROP_ENTAILED,
     [BITWUZLA_OPT_PROP_FLIP_COND_CONST_DELTA] =
         BZLA_OPT_PROP_FLIP_COND_CONST_DELTA,
     [BITWUZLA_OPT_PROP_FLIP_COND_CONST_NPATHSEL] =
@@ -153,9 +159,11 @@ static BzlaOption bzla_options[BITWUZLA_OPT_NUM_OPTS] = {
     [BITWUZLA_OPT_PROP_XOR]                = BZLA_OPT_PROP_XOR,
     [BITWUZLA_OPT_QUANT_SYNTH_SK]          = BZLA_OPT_QUANT_SYNTH_SK,
     [BITWUZLA_OPT_QUANT_SYNTH_QI]          = BZLA_OPT_QUANT_SYNTH_QI,
+    [BITWUZLA_OPT_QUANT_SYNTH_N_THREADS]   = BZLA_OPT_QUANT_SYNTH_N_THREADS,
     [BITWUZLA_OPT_QUANT_SKOLEM_UF]         = BZLA_OPT_QUANT_SKOLEM_UF,
     [BITWUZLA_OPT_QUANT_EAGER_SKOLEM]      = BZLA_OPT_QUANT_EAGER_SKOLEM,
     [BITWUZLA_OPT_QUANT_MBQI]              = BZLA_OPT_QUANT_MBQI,
+    [BITWUZLA_OPT_QUANT_CE_N_THREADS]      = BZLA_OPT_QUANT_CE_N_THREADS,
     [BITWUZLA_OPT_QUANT_MODE]              = BZLA_OPT_QUANT_MODE,
     [BITWUZLA_OPT_RW_EXTRACT_ARITH]        = BZLA_OPT_RW_EXTRACT_ARITH,
     [BITWUZLA_OPT_RW_LEVEL]                = BZLA_OPT_RW_LEVEL,
@@ -185,6 +193,7 @@ static BzlaOption bzla_options[BITWUZLA_OPT_NUM_OPTS] = {
     [BITWUZLA_OPT_SLS_MOVE_RANGE]          = BZLA_OPT_SLS_MOVE_RANGE,
     [BITWUZLA_OPT_SLS_MOVE_SEGMENT]        = BZLA_OPT_SLS_MOVE_SEGMENT,
     [BITWUZLA_OPT_SLS_NFLIPS]              = BZLA_OPT_SLS_NFLIPS,
+    [BITWUZLA_OPT_SLS_N_THREADS]           = BZLA_OPT_SLS_N_THREADS,
     [BITWUZLA_OPT_SLS_PROB_MOVE_RAND_WALK] = BZLA_OPT_SLS_PROB_MOVE_RAND_WALK,
     [BITWUZLA_OPT_SLS_STRATEGY]            = BZLA_OPT_SLS_STRATEGY,
     [BITWUZLA_OPT_SLS_USE_BANDIT]          = BZLA_OPT_SLS_USE_BANDIT,
@@ -197,6 +206,7 @@ static BitwuzlaOption bitwuzla_options[BZLA_OPT_NUM_OPTS] = {
     [BZLA_OPT_AIGPROP_NPROPS]          = BITWUZLA_OPT_AIGPROP_NPROPS,
     [BZLA_OPT_AIGPROP_USE_BANDIT]      = BITWUZLA_OPT_AIGPROP_USE_BANDIT,
     [BZLA_OPT_AIGPROP_USE_RESTARTS]    = BITWUZLA_OPT_AIGPROP_USE_RESTARTS,
+    [BZLA_OPT_BMC_KMAX]                = BITWUZLA_OPT_BMC_KMAX,
     [BZLA_OPT_CHECK_MODEL]             = BITWUZLA_OPT_CHECK_MODEL,
     [BZLA_OPT_CHECK_UNCONSTRAINED]     = BITWUZLA_OPT_CHECK_UNCONSTRAINED,
     [BZLA_OPT_CHECK_UNSAT_ASSUMPTIONS] = BITWUZLA_OPT_CHECK_UNSAT_ASSUMPTIONS,
@@ -211,15 +221,18 @@ static BitwuzlaOption bitwuzla_options[BZLA_OPT_NUM_OPTS] = {
     [BZLA_OPT_FUN_LAZY_SYNTHESIZE]     = BITWUZLA_OPT_FUN_LAZY_SYNTHESIZE,
     [BZLA_OPT_FUN_PREPROP]             = BITWUZLA_OPT_FUN_PREPROP,
     [BZLA_OPT_FUN_PRESLS]              = BITWUZLA_OPT_FUN_PRESLS,
+    [BZLA_OPT_FUN_SAT_PHASES]          = BITWUZLA_OPT_FUN_SAT_PHASES,
     [BZLA_OPT_FUN_STORE_LAMBDAS]       = BITWUZLA_OPT_FUN_STORE_LAMBDAS,
     [BZLA_OPT_INCREMENTAL]             = BITWUZLA_OPT_INCREMENTAL,
     [BZLA_OPT_INPUT_FORMAT]            = BITWUZLA_OPT_INPUT_FORMAT,
     [BZLA_OPT_LOGLEVEL]                = BITWUZLA_OPT_LOGLEVEL,
+    [BZLA_OPT_LS_SHARE_CONST_BITS]     = BITWUZLA_OPT_LS_SHARE_CONST_BITS,
     [BZLA_OPT_LS_SHARE_SAT]            = BITWUZLA_OPT_LS_SHARE_SAT,
     [BZLA_OPT_OUTPUT_FORMAT]           = BITWUZLA_OPT_OUTPUT_FORMAT,
     [BZLA_OPT_OUTPUT_NUMBER_FORMAT]    = BITWUZLA_OPT_OUTPUT_NUMBER_FORMAT,
     [BZLA_OPT_PARSE_INTERACTIVE]       = BITWUZLA_OPT_PARSE_INTERACTIVE,
     [BZLA_OPT_PP_ACKERMANN]            = BITWUZLA_OPT_PP_ACKERMANN,
+    [BZLA_OPT_PP_ACKERMANN_SPARSE]     = BITWUZLA_OPT_PP_ACKERMANN_SPARSE,
     [BZLA_OPT_PP_BETA_REDUCE]          = BITWUZLA_OPT_PP_BETA_REDUCE,
     [BZLA_OPT_PP_ELIMINATE_EXTRACTS]   = BITWUZLA_OPT_PP_ELIMINATE_EXTRACTS,
     [BZLA_OPT_PP_ELIMINATE_ITES]       = BITWUZLA_OPT_PP_ELIMINATE_ITES,
@@ -230,14 +243,15 @@ static BitwuzlaOption bitwuzla_options[BZLA_OPT_NUM_OPTS] = {
     [BZLA_OPT_PP_SKELETON_PREPROC]     = BITWUZLA_OPT_PP_SKELETON_PREPROC,
     [BZLA_OPT_PP_UNCONSTRAINED_OPTIMIZATION] =
         BITWUZLA_OPT_PP_UNCONSTRAINED_OPTIMIZATION,
-    [BZLA_OPT_PP_VAR_SUBST]        = BITWUZLA_OPT_PP_VAR_SUBST,
-    [BZLA_OPT_PRETTY_PRINT]        = BITWUZLA_OPT_PRETTY_PRINT,
-    [BZLA_OPT_PRINT_DIMACS]        = BITWUZLA_OPT_PRINT_DIMACS,
-    [BZLA_OPT_PRODUCE_MODELS]      = BITWUZLA_OPT_PRODUCE_MODELS,
-    [BZLA_OPT_PRODUCE_UNSAT_CORES] = BITWUZLA_OPT_PRODUCE_UNSAT_CORES,
-    [BZLA_OPT_PROP_CONST_BITS]     = BITWUZLA_OPT_PROP_CONST_BITS,
-    [BZLA_OPT_PROP_CONST_DOMAINS]  = BITWUZLA_OPT_PROP_CONST_DOMAINS,
-    [BZLA_OPT_PROP_ENTAILED]       = BITWUZLA_OPT_PROP_ENTAILED,
+    [BZLA_OPT_PP_VAR_SUBST]             = BITWUZLA_OPT_PP_VAR_SUBST,
+    [BZLA_OPT_PRETTY_PRINT]             = BITWUZLA_OPT_PRETTY_PRINT,
+    [BZLA_OPT_PRINT_DIMACS]             = BITWUZLA_OPT_PRINT_DIMACS,
+    [BZLA_OPT_PRODUCE_MODELS]           = BITWUZLA_OPT_PRODUCE_MODELS,
+    [BZLA_OPT_PRODUCE_UNSAT_CORES]      = BITWUZLA_OPT_PRODUCE_UNSAT_CORES,
+    [BZLA_OPT_PROP_CONST_BITS]          = BITWUZLA_OPT_PROP_CONST_BITS,
+    [BZLA_OPT_PROP_CONST_DOMAINS]       = BITWUZLA_OPT_PROP_CONST_DOMAINS,
+    [BZLA_OPT_PROP_CONST_DOMAINS_LIMIT] = BITWUZLA_OPT_PROP_CONST_DOMAINS_LIMIT,
+    [BZLA_OPT_PROP_ENTAILED]            = BITWUZLA_OPT_PROP_ENTAILED,
     [BZLA_OPT_PROP_FLIP_COND_CONST_DELTA] =
         BITWUZLA_OPT_PROP_FLIP_COND_CONST_DELTA,
     [BZLA_OPT_PROP_FLIP_COND_CONST_NPATHSEL] =
@@ -267,9 +281,11 @@ static BitwuzlaOption bitwuzla_options[BZLA_OPT_NUM_OPTS] = {
     [BZLA_OPT_PROP_XOR]                = BITWUZLA_OPT_PROP_XOR,
     [BZLA_OPT_QUANT_SYNTH_SK]          = BITWUZLA_OPT_QUANT_SYNTH_SK,
     [BZLA_OPT_QUANT_SYNTH_QI]          = BITWUZLA_OPT_QUANT_SYNTH_QI,
+    [BZLA_OPT_QUANT_SYNTH_N_THREADS]   = BITWUZLA_OPT_QUANT_SYNTH_N_THREADS,
     [BZLA_OPT_QUANT_SKOLEM_UF]         = BITWUZLA_OPT_QUANT_SKOLEM_UF,
     [BZLA_OPT_QUANT_EAGER_SKOLEM]      = BITWUZLA_OPT_QUANT_EAGER_SKOLEM,
     [BZLA_OPT_QUANT_MBQI]              = BITWUZLA_OPT_QUANT_MBQI,
+    [BZLA_OPT_QUANT_CE_N_THREADS]      = BITWUZLA_OPT_QUANT_CE_N_THREADS,
     [BZLA_OPT_QUANT_MODE]              = BITWUZLA_OPT_QUANT_MODE,
     [BZLA_OPT_RW_EXTRACT_ARITH]        = BITWUZLA_OPT_RW_EXTRACT_ARITH,
     [BZLA_OPT_RW_LEVEL]                = BITWUZLA_OPT_RW_LEVEL,
@@ -299,6 +315,7 @@ static BitwuzlaOption bitwuzla_options[BZLA_OPT_NUM_OPTS] = {
     [BZLA_OPT_SLS_MOVE_RANGE]          = BITWUZLA_OPT_SLS_MOVE_RANGE,
     [BZLA_OPT_SLS_MOVE_SEGMENT]        = BITWUZLA_OPT_SLS_MOVE_SEGMENT,
     [BZLA_OPT_SLS_NFLIPS]              = BITWUZLA_OPT_SLS_NFLIPS,
+    [BZLA_OPT_SLS_N_THREADS]           = BITWUZLA_OPT_SLS_N_THREADS,
     [BZLA_OPT_SLS_PROB_MOVE_RAND_WALK] = BITWUZLA_OPT_SLS_PROB_MOVE_RAND_WALK,
     [BZLA_OPT_SLS_STRATEGY]            = BITWUZLA_OPT_SLS_STRATEGY,
     [BZLA_OPT_SLS_USE_BANDIT]          = BITWUZLA_OPT_SLS_USE_BANDIT,
@@ -3384,6 +3401,28 @@ bitwuzla_dump_formula(Bitwuzla *bitwuzla, const char *format, FILE *file)
   }
 }
 
+void
+bitwuzla_save_state(Bitwuzla *bitwuzla, FILE *file)
+{
+  BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_ARG_NOT_NULL(file);
+
+  Bzla *bzla = BZLA_IMPORT_BITWUZLA(bitwuzla);
+  bzla_state_save(bzla, file);
+}
+
+void
+bitwuzla_load_state(Bitwuzla *bitwuzla, FILE *file)
+{
+  BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_ARG_NOT_NULL(file);
+
+  reset_assumptions(bitwuzla);
+
+  Bzla *bzla = BZLA_IMPORT_BITWUZLA(bitwuzla);
+  bzla_state_load(bzla, file);
+}
+
 BitwuzlaResult
 bitwuzla_parse(Bitwuzla *bitwuzla,
                FILE *infile,
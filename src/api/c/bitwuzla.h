@@ -53,6 +53,22 @@ enum BitwuzlaOption
 {
   /* --------------------------- General Options --------------------------- */
 
+  /*! **Maximum bound for bounded model checking.**
+   *
+   * BTOR2 input with sequential extensions (`state`, `init`, `next`, `bad`)
+   * is checked via incremental bounded model checking. The transition
+   * relation is unrolled up to this bound and the bad state properties are
+   * checked at each bound under assumptions. Prints `sat` and a BTOR2
+   * witness if a bad state is reachable, and `unsat` if no bad state is
+   * reachable within the bound.
+   *
+   * Values:
+   *  * An unsigned integer value (**default**: 20).
+   *
+   * @note Justice and fairness properties are not supported.
+   */
+  BITWUZLA_OPT_BMC_KMAX,
+
   /*! **Configure the solver engine.**
    *
    * Values:
@@ -64,7 +80,9 @@ enum BitwuzlaOption
    *    demand for QF_AUFBVFP, and eager bit-blasting (optionally with local
    *    searchin a sequential portfolio) for QF_BV.
    *  * **prop**:
-   *    The propagation-based local search QF_BV engine.
+   *    The propagation-based local search QF_BV engine. Also supports
+   *    QF_BVFP, except for formulas with `fp.min`, `fp.max`, `fp.to_sbv`,
+   *    `fp.to_ubv` or `fp.fma` (falls back to engine **fun**).
    *  * **sls**:
    *     The stochastic local search QF_BV engine.
    *  * **quant**:
@@ -256,6 +274,23 @@ enum BitwuzlaOption
    */
   BITWUZLA_OPT_PP_ACKERMANN,
 
+  /*! **Sparse Ackermannization preprocessing.**
+   *
+   * Only add Ackermann constraints for pairs of function applications whose
+   * arguments are not known to be distinct. Arguments are distinct if they
+   * are different constants, or if they have conflicting bits that are fixed
+   * by constants (via concatenation, extraction, and bit-wise and and
+   * if-then-else). Applications with only constant arguments are not paired.
+   * Only has an effect with BITWUZLA_OPT_PP_ACKERMANN enabled.
+   *
+   * Values:
+   *  * **1**: enable
+   *  * **0**: disable [**default**]
+   *
+   *  @warning This is an expert option to configure preprocessing.
+   */
+  BITWUZLA_OPT_PP_ACKERMANN_SPARSE,
+
   /*! **Beta reduction preprocessing.**
    *
    * Eager elimination of lambda terms via beta reduction.
@@ -582,6 +617,21 @@ enum BitwuzlaOption
    */
   BITWUZLA_OPT_FUN_PRESLS,
 
+  /*! **Function solver engine:
+   *    Warm-start SAT solver phases.**
+   *
+   * Before each SAT call, set the phases of the SAT solver to the current
+   * model values of bit-blasted inputs (e.g., the model determined by the
+   * local search preprocessing or by the previous SAT call).
+   *
+   * Values:
+   *  * **1**: enable [**default**]
+   *  * **0**: disable
+   *
+   *  @warning This is an expert option to configure the func solver engine.
+   */
+  BITWUZLA_OPT_FUN_SAT_PHASES,
+
   /*! **Function solver engine:
    *    Represent store as lambda.**
    *
@@ -813,6 +863,22 @@ enum BitwuzlaOption
    */
   BITWUZLA_OPT_SLS_NFLIPS,
 
+  /*! **Stochastic local search solver engine:
+   *    Number of threads.**
+   *
+   * Configure the number of threads used to score candidate moves of the SLS
+   * engine. Moves are scored in parallel against the current model and the
+   * best move is selected as in the sequential case, hence the result does
+   * not depend on the number of threads. Has no effect with
+   * BITWUZLA_OPT_SLS_MOVE_INC_MOVE_TEST enabled.
+   *
+   * Values:
+   *  * An unsigned integer value > 0 (**default**: 1).
+   *
+   *  @warning This is an expert option to configure the sls solver engine.
+   */
+  BITWUZLA_OPT_SLS_N_THREADS,
+
   /*! **Stochastic local search solver engine:
    *    Move strategy.**
    *
@@ -903,6 +969,22 @@ enum BitwuzlaOption
    */
   BITWUZLA_OPT_PROP_CONST_DOMAINS,
 
+  /*! **Propagation-based local search solver engine:
+   *    Domain propagation limit.**
+   *
+   * Configure the number of domain propagator applications used as a limit
+   * for determining constant bits via domain propagators. No limit if 0.
+   *
+   * Values:
+   *  * An unsigned integer value (**default**: 0).
+   *
+   * @see
+   *   * BITWUZLA_OPT_PROP_CONST_DOMAINS
+   *
+   *  @warning This is an expert option to configure the prop solver engine.
+   */
+  BITWUZLA_OPT_PROP_CONST_DOMAINS_LIMIT,
+
   /*! **Propagation-based local search solver engine:
    *    Entailed propagations.**
    *
@@ -1308,6 +1390,20 @@ enum BitwuzlaOption
    */
   BITWUZLA_OPT_QUANT_SYNTH_QI,
 
+  /*! **Quantifier solver engine:
+   *    Number of synthesis threads.**
+   *
+   * Configure the number of threads used to enumerate candidate terms in
+   * Skolem function and quantifier instantiation synthesis.
+   *
+   * Values:
+   *  * An unsigned integer value > 0 (**default**: 1).
+   *
+   *  @warning This is an expert option to configure the quantifier solver
+   *  engine.
+   */
+  BITWUZLA_OPT_QUANT_SYNTH_N_THREADS,
+
   /*! **Quantifier solver engine:
    *    Skolemization.**
    *
@@ -1348,6 +1444,24 @@ enum BitwuzlaOption
    */
   BITWUZLA_OPT_QUANT_MBQI,
 
+  /*! **Quantifier solver engine:
+   *    Number of counterexample check threads.**
+   *
+   * Configure the number of threads used to check active quantifiers for
+   * counterexamples. With more than one thread, the checks of a round are
+   * performed concurrently on clones of the ground solver and the resulting
+   * instantiation lemmas are added after all checks are done. The clones are
+   * kept across rounds and solve incrementally.
+   * Has no effect on formulas with floating-point terms.
+   *
+   * Values:
+   *  * An unsigned integer value > 0 (**default**: 1).
+   *
+   *  @warning This is an expert option to configure the quantifier solver
+   *  engine.
+   */
+  BITWUZLA_OPT_QUANT_CE_N_THREADS,
+
   BITWUZLA_OPT_QUANT_MODE,
 
   /* ------------------------ Other Expert Options ------------------------- */
@@ -1394,6 +1508,28 @@ enum BitwuzlaOption
    */
   BITWUZLA_OPT_DECLSORT_BV_WIDTH,
 
+  /*! **Share constant bits determined via domain propagation with
+   *    bit-blasting engine.**
+   *
+   * Constant bits determined by the propagation-based local search engine
+   * are asserted as unit clauses to the SAT solver of the bit-blasting
+   * engine. Constant bits are only shared if no assumptions are present.
+   * This option is only effective when the propagation-based local search
+   * engine is combined with the bit-blasting engine in a sequential
+   * portfolio.
+   *
+   * Values:
+   *  * **1**: enable
+   *  * **0**: disable [**default**]
+   *
+   * @see
+   *   * BITWUZLA_OPT_PROP_CONST_BITS
+   *   * BITWUZLA_OPT_PROP_CONST_DOMAINS
+   *
+   *  @warning This is an expert option.
+   */
+  BITWUZLA_OPT_LS_SHARE_CONST_BITS,
+
   /*! **Share partial models determined via local search with bit-blasting
    *    engine.**
    *
@@ -3215,6 +3351,37 @@ void bitwuzla_print_model(Bitwuzla *bitwuzla, const char *format, FILE *file);
  */
 void bitwuzla_dump_formula(Bitwuzla *bitwuzla, const char *format, FILE *file);
 
+/**
+ * Save the current state of a Bitwuzla instance to a binary file.
+ *
+ * The state comprises the options that differ from their default value, all
+ * terms and sorts of the current input formula, its inputs, assertions and
+ * pushed context levels. It does not include the state of the SAT solver,
+ * models or caches. Floating-point terms are not supported.
+ *
+ * @param bitwuzla The Bitwuzla instance.
+ * @param file The binary file to save the state to.
+ *
+ * @see
+ *   * `bitwuzla_load_state`
+ */
+void bitwuzla_save_state(Bitwuzla *bitwuzla, FILE *file);
+
+/**
+ * Load a state saved via `bitwuzla_save_state()`.
+ *
+ * Requires that no constants have been created and no context levels have
+ * been pushed. Terms of the saved instance are restored, but no term handles
+ * are returned for them.
+ *
+ * @param bitwuzla The Bitwuzla instance.
+ * @param file The binary file to load the state from.
+ *
+ * @see
+ *   * `bitwuzla_save_state`
+ */
+void bitwuzla_load_state(Bitwuzla *bitwuzla, FILE *file);
+
 /**
  * Parse input file.
  *
@@ -60,6 +60,10 @@
 
 // #define BZLA_AIG_TO_CNF_NARY_AND
 
+/* Number of literals buffered during Tseitin encoding before the clauses are
+ * handed over to the SAT solver in one call. */
+#define BZLA_AIG_TO_CNF_BUFFER_SIZE (1u << 16)
+
 /*------------------------------------------------------------------------*/
 
 static void
@@ -1098,6 +1102,7 @@ void
 bzla_aig_to_sat_tseitin(BzlaAIGMgr *amgr, BzlaAIG *start)
 {
   BzlaAIGPtrStack stack, tree, leafs, marked;
+  BzlaIntStack clauses;
   int32_t x, y, a, b, c;
   bool isxor, isite;
   BzlaAIG *root, *cur;
@@ -1117,6 +1122,7 @@ bzla_aig_to_sat_tseitin(BzlaAIGMgr *amgr, BzlaAIG *start)
   BZLA_INIT_STACK(mm, tree);
   BZLA_INIT_STACK(mm, leafs);
   BZLA_INIT_STACK(mm, marked);
+  BZLA_INIT_STACK(mm, clauses);
 
   start = BZLA_REAL_ADDR_AIG(start);
   BZLA_PUSH_STACK(stack, start);
@@ -1203,25 +1209,25 @@ bzla_aig_to_sat_tseitin(BzlaAIGMgr *amgr, BzlaAIG *start)
         a = bzla_aig_get_cnf_id(leafs.start[0]);
         b = bzla_aig_get_cnf_id(leafs.start[1]);
 
-        bzla_sat_add(smgr, -x);
-        bzla_sat_add(smgr, a);
-        bzla_sat_add(smgr, -b);
-        bzla_sat_add(smgr, 0);
-
-        bzla_sat_add(smgr, -x);
-        bzla_sat_add(smgr, -a);
-        bzla_sat_add(smgr, b);
-        bzla_sat_add(smgr, 0);
-
-        bzla_sat_add(smgr, x);
-        bzla_sat_add(smgr, -a);
-        bzla_sat_add(smgr, -b);
-        bzla_sat_add(smgr, 0);
-
-        bzla_sat_add(smgr, x);
-        bzla_sat_add(smgr, a);
-        bzla_sat_add(smgr, b);
-        bzla_sat_add(smgr, 0);
+        BZLA_PUSH_STACK(clauses, -x);
+        BZLA_PUSH_STACK(clauses, a);
+        BZLA_PUSH_STACK(clauses, -b);
+        BZLA_PUSH_STACK(clauses, 0);
+
+        BZLA_PUSH_STACK(clauses, -x);
+        BZLA_PUSH_STACK(clauses, -a);
+        BZLA_PUSH_STACK(clauses, b);
+        BZLA_PUSH_STACK(clauses, 0);
+
+        BZLA_PUSH_STACK(clauses, x);
+        BZLA_PUSH_STACK(clauses, -a);
+        BZLA_PUSH_STACK(clauses, -b);
+        BZLA_PUSH_STACK(clauses, 0);
+
+        BZLA_PUSH_STACK(clauses, x);
+        BZLA_PUSH_STACK(clauses, a);
+        BZLA_PUSH_STACK(clauses, b);
+        BZLA_PUSH_STACK(clauses, 0);
         amgr->num_cnf_clauses += 4;
         amgr->num_cnf_literals += 12;
       }
@@ -1232,25 +1238,25 @@ bzla_aig_to_sat_tseitin(BzlaAIGMgr *amgr, BzlaAIG *start)
         b = bzla_aig_get_cnf_id(leafs.start[1]);  // then
         c = bzla_aig_get_cnf_id(leafs.start[2]);  // cond
 
-        bzla_sat_add(smgr, -x);
-        bzla_sat_add(smgr, -c);
-        bzla_sat_add(smgr, b);
-        bzla_sat_add(smgr, 0);
-
-        bzla_sat_add(smgr, -x);
-        bzla_sat_add(smgr, c);
-        bzla_sat_add(smgr, a);
-        bzla_sat_add(smgr, 0);
-
-        bzla_sat_add(smgr, x);
-        bzla_sat_add(smgr, -c);
-        bzla_sat_add(smgr, -b);
-        bzla_sat_add(smgr, 0);
-
-        bzla_sat_add(smgr, x);
-        bzla_sat_add(smgr, c);
-        bzla_sat_add(smgr, -a);
-        bzla_sat_add(smgr, 0);
+        BZLA_PUSH_STACK(clauses, -x);
+        BZLA_PUSH_STACK(clauses, -c);
+        BZLA_PUSH_STACK(clauses, b);
+        BZLA_PUSH_STACK(clauses, 0);
+
+        BZLA_PUSH_STACK(clauses, -x);
+        BZLA_PUSH_STACK(clauses, c);
+        BZLA_PUSH_STACK(clauses, a);
+        BZLA_PUSH_STACK(clauses, 0);
+
+        BZLA_PUSH_STACK(clauses, x);
+        BZLA_PUSH_STACK(clauses, -c);
+        BZLA_PUSH_STACK(clauses, -b);
+        BZLA_PUSH_STACK(clauses, 0);
+
+        BZLA_PUSH_STACK(clauses, x);
+        BZLA_PUSH_STACK(clauses, c);
+        BZLA_PUSH_STACK(clauses, -a);
+        BZLA_PUSH_STACK(clauses, 0);
         amgr->num_cnf_clauses += 4;
         amgr->num_cnf_literals += 12;
       }
@@ -1261,11 +1267,11 @@ bzla_aig_to_sat_tseitin(BzlaAIGMgr *amgr, BzlaAIG *start)
           cur = *p;
           y   = bzla_aig_get_cnf_id(cur);
           assert(y);
-          bzla_sat_add(smgr, -y);
+          BZLA_PUSH_STACK(clauses, -y);
           amgr->num_cnf_literals++;
         }
-        bzla_sat_add(smgr, x);
-        bzla_sat_add(smgr, 0);
+        BZLA_PUSH_STACK(clauses, x);
+        BZLA_PUSH_STACK(clauses, 0);
         amgr->num_cnf_clauses++;
         amgr->num_cnf_literals++;
 
@@ -1273,16 +1279,25 @@ bzla_aig_to_sat_tseitin(BzlaAIGMgr *amgr, BzlaAIG *start)
         {
           cur = *p;
           y   = bzla_aig_get_cnf_id(cur);
-          bzla_sat_add(smgr, -x);
-          bzla_sat_add(smgr, y);
-          bzla_sat_add(smgr, 0);
+          BZLA_PUSH_STACK(clauses, -x);
+          BZLA_PUSH_STACK(clauses, y);
+          BZLA_PUSH_STACK(clauses, 0);
           amgr->num_cnf_clauses++;
           amgr->num_cnf_literals += 2;
         }
       }
     }
     BZLA_RESET_STACK(leafs);
+
+    if (BZLA_COUNT_STACK(clauses) >= BZLA_AIG_TO_CNF_BUFFER_SIZE)
+    {
+      bzla_sat_add_clauses(smgr, clauses.start, BZLA_COUNT_STACK(clauses));
+      BZLA_RESET_STACK(clauses);
+    }
   }
+  /* Clauses must be added before CNF ids of local AIGs are released below. */
+  bzla_sat_add_clauses(smgr, clauses.start, BZLA_COUNT_STACK(clauses));
+  BZLA_RELEASE_STACK(clauses);
   BZLA_RELEASE_STACK(stack);
   BZLA_RELEASE_STACK(leafs);
   BZLA_RELEASE_STACK(tree);
@@ -24,7 +24,7 @@
 
 static void
 cache_beta_result(Bzla *bzla,
-                  BzlaPtrHashTable *cache,
+                  BzlaBetaCache *cache,
                   BzlaNode *lambda,
                   BzlaNode *exp,
                   BzlaNode *result)
@@ -39,20 +39,12 @@ cache_beta_result(Bzla *bzla,
   assert(!bzla_node_is_proxy(result));
   assert(bzla_node_is_regular(lambda));
   assert(bzla_node_is_lambda(lambda));
+  assert(bzla_node_is_regular(exp));
 
-  BzlaNodePair *pair;
-  BzlaPtrHashBucket *bucket;
-
-  pair   = bzla_node_pair_new(bzla, lambda, exp);
-  bucket = bzla_hashptr_table_get(cache, pair);
-  if (bucket)
-  {
-    bzla_node_pair_delete(bzla, pair);
-    assert((BzlaNode *) bucket->data.as_ptr == result);
-  }
-  else
-    bzla_hashptr_table_add(cache, pair)->data.as_ptr =
-        bzla_node_copy(bzla, result);
+  bzla_beta_cache_add(cache,
+                      bzla_node_get_id(lambda),
+                      bzla_node_get_id(exp),
+                      bzla_node_get_id(result));
   BZLALOG(3,
           "%s: (%s, %s) -> %s",
           __FUNCTION__,
@@ -63,7 +55,7 @@ cache_beta_result(Bzla *bzla,
 
 static BzlaNode *
 cached_beta_result(Bzla *bzla,
-                   BzlaPtrHashTable *cache,
+                   BzlaBetaCache *cache,
                    BzlaNode *lambda,
                    BzlaNode *exp)
 {
@@ -72,26 +64,24 @@ cached_beta_result(Bzla *bzla,
   assert(exp);
   assert(bzla_node_is_regular(lambda));
   assert(bzla_node_is_lambda(lambda));
+  assert(bzla_node_is_regular(exp));
 
-  BzlaNodePair *pair;
-  BzlaPtrHashBucket *bucket;
+  int32_t id;
+  BzlaNode *result;
 
-  pair   = bzla_node_pair_new(bzla, lambda, exp);
-  bucket = bzla_hashptr_table_get(cache, pair);
-  bzla_node_pair_delete(bzla, pair);
+  id = bzla_beta_cache_get(
+      cache, bzla_node_get_id(lambda), bzla_node_get_id(exp));
+  if (!id) return 0;
 
-  if (bucket)
-  {
-    BZLALOG(3,
-            "%s: (%s, %s) -> %s",
-            __FUNCTION__,
-            bzla_util_node2string(lambda),
-            bzla_util_node2string(exp),
-            bzla_util_node2string(bucket->data.as_ptr));
-    return (BzlaNode *) bucket->data.as_ptr;
-  }
-
-  return 0;
+  result = bzla_node_get_by_id(bzla, id);
+  assert(result);
+  BZLALOG(3,
+          "%s: (%s, %s) -> %s",
+          __FUNCTION__,
+          bzla_util_node2string(lambda),
+          bzla_util_node2string(exp),
+          bzla_util_node2string(result));
+  return result;
 }
 
 void
@@ -236,7 +226,7 @@ beta_reduce(Bzla *bzla,
             int32_t mode,
             int32_t bound,
             BzlaPtrHashTable *merge_lambdas,
-            BzlaPtrHashTable *cache)
+            BzlaBetaCache *cache)
 {
   assert(bzla);
   assert(exp);
@@ -355,12 +345,11 @@ beta_reduce(Bzla *bzla,
         assert(bzla_node_is_regular(args));
         assert(bzla_node_is_args(args));
 
-        if (cache)
+        if (cache && !real_cur->parameterized)
         {
           cached = cached_beta_result(bzla, cache, real_cur, args);
           if (cached)
           {
-            assert(!real_cur->parameterized);
             if (bzla_node_is_inverted(cur)) cached = bzla_node_invert(cached);
             BZLA_PUSH_STACK(arg_stack, bzla_node_copy(bzla, cached));
             cur_lambda_depth--;
@@ -455,8 +444,11 @@ beta_reduce(Bzla *bzla,
               result = bzla_node_copy(bzla, e[1]);
             }
 
+            /* The cache is persistent, only cache results that do not
+             * depend on the assignment of parameters of enclosing lambdas. */
             if (cache && mode == BETA_RED_FULL
-                && bzla_node_is_lambda(real_cur->e[0]))
+                && bzla_node_is_lambda(real_cur->e[0])
+                && !real_cur->e[0]->parameterized)
               cache_beta_result(bzla, cache, real_cur->e[0], e[0], result);
             break;
           case BZLA_LAMBDA_NODE:
@@ -832,10 +824,10 @@ beta_reduce_partial_aux(Bzla *bzla,
 }
 
 BzlaNode *
-bzla_beta_reduce_full(Bzla *bzla, BzlaNode *exp, BzlaPtrHashTable *cache)
+bzla_beta_reduce_full(Bzla *bzla, BzlaNode *exp)
 {
   BZLALOG(2, "%s: %s", __FUNCTION__, bzla_util_node2string(exp));
-  return beta_reduce(bzla, exp, BETA_RED_FULL, 0, 0, cache);
+  return beta_reduce(bzla, exp, BETA_RED_FULL, 0, 0, bzla->beta_cache);
 }
 
 BzlaNode *
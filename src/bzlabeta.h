@@ -16,9 +16,9 @@
 #include "utils/bzlahashint.h"
 #include "utils/bzlahashptr.h"
 
-BzlaNode* bzla_beta_reduce_full(Bzla* bzla,
-                                BzlaNode* exp,
-                                BzlaPtrHashTable* cache);
+/* Fully beta-reduce 'exp'. Results of reducing applications of lambdas are
+ * cached in the (persistent) beta reduction cache of 'bzla'. */
+BzlaNode* bzla_beta_reduce_full(Bzla* bzla, BzlaNode* exp);
 
 BzlaNode* bzla_beta_reduce_merge(Bzla* bzla,
                                  BzlaNode* exp,
@@ -0,0 +1,175 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * This file is part of Bitwuzla.
+ *
+ * Copyright (C) 2007-2022 by the authors listed in the AUTHORS file.
+ *
+ * See COPYING for more information on using this software.
+ */
+
+#include "bzlabetacache.h"
+
+#include "bzlacore.h"
+
+#define BZLA_BETA_CACHE_MIN_SIZE 256
+
+static inline uint32_t
+hash_beta_cache_entry(int32_t lambda_id, int32_t args_id)
+{
+  uint32_t hash;
+  hash = 333444569u * (uint32_t) lambda_id;
+  hash += 76891121u * (uint32_t) args_id;
+  return hash ^ (hash >> 16);
+}
+
+static bool
+is_valid_node(Bzla *bzla, int32_t id)
+{
+  BzlaNode *n = bzla_node_get_by_id(bzla, id);
+  return n && !bzla_node_is_proxy(n);
+}
+
+/* An entry is invalid if any of its nodes was deallocated, or if the result
+ * was substituted in the meantime. */
+static bool
+is_valid_entry(Bzla *bzla, const BzlaBetaCacheEntry *e)
+{
+  BzlaNode *result;
+  if (!is_valid_node(bzla, e->lambda) || !is_valid_node(bzla, e->args))
+  {
+    return false;
+  }
+  result = bzla_node_get_by_id(bzla, e->result);
+  return result && !bzla_node_real_addr(result)->simplified;
+}
+
+static BzlaBetaCacheEntry *
+find_entry(BzlaBetaCache *cache, int32_t lambda_id, int32_t args_id)
+{
+  assert(cache->size);
+
+  uint32_t mask, pos;
+  BzlaBetaCacheEntry *e;
+
+  mask = cache->size - 1;
+  pos  = hash_beta_cache_entry(lambda_id, args_id) & mask;
+  for (;;)
+  {
+    e = &cache->entries[pos];
+    if (!e->lambda || (e->lambda == lambda_id && e->args == args_id)) break;
+    pos = (pos + 1) & mask;
+  }
+  return e;
+}
+
+/* Rebuild the table and drop invalid entries. The new size is chosen such
+ * that the load factor is at most 1/4 afterwards. */
+static void
+rebuild(BzlaBetaCache *cache)
+{
+  uint32_t i, old_size, count, size;
+  BzlaBetaCacheEntry *old_entries, *e;
+
+  old_entries = cache->entries;
+  old_size    = cache->size;
+
+  count = 0;
+  for (i = 0; i < old_size; i++)
+  {
+    e = &old_entries[i];
+    if (!e->lambda) continue;
+    if (is_valid_entry(cache->bzla, e))
+      count++;
+    else
+      e->lambda = 0;
+  }
+  cache->num_remove += cache->count - count;
+
+  size = old_size ? old_size : BZLA_BETA_CACHE_MIN_SIZE;
+  while (4 * (count + 1) > size) size *= 2;
+
+  BZLA_CNEWN(cache->bzla->mm, cache->entries, size);
+  cache->size  = size;
+  cache->count = count;
+  for (i = 0; i < old_size; i++)
+  {
+    e = &old_entries[i];
+    if (!e->lambda) continue;
+    *find_entry(cache, e->lambda, e->args) = *e;
+  }
+  BZLA_DELETEN(cache->bzla->mm, old_entries, old_size);
+}
+
+int32_t
+bzla_beta_cache_get(BzlaBetaCache *cache, int32_t lambda_id, int32_t args_id)
+{
+  assert(cache);
+  assert(lambda_id > 0);
+  assert(args_id > 0);
+
+  BzlaBetaCacheEntry *e;
+
+  if (!cache->count) return 0;
+
+  e = find_entry(cache, lambda_id, args_id);
+  if (!e->lambda || !is_valid_entry(cache->bzla, e)) return 0;
+  cache->num_get++;
+  return e->result;
+}
+
+void
+bzla_beta_cache_add(BzlaBetaCache *cache,
+                    int32_t lambda_id,
+                    int32_t args_id,
+                    int32_t result_id)
+{
+  assert(cache);
+  assert(lambda_id > 0);
+  assert(args_id > 0);
+  assert(result_id);
+
+  BzlaBetaCacheEntry *e;
+
+  if (2 * (cache->count + 1) > cache->size) rebuild(cache);
+
+  e = find_entry(cache, lambda_id, args_id);
+  if (e->lambda)
+  {
+    /* Only invalid entries are updated. */
+    assert(e->result == result_id || !is_valid_entry(cache->bzla, e));
+    e->result = result_id;
+    return;
+  }
+  e->lambda = lambda_id;
+  e->args   = args_id;
+  e->result = result_id;
+  cache->count++;
+  cache->num_add++;
+}
+
+void
+bzla_beta_cache_init(BzlaBetaCache *cache, Bzla *bzla)
+{
+  assert(cache);
+  cache->bzla       = bzla;
+  cache->entries    = 0;
+  cache->size       = 0;
+  cache->count      = 0;
+  cache->num_add    = 0;
+  cache->num_get    = 0;
+  cache->num_remove = 0;
+}
+
+void
+bzla_beta_cache_delete(BzlaBetaCache *cache)
+{
+  assert(cache);
+  if (cache->entries)
+  {
+    BZLA_DELETEN(cache->bzla->mm, cache->entries, cache->size);
+  }
+  cache->entries = 0;
+  cache->size    = 0;
+  cache->count   = 0;
+}
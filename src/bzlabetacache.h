@@ -0,0 +1,63 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * This file is part of Bitwuzla.
+ *
+ * Copyright (C) 2007-2022 by the authors listed in the AUTHORS file.
+ *
+ * See COPYING for more information on using this software.
+ */
+
+#ifndef BZLABETACACHE_H_INCLUDED
+#define BZLABETACACHE_H_INCLUDED
+
+#include "bzlanode.h"
+
+/* Cache entry that stores the result of fully beta-reducing an application of
+ * lambda 'lambda' to arguments 'args'. All entries are node ids, 'result' is
+ * negative if the result is inverted. An entry with 'lambda' 0 is empty. */
+struct BzlaBetaCacheEntry
+{
+  int32_t lambda;
+  int32_t args;
+  int32_t result;
+};
+
+typedef struct BzlaBetaCacheEntry BzlaBetaCacheEntry;
+
+/* Open addressing hash table of beta reduction results, owned by the Bzla
+ * instance and kept across beta reduction calls. No references to nodes are
+ * held, entries with deallocated or substituted nodes are invalid and dropped
+ * on lookup and when the table is resized. */
+struct BzlaBetaCache
+{
+  Bzla *bzla;
+  BzlaBetaCacheEntry *entries;
+  uint32_t size;       /* Number of entries, 0 or a power of 2. */
+  uint32_t count;      /* Number of used entries. */
+  uint64_t num_add;    /* Number of cached beta reduction results. */
+  uint64_t num_get;    /* Number of cache hits. */
+  uint64_t num_remove; /* Number of removed invalid cache entries. */
+};
+
+typedef struct BzlaBetaCache BzlaBetaCache;
+
+/* Add a new entry to the beta reduction cache. */
+void bzla_beta_cache_add(BzlaBetaCache *cache,
+                         int32_t lambda_id,
+                         int32_t args_id,
+                         int32_t result_id);
+
+/* Get the id of the cached result of beta-reducing lambda 'lambda_id' with
+ * arguments 'args_id', 0 if there is no valid cache entry. */
+int32_t bzla_beta_cache_get(BzlaBetaCache *cache,
+                            int32_t lambda_id,
+                            int32_t args_id);
+
+/* Initialize the beta reduction cache. */
+void bzla_beta_cache_init(BzlaBetaCache *cache, Bzla *bzla);
+
+/* Delete the beta reduction cache. */
+void bzla_beta_cache_delete(BzlaBetaCache *cache);
+
+#endif
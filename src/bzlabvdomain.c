@@ -108,6 +108,31 @@ bzla_bvdomain_new_fixed_uint64(BzlaMemMgr *mm, uint64_t val, uint32_t width)
   return res;
 }
 
+BzlaBvDomain *
+bzla_bvdomain_new_from_word(BzlaMemMgr *mm,
+                            const BzlaBvDomainWord *d,
+                            uint32_t width)
+{
+  assert(mm);
+  assert(d);
+  assert(width);
+  assert(width <= BZLA_BVDOMAIN_WORD_MAX_WIDTH);
+  BzlaBvDomain *res = new_domain(mm);
+  res->lo           = bzla_bv_uint64_to_bv(mm, d->lo, width);
+  res->hi           = bzla_bv_uint64_to_bv(mm, d->hi, width);
+  return res;
+}
+
+void
+bzla_bvdomain_to_word(const BzlaBvDomain *d, BzlaBvDomainWord *res)
+{
+  assert(d);
+  assert(res);
+  assert(bzla_bvdomain_get_width(d) <= BZLA_BVDOMAIN_WORD_MAX_WIDTH);
+  res->lo = bzla_bv_to_uint64(d->lo);
+  res->hi = bzla_bv_to_uint64(d->hi);
+}
+
 void
 bzla_bvdomain_free(BzlaMemMgr *mm, BzlaBvDomain *d)
 {
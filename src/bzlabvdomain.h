@@ -21,6 +21,22 @@ struct BzlaBvDomain
 
 typedef struct BzlaBvDomain BzlaBvDomain;
 
+/** Maximum width of word-level bit-vector domains. */
+#define BZLA_BVDOMAIN_WORD_MAX_WIDTH 64
+
+/**
+ * Word-level bit-vector domain of width <= BZLA_BVDOMAIN_WORD_MAX_WIDTH, with
+ * the same semantics as BzlaBvDomain. The width is not stored, bits beyond the
+ * width of the domain are always 0.
+ */
+struct BzlaBvDomainWord
+{
+  uint64_t lo;
+  uint64_t hi;
+};
+
+typedef struct BzlaBvDomainWord BzlaBvDomainWord;
+
 /** Create new bit-vector domain of width 'width' with low 0 and high ~0. */
 BzlaBvDomain *bzla_bvdomain_new_init(BzlaMemMgr *mm, uint32_t width);
 
@@ -50,6 +66,19 @@ BzlaBvDomain *bzla_bvdomain_new_fixed_uint64(BzlaMemMgr *mm,
                                              uint64_t val,
                                              uint32_t width);
 
+/**
+ * Create new bit-vector domain of width 'width' from word-level domain 'd'.
+ */
+BzlaBvDomain *bzla_bvdomain_new_from_word(BzlaMemMgr *mm,
+                                          const BzlaBvDomainWord *d,
+                                          uint32_t width);
+
+/**
+ * Convert bit-vector domain 'd' of width <= BZLA_BVDOMAIN_WORD_MAX_WIDTH to
+ * its word-level representation.
+ */
+void bzla_bvdomain_to_word(const BzlaBvDomain *d, BzlaBvDomainWord *res);
+
 /** Delete bit-vector domain. */
 void bzla_bvdomain_free(BzlaMemMgr *mm, BzlaBvDomain *d);
 
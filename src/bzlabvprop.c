@@ -762,12 +762,18 @@ bvprop_shift_const_aux(BzlaMemMgr *mm,
 
   w = bzla_bvdomain_get_width(d_z);
   assert(w == bzla_bvdomain_get_width(d_x));
-#ifndef NDEBUG
-  BzlaBitVector *uint32maxbv = bzla_bv_ones(mm, 32);
-  assert(bzla_bv_compare(n, uint32maxbv) <= 0);
-  bzla_bv_free(mm, uint32maxbv);
-#endif
-  wn = (uint32_t) bzla_bv_to_uint64(n);
+  /* shifting by n >= w is equivalent to shifting by w */
+  if (bzla_bv_get_width(n) - bzla_bv_get_num_leading_zeros(n) > 32)
+  {
+    wn = w;
+  }
+  else
+  {
+    tmp0 = bzla_bv_get_width(n) > 32 ? bzla_bv_slice(mm, n, 31, 0)
+                                     : bzla_bv_copy(mm, n);
+    wn   = (uint32_t) bzla_bv_to_uint64(tmp0);
+    bzla_bv_free(mm, tmp0);
+  }
 
   /**
    * SLL: mask1 = 1_[wn]   :: 0_[w-wn]
@@ -950,8 +956,9 @@ bvprop_shift_aux(BzlaMemMgr *mm,
     else
       d = bzla_bvdomain_new_init(mm, bw);
     BZLA_PUSH_STACK(d_ite_stack, d);
-    /* shift width */
-    bv = bzla_bv_uint64_to_bv(mm, 1u << i, bw);
+    /* shift width, 1 << i does not fit into 32 bits for i >= 32 */
+    bv = bzla_bv_new(mm, bw);
+    bzla_bv_set_bit(bv, i, 1);
     BZLA_PUSH_STACK(shift_stack, bv);
   }
 
@@ -4427,3 +4434,770 @@ DONE:
 #endif
 
 /*----------------------------------------------------------------------------*/
+/* Word-level propagators                                                     */
+/*----------------------------------------------------------------------------*/
+
+/* Note: The word-level propagators follow the structure and the order of
+ *       decomposition steps of their bit-vector counterparts above and thus
+ *       compute the same domains. */
+
+typedef bool (*BVPropWordFunUnary)(uint32_t,
+                                   BzlaBvDomainWord *,
+                                   BzlaBvDomainWord *);
+
+typedef bool (*BVPropWordFunBinary)(uint32_t,
+                                    BzlaBvDomainWord *,
+                                    BzlaBvDomainWord *,
+                                    BzlaBvDomainWord *);
+
+typedef bool (*BVPropWordFunTernary)(uint32_t,
+                                     BzlaBvDomainWord *,
+                                     BzlaBvDomainWord *,
+                                     BzlaBvDomainWord *,
+                                     BzlaBvDomainWord *);
+
+static inline uint64_t
+word_mask(uint32_t bw)
+{
+  assert(bw > 0);
+  assert(bw <= BZLA_BVDOMAIN_WORD_MAX_WIDTH);
+  return bw == 64 ? ~UINT64_C(0) : (UINT64_C(1) << bw) - 1;
+}
+
+static inline bool
+word_is_valid(const BzlaBvDomainWord *d)
+{
+  return (d->lo & ~d->hi) == 0;
+}
+
+static inline bool
+word_is_equal(const BzlaBvDomainWord *a, const BzlaBvDomainWord *b)
+{
+  return a->lo == b->lo && a->hi == b->hi;
+}
+
+static inline uint64_t
+word_sll(uint64_t v, uint64_t n, uint64_t mask)
+{
+  return n >= 64 ? 0 : (v << n) & mask;
+}
+
+static inline uint64_t
+word_srl(uint64_t v, uint64_t n)
+{
+  return n >= 64 ? 0 : v >> n;
+}
+
+/* -------------------------------------------------------------------------- */
+
+static bool
+word_decomp_step_unary(uint32_t bw,
+                       BzlaBvDomainWord *d_x,
+                       BzlaBvDomainWord *d_z,
+                       BVPropWordFunUnary fun,
+                       bool *progress)
+{
+  BzlaBvDomainWord res_x = *d_x, res_z = *d_z;
+
+  if (!fun(bw, &res_x, &res_z)) return false;
+  if (!(*progress))
+  {
+    *progress = !word_is_equal(d_x, &res_x) || !word_is_equal(d_z, &res_z);
+  }
+  *d_x = res_x;
+  *d_z = res_z;
+  return true;
+}
+
+static bool
+word_decomp_step_binary(uint32_t bw,
+                        BzlaBvDomainWord *d_x,
+                        BzlaBvDomainWord *d_y,
+                        BzlaBvDomainWord *d_z,
+                        BVPropWordFunBinary fun,
+                        bool *progress)
+{
+  BzlaBvDomainWord res_x = *d_x, res_y = *d_y, res_z = *d_z;
+
+  if (!fun(bw, &res_x, &res_y, &res_z)) return false;
+  if (!(*progress))
+  {
+    *progress = !word_is_equal(d_x, &res_x) || !word_is_equal(d_y, &res_y)
+                || !word_is_equal(d_z, &res_z);
+  }
+  *d_x = res_x;
+  *d_y = res_y;
+  *d_z = res_z;
+  return true;
+}
+
+static bool
+word_decomp_step_ternary(uint32_t bw,
+                         BzlaBvDomainWord *d_x,
+                         BzlaBvDomainWord *d_y,
+                         BzlaBvDomainWord *d_z,
+                         BzlaBvDomainWord *d_c,
+                         BVPropWordFunTernary fun,
+                         bool *progress)
+{
+  BzlaBvDomainWord res_x = *d_x, res_y = *d_y, res_z = *d_z, res_c = *d_c;
+
+  if (!fun(bw, &res_x, &res_y, &res_z, &res_c)) return false;
+  if (!(*progress))
+  {
+    *progress = !word_is_equal(d_x, &res_x) || !word_is_equal(d_y, &res_y)
+                || !word_is_equal(d_z, &res_z) || !word_is_equal(d_c, &res_c);
+  }
+  *d_x = res_x;
+  *d_y = res_y;
+  *d_z = res_z;
+  *d_c = res_c;
+  return true;
+}
+
+/* -------------------------------------------------------------------------- */
+
+static bool
+word_not(uint32_t bw, BzlaBvDomainWord *d_x, BzlaBvDomainWord *d_z)
+{
+  uint64_t mask      = word_mask(bw);
+  BzlaBvDomainWord x = *d_x, z = *d_z;
+
+  d_x->lo = x.lo | (~z.hi & mask);
+  d_x->hi = x.hi & ~z.lo;
+  d_z->lo = z.lo | (~x.hi & mask);
+  d_z->hi = z.hi & ~x.lo;
+  return word_is_valid(d_x) && word_is_valid(d_z);
+}
+
+static bool
+word_and(uint32_t bw,
+         BzlaBvDomainWord *d_x,
+         BzlaBvDomainWord *d_y,
+         BzlaBvDomainWord *d_z)
+{
+  (void) bw;
+  BzlaBvDomainWord x = *d_x, y = *d_y, z = *d_z;
+
+  d_x->lo = x.lo | z.lo;
+  d_x->hi = x.hi & (z.hi | ~y.lo);
+  d_y->lo = y.lo | z.lo;
+  d_y->hi = y.hi & (z.hi | ~x.lo);
+  d_z->lo = z.lo | (x.lo & y.lo);
+  d_z->hi = z.hi & x.hi & y.hi;
+  return word_is_valid(d_x) && word_is_valid(d_y) && word_is_valid(d_z);
+}
+
+static bool
+word_or(uint32_t bw,
+        BzlaBvDomainWord *d_x,
+        BzlaBvDomainWord *d_y,
+        BzlaBvDomainWord *d_z)
+{
+  (void) bw;
+  BzlaBvDomainWord x = *d_x, y = *d_y, z = *d_z;
+
+  d_x->lo = x.lo | (~y.hi & z.lo);
+  d_x->hi = x.hi & z.hi;
+  d_y->lo = y.lo | (~x.hi & z.lo);
+  d_y->hi = y.hi & z.hi;
+  d_z->lo = z.lo | x.lo | y.lo;
+  d_z->hi = z.hi & (x.hi | y.hi);
+  return word_is_valid(d_x) && word_is_valid(d_y) && word_is_valid(d_z);
+}
+
+static bool
+word_xor(uint32_t bw,
+         BzlaBvDomainWord *d_x,
+         BzlaBvDomainWord *d_y,
+         BzlaBvDomainWord *d_z)
+{
+  (void) bw;
+  BzlaBvDomainWord x = *d_x, y = *d_y, z = *d_z;
+
+  d_x->lo = x.lo | (~z.hi & y.lo) | (z.lo & ~y.hi);
+  d_x->hi = x.hi & (z.hi | y.hi) & ~(y.lo & z.lo);
+  d_y->lo = y.lo | (~z.hi & x.lo) | (z.lo & ~x.hi);
+  d_y->hi = y.hi & (z.hi | x.hi) & ~(x.lo & z.lo);
+  d_z->lo = z.lo | (~x.hi & y.lo) | (x.lo & ~y.hi);
+  d_z->hi = z.hi & (x.hi | y.hi) & ~(x.lo & y.lo);
+  return word_is_valid(d_x) && word_is_valid(d_y) && word_is_valid(d_z);
+}
+
+/* Propagate domains 'd_c' and 'd_z' of z = sext(c, bw - 1) with bw(c) = 1. */
+static bool
+word_sext_bit(uint32_t bw, BzlaBvDomainWord *d_c, BzlaBvDomainWord *d_z)
+{
+  uint64_t mask      = word_mask(bw);
+  BzlaBvDomainWord c = *d_c, z = *d_z;
+  bool redor, redand;
+
+  redor  = z.lo != 0;
+  redand = z.hi == mask;
+
+  d_c->lo = c.lo | redor;
+  d_c->hi = c.hi & redand;
+  d_z->lo = z.lo | (c.lo ? mask : 0) | (redor ? mask : 0);
+  d_z->hi = z.hi & (c.hi ? mask : 0) & (redand ? mask : 0);
+  return word_is_valid(d_c) && word_is_valid(d_z);
+}
+
+static bool
+word_shift_const(uint32_t bw,
+                 BzlaBvDomainWord *d_x,
+                 BzlaBvDomainWord *d_z,
+                 uint64_t n,
+                 bool is_srl)
+{
+  uint64_t mask, mask1;
+  BzlaBvDomainWord x = *d_x, z = *d_z;
+
+  mask = word_mask(bw);
+
+  /**
+   * SLL: mask1 = 1_[n]   :: 0_[bw-n]
+   * SRL: mask1 = 0_[bw-n] :: 1_[n]
+   */
+  if (n == 0)
+    mask1 = 0;
+  else if (n >= bw)
+    mask1 = mask;
+  else
+    mask1 = is_srl ? (UINT64_C(1) << n) - 1 : mask & ~(mask >> n);
+
+  if (is_srl)
+  {
+    d_x->lo = x.lo | word_sll(z.lo, n, mask);
+    d_x->hi = (word_sll(z.hi, n, mask) | mask1) & x.hi;
+    d_z->lo = word_srl(x.lo, n) | z.lo;
+    d_z->hi = word_srl(x.hi, n) & z.hi;
+  }
+  else
+  {
+    d_x->lo = x.lo | word_srl(z.lo, n);
+    d_x->hi = (word_srl(z.hi, n) | mask1) & x.hi;
+    d_z->lo = word_sll(x.lo, n, mask) | z.lo;
+    d_z->hi = word_sll(x.hi, n, mask) & z.hi;
+  }
+  return word_is_valid(d_x) && word_is_valid(d_z);
+}
+
+static bool
+word_decomp_step_shiftc(uint32_t bw,
+                        BzlaBvDomainWord *d_x,
+                        BzlaBvDomainWord *d_z,
+                        uint64_t n,
+                        bool is_srl,
+                        bool *progress)
+{
+  BzlaBvDomainWord res_x = *d_x, res_z = *d_z;
+
+  if (!word_shift_const(bw, &res_x, &res_z, n, is_srl)) return false;
+  if (!(*progress))
+  {
+    *progress = !word_is_equal(d_x, &res_x) || !word_is_equal(d_z, &res_z);
+  }
+  *d_x = res_x;
+  *d_z = res_z;
+  return true;
+}
+
+static bool
+word_decomp_step_slice(uint32_t bw,
+                       BzlaBvDomainWord *d_x,
+                       BzlaBvDomainWord *d_z,
+                       uint32_t upper,
+                       uint32_t lower,
+                       bool *progress)
+{
+  BzlaBvDomainWord res_x = *d_x, res_z = *d_z;
+
+  if (!bzla_bvprop_word_slice(bw, &res_x, &res_z, upper, lower)) return false;
+  if (!(*progress))
+  {
+    *progress = !word_is_equal(d_x, &res_x) || !word_is_equal(d_z, &res_z);
+  }
+  *d_x = res_x;
+  *d_z = res_z;
+  return true;
+}
+
+/* -------------------------------------------------------------------------- */
+
+bool
+bzla_bvprop_word_eq(uint32_t bw,
+                    BzlaBvDomainWord *d_x,
+                    BzlaBvDomainWord *d_y,
+                    BzlaBvDomainWord *d_z)
+{
+  assert(d_x);
+  assert(word_is_valid(d_x));
+  assert(d_y);
+  assert(word_is_valid(d_y));
+  assert(d_z);
+  assert(word_is_valid(d_z));
+
+  uint64_t mask, sext_lo_z, conflict;
+  BzlaBvDomainWord x = *d_x, y = *d_y, z = *d_z;
+
+  mask      = word_mask(bw);
+  sext_lo_z = (z.lo & 1) ? mask : 0;
+
+  /* lo_x' = lo_x | (sext(lo_z,n) & lo_y) */
+  d_x->lo = x.lo | (sext_lo_z & y.lo);
+  /* hi_x' = hi_x & ~(sext(hi_z,n) & ~hi_y) */
+  d_x->hi = x.hi & ~(sext_lo_z & ~y.hi);
+  if (!word_is_valid(d_x)) return false;
+
+  /* lo_y' = lo_y | (sext(lo_z,n) & lo_x) */
+  d_y->lo = y.lo | (sext_lo_z & x.lo);
+  /* hi_y' = hi_y & ~(sext(hi_z,n) & ~hi_x) */
+  d_y->hi = y.hi & ~(sext_lo_z & ~x.hi);
+  if (!word_is_valid(d_y)) return false;
+
+  /* lo_z' = lo_z | redand((lo_x & lo_y) | (~hi_x & ~hi_y)) */
+  d_z->lo = z.lo | (((x.lo & y.lo) | (~x.hi & ~y.hi & mask)) == mask);
+  /* hi_z' = hi_z & ~redor((lo_x & ~hi_y) | (~hi_x & lo_y)) */
+  conflict = (x.lo & ~y.hi) | (~x.hi & y.lo);
+  d_z->hi  = z.hi & (conflict == 0);
+  return word_is_valid(d_z);
+}
+
+bool
+bzla_bvprop_word_and(uint32_t bw,
+                     BzlaBvDomainWord *d_x,
+                     BzlaBvDomainWord *d_y,
+                     BzlaBvDomainWord *d_z)
+{
+  assert(d_x);
+  assert(word_is_valid(d_x));
+  assert(d_y);
+  assert(word_is_valid(d_y));
+  assert(d_z);
+  assert(word_is_valid(d_z));
+  return word_and(bw, d_x, d_y, d_z);
+}
+
+bool
+bzla_bvprop_word_slice(uint32_t bw,
+                       BzlaBvDomainWord *d_x,
+                       BzlaBvDomainWord *d_z,
+                       uint32_t upper,
+                       uint32_t lower)
+{
+  assert(d_x);
+  assert(word_is_valid(d_x));
+  assert(d_z);
+  assert(word_is_valid(d_z));
+  assert(upper >= lower);
+  assert(upper < bw);
+  (void) bw;
+
+  uint64_t mask, lo, hi;
+
+  /* Apply equality propagator on sliced 'x' domain, the don't care bits of
+   * 'x' are not changed (see bzla_bvprop_slice). */
+  mask = word_mask(upper - lower + 1);
+  lo   = ((d_x->lo >> lower) & mask) | d_z->lo;
+  hi   = ((d_x->hi >> lower) & mask) & d_z->hi;
+  if (lo & ~hi) return false;
+
+  d_z->lo = lo;
+  d_z->hi = hi;
+  d_x->lo = (d_x->lo & ~(mask << lower)) | (lo << lower);
+  d_x->hi = (d_x->hi & ~(mask << lower)) | (hi << lower);
+  return true;
+}
+
+bool
+bzla_bvprop_word_concat(uint32_t bw_x,
+                        uint32_t bw_y,
+                        BzlaBvDomainWord *d_x,
+                        BzlaBvDomainWord *d_y,
+                        BzlaBvDomainWord *d_z)
+{
+  assert(d_x);
+  assert(word_is_valid(d_x));
+  assert(d_y);
+  assert(word_is_valid(d_y));
+  assert(d_z);
+  assert(word_is_valid(d_z));
+  assert(bw_x + bw_y <= BZLA_BVDOMAIN_WORD_MAX_WIDTH);
+  (void) bw_x;
+
+  uint64_t mask_y = word_mask(bw_y);
+
+  /* z = zx o zy, x = zx, y = zy */
+  d_x->lo |= d_z->lo >> bw_y;
+  d_x->hi &= d_z->hi >> bw_y;
+  if (!word_is_valid(d_x)) return false;
+  d_y->lo |= d_z->lo & mask_y;
+  d_y->hi &= d_z->hi & mask_y;
+  if (!word_is_valid(d_y)) return false;
+
+  d_z->lo = (d_x->lo << bw_y) | d_y->lo;
+  d_z->hi = (d_x->hi << bw_y) | d_y->hi;
+  return true;
+}
+
+bool
+bzla_bvprop_word_cond(uint32_t bw,
+                      BzlaBvDomainWord *d_x,
+                      BzlaBvDomainWord *d_y,
+                      BzlaBvDomainWord *d_z,
+                      BzlaBvDomainWord *d_c)
+{
+  assert(d_c);
+  assert(word_is_valid(d_c));
+  assert(d_x);
+  assert(word_is_valid(d_x));
+  assert(d_y);
+  assert(word_is_valid(d_y));
+  assert(d_z);
+  assert(word_is_valid(d_z));
+
+  bool progress, c_is_fixed;
+  uint64_t mask;
+  BzlaBvDomainWord x, y, z, bvc, res_bvc;
+
+  mask = word_mask(bw);
+
+  c_is_fixed = d_c->lo == d_c->hi;
+  bvc.lo     = c_is_fixed && d_c->lo ? mask : 0;
+  bvc.hi     = !c_is_fixed || d_c->lo ? mask : 0;
+
+  do
+  {
+    progress = false;
+
+    x = *d_x;
+    y = *d_y;
+    z = *d_z;
+
+    /* lo_bvc' = lo_bvc | (lo_z & ~hi_y) | (~hi_z & lo_y) */
+    res_bvc.lo = bvc.lo | (z.lo & ~y.hi) | (~z.hi & y.lo);
+    /* hi_bvc' = hi_bvc & (~lo_z | hi_x) & (hi_z | ~lo_x) */
+    res_bvc.hi = bvc.hi & (~z.lo | x.hi) & (z.hi | ~x.lo);
+    /* lo_x' = lo_x | (lo_z & (lo_bvc | ~hi_y)) */
+    d_x->lo = x.lo | (z.lo & (bvc.lo | ~y.hi));
+    /* hi_x' = hi_x & (hi_z | (~lo_bvc & ~lo_y)) */
+    d_x->hi = x.hi & (z.hi | (~bvc.lo & ~y.lo));
+    /* lo_y' = lo_y | (lo_z & (~hi_bvc | ~hi_x)) */
+    d_y->lo = y.lo | (z.lo & (~bvc.hi | ~x.hi));
+    /* hi_y' = hi_y & (hi_z | (hi_bvc & ~lo_x)) */
+    d_y->hi = y.hi & (z.hi | (bvc.hi & ~x.lo));
+    /* lo_z' = lo_z | (lo_bvc & lo_x) | (~hi_bvc & lo_y) | (lo_x & lo_y) */
+    d_z->lo = z.lo | (bvc.lo & x.lo) | (~bvc.hi & y.lo) | (x.lo & y.lo);
+    /* hi_z' = hi_z & (~lo_bvc | hi_x) & (hi_bvc | hi_y) & (hi_x | hi_y) */
+    d_z->hi = z.hi & (~bvc.lo | x.hi) & (bvc.hi | y.hi) & (x.hi | y.hi);
+
+    if (!word_is_valid(&res_bvc) || !word_is_valid(d_x)
+        || !word_is_valid(d_y) || !word_is_valid(d_z))
+    {
+      return false;
+    }
+
+    if (bw > 1)
+    {
+      progress = !word_is_equal(&x, d_x) || !word_is_equal(&y, d_y)
+                 || !word_is_equal(&z, d_z) || !word_is_equal(&bvc, &res_bvc);
+    }
+    bvc = res_bvc;
+
+    if (bw > 1 && !c_is_fixed && progress)
+    {
+      if (!word_decomp_step_unary(bw, d_c, &bvc, word_sext_bit, &progress))
+      {
+        return false;
+      }
+    }
+  } while (progress);
+
+  return true;
+}
+
+/**
+ * Note: 'd_cout' passes in the input domain for cout and returns the
+ *       resulting domain for cout.
+ */
+static bool
+word_add_aux(uint32_t bw,
+             BzlaBvDomainWord *d_x,
+             BzlaBvDomainWord *d_y,
+             BzlaBvDomainWord *d_z,
+             BzlaBvDomainWord *d_cout)
+{
+  bool progress;
+  uint64_t mask;
+  BzlaBvDomainWord cin, x_xor_y, x_and_y, cin_and_x_xor_y;
+
+  mask = word_mask(bw);
+
+  /* cin = x...x0 */
+  cin.lo = 0;
+  cin.hi = mask & ~UINT64_C(1);
+
+  x_xor_y.lo      = 0;
+  x_xor_y.hi      = mask;
+  x_and_y         = x_xor_y;
+  cin_and_x_xor_y = x_xor_y;
+
+  /**
+   * full adder:
+   * z    = x ^ y ^ cin
+   * cout = (x & y) | (cin & (x ^ y))
+   * cin  = cout << 1
+   */
+  do
+  {
+    progress = false;
+
+    /* x_xor_y = x ^ y */
+    if (!word_decomp_step_binary(bw, d_x, d_y, &x_xor_y, word_xor, &progress))
+    {
+      return false;
+    }
+    /* z = x_xor_y ^ cin */
+    if (!word_decomp_step_binary(bw, &x_xor_y, &cin, d_z, word_xor, &progress))
+    {
+      return false;
+    }
+    /* x_and_y = x & y */
+    if (!word_decomp_step_binary(bw, d_x, d_y, &x_and_y, word_and, &progress))
+    {
+      return false;
+    }
+    /* cin_and_x_xor_y = cin & x_xor_y */
+    if (!word_decomp_step_binary(
+            bw, &cin, &x_xor_y, &cin_and_x_xor_y, word_and, &progress))
+    {
+      return false;
+    }
+    /* cout = x_and_y | cin_and_x_xor_y */
+    if (!word_decomp_step_binary(
+            bw, &x_and_y, &cin_and_x_xor_y, d_cout, word_or, &progress))
+    {
+      return false;
+    }
+    /* cin  = cout << 1 */
+    if (!word_decomp_step_shiftc(bw, d_cout, &cin, 1, false, &progress))
+    {
+      return false;
+    }
+  } while (progress);
+
+  return true;
+}
+
+bool
+bzla_bvprop_word_add(uint32_t bw,
+                     BzlaBvDomainWord *d_x,
+                     BzlaBvDomainWord *d_y,
+                     BzlaBvDomainWord *d_z)
+{
+  assert(d_x);
+  assert(word_is_valid(d_x));
+  assert(d_y);
+  assert(word_is_valid(d_y));
+  assert(d_z);
+  assert(word_is_valid(d_z));
+
+  BzlaBvDomainWord cout;
+
+  /* cout = x...x */
+  cout.lo = 0;
+  cout.hi = word_mask(bw);
+  return word_add_aux(bw, d_x, d_y, d_z, &cout);
+}
+
+bool
+bzla_bvprop_word_ult(uint32_t bw,
+                     BzlaBvDomainWord *d_x,
+                     BzlaBvDomainWord *d_y,
+                     BzlaBvDomainWord *d_z)
+{
+  assert(d_x);
+  assert(word_is_valid(d_x));
+  assert(d_y);
+  assert(word_is_valid(d_y));
+  assert(d_z);
+  assert(word_is_valid(d_z));
+
+  bool progress;
+  BzlaBvDomainWord not_y, add_1, add_2, cout_1, cout_2;
+  BzlaBvDomainWord cout_msb, cout_msb_1, cout_msb_2, one;
+
+  /**
+   * z_[1] = x_[bw] < y_[bw]
+   *       = ~(cout(~y + 1)[MSB:MSB] | cout(x + (~y + 1))[MSB:MSB]) */
+
+  not_y.lo = 0;
+  not_y.hi = word_mask(bw);
+  add_1    = not_y;
+  add_2    = not_y;
+  cout_1   = not_y;
+  cout_2   = not_y;
+
+  cout_msb.lo = 0;
+  cout_msb.hi = 1;
+  cout_msb_1  = cout_msb;
+  cout_msb_2  = cout_msb;
+
+  one.lo = 1;
+  one.hi = 1;
+
+  do
+  {
+    progress = false;
+
+    /* not_y = ~y */
+    if (!word_decomp_step_unary(bw, d_y, &not_y, word_not, &progress))
+    {
+      return false;
+    }
+    /* (add_1, cout_1) = not_y + 1 */
+    if (!word_decomp_step_ternary(
+            bw, &not_y, &one, &add_1, &cout_1, word_add_aux, &progress))
+    {
+      return false;
+    }
+    assert(one.lo == 1 && one.hi == 1);
+    /* (add_2, cout_2) = x + add_1 */
+    if (!word_decomp_step_ternary(
+            bw, d_x, &add_1, &add_2, &cout_2, word_add_aux, &progress))
+    {
+      return false;
+    }
+    /* cout_msb_1 = cout(add_1)[MSB:MSB] */
+    if (!word_decomp_step_slice(
+            bw, &cout_1, &cout_msb_1, bw - 1, bw - 1, &progress))
+    {
+      return false;
+    }
+    /* cout_msb_2 = cout(add_2)[MSB:MSB] */
+    if (!word_decomp_step_slice(
+            bw, &cout_2, &cout_msb_2, bw - 1, bw - 1, &progress))
+    {
+      return false;
+    }
+    /* cout_msb = cout_msb_1 | cout_msb_2 */
+    if (!word_decomp_step_binary(
+            1, &cout_msb_1, &cout_msb_2, &cout_msb, word_or, &progress))
+    {
+      return false;
+    }
+    /* z = ~cout_msb */
+    if (!word_decomp_step_unary(1, &cout_msb, d_z, word_not, &progress))
+    {
+      return false;
+    }
+  } while (progress);
+
+  return true;
+}
+
+static bool
+word_shift_aux(uint32_t bw,
+               BzlaBvDomainWord *d_x,
+               BzlaBvDomainWord *d_y,
+               BzlaBvDomainWord *d_z,
+               bool is_srl)
+{
+  assert(d_x);
+  assert(word_is_valid(d_x));
+  assert(d_y);
+  assert(word_is_valid(d_y));
+  assert(d_z);
+  assert(word_is_valid(d_z));
+
+  /* z_[bw] = x_[bw] << y_[bw], decomposed into a chain of bw ite over constant
+   * shifts by 1 << i for i = 0 to bw - 1 (see bvprop_shift_aux). */
+
+  uint32_t i;
+  bool progress;
+  uint64_t mask;
+  BzlaBvDomainWord d_c[BZLA_BVDOMAIN_WORD_MAX_WIDTH];
+  BzlaBvDomainWord d_shift[BZLA_BVDOMAIN_WORD_MAX_WIDTH];
+  BzlaBvDomainWord d_ite[BZLA_BVDOMAIN_WORD_MAX_WIDTH];
+  BzlaBvDomainWord *d_z_prev;
+
+  mask = word_mask(bw);
+
+  for (i = 0; i < bw; i++)
+  {
+    /* slice y into bw ite conditions */
+    d_c[i].lo = (d_y->lo >> i) & 1;
+    d_c[i].hi = (d_y->hi >> i) & 1;
+    /* bw shift propagators */
+    d_shift[i].lo = 0;
+    d_shift[i].hi = mask;
+    /* bw ite propagators */
+    d_ite[i] = i == bw - 1 ? *d_z : d_shift[i];
+  }
+
+  do
+  {
+    progress = false;
+
+    for (i = 0; i < bw; i++)
+    {
+      d_z_prev = i ? &d_ite[i - 1] : d_x;
+
+      /**
+       * SLL: prev_z << (1 << i)
+       * SRL: prev_z >> (1 << i)
+       */
+      if (!word_decomp_step_shiftc(
+              bw, d_z_prev, &d_shift[i], UINT64_C(1) << i, is_srl, &progress))
+      {
+        return false;
+      }
+
+      /**
+       * SLL: ite (y[i:i], prev_z << (1 << i), prev_z)
+       * SRL: ite (y[i:i], prev_z >> (1 << i), prev_z)
+       */
+      if (!word_decomp_step_ternary(bw,
+                                    &d_shift[i],
+                                    d_z_prev,
+                                    &d_ite[i],
+                                    &d_c[i],
+                                    bzla_bvprop_word_cond,
+                                    &progress))
+      {
+        return false;
+      }
+    }
+  } while (progress);
+
+  /* Collect y bits into the result for d_y. */
+  d_y->lo = 0;
+  d_y->hi = 0;
+  for (i = 0; i < bw; i++)
+  {
+    d_y->lo |= d_c[i].lo << i;
+    d_y->hi |= d_c[i].hi << i;
+  }
+  *d_z = d_ite[bw - 1];
+  return true;
+}
+
+bool
+bzla_bvprop_word_sll(uint32_t bw,
+                     BzlaBvDomainWord *d_x,
+                     BzlaBvDomainWord *d_y,
+                     BzlaBvDomainWord *d_z)
+{
+  return word_shift_aux(bw, d_x, d_y, d_z, false);
+}
+
+bool
+bzla_bvprop_word_srl(uint32_t bw,
+                     BzlaBvDomainWord *d_x,
+                     BzlaBvDomainWord *d_y,
+                     BzlaBvDomainWord *d_z)
+{
+  return word_shift_aux(bw, d_x, d_y, d_z, true);
+}
+
+/*----------------------------------------------------------------------------*/
@@ -214,4 +214,76 @@ bool bzla_bvprop_urem(BzlaMemMgr *mm,
                       BzlaBvDomain **res_d_y,
                       BzlaBvDomain **res_d_z);
 
+/*----------------------------------------------------------------------------*/
+/* Word-level propagators                                                     */
+/*----------------------------------------------------------------------------*/
+
+/**
+ * The following propagators compute the same domains as their bit-vector
+ * counterparts above for widths <= BZLA_BVDOMAIN_WORD_MAX_WIDTH, but operate
+ * on word-level domains and do not allocate memory. The given domains are
+ * updated in place, 'bw' is the width of operand 'x'. If an invalid domain
+ * was computed, false is returned and the given domains are undefined.
+ */
+
+/** Propagate domains 'd_x', 'd_y', and 'd_z' of z = (x = y). */
+bool bzla_bvprop_word_eq(uint32_t bw,
+                         BzlaBvDomainWord *d_x,
+                         BzlaBvDomainWord *d_y,
+                         BzlaBvDomainWord *d_z);
+
+/** Propagate domains 'd_x', 'd_y' and 'd_z' of z = x & y. */
+bool bzla_bvprop_word_and(uint32_t bw,
+                          BzlaBvDomainWord *d_x,
+                          BzlaBvDomainWord *d_y,
+                          BzlaBvDomainWord *d_z);
+
+/** Propagate domains 'd_x' and 'd_z' of z = x[upper:lower]. */
+bool bzla_bvprop_word_slice(uint32_t bw,
+                            BzlaBvDomainWord *d_x,
+                            BzlaBvDomainWord *d_z,
+                            uint32_t upper,
+                            uint32_t lower);
+
+/**
+ * Propagate domains 'd_x', 'd_y' and 'd_z' of z = x o y, where 'bw_x' and
+ * 'bw_y' are the widths of 'x' and 'y'.
+ */
+bool bzla_bvprop_word_concat(uint32_t bw_x,
+                             uint32_t bw_y,
+                             BzlaBvDomainWord *d_x,
+                             BzlaBvDomainWord *d_y,
+                             BzlaBvDomainWord *d_z);
+
+/** Propagate domains 'd_c', 'd_x', 'd_y' and 'd_z' of z = ite(c, x, y). */
+bool bzla_bvprop_word_cond(uint32_t bw,
+                           BzlaBvDomainWord *d_x,
+                           BzlaBvDomainWord *d_y,
+                           BzlaBvDomainWord *d_z,
+                           BzlaBvDomainWord *d_c);
+
+/** Propagate domains 'd_x', 'd_y' and 'd_z' of z = x + y. */
+bool bzla_bvprop_word_add(uint32_t bw,
+                          BzlaBvDomainWord *d_x,
+                          BzlaBvDomainWord *d_y,
+                          BzlaBvDomainWord *d_z);
+
+/** Propagate domains 'd_x', 'd_y' and 'd_z' of z = x < y (unsigned lt). */
+bool bzla_bvprop_word_ult(uint32_t bw,
+                          BzlaBvDomainWord *d_x,
+                          BzlaBvDomainWord *d_y,
+                          BzlaBvDomainWord *d_z);
+
+/** Propagate domains 'd_x', 'd_y' and 'd_z' of z = x << y. */
+bool bzla_bvprop_word_sll(uint32_t bw,
+                          BzlaBvDomainWord *d_x,
+                          BzlaBvDomainWord *d_y,
+                          BzlaBvDomainWord *d_z);
+
+/** Propagate domains 'd_x', 'd_y' and 'd_z' of z = x >> y. */
+bool bzla_bvprop_word_srl(uint32_t bw,
+                          BzlaBvDomainWord *d_x,
+                          BzlaBvDomainWord *d_y,
+                          BzlaBvDomainWord *d_z);
+
 #endif
@@ -248,6 +248,8 @@ chkclone_stats(Bzla *bzla, Bzla *clone)
   BZLA_CHKCLONE_STATS(muls_normalized);
   BZLA_CHKCLONE_STATS(muls_normalized);
   BZLA_CHKCLONE_STATS(ackermann_constraints);
+  BZLA_CHKCLONE_STATS(ackermann_constraints_skipped);
+  BZLA_CHKCLONE_STATS(ackermann_pairs_checked);
   BZLA_CHKCLONE_STATS(bv_uc_props);
   BZLA_CHKCLONE_STATS(fun_uc_props);
   BZLA_CHKCLONE_STATS(lambdas_merged);
@@ -471,6 +473,25 @@ chkclone_aig_cnf_id_table(Bzla *bzla, Bzla *clone)
            == bzla_node_get_tag(real_cexp->field)); \
   } while (0)
 
+#ifndef BZLA_COMPACT_PARENTS
+#define BZLA_CHKCLONE_EXPPTRPARENT(accessor, i)            \
+  do                                                       \
+  {                                                        \
+    e  = accessor(real_exp, i);                            \
+    ce = accessor(real_cexp, i);                           \
+    if (!e)                                                \
+    {                                                      \
+      assert(!ce);                                         \
+      break;                                               \
+    }                                                      \
+    assert(e != ce);                                       \
+    BZLA_CHKCLONE_EXPID(e, ce);                            \
+    assert(bzla_node_real_addr(e)->bzla == bzla);          \
+    assert(bzla_node_real_addr(ce)->bzla == clone);        \
+    assert(bzla_node_get_tag(e) == bzla_node_get_tag(ce)); \
+  } while (0)
+#endif
+
 void
 bzla_chkclone_exp(Bzla *bzla,
                   Bzla *clone,
@@ -553,11 +574,19 @@ bzla_chkclone_exp(Bzla *bzla,
 
   BZLA_CHKCLONE_EXPPTRID(next);
   BZLA_CHKCLONE_EXPPTRID(simplified);
+#ifdef BZLA_COMPACT_PARENTS
+  BZLA_CHKCLONE_EXP(apply_parents);
+  for (i = 0; i < real_exp->parents; i++)
+    assert(real_exp->parent_ids[i] == real_cexp->parent_ids[i]);
+#else
   BZLA_CHKCLONE_EXPPTRID(first_parent);
   BZLA_CHKCLONE_EXPPTRID(last_parent);
+#endif
   BZLA_CHKCLONE_EXPPTRINV(simplified);
+#ifndef BZLA_COMPACT_PARENTS
   BZLA_CHKCLONE_EXPPTRTAG(first_parent);
   BZLA_CHKCLONE_EXPPTRTAG(last_parent);
+#endif
 
   if (bzla_node_is_proxy(real_exp)) return;
 
@@ -580,13 +609,13 @@ bzla_chkclone_exp(Bzla *bzla,
              == bzla_node_bv_slice_get_lower(real_cexp));
     }
 
+#ifndef BZLA_COMPACT_PARENTS
     for (i = 0; i < real_exp->arity; i++)
     {
-      BZLA_CHKCLONE_EXPPTRID(prev_parent[i]);
-      BZLA_CHKCLONE_EXPPTRID(next_parent[i]);
-      BZLA_CHKCLONE_EXPPTRTAG(prev_parent[i]);
-      BZLA_CHKCLONE_EXPPTRTAG(next_parent[i]);
+      BZLA_CHKCLONE_EXPPTRPARENT(BZLA_NODE_PREV_PARENT, i);
+      BZLA_CHKCLONE_EXPPTRPARENT(BZLA_NODE_NEXT_PARENT, i);
     }
+#endif
   }
 
 #if 0
@@ -754,6 +783,19 @@ chkclone_node_unique_table(Bzla *bzla, Bzla *clone)
     }
     BZLA_CHKCLONE_EXPID(btable->chains[i], ctable->chains[i]);
   }
+
+  assert(btable->old_size == ctable->old_size);
+  assert(btable->migrated == ctable->migrated);
+  assert(!btable->old_chains == !ctable->old_chains);
+  for (i = btable->migrated; i < btable->old_size; i++)
+  {
+    if (!btable->old_chains[i])
+    {
+      assert(!ctable->old_chains[i]);
+      continue;
+    }
+    BZLA_CHKCLONE_EXPID(btable->old_chains[i], ctable->old_chains[i]);
+  }
 }
 
 /*------------------------------------------------------------------------*/
@@ -1159,6 +1201,7 @@ chkclone_slv(Bzla *bzla, Bzla *clone)
     BZLA_CHKCLONE_SLV_STATS(slv, cslv, inv_urem);
     BZLA_CHKCLONE_SLV_STATS(slv, cslv, inv_concat);
     BZLA_CHKCLONE_SLV_STATS(slv, cslv, inv_slice);
+    BZLA_CHKCLONE_SLV_STATS(slv, cslv, inv_fp);
 
     BZLA_CHKCLONE_SLV_STATS(slv, cslv, cons_add);
     BZLA_CHKCLONE_SLV_STATS(slv, cslv, cons_and);
@@ -1171,6 +1214,7 @@ chkclone_slv(Bzla *bzla, Bzla *clone)
     BZLA_CHKCLONE_SLV_STATS(slv, cslv, cons_urem);
     BZLA_CHKCLONE_SLV_STATS(slv, cslv, cons_concat);
     BZLA_CHKCLONE_SLV_STATS(slv, cslv, cons_slice);
+    BZLA_CHKCLONE_SLV_STATS(slv, cslv, cons_fp);
 #endif
   }
   else if (bzla->slv->kind == BZLA_AIGPROP_SOLVER_KIND)
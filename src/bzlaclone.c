@@ -572,11 +572,22 @@ clone_exp(Bzla *clone,
 
   res->bzla = clone;
 
+#ifdef BZLA_COMPACT_PARENTS
+  /* node ids are preserved */
+  if (exp->parents_size)
+  {
+    BZLA_NEWN(mm, res->parent_ids, exp->parents_size);
+    memcpy(res->parent_ids,
+           exp->parent_ids,
+           exp->parents * sizeof *exp->parent_ids);
+  }
+#else
   assert(!exp->first_parent || !bzla_node_is_invalid(exp->first_parent));
   assert(!exp->last_parent || !bzla_node_is_invalid(exp->last_parent));
 
   BZLA_PUSH_STACK_IF(exp->first_parent, *parents, &res->first_parent);
   BZLA_PUSH_STACK_IF(exp->last_parent, *parents, &res->last_parent);
+#endif
   /* <---------------------------------------------------------------------- */
 
   /* ------------- BZLA_ADDITIONAL_VAR_NODE_STRUCT (all nodes) ------------- */
@@ -594,16 +605,22 @@ clone_exp(Bzla *clone,
         }
       }
 
+#ifndef BZLA_COMPACT_PARENTS
       for (i = 0; i < exp->arity; i++)
       {
-        assert(!exp->prev_parent[i]
-               || !bzla_node_is_invalid(exp->prev_parent[i]));
-        assert(!exp->next_parent[i]
-               || !bzla_node_is_invalid(exp->next_parent[i]));
-
-        BZLA_PUSH_STACK_IF(exp->prev_parent[i], *parents, &res->prev_parent[i]);
-        BZLA_PUSH_STACK_IF(exp->next_parent[i], *parents, &res->next_parent[i]);
+        assert(!BZLA_NODE_PREV_PARENT(exp, i)
+               || !bzla_node_is_invalid(BZLA_NODE_PREV_PARENT(exp, i)));
+        assert(!BZLA_NODE_NEXT_PARENT(exp, i)
+               || !bzla_node_is_invalid(BZLA_NODE_NEXT_PARENT(exp, i)));
+
+        BZLA_PUSH_STACK_IF(BZLA_NODE_PREV_PARENT(exp, i),
+                           *parents,
+                           &BZLA_NODE_PREV_PARENT(res, i));
+        BZLA_PUSH_STACK_IF(BZLA_NODE_NEXT_PARENT(exp, i),
+                           *parents,
+                           &BZLA_NODE_NEXT_PARENT(res, i));
       }
+#endif
     }
   }
   /* <---------------------------------------------------------------------- */
@@ -841,6 +858,20 @@ clone_nodes_unique_table(Bzla *bzla, Bzla *clone, BzlaNodeMap *exp_map)
     res->chains[i] = bzla_nodemap_mapped(exp_map, table->chains[i]);
     assert(res->chains[i]);
   }
+
+  res->old_size   = table->old_size;
+  res->migrated   = table->migrated;
+  res->old_chains = 0;
+  if (table->old_chains)
+  {
+    BZLA_CNEWN(mm, res->old_chains, table->old_size);
+    for (i = table->migrated; i < table->old_size; i++)
+    {
+      if (!table->old_chains[i]) continue;
+      res->old_chains[i] = bzla_nodemap_mapped(exp_map, table->old_chains[i]);
+      assert(res->old_chains[i]);
+    }
+  }
 }
 
 #define MEM_INT_HASH_TABLE(table)                               \
@@ -1173,6 +1204,9 @@ clone_aux_bzla(Bzla *bzla,
     {
       allocated += MEM_PTR_HASH_TABLE(bzla_node_lambda_get_static_rho(cur));
     }
+#ifdef BZLA_COMPACT_PARENTS
+    allocated += cur->parents_size * sizeof(*cur->parent_ids);
+#endif
   }
   /* Note: hash table is initialized with size 1 */
   allocated += (emap->table->size - 1) * sizeof(BzlaPtrHashBucket *)
@@ -1189,7 +1223,9 @@ clone_aux_bzla(Bzla *bzla,
   BZLALOG(2,
           "  clone nodes unique table: %.3f s",
           (bzla_util_time_stamp() - delta));
-  assert((allocated += bzla->nodes_unique_table.size * sizeof(BzlaNode *))
+  assert((allocated += (bzla->nodes_unique_table.size
+                         + bzla->nodes_unique_table.old_size)
+                        * sizeof(BzlaNode *))
          == clone->mm->allocated);
 
   clone->node2symbol = bzla_hashptr_table_clone(mm,
@@ -1403,16 +1439,48 @@ clone_aux_bzla(Bzla *bzla,
   assert(allocated == clone->mm->allocated);
 #endif
   BZLA_NEW(mm, clone->rw_cache);
-  memcpy(clone->rw_cache, bzla->rw_cache, sizeof(BzlaRwCache));
-  clone->rw_cache->bzla  = clone;
-  clone->rw_cache->cache = bzla_hashptr_table_clone(
-      mm, bzla->rw_cache->cache, bzla_clone_key_as_rw_cache_tuple, 0, 0, 0);
+  BZLA_NEW(mm, clone->beta_cache);
+  if (exp_layer_only)
+  {
+    /* The rewrite and beta reduction caches are not copied when we only clone
+     * the exp layer, the clone populates its own caches on demand. Note that
+     * this only saves copying the caches, the nodes are still deep-copied. */
+    bzla_rw_cache_init(clone->rw_cache, clone);
+    bzla_beta_cache_init(clone->beta_cache, clone);
 #ifndef NDEBUG
-  CHKCLONE_MEM_PTR_HASH_TABLE(bzla->rw_cache->cache, clone->rw_cache->cache);
-  allocated += sizeof(*bzla->rw_cache);
-  allocated += bzla->rw_cache->cache->count * sizeof(BzlaRwCacheTuple);
-  allocated += MEM_PTR_HASH_TABLE(bzla->rw_cache->cache);
+    allocated += sizeof(*bzla->rw_cache);
+    allocated += MEM_PTR_HASH_TABLE(clone->rw_cache->cache);
+    allocated += sizeof(*bzla->beta_cache);
 #endif
+  }
+  else
+  {
+    memcpy(clone->rw_cache, bzla->rw_cache, sizeof(BzlaRwCache));
+    clone->rw_cache->bzla  = clone;
+    clone->rw_cache->cache = bzla_hashptr_table_clone(
+        mm, bzla->rw_cache->cache, bzla_clone_key_as_rw_cache_tuple, 0, 0, 0);
+#ifndef NDEBUG
+    CHKCLONE_MEM_PTR_HASH_TABLE(bzla->rw_cache->cache, clone->rw_cache->cache);
+    allocated += sizeof(*bzla->rw_cache);
+    allocated += bzla->rw_cache->cache->count * sizeof(BzlaRwCacheTuple);
+    allocated += MEM_PTR_HASH_TABLE(bzla->rw_cache->cache);
+#endif
+
+    /* Node ids are preserved when cloning, the cached ids remain valid. */
+    memcpy(clone->beta_cache, bzla->beta_cache, sizeof(BzlaBetaCache));
+    clone->beta_cache->bzla = clone;
+    if (bzla->beta_cache->entries)
+    {
+      BZLA_NEWN(mm, clone->beta_cache->entries, bzla->beta_cache->size);
+      memcpy(clone->beta_cache->entries,
+             bzla->beta_cache->entries,
+             bzla->beta_cache->size * sizeof(BzlaBetaCacheEntry));
+    }
+#ifndef NDEBUG
+    allocated += sizeof(*bzla->beta_cache);
+    allocated += bzla->beta_cache->size * sizeof(BzlaBetaCacheEntry);
+#endif
+  }
 
   /* move synthesized constraints to unsynthesized if we only clone the exp
    * layer */
@@ -1877,8 +1945,11 @@ bzla_clone_recursively_rebuild_exp(Bzla *bzla,
         case BZLA_FORALL_NODE:
           cur_clone = bzla_exp_forall(clone, e[0], e[1]);
           break;
+        case BZLA_UPDATE_NODE:
+          cur_clone = bzla_exp_update(clone, e[0], e[1], e[2]);
+          break;
         default:
-          assert(bzla_node_is_bv_cond(cur));
+          assert(bzla_node_is_cond(cur));
           cur_clone = bzla_exp_cond(clone, e[0], e[1], e[2]);
       }
       bzla_nodemap_map(exp_map, cur, cur_clone);
@@ -16,12 +16,15 @@
 /* Clone an existing Bitwuzla instance. */
 Bzla *bzla_clone(Bzla *bzla);
 
-/* Clone the expression layer of an existing Bitwuzla instance. */
+/* Clone the expression layer of an existing Bitwuzla instance. All nodes,
+ * sorts and node tables are deep-copied, the clone does not share storage
+ * with 'bzla'. The rewrite and beta reduction caches are not cloned, the
+ * clone starts with empty caches. */
 Bzla *bzla_clone_exp_layer(Bzla *bzla,
                            BzlaNodeMap **exp_map,
                            bool clone_simplified);
 
-/* Clone the expression layer and no bzla->slv */
+/* Clone the expression layer and no bzla->slv (see bzla_clone_exp_layer). */
 Bzla *bzla_clone_formula(Bzla *bzla);
 
 /* Rebuild 'exp' (and all expressions below) of an existing Bitwuzla instance
@@ -10,6 +10,7 @@
 
 #include "bzlacore.h"
 
+#include <inttypes.h>
 #include <limits.h>
 
 #ifndef NDEBUG
@@ -22,6 +23,7 @@
 #include "bzlaexp.h"
 #include "bzlafp.h"
 #include "bzlalog.h"
+#include "bzlalsutils.h"
 #include "bzlamodel.h"
 #include "bzlaopt.h"
 #include "bzlarewrite.h"
@@ -56,6 +58,14 @@
     BZLA_DELETEN(mm, (table).chains, (table).size); \
   } while (0)
 
+#define BZLA_RELEASE_NODE_UNIQUE_TABLE(mm, table)             \
+  do                                                          \
+  {                                                           \
+    BZLA_RELEASE_UNIQUE_TABLE(mm, table);                     \
+    if ((table).old_chains)                                   \
+      BZLA_DELETEN(mm, (table).old_chains, (table).old_size); \
+  } while (0)
+
 #define BZLA_INIT_SORT_UNIQUE_TABLE(mm, table) \
   do                                           \
   {                                            \
@@ -520,6 +530,17 @@ bzla_print_stats(Bzla *bzla)
             + bzla->rw_cache->cache->size * sizeof(BzlaPtrHashBucket *))
                / (double) (1 << 20));
 
+  BZLA_MSG(bzla->msg, 1, "");
+  BZLA_MSG(bzla->msg, 1, "beta reduction cache");
+  BZLA_MSG(bzla->msg, 1, "  %lld cached (add)", bzla->beta_cache->num_add);
+  BZLA_MSG(bzla->msg, 1, "  %lld cached (get)", bzla->beta_cache->num_get);
+  BZLA_MSG(bzla->msg, 1, "  %lld removed", bzla->beta_cache->num_remove);
+  BZLA_MSG(bzla->msg,
+           1,
+           "  %.2f MB cache",
+           bzla->beta_cache->size * sizeof(BzlaBetaCacheEntry)
+               / (double) (1 << 20));
+
 #ifndef NDEBUG
   BzlaPtrHashTableIterator it;
   char *rule;
@@ -668,6 +689,93 @@ bzla_print_stats(Bzla *bzla)
       bzla->msg, 1, "%.1f MB", bzla->mm->maxallocated / (double) (1 << 20));
 }
 
+static void
+print_json_time(FILE *file, const char *name, double time, bool last)
+{
+  fprintf(file, "    \"%s\": %.6f%s\n", name, time, last ? "" : ",");
+}
+
+static void
+print_json_stat(FILE *file, const char *name, uint64_t val, bool last)
+{
+  fprintf(file, "    \"%s\": %" PRIu64 "%s\n", name, val, last ? "" : ",");
+}
+
+void
+bzla_print_stats_json(Bzla *bzla, FILE *file, double total)
+{
+  assert(bzla);
+  assert(file);
+
+  BzlaSATMgr *smgr;
+  BzlaFunSolver *fslv;
+  double sat_time = 0, lemma_gen = 0, check_consistency = 0;
+  uint64_t refinements = 0, lemmas = 0;
+
+  smgr = bzla_get_sat_mgr(bzla);
+  if (smgr) sat_time = smgr->sat_time;
+
+  if (bzla->slv && bzla->slv->kind == BZLA_FUN_SOLVER_KIND)
+  {
+    fslv              = BZLA_FUN_SOLVER(bzla);
+    lemma_gen         = fslv->time.lemma_gen;
+    check_consistency = fslv->time.check_consistency;
+    refinements       = fslv->stats.refinement_iterations;
+    lemmas            = fslv->stats.lod_refinements;
+  }
+
+  fprintf(file, "{\n");
+#ifdef BZLA_TIME_STATISTICS
+  fprintf(file, "  \"time_statistics\": true,\n");
+#else
+  fprintf(file, "  \"time_statistics\": false,\n");
+#endif
+  fprintf(file, "  \"time\": {\n");
+  print_json_time(file, "parse", bzla->time.parse, false);
+  print_json_time(file, "solve", bzla->time.sat, false);
+  print_json_time(file, "simplify", bzla->time.simplify, false);
+  print_json_time(file, "rewrite", bzla->time.rewrite, false);
+  print_json_time(file, "variable_substitution", bzla->time.subst, false);
+  print_json_time(file, "embedded_substitution", bzla->time.embedded, false);
+  print_json_time(file, "occurrence_check", bzla->time.occurrence, false);
+  print_json_time(file, "variable_slicing", bzla->time.slicing, false);
+  print_json_time(file, "skeleton", bzla->time.skel, false);
+  print_json_time(file, "unconstrained_optimization", bzla->time.ucopt, false);
+  print_json_time(file, "lambda_extraction", bzla->time.extract, false);
+  print_json_time(file, "lambda_merging", bzla->time.merge, false);
+  print_json_time(file, "apply_elimination", bzla->time.elimapplies, false);
+  print_json_time(file, "ackermann", bzla->time.ack, false);
+  print_json_time(file, "substitute_rebuild", bzla->time.subst_rebuild, false);
+  print_json_time(file, "bitblast", bzla->time.synth_exp, false);
+  print_json_time(file, "sat", sat_time, false);
+  print_json_time(file, "consistency_check", check_consistency, false);
+  print_json_time(file, "lemma_generation", lemma_gen, false);
+  print_json_time(file, "beta_reduction", bzla->time.beta, false);
+  print_json_time(file, "partial_beta_reduction", bzla->time.betap, false);
+  print_json_time(file, "model_generation", bzla->time.model_gen, false);
+  print_json_time(file, "cloning", bzla->time.cloning, false);
+  print_json_time(file, "total", total, false);
+  print_json_time(file, "total_cpu", bzla_util_process_time(), true);
+  fprintf(file, "  },\n");
+  fprintf(file, "  \"stats\": {\n");
+  print_json_stat(file, "check_sat_calls", bzla->bzla_sat_bzla_called, false);
+  print_json_stat(file, "sat_calls", smgr ? smgr->satcalls : 0, false);
+  print_json_stat(file, "refinement_iterations", refinements, false);
+  print_json_stat(file, "lemmas", lemmas, false);
+  print_json_stat(
+      file, "var_substitutions", bzla->stats.var_substitutions, false);
+  print_json_stat(file, "expressions", bzla->stats.expressions, false);
+  print_json_stat(
+      file, "beta_reduce_calls", bzla->stats.beta_reduce_calls, true);
+  fprintf(file, "  },\n");
+  fprintf(file, "  \"memory\": {\n");
+  print_json_stat(file, "max_allocated", bzla->mm->maxallocated, false);
+  print_json_stat(file, "sat_max_allocated", bzla->mm->sat_maxallocated, true);
+  fprintf(file, "  }\n");
+  fprintf(file, "}\n");
+  fflush(file);
+}
+
 Bzla *
 bzla_new(void)
 {
@@ -769,6 +877,9 @@ bzla_new(void)
   BZLA_CNEW(mm, bzla->rw_cache);
   bzla_rw_cache_init(bzla->rw_cache, bzla);
 
+  BZLA_CNEW(mm, bzla->beta_cache);
+  bzla_beta_cache_init(bzla->beta_cache, bzla);
+
   return bzla;
 }
 
@@ -1015,7 +1126,7 @@ bzla_delete(Bzla *bzla)
   }
   assert(getenv("BZLALEAK") || getenv("BZLALEAKEXP") || !node_leak);
 #endif
-  BZLA_RELEASE_UNIQUE_TABLE(mm, bzla->nodes_unique_table);
+  BZLA_RELEASE_NODE_UNIQUE_TABLE(mm, bzla->nodes_unique_table);
   BZLA_RELEASE_STACK(bzla->nodes_id_table);
 
   assert(getenv("BZLALEAK") || getenv("BZLALEAKSORT")
@@ -1043,6 +1154,9 @@ bzla_delete(Bzla *bzla)
   bzla_rw_cache_delete(bzla->rw_cache);
   BZLA_DELETE(mm, bzla->rw_cache);
 
+  bzla_beta_cache_delete(bzla->beta_cache);
+  BZLA_DELETE(mm, bzla->beta_cache);
+
   assert(bzla->rec_rw_calls == 0);
   bzla_msg_delete(bzla->msg);
   BZLA_DELETE(mm, bzla);
@@ -2777,7 +2891,7 @@ bzla_check_sat(Bzla *bzla, int32_t lod_limit, int32_t sat_limit)
   BzlaSolverResult res;
   uint32_t engine;
 
-  start = bzla_util_time_stamp();
+  start = bzla_util_monotonic_time();
 
   BZLA_MSG(bzla->msg, 1, "calling SAT");
 
@@ -2831,19 +2945,15 @@ bzla_check_sat(Bzla *bzla, int32_t lod_limit, int32_t sat_limit)
       && !bzla_opt_get(bzla, BZLA_OPT_PRODUCE_MODELS)
       && !bzla_opt_get(bzla, BZLA_OPT_PRINT_DIMACS))
   {
-    uclone = bzla_clone(bzla);
+    /* The clone is solved from scratch with the fun engine, hence neither the
+     * AIG layer nor the solver need to be cloned. */
+    uclone = bzla_clone_formula(bzla);
     bzla_opt_set(uclone, BZLA_OPT_PP_UNCONSTRAINED_OPTIMIZATION, 0);
     bzla_opt_set(uclone, BZLA_OPT_CHECK_UNCONSTRAINED, 0);
     bzla_opt_set(uclone, BZLA_OPT_CHECK_MODEL, 0);
     bzla_opt_set(uclone, BZLA_OPT_CHECK_UNSAT_ASSUMPTIONS, 0);
     bzla_set_term(uclone, 0, 0);
-
     bzla_opt_set(uclone, BZLA_OPT_ENGINE, BZLA_ENGINE_FUN);
-    if (uclone->slv)
-    {
-      uclone->slv->api.delet(uclone->slv);
-      uclone->slv = 0;
-    }
   }
   BzlaCheckModelContext *chkmodel = 0;
   if (check && bzla_opt_get(bzla, BZLA_OPT_CHECK_MODEL))
@@ -2904,9 +3014,11 @@ bzla_check_sat(Bzla *bzla, int32_t lod_limit, int32_t sat_limit)
 
     if (!bzla->slv)
     {
-      /* these engines work on QF_BV only */
+      /* the local search engines evaluate floating-point operators
+       * natively, fall back to the fun engine for operators they do not
+       * support */
       if (engine == BZLA_ENGINE_SLS && bzla->ufs->count == 0
-          && bzla->feqs->count == 0)
+          && bzla->feqs->count == 0 && bzla_lsutils_fp_supported(bzla))
       {
         assert(bzla->lambdas->count == 0
                || bzla_opt_get(bzla, BZLA_OPT_PP_BETA_REDUCE));
@@ -2915,7 +3027,7 @@ bzla_check_sat(Bzla *bzla, int32_t lod_limit, int32_t sat_limit)
         bzla->slv = bzla_new_sls_solver(bzla);
       }
       else if (engine == BZLA_ENGINE_PROP && bzla->ufs->count == 0
-               && bzla->feqs->count == 0)
+               && bzla->feqs->count == 0 && bzla_lsutils_fp_supported(bzla))
       {
         assert(bzla->lambdas->count == 0
                || bzla_opt_get(bzla, BZLA_OPT_PP_BETA_REDUCE));
@@ -3005,7 +3117,7 @@ bzla_check_sat(Bzla *bzla, int32_t lod_limit, int32_t sat_limit)
     bzla_check_failed_assumptions(bzla);
 #endif
 
-  delta = bzla_util_time_stamp() - start;
+  delta = bzla_util_monotonic_time() - start;
 
   BZLA_MSG(bzla->msg,
            1,
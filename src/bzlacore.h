@@ -14,6 +14,7 @@
 #include <stdbool.h>
 
 #include "bzlaass.h"
+#include "bzlabetacache.h"
 #include "bzlamsg.h"
 #include "bzlanode.h"
 #include "bzlaopt.h"
@@ -39,6 +40,12 @@ struct BzlaNodeUniqueTable
   uint32_t size;
   uint32_t num_elements;
   BzlaNode **chains;
+  /* The table is resized incrementally: while 'old_chains' is set, buckets
+   * 'migrated' to 'old_size' - 1 of the previous table still hold nodes that
+   * have not been moved to 'chains' yet. */
+  uint32_t old_size;
+  uint32_t migrated;
+  BzlaNode **old_chains;
 };
 
 typedef struct BzlaNodeUniqueTable BzlaNodeUniqueTable;
@@ -111,6 +118,7 @@ struct Bzla
   uint32_t rec_rw_calls; /* calls for recursive rewriting */
   uint32_t valid_assignments;
   BzlaRwCache *rw_cache;
+  BzlaBetaCache *beta_cache;
 
   int32_t vis_idx; /* file index for visualizing expressions */
 
@@ -173,6 +181,8 @@ struct Bzla
     uint32_t ands_normalized;       /* number of and chains normalizations */
     uint32_t muls_normalized;       /* number of mul chains normalizations */
     uint32_t ackermann_constraints;
+    uint_least64_t ackermann_constraints_skipped;
+    uint_least64_t ackermann_pairs_checked;
     uint_least64_t prop_apply_lambda; /* number of static props over lambdas */
     uint_least64_t prop_apply_update; /* number of static props over updates */
     uint32_t bv_uc_props;
@@ -194,6 +204,7 @@ struct Bzla
 
   struct
   {
+    double parse;
     double sat;
     double simplify;
     double subst;
@@ -246,6 +257,11 @@ void bzla_set_msg_prefix(Bzla *bzla, const char *prefix);
 /* Prints statistics. */
 void bzla_print_stats(Bzla *bzla);
 
+/* Prints time statistics, statistics and memory usage as JSON object.
+ * 'total' is the wall-clock time to report as total time, the CPU time of
+ * the process is reported separately as 'total_cpu'. */
+void bzla_print_stats_json(Bzla *bzla, FILE *file, double total);
+
 /* Reset time statistics. */
 void bzla_reset_time(Bzla *bzla);
 
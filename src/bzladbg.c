@@ -54,20 +54,26 @@ bzla_dbg_check_lambdas_static_rho_proxy_free(const Bzla *bzla)
 bool
 bzla_dbg_check_unique_table_children_proxy_free(const Bzla *bzla)
 {
-  uint32_t i, j;
+  size_t i;
+  uint32_t j;
   BzlaNode *cur;
 
-  for (i = 0; i < bzla->nodes_unique_table.size; i++)
-    for (cur = bzla->nodes_unique_table.chains[i]; cur; cur = cur->next)
-      for (j = 0; j < cur->arity; j++)
-        if (bzla_node_is_proxy(cur->e[j]))
-        {
-          BZLALOG(1,
-                  "found proxy node in unique table: %s (parent: %s)",
-                  bzla_util_node2string(cur->e[j]),
-                  bzla_util_node2string(cur));
-          return false;
-        }
+  /* the unique table may be resized incrementally, hence we check all nodes
+   * that are in the unique table via the id table */
+  for (i = 1; i < BZLA_COUNT_STACK(bzla->nodes_id_table); i++)
+  {
+    cur = BZLA_PEEK_STACK(bzla->nodes_id_table, i);
+    if (!cur || !cur->unique) continue;
+    for (j = 0; j < cur->arity; j++)
+      if (bzla_node_is_proxy(cur->e[j]))
+      {
+        BZLALOG(1,
+                "found proxy node in unique table: %s (parent: %s)",
+                bzla_util_node2string(cur->e[j]),
+                bzla_util_node2string(cur));
+        return false;
+      }
+  }
   return true;
 }
 
@@ -111,20 +117,21 @@ bzla_dbg_check_hash_table_simp_free(BzlaPtrHashTable *table)
 bool
 bzla_dbg_check_unique_table_rebuild(const Bzla *bzla)
 {
-  uint32_t i;
+  size_t i;
   BzlaNode *cur;
 
-  for (i = 0; i < bzla->nodes_unique_table.size; i++)
-    for (cur = bzla->nodes_unique_table.chains[i]; cur; cur = cur->next)
+  for (i = 1; i < BZLA_COUNT_STACK(bzla->nodes_id_table); i++)
+  {
+    cur = BZLA_PEEK_STACK(bzla->nodes_id_table, i);
+    if (!cur || !cur->unique) continue;
+    if (cur->rebuild)
     {
-      if (cur->rebuild)
-      {
-        BZLALOG(1,
-                "found node with rebuild flag enabled: %s",
-                bzla_util_node2string(cur));
-        return false;
-      }
+      BZLALOG(1,
+              "found node with rebuild flag enabled: %s",
+              bzla_util_node2string(cur));
+      return false;
     }
+  }
   return true;
 }
 
@@ -11,10 +11,13 @@
 #include "bzlalsutils.h"
 
 #include "bzlabv.h"
+#include "bzlafp.h"
 #include "bzlalog.h"
 #include "bzlamodel.h"
 #include "bzlanode.h"
+#include "bzlarm.h"
 #include "bzlaslsutils.h"
+#include "bzlasort.h"
 #include "utils/bzlanodeiter.h"
 #include "utils/bzlautil.h"
 
@@ -66,6 +69,91 @@ update_roots_table(Bzla *bzla,
   }
 }
 
+static void
+undo_push_bv(BzlaLsUndoEntryStack *undo, int32_t id, BzlaBitVector *bv)
+{
+  BzlaLsUndoEntry e;
+  e.id       = id;
+  e.is_score = false;
+  e.bv       = bv;
+  e.score    = 0;
+  BZLA_PUSH_STACK(*undo, e);
+}
+
+static void
+undo_push_score(BzlaLsUndoEntryStack *undo, int32_t id, double score)
+{
+  BzlaLsUndoEntry e;
+  e.id       = id;
+  e.is_score = true;
+  e.bv       = 0;
+  e.score    = score;
+  BZLA_PUSH_STACK(*undo, e);
+}
+
+/* Set the model value of node 'id' to 'bv', the previous value is either
+ * freed or recorded in 'undo'. */
+static void
+set_model_value(BzlaMemMgr *mm,
+                BzlaHashTableData *d,
+                int32_t id,
+                BzlaBitVector *bv,
+                BzlaLsUndoEntryStack *undo)
+{
+  if (undo)
+    undo_push_bv(undo, id, d->as_ptr);
+  else
+    bzla_bv_free(mm, d->as_ptr);
+  d->as_ptr = bv;
+}
+
+/* Set the score of node 'id' to 'score', the previous score is recorded in
+ * 'undo' if given. */
+static void
+set_score(BzlaIntHashTable *score,
+          int32_t id,
+          double value,
+          BzlaLsUndoEntryStack *undo)
+{
+  BzlaHashTableData *d = bzla_hashint_map_get(score, id);
+  assert(d);
+  if (undo) undo_push_score(undo, id, d->as_dbl);
+  d->as_dbl = value;
+}
+
+/* Compute the value of bit-vector node 'n' from the values 'e' of its
+ * children. */
+static BzlaBitVector *
+eval_bv_node(BzlaMemMgr *mm, BzlaNode *n, BzlaBitVector *e[])
+{
+  assert(bzla_node_is_regular(n));
+  assert(!bzla_lsutils_is_fp_op(n));
+
+  switch (n->kind)
+  {
+    case BZLA_BV_ADD_NODE: return bzla_bv_add(mm, e[0], e[1]);
+    case BZLA_BV_AND_NODE: return bzla_bv_and(mm, e[0], e[1]);
+    case BZLA_BV_EQ_NODE: return bzla_bv_eq(mm, e[0], e[1]);
+    case BZLA_BV_ULT_NODE: return bzla_bv_ult(mm, e[0], e[1]);
+    case BZLA_BV_SLL_NODE: return bzla_bv_sll(mm, e[0], e[1]);
+    case BZLA_BV_SLT_NODE: return bzla_bv_slt(mm, e[0], e[1]);
+    case BZLA_BV_SRL_NODE: return bzla_bv_srl(mm, e[0], e[1]);
+    case BZLA_BV_MUL_NODE: return bzla_bv_mul(mm, e[0], e[1]);
+    case BZLA_BV_UDIV_NODE: return bzla_bv_udiv(mm, e[0], e[1]);
+    case BZLA_BV_UREM_NODE: return bzla_bv_urem(mm, e[0], e[1]);
+    case BZLA_BV_CONCAT_NODE: return bzla_bv_concat(mm, e[0], e[1]);
+    case BZLA_BV_SLICE_NODE:
+      return bzla_bv_slice(mm,
+                           e[0],
+                           bzla_node_bv_slice_get_upper(n),
+                           bzla_node_bv_slice_get_lower(n));
+    default:
+      assert(bzla_node_is_cond(n));
+      return bzla_bv_is_true(e[0]) ? bzla_bv_copy(mm, e[1])
+                                   : bzla_bv_copy(mm, e[2]);
+  }
+}
+
 /**
  * Update cone of influence.
  *
@@ -87,6 +175,7 @@ bzla_lsutils_update_cone(Bzla *bzla,
                          BzlaIntHashTable *score,
                          BzlaIntHashTable *exps,
                          bool update_roots,
+                         BzlaLsUndoEntryStack *undo,
                          uint64_t *stats_updates,
                          double *time_update_cone,
                          double *time_update_cone_reset,
@@ -105,7 +194,7 @@ bzla_lsutils_update_cone(Bzla *bzla,
   assert(time_update_cone_reset);
   assert(time_update_cone_model_gen);
 
-  double start, delta;
+  double start, delta, now;
   uint32_t i, j;
   int32_t id;
   BzlaNode *exp, *cur;
@@ -122,6 +211,7 @@ bzla_lsutils_update_cone(Bzla *bzla,
   mm = bzla->mm;
 
 #ifndef NDEBUG
+  bool check_roots;
   BzlaPtrHashTableIterator pit;
   BzlaNode *root;
   bzla_iter_hashptr_init(&pit, bzla->unsynthesized_constraints);
@@ -174,7 +264,10 @@ bzla_lsutils_update_cone(Bzla *bzla,
   BZLA_RELEASE_STACK(stack);
   bzla_hashint_table_delete(cache);
 
-  *time_update_cone_reset += bzla_util_time_stamp() - delta;
+  /* consecutive phases share time stamps */
+  now = bzla_util_time_stamp();
+  *time_update_cone_reset += now - delta;
+  delta = now;
 
   /* update assignment and score of exps ----------------------------------- */
 
@@ -195,26 +288,31 @@ bzla_lsutils_update_cone(Bzla *bzla,
       /* old assignment != new assignment */
       update_roots_table(bzla, roots, exp, ass);
     }
-    bzla_bv_free(mm, d->as_ptr);
-    d->as_ptr = bzla_bv_copy(mm, ass);
+    bv = bzla_bv_copy(mm, ass);
+    bzla_lsutils_fp_normalize_value(bzla, exp, &bv);
+    set_model_value(mm, d, exp->id, bv, undo);
     if ((d = bzla_hashint_map_get(bv_model, -exp->id)))
     {
-      bzla_bv_free(mm, d->as_ptr);
-      d->as_ptr = bzla_bv_not(mm, ass);
+      set_model_value(mm, d, -exp->id, bzla_bv_not(mm, bv), undo);
     }
 
     /* update score */
-    if (score && bzla_node_bv_get_width(bzla, exp) == 1)
+    if (score && bzla_node_is_bv(bzla, exp)
+        && bzla_node_bv_get_width(bzla, exp) == 1)
     {
-      assert(bzla_hashint_map_contains(score, bzla_node_get_id(exp)));
-      bzla_hashint_map_get(score, bzla_node_get_id(exp))->as_dbl =
-          bzla_slsutils_compute_score_node(
-              bzla, bv_model, bzla->fun_model, score, exp);
-
-      assert(bzla_hashint_map_contains(score, -bzla_node_get_id(exp)));
-      bzla_hashint_map_get(score, -bzla_node_get_id(exp))->as_dbl =
-          bzla_slsutils_compute_score_node(
-              bzla, bv_model, bzla->fun_model, score, bzla_node_invert(exp));
+      set_score(score,
+                exp->id,
+                bzla_slsutils_compute_score_node(
+                    bzla, bv_model, bzla->fun_model, score, exp),
+                undo);
+      set_score(score,
+                -exp->id,
+                bzla_slsutils_compute_score_node(bzla,
+                                                 bv_model,
+                                                 bzla->fun_model,
+                                                 score,
+                                                 bzla_node_invert(exp)),
+                undo);
     }
   }
 
@@ -225,8 +323,6 @@ bzla_lsutils_update_cone(Bzla *bzla,
 
   /* update model of cone ------------------------------------------------- */
 
-  delta = bzla_util_time_stamp();
-
   for (i = 0; i < BZLA_COUNT_STACK(cone); i++)
   {
     cur = BZLA_PEEK_STACK(cone, i);
@@ -242,7 +338,9 @@ bzla_lsutils_update_cone(Bzla *bzla,
       {
         d = bzla_hashint_map_get(bv_model, bzla_node_real_addr(cur->e[j])->id);
         /* Note: generate model enabled branch for ite (and does not
-         * generate model for nodes in the branch, hence !b may happen */
+         * generate model for nodes in the branch, hence !b may happen.
+         * Values computed for nodes outside of the cone do not depend on
+         * 'exps' and remain valid if the move is undone. */
         if (!d)
           e[j] = bzla_model_recursively_compute_assignment(
               bzla, bv_model, bzla->fun_model, cur->e[j]);
@@ -251,29 +349,13 @@ bzla_lsutils_update_cone(Bzla *bzla,
                                                   : bzla_bv_copy(mm, d->as_ptr);
       }
     }
-    switch (cur->kind)
+    if (bzla_lsutils_is_fp_op(cur))
     {
-      case BZLA_BV_ADD_NODE: bv = bzla_bv_add(mm, e[0], e[1]); break;
-      case BZLA_BV_AND_NODE: bv = bzla_bv_and(mm, e[0], e[1]); break;
-      case BZLA_BV_EQ_NODE: bv = bzla_bv_eq(mm, e[0], e[1]); break;
-      case BZLA_BV_ULT_NODE: bv = bzla_bv_ult(mm, e[0], e[1]); break;
-      case BZLA_BV_SLL_NODE: bv = bzla_bv_sll(mm, e[0], e[1]); break;
-      case BZLA_BV_SLT_NODE: bv = bzla_bv_slt(mm, e[0], e[1]); break;
-      case BZLA_BV_SRL_NODE: bv = bzla_bv_srl(mm, e[0], e[1]); break;
-      case BZLA_BV_MUL_NODE: bv = bzla_bv_mul(mm, e[0], e[1]); break;
-      case BZLA_BV_UDIV_NODE: bv = bzla_bv_udiv(mm, e[0], e[1]); break;
-      case BZLA_BV_UREM_NODE: bv = bzla_bv_urem(mm, e[0], e[1]); break;
-      case BZLA_BV_CONCAT_NODE: bv = bzla_bv_concat(mm, e[0], e[1]); break;
-      case BZLA_BV_SLICE_NODE:
-        bv = bzla_bv_slice(mm,
-                           e[0],
-                           bzla_node_bv_slice_get_upper(cur),
-                           bzla_node_bv_slice_get_lower(cur));
-        break;
-      default:
-        assert(bzla_node_is_cond(cur));
-        bv = bzla_bv_is_true(e[0]) ? bzla_bv_copy(mm, e[1])
-                                   : bzla_bv_copy(mm, e[2]);
+      bv = bzla_lsutils_fp_eval(bzla, cur, e);
+    }
+    else
+    {
+      bv = eval_bv_node(mm, cur, e);
     }
 
     /* update assignment */
@@ -299,34 +381,35 @@ bzla_lsutils_update_cone(Bzla *bzla,
     {
       bzla_node_copy(bzla, cur);
       bzla_hashint_map_add(bv_model, cur->id)->as_ptr = bv;
+      if (undo) undo_push_bv(undo, cur->id, 0);
     }
     else
     {
-      bzla_bv_free(mm, d->as_ptr);
-      d->as_ptr = bv;
+      set_model_value(mm, d, cur->id, bv, undo);
     }
 
     if ((d = bzla_hashint_map_get(bv_model, -cur->id)))
     {
-      bzla_bv_free(mm, d->as_ptr);
-      d->as_ptr = bzla_bv_not(mm, bv);
+      set_model_value(mm, d, -cur->id, bzla_bv_not(mm, bv), undo);
     }
     /* cleanup */
     for (j = 0; j < cur->arity; j++) bzla_bv_free(mm, e[j]);
   }
-  *time_update_cone_model_gen += bzla_util_time_stamp() - delta;
+  now = bzla_util_time_stamp();
+  *time_update_cone_model_gen += now - delta;
+  delta = now;
 
   /* update score of cone ------------------------------------------------- */
 
   if (score)
   {
-    delta = bzla_util_time_stamp();
     for (i = 0; i < BZLA_COUNT_STACK(cone); i++)
     {
       cur = BZLA_PEEK_STACK(cone, i);
       assert(bzla_node_is_regular(cur));
 
-      if (bzla_node_bv_get_width(bzla, cur) != 1) continue;
+      if (!bzla_node_is_bv(bzla, cur) || bzla_node_bv_get_width(bzla, cur) != 1)
+        continue;
 
       id = bzla_node_get_id(cur);
       if (!bzla_hashint_map_contains(score, id))
@@ -335,24 +418,33 @@ bzla_lsutils_update_cone(Bzla *bzla,
         assert(!bzla_hashint_map_contains(score, -id));
         continue;
       }
-      bzla_hashint_map_get(score, id)->as_dbl =
-          bzla_slsutils_compute_score_node(
-              bzla, bv_model, bzla->fun_model, score, cur);
-      assert(bzla_hashint_map_contains(score, -id));
-      bzla_hashint_map_get(score, -id)->as_dbl =
-          bzla_slsutils_compute_score_node(
-              bzla, bv_model, bzla->fun_model, score, bzla_node_invert(cur));
+      set_score(score,
+                id,
+                bzla_slsutils_compute_score_node(
+                    bzla, bv_model, bzla->fun_model, score, cur),
+                undo);
+      set_score(score,
+                -id,
+                bzla_slsutils_compute_score_node(bzla,
+                                                 bv_model,
+                                                 bzla->fun_model,
+                                                 score,
+                                                 bzla_node_invert(cur)),
+                undo);
     }
-    *time_update_cone_compute_score += bzla_util_time_stamp() - delta;
+    now = bzla_util_time_stamp();
+    *time_update_cone_compute_score += now - delta;
   }
 
   BZLA_RELEASE_STACK(cone);
 
 #ifndef NDEBUG
+  /* 'roots' is not consistent with a tentative move until it is undone */
+  check_roots = update_roots || !undo;
   bzla_iter_hashptr_init(&pit, bzla->unsynthesized_constraints);
   bzla_iter_hashptr_queue(&pit, bzla->synthesized_constraints);
   bzla_iter_hashptr_queue(&pit, bzla->assumptions);
-  while (bzla_iter_hashptr_has_next(&pit))
+  while (check_roots && bzla_iter_hashptr_has_next(&pit))
   {
     root = bzla_iter_hashptr_next(&pit);
     if (bzla_bv_is_false(bzla_model_get_bv(bzla, root)))
@@ -361,19 +453,323 @@ bzla_lsutils_update_cone(Bzla *bzla,
       assert(!bzla_hashint_map_contains(roots, bzla_node_get_id(root)));
   }
 #endif
-  *time_update_cone += bzla_util_time_stamp() - start;
+  *time_update_cone += now - start;
+}
+
+void
+bzla_lsutils_undo(Bzla *bzla,
+                  BzlaIntHashTable *bv_model,
+                  BzlaIntHashTable *score,
+                  BzlaLsUndoEntryStack *undo)
+{
+  assert(bzla);
+  assert(bv_model);
+  assert(undo);
+
+  BzlaLsUndoEntry e;
+  BzlaHashTableData *d, data;
+
+  while (!BZLA_EMPTY_STACK(*undo))
+  {
+    e = BZLA_POP_STACK(*undo);
+    if (e.is_score)
+    {
+      assert(score);
+      assert(bzla_hashint_map_contains(score, e.id));
+      bzla_hashint_map_get(score, e.id)->as_dbl = e.score;
+    }
+    else if (e.bv)
+    {
+      d = bzla_hashint_map_get(bv_model, e.id);
+      assert(d);
+      bzla_bv_free(bzla->mm, d->as_ptr);
+      d->as_ptr = e.bv;
+    }
+    else
+    {
+      /* model value was added by the cone update */
+      assert(e.id > 0);
+      bzla_hashint_map_remove(bv_model, e.id, &data);
+      bzla_bv_free(bzla->mm, data.as_ptr);
+      bzla_node_release(bzla, bzla_node_get_by_id(bzla, e.id));
+    }
+  }
+}
+
+void
+bzla_lsutils_undo_discard(Bzla *bzla, BzlaLsUndoEntryStack *undo)
+{
+  assert(bzla);
+  assert(undo);
+
+  BzlaLsUndoEntry e;
+
+  while (!BZLA_EMPTY_STACK(*undo))
+  {
+    e = BZLA_POP_STACK(*undo);
+    if (e.bv) bzla_bv_free(bzla->mm, e.bv);
+  }
+}
+
+BzlaBitVector *
+bzla_lsutils_get_bv_delta(BzlaMemMgr *mm,
+                          BzlaIntHashTable *bv_model,
+                          BzlaIntHashTable *delta_model,
+                          BzlaNode *exp)
+{
+  assert(mm);
+  assert(bv_model);
+  assert(delta_model);
+  assert(exp);
+
+  int32_t id;
+  BzlaHashTableData *d;
+
+  if (bzla_node_is_bv_const(exp))
+  {
+    return bzla_bv_copy(mm, bzla_node_bv_const_get_bits(exp));
+  }
+  id = bzla_node_real_addr(exp)->id;
+  if (!(d = bzla_hashint_map_get(delta_model, id))
+      && !(d = bzla_hashint_map_get(bv_model, id)))
+  {
+    return 0;
+  }
+  return bzla_node_is_inverted(exp) ? bzla_bv_not(mm, d->as_ptr)
+                                    : bzla_bv_copy(mm, d->as_ptr);
+}
+
+/* Compute the scores of 'exp' and its negation if 'exp' is a Boolean node
+ * reachable from the roots, i.e., if it has a score. */
+static bool
+compute_score_delta(Bzla *bzla,
+                    BzlaMemMgr *mm,
+                    BzlaIntHashTable *bv_model,
+                    BzlaIntHashTable *score,
+                    BzlaIntHashTable *delta_model,
+                    BzlaIntHashTable *delta_score,
+                    BzlaLsUndoEntryStack *score_log,
+                    BzlaNode *exp)
+{
+  double sc;
+
+  if (!bzla_node_is_bv(bzla, exp) || bzla_node_bv_get_width(bzla, exp) != 1
+      || !bzla_hashint_map_contains(score, exp->id))
+  {
+    return true;
+  }
+  if (!bzla_slsutils_compute_score_node_delta(
+          mm, bv_model, score, delta_model, delta_score, exp, &sc))
+  {
+    return false;
+  }
+  undo_push_score(
+      score_log, exp->id, bzla_hashint_map_get(score, exp->id)->as_dbl);
+  bzla_hashint_map_add(delta_score, exp->id)->as_dbl = sc;
+  if (!bzla_slsutils_compute_score_node_delta(mm,
+                                              bv_model,
+                                              score,
+                                              delta_model,
+                                              delta_score,
+                                              bzla_node_invert(exp),
+                                              &sc))
+  {
+    return false;
+  }
+  assert(bzla_hashint_map_contains(score, -exp->id));
+  undo_push_score(
+      score_log, -exp->id, bzla_hashint_map_get(score, -exp->id)->as_dbl);
+  bzla_hashint_map_add(delta_score, -exp->id)->as_dbl = sc;
+  return true;
+}
+
+bool
+bzla_lsutils_compute_cone_delta(Bzla *bzla,
+                                BzlaMemMgr *mm,
+                                BzlaIntHashTable *bv_model,
+                                BzlaIntHashTable *score,
+                                BzlaIntHashTable *exps,
+                                BzlaIntHashTable *delta_model,
+                                BzlaIntHashTable *delta_score,
+                                BzlaLsUndoEntryStack *score_log,
+                                uint64_t *stats_updates)
+{
+  assert(bzla);
+  assert(mm);
+  assert(bv_model);
+  assert(score);
+  assert(exps);
+  assert(exps->count);
+  assert(delta_model);
+  assert(!delta_model->count);
+  assert(delta_score);
+  assert(!delta_score->count);
+  assert(score_log);
+  assert(BZLA_EMPTY_STACK(*score_log));
+  assert(stats_updates);
+
+  bool res;
+  uint32_t i, j;
+  BzlaNode *exp, *cur;
+  BzlaNodeIterator nit;
+  BzlaIntHashTableIterator iit;
+  BzlaNodePtrStack stack, cone;
+  BzlaIntHashTable *cache;
+  BzlaBitVector *e[BZLA_NODE_MAX_CHILDREN];
+
+  res = true;
+
+  /* collect cone, see bzla_lsutils_update_cone */
+  BZLA_INIT_STACK(mm, cone);
+  BZLA_INIT_STACK(mm, stack);
+  bzla_iter_hashint_init(&iit, exps);
+  while (bzla_iter_hashint_has_next(&iit))
+  {
+    exp = bzla_node_get_by_id(bzla, bzla_iter_hashint_next(&iit));
+    assert(bzla_node_is_regular(exp));
+    assert(bzla_lsutils_is_leaf_node(exp));
+    BZLA_PUSH_STACK(stack, exp);
+  }
+  cache = bzla_hashint_table_new(mm);
+  while (!BZLA_EMPTY_STACK(stack))
+  {
+    cur = BZLA_POP_STACK(stack);
+    assert(bzla_node_is_regular(cur));
+
+    if (bzla_node_is_fun(cur) || bzla_node_is_args(cur) || cur->parameterized)
+      continue;
+
+    if (bzla_hashint_table_contains(cache, cur->id)) continue;
+    bzla_hashint_table_add(cache, cur->id);
+    if (!bzla_hashint_table_contains(exps, cur->id)) BZLA_PUSH_STACK(cone, cur);
+    *stats_updates += 1;
+
+    bzla_iter_parent_init(&nit, cur);
+    while (bzla_iter_parent_has_next(&nit))
+      BZLA_PUSH_STACK(stack, bzla_iter_parent_next(&nit));
+  }
+  BZLA_RELEASE_STACK(stack);
+  bzla_hashint_table_delete(cache);
+
+  qsort(cone.start,
+        BZLA_COUNT_STACK(cone),
+        sizeof(BzlaNode *),
+        bzla_node_compare_by_id_qsort_asc);
+
+  /* model values */
+  bzla_iter_hashint_init(&iit, exps);
+  while (bzla_iter_hashint_has_next(&iit))
+  {
+    e[0] = exps->data[iit.cur_pos].as_ptr;
+    exp  = bzla_node_get_by_id(bzla, bzla_iter_hashint_next(&iit));
+    /* floating-point and rounding mode values are normalized via SymFPU,
+     * see bzla_lsutils_fp_normalize_value */
+    if (bzla_node_is_fp(bzla, exp) || bzla_node_is_rm(bzla, exp))
+    {
+      res = false;
+      goto DONE;
+    }
+    bzla_hashint_map_add(delta_model, exp->id)->as_ptr = bzla_bv_copy(mm, e[0]);
+  }
+  for (i = 0; i < BZLA_COUNT_STACK(cone); i++)
+  {
+    cur = BZLA_PEEK_STACK(cone, i);
+    /* floating-point operations are evaluated via SymFPU, which is not
+     * thread-safe */
+    if (bzla_lsutils_is_fp_op(cur))
+    {
+      res = false;
+      goto DONE;
+    }
+    for (j = 0; j < cur->arity; j++)
+    {
+      e[j] = bzla_lsutils_get_bv_delta(mm, bv_model, delta_model, cur->e[j]);
+      if (!e[j])
+      {
+        /* children outside of the cone without model value, these are
+         * computed on demand by bzla_lsutils_update_cone */
+        while (j > 0) bzla_bv_free(mm, e[--j]);
+        res = false;
+        goto DONE;
+      }
+    }
+    bzla_hashint_map_add(delta_model, cur->id)->as_ptr =
+        eval_bv_node(mm, cur, e);
+    for (j = 0; j < cur->arity; j++) bzla_bv_free(mm, e[j]);
+  }
+
+  /* scores */
+  bzla_iter_hashint_init(&iit, exps);
+  while (res && bzla_iter_hashint_has_next(&iit))
+  {
+    exp = bzla_node_get_by_id(bzla, bzla_iter_hashint_next(&iit));
+    res = compute_score_delta(
+        bzla, mm, bv_model, score, delta_model, delta_score, score_log, exp);
+  }
+  for (i = 0; res && i < BZLA_COUNT_STACK(cone); i++)
+  {
+    res = compute_score_delta(bzla,
+                              mm,
+                              bv_model,
+                              score,
+                              delta_model,
+                              delta_score,
+                              score_log,
+                              BZLA_PEEK_STACK(cone, i));
+  }
+
+DONE:
+  BZLA_RELEASE_STACK(cone);
+  return res;
+}
+
+void
+bzla_lsutils_delta_reset(BzlaMemMgr *mm,
+                         BzlaIntHashTable *delta_model,
+                         BzlaIntHashTable *delta_score,
+                         BzlaLsUndoEntryStack *score_log)
+{
+  assert(mm);
+  assert(delta_model);
+  assert(delta_score);
+  assert(score_log);
+
+  BzlaIntHashTableIterator iit;
+
+  bzla_iter_hashint_init(&iit, delta_model);
+  while (bzla_iter_hashint_has_next(&iit))
+    bzla_bv_free(mm, bzla_iter_hashint_next_data(&iit)->as_ptr);
+  bzla_hashint_map_clear(delta_model);
+  bzla_hashint_map_clear(delta_score);
+  BZLA_RESET_STACK(*score_log);
 }
 
 bool
 bzla_lsutils_is_leaf_node(BzlaNode *n)
 {
   assert(n);
-  return bzla_node_is_bv_var(n) || bzla_node_is_apply(n)
+  return bzla_node_is_bv_var(n) || bzla_node_is_fp_var(n)
+         || bzla_node_is_rm_var(n) || bzla_node_is_apply(n)
          || bzla_node_is_fun_eq(n) || bzla_node_is_quantifier(n);
 }
 
+uint32_t
+bzla_lsutils_get_bv_width(Bzla *bzla, const BzlaNode *n)
+{
+  assert(bzla);
+  assert(n);
+
+  if (bzla_node_is_rm(bzla, n)) return BZLA_RM_BW;
+  if (bzla_node_is_fp(bzla, n))
+  {
+    return bzla_sort_fp_get_bv_width(bzla, bzla_node_get_sort_id(n));
+  }
+  return bzla_node_bv_get_width(bzla, n);
+}
+
 /**
- * Initialize model values for inputs (var, apply, feq) based on previous
+ * Initialize model values for inputs (var, apply, feq, fp and rm var) based
+ * on previous
  * model or zero-initialize if no previous model exists.
  */
 void
@@ -405,7 +801,7 @@ bzla_lsutils_initialize_bv_model(BzlaSolver *slv)
       }
       else
       {
-        cur_value = bzla_bv_zero(mm, bzla_node_bv_get_width(bzla, cur));
+        cur_value = bzla_bv_zero(mm, bzla_lsutils_get_bv_width(bzla, cur));
       }
 #ifndef NBZLALOG
       char *bits = bzla_bv_to_char(mm, cur_value);
@@ -420,3 +816,252 @@ bzla_lsutils_initialize_bv_model(BzlaSolver *slv)
   bzla_model_delete_bv(bzla, &bzla->bv_model);
   bzla->bv_model = bv_model;
 }
+
+/* -------------------------------------------------------------------------- */
+
+bool
+bzla_lsutils_is_fp_op(const BzlaNode *n)
+{
+  assert(n);
+
+  switch (bzla_node_real_addr(n)->kind)
+  {
+    case BZLA_FP_CONST_NODE:
+    case BZLA_RM_CONST_NODE:
+    case BZLA_RM_EQ_NODE:
+    case BZLA_FP_ABS_NODE:
+    case BZLA_FP_IS_INF_NODE:
+    case BZLA_FP_IS_NAN_NODE:
+    case BZLA_FP_IS_NEG_NODE:
+    case BZLA_FP_IS_NORM_NODE:
+    case BZLA_FP_IS_POS_NODE:
+    case BZLA_FP_IS_SUBNORM_NODE:
+    case BZLA_FP_IS_ZERO_NODE:
+    case BZLA_FP_NEG_NODE:
+    case BZLA_FP_TO_FP_BV_NODE:
+    case BZLA_FP_EQ_NODE:
+    case BZLA_FP_LTE_NODE:
+    case BZLA_FP_LT_NODE:
+    case BZLA_FP_MIN_NODE:
+    case BZLA_FP_MAX_NODE:
+    case BZLA_FP_SQRT_NODE:
+    case BZLA_FP_REM_NODE:
+    case BZLA_FP_RTI_NODE:
+    case BZLA_FP_TO_SBV_NODE:
+    case BZLA_FP_TO_UBV_NODE:
+    case BZLA_FP_TO_FP_FP_NODE:
+    case BZLA_FP_TO_FP_SBV_NODE:
+    case BZLA_FP_TO_FP_UBV_NODE:
+    case BZLA_FP_ADD_NODE:
+    case BZLA_FP_MUL_NODE:
+    case BZLA_FP_DIV_NODE:
+    case BZLA_FP_FMA_NODE: return true;
+    default: return false;
+  }
+}
+
+bool
+bzla_lsutils_fp_supported(Bzla *bzla)
+{
+  assert(bzla);
+
+  /* Operators without a native value function in BzlaFloatingPoint. These
+   * are handled via word-blasting by the fun solver. */
+  return bzla->ops[BZLA_FP_MIN_NODE].cur == 0
+         && bzla->ops[BZLA_FP_MAX_NODE].cur == 0
+         && bzla->ops[BZLA_FP_TO_SBV_NODE].cur == 0
+         && bzla->ops[BZLA_FP_TO_UBV_NODE].cur == 0
+         && bzla->ops[BZLA_FP_FMA_NODE].cur == 0;
+}
+
+BzlaBitVector *
+bzla_lsutils_fp_eval(Bzla *bzla, BzlaNode *n, BzlaBitVector *e[])
+{
+  assert(bzla);
+  assert(n);
+  assert(bzla_node_is_regular(n));
+  assert(bzla_lsutils_is_fp_op(n));
+  assert(n->arity <= 3);
+
+  uint32_t i;
+  bool bres = false;
+  BzlaSortId sort;
+  BzlaRoundingMode rm = BZLA_RM_RNE;
+  BzlaFloatingPoint *fp[3] = {0, 0, 0}, *fpres = 0;
+  BzlaBitVector *res;
+  BzlaMemMgr *mm;
+
+  mm = bzla->mm;
+
+  for (i = 0; i < n->arity; i++)
+  {
+    if (bzla_node_is_rm(bzla, n->e[i]))
+    {
+      rm = bzla_rm_from_bv(e[i]);
+    }
+    else if (bzla_node_is_fp(bzla, n->e[i]))
+    {
+      fp[i] = bzla_fp_from_bv(bzla, bzla_node_get_sort_id(n->e[i]), e[i]);
+    }
+  }
+  sort = bzla_node_get_sort_id(n);
+
+  switch (n->kind)
+  {
+    case BZLA_FP_CONST_NODE:
+      fpres = bzla_fp_copy(bzla, bzla_node_fp_const_get_fp(n));
+      break;
+    case BZLA_RM_CONST_NODE:
+      return bzla_bv_uint64_to_bv(
+          mm, bzla_node_rm_const_get_rm(n), BZLA_RM_BW);
+    case BZLA_RM_EQ_NODE: return bzla_bv_eq(mm, e[0], e[1]);
+    case BZLA_FP_IS_INF_NODE: bres = bzla_fp_is_inf(bzla, fp[0]); break;
+    case BZLA_FP_IS_NAN_NODE: bres = bzla_fp_is_nan(bzla, fp[0]); break;
+    case BZLA_FP_IS_NEG_NODE: bres = bzla_fp_is_neg(bzla, fp[0]); break;
+    case BZLA_FP_IS_NORM_NODE: bres = bzla_fp_is_normal(bzla, fp[0]); break;
+    case BZLA_FP_IS_POS_NODE: bres = bzla_fp_is_pos(bzla, fp[0]); break;
+    case BZLA_FP_IS_SUBNORM_NODE:
+      bres = bzla_fp_is_subnormal(bzla, fp[0]);
+      break;
+    case BZLA_FP_IS_ZERO_NODE: bres = bzla_fp_is_zero(bzla, fp[0]); break;
+    case BZLA_FP_EQ_NODE: bres = bzla_fp_eq(bzla, fp[0], fp[1]); break;
+    case BZLA_FP_LTE_NODE: bres = bzla_fp_lte(bzla, fp[0], fp[1]); break;
+    case BZLA_FP_LT_NODE: bres = bzla_fp_lt(bzla, fp[0], fp[1]); break;
+    case BZLA_FP_ABS_NODE: fpres = bzla_fp_abs(bzla, fp[0]); break;
+    case BZLA_FP_NEG_NODE: fpres = bzla_fp_neg(bzla, fp[0]); break;
+    case BZLA_FP_TO_FP_BV_NODE:
+      fpres = bzla_fp_from_bv(bzla, sort, e[0]);
+      break;
+    case BZLA_FP_SQRT_NODE: fpres = bzla_fp_sqrt(bzla, rm, fp[1]); break;
+    case BZLA_FP_RTI_NODE: fpres = bzla_fp_rti(bzla, rm, fp[1]); break;
+    case BZLA_FP_REM_NODE: fpres = bzla_fp_rem(bzla, fp[0], fp[1]); break;
+    case BZLA_FP_TO_FP_FP_NODE:
+      fpres = bzla_fp_convert(bzla, sort, rm, fp[1]);
+      break;
+    case BZLA_FP_TO_FP_SBV_NODE:
+      fpres = bzla_fp_convert_from_sbv(bzla, sort, rm, e[1]);
+      break;
+    case BZLA_FP_TO_FP_UBV_NODE:
+      fpres = bzla_fp_convert_from_ubv(bzla, sort, rm, e[1]);
+      break;
+    case BZLA_FP_ADD_NODE: fpres = bzla_fp_add(bzla, rm, fp[1], fp[2]); break;
+    case BZLA_FP_MUL_NODE: fpres = bzla_fp_mul(bzla, rm, fp[1], fp[2]); break;
+    case BZLA_FP_DIV_NODE: fpres = bzla_fp_div(bzla, rm, fp[1], fp[2]); break;
+    default:
+      /* min, max, to_sbv, to_ubv and fma are rejected up front, see
+       * bzla_lsutils_fp_supported */
+      assert(false);
+  }
+
+  if (fpres)
+  {
+    res = bzla_fp_as_bv(bzla, fpres);
+    bzla_fp_free(bzla, fpres);
+  }
+  else
+  {
+    res = bres ? bzla_bv_one(mm, 1) : bzla_bv_zero(mm, 1);
+  }
+  for (i = 0; i < n->arity; i++)
+  {
+    if (fp[i]) bzla_fp_free(bzla, fp[i]);
+  }
+  return res;
+}
+
+/**
+ * Initialize model values for floating-point and rounding mode operations
+ * (and ite over these sorts) by evaluating them natively on the current
+ * assignment of the inputs. Since the bit-vector model is consulted first
+ * when generating the model, this prevents model generation from falling
+ * back to the word-blasted representation of these nodes.
+ */
+void
+bzla_lsutils_fp_normalize_value(Bzla *bzla,
+                                const BzlaNode *n,
+                                BzlaBitVector **bv)
+{
+  assert(bzla);
+  assert(n);
+  assert(bv);
+  assert(*bv);
+
+  uint64_t rm;
+  BzlaFloatingPoint *fp;
+  BzlaBitVector *res;
+
+  if (bzla_node_is_rm(bzla, n))
+  {
+    rm = bzla_bv_to_uint64(*bv);
+    if (bzla_rm_is_valid(rm)) return;
+    res = bzla_bv_uint64_to_bv(bzla->mm, rm % BZLA_RM_MAX, BZLA_RM_BW);
+  }
+  else if (bzla_node_is_fp(bzla, n))
+  {
+    /* packing an unpacked value yields the canonical NaN */
+    fp  = bzla_fp_from_bv(bzla, bzla_node_get_sort_id(n), *bv);
+    res = bzla_fp_as_bv(bzla, fp);
+    bzla_fp_free(bzla, fp);
+  }
+  else
+  {
+    return;
+  }
+  bzla_bv_free(bzla->mm, *bv);
+  *bv = res;
+}
+
+void
+bzla_lsutils_initialize_fp_model(Bzla *bzla, BzlaIntHashTable *bv_model)
+{
+  assert(bzla);
+  assert(bv_model);
+  assert(bzla->fun_model);
+
+  size_t i;
+  uint32_t j;
+  BzlaNode *cur;
+  BzlaBitVector *e[BZLA_NODE_MAX_CHILDREN], *bv;
+  BzlaMemMgr *mm;
+
+  mm = bzla->mm;
+
+  /* children always have a smaller id than their parents, traversing the
+   * node table in ascending id order thus yields a valid evaluation order */
+  for (i = 1; i < BZLA_COUNT_STACK(bzla->nodes_id_table); ++i)
+  {
+    cur = BZLA_PEEK_STACK(bzla->nodes_id_table, i);
+    if (!cur || cur->parameterized || bzla_node_is_proxy(cur)
+        || bzla_hashint_map_contains(bv_model, cur->id))
+      continue;
+
+    if (bzla_lsutils_is_fp_op(cur))
+    {
+      for (j = 0; j < cur->arity; j++)
+      {
+        e[j] = bzla_model_recursively_compute_assignment(
+            bzla, bv_model, bzla->fun_model, cur->e[j]);
+      }
+      bv = bzla_lsutils_fp_eval(bzla, cur, e);
+    }
+    else if (bzla_node_is_cond(cur)
+             && (bzla_node_is_fp(bzla, cur) || bzla_node_is_rm(bzla, cur)))
+    {
+      for (j = 0; j < cur->arity; j++)
+      {
+        e[j] = bzla_model_recursively_compute_assignment(
+            bzla, bv_model, bzla->fun_model, cur->e[j]);
+      }
+      bv = bzla_bv_is_true(e[0]) ? bzla_bv_copy(mm, e[1])
+                                 : bzla_bv_copy(mm, e[2]);
+    }
+    else
+    {
+      continue;
+    }
+
+    bzla_model_add_to_bv(bzla, bv_model, cur, bv);
+    bzla_bv_free(mm, bv);
+    for (j = 0; j < cur->arity; j++) bzla_bv_free(mm, e[j]);
+  }
+}
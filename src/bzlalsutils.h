@@ -11,9 +11,26 @@
 #ifndef BZLALSUTILS_H_INCLUDED
 #define BZLALSUTILS_H_INCLUDED
 
+#include "bzlabv.h"
 #include "bzlaslv.h"
 #include "bzlatypes.h"
 #include "utils/bzlahashint.h"
+#include "utils/bzlastack.h"
+
+/**
+ * Entry of the undo log of bzla_lsutils_update_cone, records the previous
+ * model value or score of a node.
+ */
+struct BzlaLsUndoEntry
+{
+  int32_t id;        /* node id, negative ids denote inverted nodes */
+  bool is_score;     /* score (true) or model value (false) entry */
+  BzlaBitVector* bv; /* previous model value, 0 if there was none */
+  double score;      /* previous score */
+};
+typedef struct BzlaLsUndoEntry BzlaLsUndoEntry;
+
+BZLA_DECLARE_STACK(BzlaLsUndoEntry, BzlaLsUndoEntry);
 
 /**
  * Update cone of incluence as a consequence of a local search move.
@@ -22,6 +39,12 @@
  *         + PROP engine: always
  *         + SLS  engine: only if an actual move is performed
  *                        (not during neighborhood exploration, 'try_move')
+ *
+ * If 'undo' is given, all overwritten model values and scores are recorded
+ * in 'undo' such that a tentative move can be reverted with
+ * bzla_lsutils_undo in time proportional to the size of its cone. Changes of
+ * 'roots' are not recorded, hence a move that is undone requires that
+ * 'update_roots' is false.
  */
 void bzla_lsutils_update_cone(Bzla* bzla,
                               BzlaIntHashTable* bv_model,
@@ -29,14 +52,111 @@ void bzla_lsutils_update_cone(Bzla* bzla,
                               BzlaIntHashTable* score,
                               BzlaIntHashTable* exps,
                               bool update_roots,
+                              BzlaLsUndoEntryStack* undo,
                               uint64_t* stats_updates,
                               double* time_update_cone,
                               double* time_update_cone_reset,
                               double* time_update_cone_model_gen,
                               double* time_update_cone_compute_score);
 
+/**
+ * Revert all changes of 'bv_model' and 'score' recorded in 'undo' by
+ * bzla_lsutils_update_cone. Leaves 'undo' empty.
+ */
+void bzla_lsutils_undo(Bzla* bzla,
+                       BzlaIntHashTable* bv_model,
+                       BzlaIntHashTable* score,
+                       BzlaLsUndoEntryStack* undo);
+
+/**
+ * Keep all changes recorded in 'undo' by bzla_lsutils_update_cone and release
+ * the recorded previous model values. Leaves 'undo' empty.
+ */
+void bzla_lsutils_undo_discard(Bzla* bzla, BzlaLsUndoEntryStack* undo);
+
+/**
+ * Compute the model values and scores of the cone of influence of 'exps' as
+ * bzla_lsutils_update_cone, but without modifying 'bv_model' and 'score'.
+ * All changed values and scores are stored in 'delta_model' and
+ * 'delta_score' (both empty initially), temporary and delta values are
+ * allocated via 'mm'. The previous scores of all nodes with recomputed score
+ * are recorded in 'score_log' (empty initially) in the same order as in the
+ * undo log of bzla_lsutils_update_cone. Since no shared state is modified,
+ * concurrent calls are safe as long as each thread uses its own memory
+ * manager, delta maps and log.
+ *
+ * Returns false if the cone can not be evaluated this way, i.e., if it
+ * contains floating-point operations or requires model values of nodes
+ * outside of the cone that are not yet in 'bv_model'. The deltas are
+ * incomplete in that case.
+ */
+bool bzla_lsutils_compute_cone_delta(Bzla* bzla,
+                                     BzlaMemMgr* mm,
+                                     BzlaIntHashTable* bv_model,
+                                     BzlaIntHashTable* score,
+                                     BzlaIntHashTable* exps,
+                                     BzlaIntHashTable* delta_model,
+                                     BzlaIntHashTable* delta_score,
+                                     BzlaLsUndoEntryStack* score_log,
+                                     uint64_t* stats_updates);
+
+/**
+ * Clear the deltas and the log computed by bzla_lsutils_compute_cone_delta
+ * and release the model values in 'delta_model'.
+ */
+void bzla_lsutils_delta_reset(BzlaMemMgr* mm,
+                              BzlaIntHashTable* delta_model,
+                              BzlaIntHashTable* delta_score,
+                              BzlaLsUndoEntryStack* score_log);
+
+/**
+ * Get a copy (allocated via 'mm') of the model value of 'exp', looked up in
+ * 'delta_model' first and in 'bv_model' otherwise. Returns 0 if 'exp' has no
+ * model value.
+ */
+BzlaBitVector* bzla_lsutils_get_bv_delta(BzlaMemMgr* mm,
+                                         BzlaIntHashTable* bv_model,
+                                         BzlaIntHashTable* delta_model,
+                                         BzlaNode* exp);
+
 bool bzla_lsutils_is_leaf_node(BzlaNode* n);
 
+/**
+ * Get the bit-width of the model value of given node. Floating-point and
+ * rounding mode nodes are represented by their IEEE-754 bit-vector value.
+ */
+uint32_t bzla_lsutils_get_bv_width(Bzla* bzla, const BzlaNode* n);
+
 void bzla_lsutils_initialize_bv_model(BzlaSolver* slv);
 
+/** Return true if given node is a floating-point or rounding mode operation. */
+bool bzla_lsutils_is_fp_op(const BzlaNode* n);
+
+/**
+ * Return true if all floating-point operators in the current formula can be
+ * evaluated natively (without word-blasting) by the local search engines.
+ */
+bool bzla_lsutils_fp_supported(Bzla* bzla);
+
+/**
+ * Evaluate floating-point or rounding mode operation 'n' on the given
+ * children values 'e'. Returns a new bit-vector.
+ */
+BzlaBitVector* bzla_lsutils_fp_eval(Bzla* bzla,
+                                    BzlaNode* n,
+                                    BzlaBitVector* e[]);
+
+/**
+ * Normalize value 'bv' of floating-point or rounding mode input 'n' in place.
+ * All NaNs are equal in SMT-LIB, and operands are compared bit-wise, hence
+ * NaN values are replaced with the canonical NaN. Invalid rounding mode
+ * values are mapped to a valid rounding mode. Values of other nodes are left
+ * unchanged. Not thread-safe (uses SymFPU).
+ */
+void bzla_lsutils_fp_normalize_value(Bzla* bzla,
+                                     const BzlaNode* n,
+                                     BzlaBitVector** bv);
+
+void bzla_lsutils_initialize_fp_model(Bzla* bzla, BzlaIntHashTable* bv_model);
+
 #endif
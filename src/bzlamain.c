@@ -35,11 +35,16 @@ typedef struct BitwuzlaMainApp BitwuzlaMainApp;
 static BitwuzlaMainApp *g_app;
 
 static double g_start_time_real;
+static double g_start_time_wall;
 static uint32_t g_verbosity;
 static uint32_t g_set_alarm;
 
 #ifdef BZLA_HAVE_SIGNALS
 static bool g_caught_sig;
+/* Set from the signal and alarm handlers if --stats-json is given, the
+ * solver is then terminated via the termination callback and the JSON
+ * statistics are written on the regular exit path. */
+static volatile sig_atomic_t g_terminate;
 
 static void (*sig_int_handler)(int32_t);
 static void (*sig_segv_handler)(int32_t);
@@ -60,6 +65,7 @@ static BitwuzlaOption bitwuzla_options[BZLA_OPT_NUM_OPTS] = {
     [BZLA_OPT_AIGPROP_NPROPS]          = BITWUZLA_OPT_AIGPROP_NPROPS,
     [BZLA_OPT_AIGPROP_USE_BANDIT]      = BITWUZLA_OPT_AIGPROP_USE_BANDIT,
     [BZLA_OPT_AIGPROP_USE_RESTARTS]    = BITWUZLA_OPT_AIGPROP_USE_RESTARTS,
+    [BZLA_OPT_BMC_KMAX]                = BITWUZLA_OPT_BMC_KMAX,
     [BZLA_OPT_CHECK_MODEL]             = BITWUZLA_OPT_CHECK_MODEL,
     [BZLA_OPT_CHECK_UNCONSTRAINED]     = BITWUZLA_OPT_CHECK_UNCONSTRAINED,
     [BZLA_OPT_CHECK_UNSAT_ASSUMPTIONS] = BITWUZLA_OPT_CHECK_UNSAT_ASSUMPTIONS,
@@ -74,15 +80,18 @@ static BitwuzlaOption bitwuzla_options[BZLA_OPT_NUM_OPTS] = {
     [BZLA_OPT_FUN_LAZY_SYNTHESIZE]     = BITWUZLA_OPT_FUN_LAZY_SYNTHESIZE,
     [BZLA_OPT_FUN_PREPROP]             = BITWUZLA_OPT_FUN_PREPROP,
     [BZLA_OPT_FUN_PRESLS]              = BITWUZLA_OPT_FUN_PRESLS,
+    [BZLA_OPT_FUN_SAT_PHASES]          = BITWUZLA_OPT_FUN_SAT_PHASES,
     [BZLA_OPT_FUN_STORE_LAMBDAS]       = BITWUZLA_OPT_FUN_STORE_LAMBDAS,
     [BZLA_OPT_INCREMENTAL]             = BITWUZLA_OPT_INCREMENTAL,
     [BZLA_OPT_INPUT_FORMAT]            = BITWUZLA_OPT_INPUT_FORMAT,
     [BZLA_OPT_LOGLEVEL]                = BITWUZLA_OPT_LOGLEVEL,
+    [BZLA_OPT_LS_SHARE_CONST_BITS]     = BITWUZLA_OPT_LS_SHARE_CONST_BITS,
     [BZLA_OPT_LS_SHARE_SAT]            = BITWUZLA_OPT_LS_SHARE_SAT,
     [BZLA_OPT_OUTPUT_FORMAT]           = BITWUZLA_OPT_OUTPUT_FORMAT,
     [BZLA_OPT_OUTPUT_NUMBER_FORMAT]    = BITWUZLA_OPT_OUTPUT_NUMBER_FORMAT,
     [BZLA_OPT_PARSE_INTERACTIVE]       = BITWUZLA_OPT_PARSE_INTERACTIVE,
     [BZLA_OPT_PP_ACKERMANN]            = BITWUZLA_OPT_PP_ACKERMANN,
+    [BZLA_OPT_PP_ACKERMANN_SPARSE]     = BITWUZLA_OPT_PP_ACKERMANN_SPARSE,
     [BZLA_OPT_PP_BETA_REDUCE]          = BITWUZLA_OPT_PP_BETA_REDUCE,
     [BZLA_OPT_PP_ELIMINATE_EXTRACTS]   = BITWUZLA_OPT_PP_ELIMINATE_EXTRACTS,
     [BZLA_OPT_PP_ELIMINATE_ITES]       = BITWUZLA_OPT_PP_ELIMINATE_ITES,
@@ -93,14 +102,15 @@ static BitwuzlaOption bitwuzla_options[BZLA_OPT_NUM_OPTS] = {
     [BZLA_OPT_PP_SKELETON_PREPROC]     = BITWUZLA_OPT_PP_SKELETON_PREPROC,
     [BZLA_OPT_PP_UNCONSTRAINED_OPTIMIZATION] =
         BITWUZLA_OPT_PP_UNCONSTRAINED_OPTIMIZATION,
-    [BZLA_OPT_PP_VAR_SUBST]        = BITWUZLA_OPT_PP_VAR_SUBST,
-    [BZLA_OPT_PRETTY_PRINT]        = BITWUZLA_OPT_PRETTY_PRINT,
-    [BZLA_OPT_PRINT_DIMACS]        = BITWUZLA_OPT_PRINT_DIMACS,
-    [BZLA_OPT_PRODUCE_MODELS]      = BITWUZLA_OPT_PRODUCE_MODELS,
-    [BZLA_OPT_PRODUCE_UNSAT_CORES] = BITWUZLA_OPT_PRODUCE_UNSAT_CORES,
-    [BZLA_OPT_PROP_CONST_BITS]     = BITWUZLA_OPT_PROP_CONST_BITS,
-    [BZLA_OPT_PROP_CONST_DOMAINS]  = BITWUZLA_OPT_PROP_CONST_DOMAINS,
-    [BZLA_OPT_PROP_ENTAILED]       = BITWUZLA_OPT_PROP_ENTAILED,
+    [BZLA_OPT_PP_VAR_SUBST]             = BITWUZLA_OPT_PP_VAR_SUBST,
+    [BZLA_OPT_PRETTY_PRINT]             = BITWUZLA_OPT_PRETTY_PRINT,
+    [BZLA_OPT_PRINT_DIMACS]             = BITWUZLA_OPT_PRINT_DIMACS,
+    [BZLA_OPT_PRODUCE_MODELS]           = BITWUZLA_OPT_PRODUCE_MODELS,
+    [BZLA_OPT_PRODUCE_UNSAT_CORES]      = BITWUZLA_OPT_PRODUCE_UNSAT_CORES,
+    [BZLA_OPT_PROP_CONST_BITS]          = BITWUZLA_OPT_PROP_CONST_BITS,
+    [BZLA_OPT_PROP_CONST_DOMAINS]       = BITWUZLA_OPT_PROP_CONST_DOMAINS,
+    [BZLA_OPT_PROP_CONST_DOMAINS_LIMIT] = BITWUZLA_OPT_PROP_CONST_DOMAINS_LIMIT,
+    [BZLA_OPT_PROP_ENTAILED]            = BITWUZLA_OPT_PROP_ENTAILED,
     [BZLA_OPT_PROP_FLIP_COND_CONST_DELTA] =
         BITWUZLA_OPT_PROP_FLIP_COND_CONST_DELTA,
     [BZLA_OPT_PROP_FLIP_COND_CONST_NPATHSEL] =
@@ -130,9 +140,11 @@ static BitwuzlaOption bitwuzla_options[BZLA_OPT_NUM_OPTS] = {
     [BZLA_OPT_PROP_XOR]                = BITWUZLA_OPT_PROP_XOR,
     [BZLA_OPT_QUANT_SYNTH_SK]          = BITWUZLA_OPT_QUANT_SYNTH_SK,
     [BZLA_OPT_QUANT_SYNTH_QI]          = BITWUZLA_OPT_QUANT_SYNTH_QI,
+    [BZLA_OPT_QUANT_SYNTH_N_THREADS]   = BITWUZLA_OPT_QUANT_SYNTH_N_THREADS,
     [BZLA_OPT_QUANT_SKOLEM_UF]         = BITWUZLA_OPT_QUANT_SKOLEM_UF,
     [BZLA_OPT_QUANT_EAGER_SKOLEM]      = BITWUZLA_OPT_QUANT_EAGER_SKOLEM,
     [BZLA_OPT_QUANT_MBQI]              = BITWUZLA_OPT_QUANT_MBQI,
+    [BZLA_OPT_QUANT_CE_N_THREADS]      = BITWUZLA_OPT_QUANT_CE_N_THREADS,
     [BZLA_OPT_QUANT_MODE]              = BITWUZLA_OPT_QUANT_MODE,
     [BZLA_OPT_RW_EXTRACT_ARITH]        = BITWUZLA_OPT_RW_EXTRACT_ARITH,
     [BZLA_OPT_RW_LEVEL]                = BITWUZLA_OPT_RW_LEVEL,
@@ -162,6 +174,7 @@ static BitwuzlaOption bitwuzla_options[BZLA_OPT_NUM_OPTS] = {
     [BZLA_OPT_SLS_MOVE_RANGE]          = BITWUZLA_OPT_SLS_MOVE_RANGE,
     [BZLA_OPT_SLS_MOVE_SEGMENT]        = BITWUZLA_OPT_SLS_MOVE_SEGMENT,
     [BZLA_OPT_SLS_NFLIPS]              = BITWUZLA_OPT_SLS_NFLIPS,
+    [BZLA_OPT_SLS_N_THREADS]           = BITWUZLA_OPT_SLS_N_THREADS,
     [BZLA_OPT_SLS_PROB_MOVE_RAND_WALK] = BITWUZLA_OPT_SLS_PROB_MOVE_RAND_WALK,
     [BZLA_OPT_SLS_STRATEGY]            = BITWUZLA_OPT_SLS_STRATEGY,
     [BZLA_OPT_SLS_USE_BANDIT]          = BITWUZLA_OPT_SLS_USE_BANDIT,
@@ -180,6 +193,7 @@ enum BitwuzlaMainOption
   BZLAMAIN_OPT_VERSION,
   BZLAMAIN_OPT_TIME,
   BZLAMAIN_OPT_OUTPUT,
+  BZLAMAIN_OPT_STATS_JSON,
   BZLAMAIN_OPT_LGL_NOFORK,
   BZLAMAIN_OPT_HEX,
   BZLAMAIN_OPT_DEC,
@@ -231,6 +245,7 @@ struct BitwuzlaMainApp
   FILE *outfile;
   char *outfile_name;
   bool close_outfile;
+  char *stats_json_name;
 };
 
 /*------------------------------------------------------------------------*/
@@ -352,6 +367,19 @@ bzlamain_init_opts(BitwuzlaMainApp *app)
                     false,
                     BZLA_ARG_EXPECT_STR,
                     "set output file for dumping");
+  bzlamain_init_opt(app,
+                    BZLAMAIN_OPT_STATS_JSON,
+                    true,
+                    false,
+                    "stats-json",
+                    0,
+                    0,
+                    0,
+                    0,
+                    false,
+                    BZLA_ARG_EXPECT_STR,
+                    "write time statistics, statistics and memory usage in "
+                    "JSON format to given file");
 #ifdef BZLA_USE_LINGELING
   bzlamain_init_opt(app,
                     BZLAMAIN_OPT_LGL_NOFORK,
@@ -540,6 +568,24 @@ bzlamain_print_stats(Bitwuzla *bitwuzla)
   bzla_print_stats(bitwuzla_get_bzla(bitwuzla));
 }
 
+static void
+bzlamain_print_stats_json(BitwuzlaMainApp *app)
+{
+  FILE *file;
+
+  if (!app->stats_json_name) return;
+
+  file = fopen(app->stats_json_name, "w");
+  if (!file)
+  {
+    fprintf(stderr, "bitwuzla: can not create '%s'\n", app->stats_json_name);
+    return;
+  }
+  bzla_print_stats_json(
+      app->bzla, file, bzla_util_monotonic_time() - g_start_time_wall);
+  fclose(file);
+}
+
 /*------------------------------------------------------------------------*/
 
 static BitwuzlaMainApp *
@@ -739,7 +785,7 @@ print_opt(BitwuzlaMainApp *app,
 
   if (!strcmp(lng, "time"))
     sprintf(paramstr, "<seconds>");
-  else if (!strcmp(lng, "output"))
+  else if (!strcmp(lng, "output") || !strcmp(lng, "stats-json"))
     sprintf(paramstr, "<file>");
   else if (!strcmp(lng, bzla_opt_get_lng(app->bzla, BZLA_OPT_ENGINE))
            || !strcmp(lng, bzla_opt_get_lng(app->bzla, BZLA_OPT_SAT_ENGINE)))
@@ -988,7 +1034,7 @@ print_static_stats(int32_t sat_res)
 {
 #ifdef BZLA_TIME_STATISTICS
   double real    = bzla_util_current_time() - g_start_time_real;
-  double process = bzla_util_time_stamp();
+  double process = bzla_util_process_time();
   bzlamain_msg("%.3f seconds process", process);
   bzlamain_msg("%.3f seconds real", real);
 #endif
@@ -1026,12 +1072,24 @@ reset_sig_handlers(void)
   (void) signal(SIGBUS, sig_bus_handler);
 }
 
+static int32_t
+terminate_main(void *state)
+{
+  (void) state;
+  return g_terminate;
+}
+
 static void
 catch_sig(int32_t sig)
 {
   if (!g_caught_sig)
   {
     g_caught_sig = true;
+    if (g_app->stats_json_name && (sig == SIGINT || sig == SIGTERM))
+    {
+      g_terminate = 1;
+      return;
+    }
     if (g_verbosity > 0)
     {
       bzlamain_print_stats(g_app->bitwuzla);
@@ -1070,6 +1128,13 @@ catch_alarm(int32_t sig)
   if (g_set_alarm > 0)
   {
     bzlamain_msg("ALARM TRIGGERED: time limit %d seconds reached", g_set_alarm);
+    if (g_app->stats_json_name && !g_terminate)
+    {
+      /* give the solver one more second to terminate */
+      g_terminate = 1;
+      alarm(1);
+      return;
+    }
     if (g_verbosity > 0)
     {
       bzlamain_print_stats(g_app->bitwuzla);
@@ -1118,6 +1183,7 @@ bitwuzla_main(int32_t argc, char **argv)
   BzlaPtrHashBucket *b;
 
   g_start_time_real = bzla_util_current_time();
+  g_start_time_wall = bzla_util_monotonic_time();
 
   g_app    = bzlamain_new_bzlamain(bitwuzla_new());
   bitwuzla = g_app->bitwuzla;
@@ -1267,6 +1333,10 @@ bitwuzla_main(int32_t argc, char **argv)
           g_app->outfile_name = po->valstr;
           break;
 
+        case BZLAMAIN_OPT_STATS_JSON:
+          g_app->stats_json_name = po->valstr;
+          break;
+
         case BZLAMAIN_OPT_LGL_NOFORK:
           bitwuzla_set_option(bitwuzla, BITWUZLA_OPT_SAT_ENGINE_LGL_FORK, 0);
           break;
@@ -1496,6 +1566,8 @@ bitwuzla_main(int32_t argc, char **argv)
   }
 #ifdef BZLA_HAVE_SIGNALS
   set_sig_handlers();
+  if (g_app->stats_json_name)
+    bitwuzla_set_termination_callback(bitwuzla, terminate_main, 0);
 
   /* set alarm */
   if (g_set_alarm)
@@ -1605,7 +1677,7 @@ bitwuzla_main(int32_t argc, char **argv)
     }
 
 #ifdef BZLA_TIME_STATISTICS
-    if (g_verbosity) bzlamain_msg("%.1f seconds", bzla_util_time_stamp());
+    if (g_verbosity) bzlamain_msg("%.1f seconds", bzla_util_process_time());
 #endif
     goto DONE;
   }
@@ -1639,10 +1711,14 @@ bitwuzla_main(int32_t argc, char **argv)
     goto DONE;
   }
 
+  /* BTOR2 model checking problems are solved while parsing, the parser
+   * already printed the result and the witness */
+  bool bmc = !parsed_smt2 && bzla->bzla_sat_bzla_called > 0;
+
   /* call sat (if not yet called) */
-  if (parse_res == BITWUZLA_UNKNOWN && !bzla_terminate(bzla) && !parsed_smt2)
+  if (parse_res == BITWUZLA_UNKNOWN && !parsed_smt2 && !bmc)
   {
-    sat_res = bitwuzla_check_sat(bitwuzla);
+    if (!bzla_terminate(bzla)) sat_res = bitwuzla_check_sat(bitwuzla);
     print_sat_result(g_app, sat_res);
   }
   else
@@ -1666,7 +1742,7 @@ bitwuzla_main(int32_t argc, char **argv)
   }
 
   /* print model */
-  if (pmodel && sat_res == BITWUZLA_SAT)
+  if (pmodel && sat_res == BITWUZLA_SAT && !bmc)
   {
     assert(bitwuzla_get_option(bitwuzla, BITWUZLA_OPT_PRODUCE_MODELS));
     format = bitwuzla_get_option(bitwuzla, BITWUZLA_OPT_OUTPUT_FORMAT);
@@ -1693,6 +1769,8 @@ DONE:
   assert(res == BZLA_ERR_EXIT || res == BZLA_SUCC_EXIT || res == BZLA_SAT_EXIT
          || res == BZLA_UNSAT_EXIT || res == BZLA_UNKNOWN_EXIT);
 
+  if (!g_app->done) bzlamain_print_stats_json(g_app);
+
   if (g_app->close_infile == 1)
     fclose(g_app->infile);
   else if (g_app->close_infile == 2)
@@ -760,7 +760,7 @@ ensure_model(Bzla *bzla,
   BzlaNodePtrStack visit, nodes;
   BzlaIntHashTable *cache;
 
-  start = bzla_util_time_stamp();
+  start = bzla_util_monotonic_time();
   cache = bzla_hashint_table_new(bzla->mm);
   BZLA_INIT_STACK(bzla->mm, nodes);
 
@@ -794,7 +794,7 @@ ensure_model(Bzla *bzla,
       bzla, bv_model, fun_model, nodes.start, BZLA_COUNT_STACK(nodes));
 
   BZLA_RELEASE_STACK(nodes);
-  bzla->time.model_gen += bzla_util_time_stamp() - start;
+  bzla->time.model_gen += bzla_util_monotonic_time() - start;
 }
 
 /* Note: no need to free returned bit vector,
@@ -1213,7 +1213,7 @@ bzla_model_recursively_compute_assignment(Bzla *bzla,
       else if (bzla_node_is_apply(real_cur)
                && bzla_node_is_lambda(real_cur->e[0]))
       {
-        next = bzla_beta_reduce_full(bzla, real_cur, 0);
+        next = bzla_beta_reduce_full(bzla, real_cur);
         assert(!bzla_node_real_addr(next)->parameterized);
         next = bzla_node_cond_invert(cur, next);
         BZLA_PUSH_STACK(work_stack, next);
@@ -1731,7 +1731,7 @@ bzla_model_generate(Bzla *bzla,
   BzlaPtrHashTableIterator it;
   BzlaNodePtrStack roots, nodes;
 
-  start = bzla_util_time_stamp();
+  start = bzla_util_monotonic_time();
 
   BZLA_INIT_STACK(bzla->mm, nodes);
 
@@ -1773,7 +1773,7 @@ bzla_model_generate(Bzla *bzla,
     bzla_node_release(bzla, BZLA_POP_STACK(nodes));
   BZLA_RELEASE_STACK(nodes);
 
-  bzla->time.model_gen += bzla_util_time_stamp() - start;
+  bzla->time.model_gen += bzla_util_monotonic_time() - start;
 }
 
 /*------------------------------------------------------------------------*/
@@ -13,6 +13,7 @@
 #include <assert.h>
 #include <ctype.h>
 #include <limits.h>
+#include <stddef.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -40,6 +41,10 @@
   ((table).num_elements >= (table).size \
    && bzla_util_log_2((table).size) < BZLA_UNIQUE_TABLE_LIMIT)
 
+/* Number of buckets of the previous unique table that are moved to the
+ * enlarged table on every insertion. */
+#define BZLA_UNIQUE_TABLE_MIGRATE 4
+
 /*------------------------------------------------------------------------*/
 
 const char *const g_bzla_op2str[BZLA_NUM_OPS_NODE] = {
@@ -103,9 +108,28 @@ const char *const g_bzla_op2str[BZLA_NUM_OPS_NODE] = {
 
 /*------------------------------------------------------------------------*/
 
-static uint32_t hash_primes[] = {333444569u, 76891121u, 456790003u, 111130391u};
+#define BZLA_HASH_MULT 0x9e3779b97f4a7c15ull
+
+/* Combines hash value 'hash' with 'value'. */
+static inline uint64_t
+hash_add(uint64_t hash, uint64_t value)
+{
+  return (hash + value) * BZLA_HASH_MULT;
+}
 
-#define NPRIMES ((uint32_t)(sizeof hash_primes / sizeof *hash_primes))
+/* Finalizes 'hash' with the 64-bit finalizer of MurmurHash3 such that every
+ * input bit affects every output bit, i.e., the lower bits used as bucket
+ * index are well distributed even for consecutive node ids. */
+static inline uint32_t
+hash_mix(uint64_t hash)
+{
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdull;
+  hash ^= hash >> 33;
+  hash *= 0xc4ceb9fe1a85ec53ull;
+  hash ^= hash >> 33;
+  return (uint32_t) hash;
+}
 
 /*------------------------------------------------------------------------*/
 
@@ -540,7 +564,7 @@ bzla_node_copy(Bzla *bzla, BzlaNode *exp)
 static inline uint32_t
 hash_bv_fp_exp(Bzla *bzla, BzlaNodeKind kind, uint32_t arity, BzlaNode *e[])
 {
-  uint32_t hash = 0;
+  uint64_t hash;
   uint32_t i;
 #ifndef NDEBUG
   if (bzla_opt_get(bzla, BZLA_OPT_RW_SORT_EXP) > 0
@@ -549,33 +573,53 @@ hash_bv_fp_exp(Bzla *bzla, BzlaNodeKind kind, uint32_t arity, BzlaNode *e[])
         assert(bzla_node_real_addr(e[0])->id <= bzla_node_real_addr(e[1])->id);
 #else
   (void) bzla;
-  (void) kind;
 #endif
-  assert(arity <= NPRIMES);
-  for (i = 0; i < arity; i++)
-    hash += hash_primes[i] * (uint32_t) bzla_node_real_addr(e[i])->id;
-  return hash;
+  assert(arity <= BZLA_NODE_MAX_CHILDREN);
+  hash = hash_add(kind, arity);
+  /* (= (bvnot a) b) and (= a (bvnot b)) are equal (cf. find_bv_fp_exp) */
+  if (kind == BZLA_BV_EQ_NODE)
+  {
+    hash = hash_add(hash, (uint32_t) bzla_node_real_addr(e[0])->id);
+    hash = hash_add(hash, (uint32_t) bzla_node_real_addr(e[1])->id);
+    hash = hash_add(hash,
+                    bzla_node_is_inverted(e[0]) ^ bzla_node_is_inverted(e[1]));
+  }
+  else
+  {
+    for (i = 0; i < arity; i++)
+      hash = hash_add(hash, (uint32_t) bzla_node_get_id(e[i]));
+  }
+  return hash_mix(hash);
 }
 
 static inline uint32_t
 hash_slice_exp(BzlaNode *e, uint32_t upper, uint32_t lower)
 {
-  uint32_t hash;
+  uint64_t hash;
   assert(upper >= lower);
-  hash = hash_primes[0] * (uint32_t) bzla_node_real_addr(e)->id;
-  hash += hash_primes[1] * (uint32_t) upper;
-  hash += hash_primes[2] * (uint32_t) lower;
-  return hash;
+  hash = hash_add(BZLA_BV_SLICE_NODE, (uint32_t) bzla_node_get_id(e));
+  hash = hash_add(hash, upper);
+  hash = hash_add(hash, lower);
+  return hash_mix(hash);
 }
 
 static inline uint32_t
-hash_fp_conversion_exp(BzlaNode *e0, BzlaNode *e1, BzlaSortId sort)
+hash_fp_conversion_exp(BzlaNodeKind kind,
+                       BzlaNode *e0,
+                       BzlaNode *e1,
+                       BzlaSortId sort)
 {
-  uint32_t hash;
-  hash = hash_primes[0] * (uint32_t) bzla_node_real_addr(e0)->id;
-  if (e1) hash += hash_primes[1] * (uint32_t) bzla_node_real_addr(e1)->id;
-  hash += hash_primes[2] * sort;
-  return hash;
+  uint64_t hash;
+  hash = hash_add(kind, (uint32_t) bzla_node_get_id(e0));
+  if (e1) hash = hash_add(hash, (uint32_t) bzla_node_get_id(e1));
+  hash = hash_add(hash, sort);
+  return hash_mix(hash);
+}
+
+static inline uint32_t
+hash_const_exp(BzlaNodeKind kind, uint32_t value_hash)
+{
+  return hash_mix(hash_add(kind, value_hash));
 }
 
 static uint32_t
@@ -615,14 +659,14 @@ hash_binder_exp(Bzla *bzla,
      * value instead of recomputing it */
     if (bzla_node_is_lambda(real_cur))
     {
-      hash += bzla_hashptr_table_get(bzla->lambdas, real_cur)->data.as_int;
+      hash += real_cur->hash;
       hash += real_cur->kind;
       hash += real_cur->e[0]->kind;
       continue;
     }
     else if (bzla_node_is_quantifier(real_cur))
     {
-      hash += bzla_hashptr_table_get(bzla->quantifiers, real_cur)->data.as_int;
+      hash += real_cur->hash;
       hash += real_cur->kind;
       hash += real_cur->e[0]->kind;
       /* copy parameters of real_cur to params */
@@ -653,71 +697,7 @@ hash_binder_exp(Bzla *bzla,
   }
   BZLA_RELEASE_STACK(visit);
   bzla_hashint_table_delete(marked);
-  return hash;
-}
-
-/* Computes hash value of expresssion by children ids */
-static uint32_t
-compute_hash_exp(Bzla *bzla, BzlaNode *exp, uint32_t table_size)
-{
-  assert(exp);
-  assert(table_size > 0);
-  assert(bzla_util_is_power_of_2(table_size));
-  assert(bzla_node_is_regular(exp));
-  assert(!bzla_node_is_var(exp));
-  assert(!bzla_node_is_uf(exp));
-
-  uint32_t hash = 0;
-
-  if (bzla_node_is_bv_const(exp))
-  {
-    hash = bzla_bv_hash(bzla_node_bv_const_get_bits(exp));
-  }
-  else if (bzla_node_is_rm_const(exp))
-  {
-    hash = bzla_rm_hash(bzla_node_rm_const_get_rm(exp));
-  }
-  else if (bzla_node_is_fp_const(exp))
-  {
-    hash = bzla_fp_hash(bzla_node_fp_const_get_fp(exp));
-  }
-  /* hash for lambdas is computed once during creation. afterwards, we always
-   * have to use the saved hash value since hashing of lambdas requires all
-   * parameterized nodes and their inputs (cf. hash_binder_exp), which may
-   * change at some point. */
-  else if (bzla_node_is_lambda(exp))
-  {
-    hash = bzla_hashptr_table_get(exp->bzla->lambdas, (BzlaNode *) exp)
-               ->data.as_int;
-  }
-  else if (bzla_node_is_quantifier(exp))
-  {
-    hash = bzla_hashptr_table_get(exp->bzla->quantifiers, exp)->data.as_int;
-  }
-  else if (exp->kind == BZLA_BV_SLICE_NODE)
-  {
-    hash = hash_slice_exp(exp->e[0],
-                          bzla_node_bv_slice_get_upper(exp),
-                          bzla_node_bv_slice_get_lower(exp));
-  }
-  else if (exp->kind == BZLA_FP_TO_FP_BV_NODE)
-  {
-    hash = hash_fp_conversion_exp(exp->e[0], 0, bzla_node_get_sort_id(exp));
-  }
-  else if (exp->kind == BZLA_FP_TO_SBV_NODE || exp->kind == BZLA_FP_TO_UBV_NODE
-           || exp->kind == BZLA_FP_TO_FP_FP_NODE
-           || exp->kind == BZLA_FP_TO_FP_SBV_NODE
-           || exp->kind == BZLA_FP_TO_FP_UBV_NODE)
-  {
-    hash = hash_fp_conversion_exp(
-        exp->e[0], exp->e[1], bzla_node_get_sort_id(exp));
-  }
-  else
-  {
-    hash = hash_bv_fp_exp(bzla, exp->kind, exp->arity, exp->e);
-  }
-  hash &= table_size - 1;
-  return hash;
+  return hash_mix(hash);
 }
 
 /*------------------------------------------------------------------------*/
@@ -749,39 +729,104 @@ setup_node_and_add_to_id_table(Bzla *bzla, void *ptr)
   if (bzla_node_is_apply(exp)) exp->apply_below = 1;
 }
 
-/* Enlarges unique table and rehashes expressions. */
+/* Returns the chain of the unique table that holds the nodes with hash value
+ * 'hash'. */
+static inline BzlaNode **
+get_chain_nodes_unique_table(Bzla *bzla, uint32_t hash)
+{
+  BzlaNodeUniqueTable *table;
+  uint32_t i;
+
+  table = &bzla->nodes_unique_table;
+  if (table->old_chains)
+  {
+    i = hash & (table->old_size - 1);
+    if (i >= table->migrated) return table->old_chains + i;
+  }
+  return table->chains + (hash & (table->size - 1));
+}
+
+/* Moves (at most) 'num_buckets' buckets of the previous unique table to the
+ * enlarged table. The previous table is deleted once it is empty. */
 static void
-enlarge_nodes_unique_table(Bzla *bzla)
+migrate_nodes_unique_table(Bzla *bzla, uint32_t num_buckets)
 {
   assert(bzla);
 
-  BzlaMemMgr *mm;
-  uint32_t size, new_size, i;
-  uint32_t hash;
-  BzlaNode *cur, *temp, **new_chains;
+  BzlaNodeUniqueTable *table;
+  BzlaNode *cur, *temp, **chain;
+
+  table = &bzla->nodes_unique_table;
+  if (!table->old_chains) return;
 
-  mm       = bzla->mm;
-  size     = bzla->nodes_unique_table.size;
-  new_size = size ? 2 * size : 1;
-  BZLA_CNEWN(mm, new_chains, new_size);
-  for (i = 0; i < size; i++)
+  for (; num_buckets > 0 && table->migrated < table->old_size; num_buckets--)
   {
-    cur = bzla->nodes_unique_table.chains[i];
+    cur = table->old_chains[table->migrated++];
     while (cur)
     {
       assert(bzla_node_is_regular(cur));
-      assert(!bzla_node_is_var(cur));
-      assert(!bzla_node_is_uf(cur));
-      temp             = cur->next;
-      hash             = compute_hash_exp(bzla, cur, new_size);
-      cur->next        = new_chains[hash];
-      new_chains[hash] = cur;
-      cur              = temp;
+      assert(cur->unique);
+      temp      = cur->next;
+      chain     = table->chains + (cur->hash & (table->size - 1));
+      cur->next = *chain;
+      *chain    = cur;
+      cur       = temp;
     }
   }
-  BZLA_DELETEN(mm, bzla->nodes_unique_table.chains, size);
-  bzla->nodes_unique_table.size   = new_size;
-  bzla->nodes_unique_table.chains = new_chains;
+
+  if (table->migrated == table->old_size)
+  {
+    BZLA_DELETEN(bzla->mm, table->old_chains, table->old_size);
+    table->old_chains = 0;
+    table->old_size   = 0;
+    table->migrated   = 0;
+  }
+}
+
+/* Enlarges unique table. Expressions are not rehashed at once but moved to
+ * the enlarged table bucket by bucket on subsequent insertions
+ * (cf. add_to_nodes_unique_table). */
+static void
+enlarge_nodes_unique_table(Bzla *bzla)
+{
+  assert(bzla);
+
+  BzlaNodeUniqueTable *table;
+
+  table = &bzla->nodes_unique_table;
+  /* finish pending resize */
+  migrate_nodes_unique_table(bzla, table->old_size);
+  assert(!table->old_chains);
+
+  table->old_chains = table->chains;
+  table->old_size   = table->size;
+  table->migrated   = 0;
+  table->size       = table->size ? 2 * table->size : 1;
+  BZLA_CNEWN(bzla->mm, table->chains, table->size);
+}
+
+/* Inserts 'exp' with hash value 'hash' into the unique table at position
+ * 'lookup' as returned by the find_*_exp functions. Note that this moves
+ * buckets of the previous table if the table is resized, hence 'lookup' is
+ * invalid afterwards. */
+static void
+add_to_nodes_unique_table(Bzla *bzla,
+                          BzlaNode **lookup,
+                          BzlaNode *exp,
+                          uint32_t hash)
+{
+  assert(bzla);
+  assert(lookup);
+  assert(!*lookup);
+  assert(exp);
+  assert(bzla_node_is_regular(exp));
+
+  *lookup     = exp;
+  exp->hash   = hash;
+  exp->unique = 1;
+  assert(bzla->nodes_unique_table.num_elements < INT32_MAX);
+  bzla->nodes_unique_table.num_elements++;
+  migrate_nodes_unique_table(bzla, BZLA_UNIQUE_TABLE_MIGRATE);
 }
 
 static void
@@ -790,30 +835,24 @@ remove_from_nodes_unique_table_exp(Bzla *bzla, BzlaNode *exp)
   assert(exp);
   assert(bzla_node_is_regular(exp));
 
-  uint32_t hash;
-  BzlaNode *cur, *prev;
+  BzlaNode **chain;
 
   if (!exp->unique) return;
 
   assert(bzla);
   assert(bzla->nodes_unique_table.num_elements > 0);
 
-  hash = compute_hash_exp(bzla, exp, bzla->nodes_unique_table.size);
-  prev = 0;
-  cur  = bzla->nodes_unique_table.chains[hash];
-
-  while (cur != exp)
+  /* hash value of binders depends on parameterized nodes and their inputs
+   * (cf. hash_binder_exp), which may change at some point, hence we always
+   * use the hash value computed on insertion */
+  chain = get_chain_nodes_unique_table(bzla, exp->hash);
+  while (*chain != exp)
   {
-    assert(cur);
-    assert(bzla_node_is_regular(cur));
-    prev = cur;
-    cur  = cur->next;
+    assert(*chain);
+    assert(bzla_node_is_regular(*chain));
+    chain = &(*chain)->next;
   }
-  assert(cur);
-  if (!prev)
-    bzla->nodes_unique_table.chains[hash] = cur->next;
-  else
-    prev->next = cur->next;
+  *chain = exp->next;
 
   bzla->nodes_unique_table.num_elements--;
 
@@ -883,6 +922,79 @@ remove_from_hash_tables(Bzla *bzla, BzlaNode *exp, bool keep_symbol)
 
 /*------------------------------------------------------------------------*/
 
+#ifdef BZLA_COMPACT_PARENTS
+/* Add 'parent' to the parent ids of 'child', where 'child->parents' already
+ * accounts for 'parent'. Apply parents are appended, all other parents are
+ * inserted before the apply parents. */
+static void
+add_parent_id(Bzla *bzla, BzlaNode *child, BzlaNode *parent)
+{
+  assert(bzla_node_is_regular(child));
+  assert(bzla_node_is_regular(parent));
+  assert(child->parents > 0);
+
+  uint32_t n, size, pos;
+  int32_t *ids;
+
+  n = child->parents - 1;
+  if (n == child->parents_size)
+  {
+    size = n ? 2 * n : 2;
+    BZLA_REALLOC(bzla->mm, child->parent_ids, n, size);
+    child->parents_size = size;
+  }
+  ids = child->parent_ids;
+
+  if (bzla_node_is_apply(parent))
+  {
+    ids[n] = parent->id;
+    child->apply_parents++;
+  }
+  else
+  {
+    pos = n - child->apply_parents;
+    memmove(ids + pos + 1, ids + pos, child->apply_parents * sizeof *ids);
+    ids[pos] = parent->id;
+  }
+}
+
+/* Remove one occurrence of 'parent' from the parent ids of 'child', where
+ * 'child->parents' does not account for 'parent' anymore. */
+static void
+remove_parent_id(BzlaNode *child, BzlaNode *parent)
+{
+  assert(bzla_node_is_regular(child));
+  assert(bzla_node_is_regular(parent));
+
+  uint32_t n, pos, begin;
+  int32_t *ids;
+
+  n   = child->parents + 1;
+  ids = child->parent_ids;
+  if (bzla_node_is_apply(parent))
+  {
+    assert(child->apply_parents > 0);
+    begin = n - child->apply_parents;
+    pos   = n;
+    child->apply_parents--;
+  }
+  else
+  {
+    begin = 0;
+    pos   = n - child->apply_parents;
+  }
+  /* search from the most recently added parent, parents are usually
+   * released in reverse order of creation */
+  do
+  {
+    assert(pos > begin);
+    pos--;
+  } while (ids[pos] != parent->id);
+  (void) begin;
+  memmove(ids + pos, ids + pos + 1, (n - pos - 1) * sizeof *ids);
+}
+#endif
+
 /* Connects child to its parent and updates list of parent pointers.
  * Expressions are inserted at the beginning of the regular parent list
  */
@@ -895,15 +1007,18 @@ connect_child_exp(Bzla *bzla, BzlaNode *parent, BzlaNode *child, uint32_t pos)
   assert(bzla == parent->bzla);
   assert(child);
   assert(bzla == bzla_node_real_addr(child)->bzla);
-  assert(pos <= BZLA_NODE_MAX_CHILDREN - 1);
+  assert(pos < parent->arity);
   assert(bzla_simplify_exp(bzla, child) == child);
   assert(!bzla_node_is_args(child) || bzla_node_is_args(parent)
          || bzla_node_is_apply(parent) || bzla_node_is_update(parent));
 
   (void) bzla;
+#ifndef BZLA_COMPACT_PARENTS
   uint32_t tag;
   bool insert_beginning = 1;
-  BzlaNode *real_child, *first_parent, *last_parent, *tagged_parent;
+  BzlaNode *first_parent, *last_parent, *tagged_parent;
+#endif
+  BzlaNode *real_child;
 
   /* set specific flags */
 
@@ -930,14 +1045,18 @@ connect_child_exp(Bzla *bzla, BzlaNode *parent, BzlaNode *child, uint32_t pos)
 
   /* update parent lists */
 
-  if (bzla_node_is_apply(parent)) insert_beginning = false;
-
   real_child     = bzla_node_real_addr(child);
   parent->e[pos] = child;
-  tagged_parent  = bzla_node_set_tag(parent, pos);
 
-  assert(!parent->prev_parent[pos]);
-  assert(!parent->next_parent[pos]);
+#ifdef BZLA_COMPACT_PARENTS
+  add_parent_id(bzla, real_child, parent);
+#else
+  if (bzla_node_is_apply(parent)) insert_beginning = false;
+
+  tagged_parent = bzla_node_set_tag(parent, pos);
+
+  assert(!BZLA_NODE_PREV_PARENT(parent, pos));
+  assert(!BZLA_NODE_NEXT_PARENT(parent, pos));
 
   /* no parent so far? */
   if (!real_child->first_parent)
@@ -951,21 +1070,24 @@ connect_child_exp(Bzla *bzla, BzlaNode *parent, BzlaNode *child, uint32_t pos)
   {
     first_parent = real_child->first_parent;
     assert(first_parent);
-    parent->next_parent[pos] = first_parent;
-    tag                      = bzla_node_get_tag(first_parent);
-    bzla_node_real_addr(first_parent)->prev_parent[tag] = tagged_parent;
-    real_child->first_parent                            = tagged_parent;
+    BZLA_NODE_NEXT_PARENT(parent, pos) = first_parent;
+    tag = bzla_node_get_tag(first_parent);
+    BZLA_NODE_PREV_PARENT(bzla_node_real_addr(first_parent), tag) =
+        tagged_parent;
+    real_child->first_parent = tagged_parent;
   }
   /* add parent at the end of the list */
   else
   {
     last_parent = real_child->last_parent;
     assert(last_parent);
-    parent->prev_parent[pos] = last_parent;
-    tag                      = bzla_node_get_tag(last_parent);
-    bzla_node_real_addr(last_parent)->next_parent[tag] = tagged_parent;
-    real_child->last_parent                            = tagged_parent;
+    BZLA_NODE_PREV_PARENT(parent, pos) = last_parent;
+    tag = bzla_node_get_tag(last_parent);
+    BZLA_NODE_NEXT_PARENT(bzla_node_real_addr(last_parent), tag) =
+        tagged_parent;
+    real_child->last_parent = tagged_parent;
   }
+#endif
 }
 
 /* Disconnects a child from its parent and updates its parent list */
@@ -979,19 +1101,16 @@ disconnect_child_exp(Bzla *bzla, BzlaNode *parent, uint32_t pos)
   assert(!bzla_node_is_bv_const(parent));
   assert(!bzla_node_is_var(parent));
   assert(!bzla_node_is_uf(parent));
-  assert(pos <= BZLA_NODE_MAX_CHILDREN - 1);
+  assert(pos < parent->arity);
 
   (void) bzla;
-  BzlaNode *first_parent, *last_parent;
-  BzlaNode *real_child, *tagged_parent;
+#ifndef BZLA_COMPACT_PARENTS
+  BzlaNode *first_parent, *last_parent, *tagged_parent;
+#endif
+  BzlaNode *real_child;
 
-  tagged_parent = bzla_node_set_tag(parent, pos);
-  real_child    = bzla_node_real_addr(parent->e[pos]);
+  real_child = bzla_node_real_addr(parent->e[pos]);
   real_child->parents--;
-  first_parent = real_child->first_parent;
-  last_parent  = real_child->last_parent;
-  assert(first_parent);
-  assert(last_parent);
 
   /* if a parameter is disconnected from a lambda we have to reset
    * 'lambda_exp' of the parameter in order to keep a valid state */
@@ -1004,41 +1123,53 @@ disconnect_child_exp(Bzla *bzla, BzlaNode *parent, uint32_t pos)
       && bzla_node_param_get_binder(parent->e[0]) == parent)
     bzla_node_param_set_binder(parent->e[0], 0);
 
+#ifdef BZLA_COMPACT_PARENTS
+  remove_parent_id(real_child, parent);
+#else
+  tagged_parent = bzla_node_set_tag(parent, pos);
+  first_parent  = real_child->first_parent;
+  last_parent   = real_child->last_parent;
+  assert(first_parent);
+  assert(last_parent);
+
   /* only one parent? */
   if (first_parent == tagged_parent && first_parent == last_parent)
   {
-    assert(!parent->next_parent[pos]);
-    assert(!parent->prev_parent[pos]);
+    assert(!BZLA_NODE_NEXT_PARENT(parent, pos));
+    assert(!BZLA_NODE_PREV_PARENT(parent, pos));
     real_child->first_parent = 0;
     real_child->last_parent  = 0;
   }
   /* is parent first parent in the list? */
   else if (first_parent == tagged_parent)
   {
-    assert(parent->next_parent[pos]);
-    assert(!parent->prev_parent[pos]);
-    real_child->first_parent                   = parent->next_parent[pos];
+    assert(BZLA_NODE_NEXT_PARENT(parent, pos));
+    assert(!BZLA_NODE_PREV_PARENT(parent, pos));
+    real_child->first_parent = BZLA_NODE_NEXT_PARENT(parent, pos);
     BZLA_PREV_PARENT(real_child->first_parent) = 0;
   }
   /* is parent last parent in the list? */
   else if (last_parent == tagged_parent)
   {
-    assert(!parent->next_parent[pos]);
-    assert(parent->prev_parent[pos]);
-    real_child->last_parent                   = parent->prev_parent[pos];
+    assert(!BZLA_NODE_NEXT_PARENT(parent, pos));
+    assert(BZLA_NODE_PREV_PARENT(parent, pos));
+    real_child->last_parent = BZLA_NODE_PREV_PARENT(parent, pos);
     BZLA_NEXT_PARENT(real_child->last_parent) = 0;
   }
   /* detach parent from list */
   else
   {
-    assert(parent->next_parent[pos]);
-    assert(parent->prev_parent[pos]);
-    BZLA_PREV_PARENT(parent->next_parent[pos]) = parent->prev_parent[pos];
-    BZLA_NEXT_PARENT(parent->prev_parent[pos]) = parent->next_parent[pos];
+    assert(BZLA_NODE_NEXT_PARENT(parent, pos));
+    assert(BZLA_NODE_PREV_PARENT(parent, pos));
+    BZLA_PREV_PARENT(BZLA_NODE_NEXT_PARENT(parent, pos)) =
+        BZLA_NODE_PREV_PARENT(parent, pos);
+    BZLA_NEXT_PARENT(BZLA_NODE_PREV_PARENT(parent, pos)) =
+        BZLA_NODE_NEXT_PARENT(parent, pos);
   }
-  parent->next_parent[pos] = 0;
-  parent->prev_parent[pos] = 0;
-  parent->e[pos]           = 0;
+  BZLA_NODE_NEXT_PARENT(parent, pos) = 0;
+  BZLA_NODE_PREV_PARENT(parent, pos) = 0;
+#endif
+  parent->e[pos] = 0;
 }
 
 /* Disconnect children of expression in parent list and if applicable from
@@ -1182,6 +1313,10 @@ really_deallocate_exp(Bzla *bzla, BzlaNode *exp)
   bzla_sort_release(bzla, bzla_node_get_sort_id(exp));
   bzla_node_set_sort_id(exp, 0);
 
+#ifdef BZLA_COMPACT_PARENTS
+  assert(!exp->parents);
+  BZLA_DELETEN(mm, exp->parent_ids, exp->parents_size);
+#endif
   bzla_mem_free(mm, exp, exp->bytes);
 }
 
@@ -1360,6 +1495,17 @@ bzla_node_get_by_id(Bzla *bzla, int32_t id)
   return is_inverted ? bzla_node_invert(res) : res;
 }
 
+BzlaNode *
+bzla_node_get_first_parent(const BzlaNode *exp)
+{
+  assert(exp);
+
+  BzlaNodeIterator it;
+
+  bzla_iter_parent_init(&it, exp);
+  return bzla_iter_parent_has_next(&it) ? bzla_iter_parent_next(&it) : 0;
+}
+
 /*------------------------------------------------------------------------*/
 
 char *
@@ -1780,12 +1926,16 @@ is_sorted_fp_fma_exp(Bzla *bzla, BzlaNodeKind kind, BzlaNode *e[])
 
 /*------------------------------------------------------------------------*/
 
+/* The find_*_exp functions return the position of an expression in the unique
+ * table, i.e., a pointer to the expression or to the end of its chain if not
+ * found, and store its hash value in 'res_hash' if given. */
+
 /**
  * Search for bit-vector const expression in hash table.
  * Returns 0 if not found.
  */
 static BzlaNode **
-find_bv_const_exp(Bzla *bzla, BzlaBitVector *bits)
+find_bv_const_exp(Bzla *bzla, BzlaBitVector *bits, uint32_t *res_hash)
 {
   assert(bzla);
   assert(bits);
@@ -1793,14 +1943,14 @@ find_bv_const_exp(Bzla *bzla, BzlaBitVector *bits)
   BzlaNode *cur, **result;
   uint32_t hash;
 
-  hash = bzla_bv_hash(bits);
-  hash &= bzla->nodes_unique_table.size - 1;
-  result = bzla->nodes_unique_table.chains + hash;
+  hash = hash_const_exp(BZLA_BV_CONST_NODE, bzla_bv_hash(bits));
+  if (res_hash) *res_hash = hash;
+  result = get_chain_nodes_unique_table(bzla, hash);
   cur    = *result;
   while (cur)
   {
     assert(bzla_node_is_regular(cur));
-    if (bzla_node_is_bv_const(cur)
+    if (cur->hash == hash && bzla_node_is_bv_const(cur)
         && bzla_node_bv_get_width(bzla, cur) == bzla_bv_get_width(bits)
         && bzla_bv_compare(bzla_node_bv_const_get_bits(cur), bits) == 0)
     {
@@ -1820,7 +1970,7 @@ find_bv_const_exp(Bzla *bzla, BzlaBitVector *bits)
  * Returns 0 if not found.
  */
 static BzlaNode **
-find_rm_const_exp(Bzla *bzla, const BzlaRoundingMode rm)
+find_rm_const_exp(Bzla *bzla, const BzlaRoundingMode rm, uint32_t *res_hash)
 {
   assert(bzla);
   assert(bzla_rm_is_valid(rm));
@@ -1828,14 +1978,15 @@ find_rm_const_exp(Bzla *bzla, const BzlaRoundingMode rm)
   BzlaNode *cur, **result;
   uint32_t hash;
 
-  hash = bzla_rm_hash(rm);
-  hash &= bzla->nodes_unique_table.size - 1;
-  result = bzla->nodes_unique_table.chains + hash;
+  hash = hash_const_exp(BZLA_RM_CONST_NODE, bzla_rm_hash(rm));
+  if (res_hash) *res_hash = hash;
+  result = get_chain_nodes_unique_table(bzla, hash);
   cur    = *result;
   while (cur)
   {
     assert(bzla_node_is_regular(cur));
-    if (bzla_node_is_rm_const(cur) && bzla_node_rm_const_get_rm(cur) == rm)
+    if (cur->hash == hash && bzla_node_is_rm_const(cur)
+        && bzla_node_rm_const_get_rm(cur) == rm)
     {
       break;
     }
@@ -1853,7 +2004,7 @@ find_rm_const_exp(Bzla *bzla, const BzlaRoundingMode rm)
  * Returns 0 if not found.
  */
 static BzlaNode **
-find_fp_const_exp(Bzla *bzla, const BzlaFloatingPoint *fp)
+find_fp_const_exp(Bzla *bzla, const BzlaFloatingPoint *fp, uint32_t *res_hash)
 {
   assert(bzla);
   assert(fp);
@@ -1861,14 +2012,14 @@ find_fp_const_exp(Bzla *bzla, const BzlaFloatingPoint *fp)
   BzlaNode *cur, **result;
   uint32_t hash;
 
-  hash = bzla_fp_hash(fp);
-  hash &= bzla->nodes_unique_table.size - 1;
-  result = bzla->nodes_unique_table.chains + hash;
+  hash = hash_const_exp(BZLA_FP_CONST_NODE, bzla_fp_hash(fp));
+  if (res_hash) *res_hash = hash;
+  result = get_chain_nodes_unique_table(bzla, hash);
   cur    = *result;
   while (cur)
   {
     assert(bzla_node_is_regular(cur));
-    if (bzla_node_is_fp_const(cur)
+    if (cur->hash == hash && bzla_node_is_fp_const(cur)
         && !bzla_fp_compare(bzla_node_fp_const_get_fp(cur), fp))
       break;
     else
@@ -1882,7 +2033,11 @@ find_fp_const_exp(Bzla *bzla, const BzlaFloatingPoint *fp)
 
 /* Search for slice expression in hash table. Returns 0 if not found. */
 static BzlaNode **
-find_slice_exp(Bzla *bzla, BzlaNode *e0, uint32_t upper, uint32_t lower)
+find_slice_exp(Bzla *bzla,
+               BzlaNode *e0,
+               uint32_t upper,
+               uint32_t lower,
+               uint32_t *res_hash)
 {
   assert(bzla);
   assert(e0);
@@ -1892,13 +2047,13 @@ find_slice_exp(Bzla *bzla, BzlaNode *e0, uint32_t upper, uint32_t lower)
   uint32_t hash;
 
   hash = hash_slice_exp(e0, upper, lower);
-  hash &= bzla->nodes_unique_table.size - 1;
-  result = bzla->nodes_unique_table.chains + hash;
+  if (res_hash) *res_hash = hash;
+  result = get_chain_nodes_unique_table(bzla, hash);
   cur    = *result;
   while (cur)
   {
     assert(bzla_node_is_regular(cur));
-    if (cur->kind == BZLA_BV_SLICE_NODE && cur->e[0] == e0
+    if (cur->hash == hash && cur->kind == BZLA_BV_SLICE_NODE && cur->e[0] == e0
         && bzla_node_bv_slice_get_upper(cur) == upper
         && bzla_node_bv_slice_get_lower(cur) == lower)
     {
@@ -1918,8 +2073,12 @@ find_slice_exp(Bzla *bzla, BzlaNode *e0, uint32_t upper, uint32_t lower)
  * Returns 0 if not found.
  */
 static BzlaNode **
-find_fp_conversion_exp(
-    Bzla *bzla, BzlaNodeKind kind, BzlaNode *e0, BzlaNode *e1, BzlaSortId sort)
+find_fp_conversion_exp(Bzla *bzla,
+                       BzlaNodeKind kind,
+                       BzlaNode *e0,
+                       BzlaNode *e1,
+                       BzlaSortId sort,
+                       uint32_t *res_hash)
 {
   assert(bzla);
   assert(kind == BZLA_FP_TO_SBV_NODE || kind == BZLA_FP_TO_UBV_NODE
@@ -1934,14 +2093,15 @@ find_fp_conversion_exp(
   BzlaNode *cur, **result;
   uint32_t hash;
 
-  hash = hash_fp_conversion_exp(e0, e1, sort);
-  hash &= bzla->nodes_unique_table.size - 1;
-  result = bzla->nodes_unique_table.chains + hash;
+  hash = hash_fp_conversion_exp(kind, e0, e1, sort);
+  if (res_hash) *res_hash = hash;
+  result = get_chain_nodes_unique_table(bzla, hash);
   cur    = *result;
   while (cur)
   {
     assert(bzla_node_is_regular(cur));
-    if (cur->kind == kind && cur->e[0] == e0 && (!e1 || cur->e[1] == e1)
+    if (cur->hash == hash && cur->kind == kind && cur->e[0] == e0
+        && (!e1 || cur->e[1] == e1)
         && sort == bzla_node_get_sort_id(cur))
     {
       break;
@@ -1956,7 +2116,11 @@ find_fp_conversion_exp(
 }
 
 static BzlaNode **
-find_bv_fp_exp(Bzla *bzla, BzlaNodeKind kind, BzlaNode *e[], uint32_t arity)
+find_bv_fp_exp(Bzla *bzla,
+               BzlaNodeKind kind,
+               BzlaNode *e[],
+               uint32_t arity,
+               uint32_t *res_hash)
 {
   bool equal;
   uint32_t i;
@@ -1989,14 +2153,14 @@ find_bv_fp_exp(Bzla *bzla, BzlaNodeKind kind, BzlaNode *e[], uint32_t arity)
   }
 
   hash = hash_bv_fp_exp(bzla, kind, arity, e);
-  hash &= bzla->nodes_unique_table.size - 1;
+  if (res_hash) *res_hash = hash;
 
-  result = bzla->nodes_unique_table.chains + hash;
+  result = get_chain_nodes_unique_table(bzla, hash);
   cur    = *result;
   while (cur)
   {
     assert(bzla_node_is_regular(cur));
-    if (cur->kind == kind && cur->arity == arity)
+    if (cur->hash == hash && cur->kind == kind && cur->arity == arity)
     {
       equal = true;
       /* special case for bv eq; (= (bvnot a) b) == (= a (bvnot b)) */
@@ -2031,7 +2195,7 @@ find_binder_exp(Bzla *bzla,
                 BzlaNodeKind kind,
                 BzlaNode *param,
                 BzlaNode *body,
-                uint32_t *binder_hash,
+                uint32_t *res_hash,
                 BzlaIntHashTable *params,
                 BzlaPtrHashTable *map)
 {
@@ -2052,14 +2216,13 @@ find_binder_exp(Bzla *bzla,
           bzla_util_node2string(body),
           hash);
 
-  if (binder_hash) *binder_hash = hash;
-  hash &= bzla->nodes_unique_table.size - 1;
-  result = bzla->nodes_unique_table.chains + hash;
+  if (res_hash) *res_hash = hash;
+  result = get_chain_nodes_unique_table(bzla, hash);
   cur    = *result;
   while (cur)
   {
     assert(bzla_node_is_regular(cur));
-    if (cur->kind == kind
+    if (cur->hash == hash && cur->kind == kind
         && ((!map && param == cur->e[0] && body == cur->e[1])
             || (((map || !cur->parameterized)
                  && compare_binder_exp(bzla, param, body, cur, map)))))
@@ -2230,7 +2393,8 @@ compare_binder_exp(Bzla *bzla,
         result = *find_slice_exp(bzla,
                                  e[0],
                                  bzla_node_bv_slice_get_upper(real_cur),
-                                 bzla_node_bv_slice_get_lower(real_cur));
+                                 bzla_node_bv_slice_get_lower(real_cur),
+                                 0);
       }
       else if (bzla_node_is_fp_to_sbv(real_cur))
       {
@@ -2238,7 +2402,8 @@ compare_binder_exp(Bzla *bzla,
                                          BZLA_FP_TO_SBV_NODE,
                                          e[0],
                                          e[1],
-                                         bzla_node_get_sort_id(real_cur));
+                                         bzla_node_get_sort_id(real_cur),
+                                         0);
       }
       else if (bzla_node_is_fp_to_ubv(real_cur))
       {
@@ -2246,7 +2411,8 @@ compare_binder_exp(Bzla *bzla,
                                          BZLA_FP_TO_UBV_NODE,
                                          e[0],
                                          e[1],
-                                         bzla_node_get_sort_id(real_cur));
+                                         bzla_node_get_sort_id(real_cur),
+                                         0);
       }
       else if (bzla_node_is_fp_to_fp_from_bv(real_cur))
       {
@@ -2254,7 +2420,8 @@ compare_binder_exp(Bzla *bzla,
                                          BZLA_FP_TO_FP_BV_NODE,
                                          e[0],
                                          0,
-                                         bzla_node_get_sort_id(real_cur));
+                                         bzla_node_get_sort_id(real_cur),
+                                         0);
       }
       else if (bzla_node_is_fp_to_fp_from_fp(real_cur))
       {
@@ -2262,7 +2429,8 @@ compare_binder_exp(Bzla *bzla,
                                          BZLA_FP_TO_FP_FP_NODE,
                                          e[0],
                                          e[1],
-                                         bzla_node_get_sort_id(real_cur));
+                                         bzla_node_get_sort_id(real_cur),
+                                         0);
       }
       else if (bzla_node_is_fp_to_fp_from_sbv(real_cur))
       {
@@ -2270,7 +2438,8 @@ compare_binder_exp(Bzla *bzla,
                                          BZLA_FP_TO_FP_SBV_NODE,
                                          e[0],
                                          e[1],
-                                         bzla_node_get_sort_id(real_cur));
+                                         bzla_node_get_sort_id(real_cur),
+                                         0);
       }
       else if (bzla_node_is_fp_to_fp_from_ubv(real_cur))
       {
@@ -2278,7 +2447,8 @@ compare_binder_exp(Bzla *bzla,
                                          BZLA_FP_TO_FP_UBV_NODE,
                                          e[0],
                                          e[1],
-                                         bzla_node_get_sort_id(real_cur));
+                                         bzla_node_get_sort_id(real_cur),
+                                         0);
       }
       else if (bzla_node_is_param(real_cur))
       {
@@ -2290,7 +2460,8 @@ compare_binder_exp(Bzla *bzla,
       else
       {
         assert(!bzla_node_is_binder(real_cur));
-        result = *find_bv_fp_exp(bzla, real_cur->kind, e, real_cur->arity);
+        result =
+            *find_bv_fp_exp(bzla, real_cur->kind, e, real_cur->arity, 0);
       }
 
       if (!result)
@@ -2328,7 +2499,7 @@ find_exp(Bzla *bzla,
          BzlaNodeKind kind,
          BzlaNode *e[],
          uint32_t arity,
-         uint32_t *binder_hash,
+         uint32_t *res_hash,
          BzlaIntHashTable *params)
 {
   assert(bzla);
@@ -2342,15 +2513,35 @@ find_exp(Bzla *bzla,
 
   if (kind == BZLA_LAMBDA_NODE || kind == BZLA_FORALL_NODE
       || kind == BZLA_EXISTS_NODE)
-    return find_binder_exp(bzla, kind, e[0], e[1], binder_hash, params, 0);
-  else if (binder_hash)
-    *binder_hash = 0;
+    return find_binder_exp(bzla, kind, e[0], e[1], res_hash, params, 0);
 
-  return find_bv_fp_exp(bzla, kind, e, arity);
+  return find_bv_fp_exp(bzla, kind, e, arity, res_hash);
 }
 
 /*------------------------------------------------------------------------*/
 
+/* Allocate an n-ary node of given kind and arity. Only the children (and
+ * their parent links) that are actually needed are allocated, see
+ * BZLA_ADDITIONAL_NODE_STRUCT. */
+static BzlaNode *
+new_nary_node(Bzla *bzla, BzlaNodeKind kind, uint32_t arity)
+{
+  assert(arity > 0);
+  assert(arity <= BZLA_NODE_MAX_CHILDREN);
+
+  size_t bytes;
+  BzlaNode *exp;
+
+  bytes = offsetof(BzlaNode, e)
+          + BZLA_NODE_LINKS_PER_CHILD * arity * sizeof(BzlaNode *);
+  assert(bytes <= UINT8_MAX);
+  exp = bzla_mem_calloc(bzla->mm, 1, bytes);
+  set_kind(bzla, exp, kind);
+  exp->bytes = bytes;
+  exp->arity = arity;
+  return exp;
+}
+
 static BzlaNode *
 new_bv_const_exp_node(Bzla *bzla, BzlaBitVector *bits)
 {
@@ -2418,12 +2609,9 @@ new_unary_to_fp_exp_node(Bzla *bzla, BzlaNode *e0, BzlaSortId sort)
   assert(bzla_sort_is_fp(bzla, sort));
   assert(bzla == bzla_node_real_addr(e0)->bzla);
 
-  BzlaNode *exp = 0;
+  BzlaNode *exp;
 
-  BZLA_CNEW(bzla->mm, exp);
-  set_kind(bzla, (BzlaNode *) exp, BZLA_FP_TO_FP_BV_NODE);
-  exp->bytes = sizeof *exp;
-  exp->arity = 1;
+  exp = new_nary_node(bzla, BZLA_FP_TO_FP_BV_NODE, 1);
   bzla_node_set_sort_id(exp, bzla_sort_copy(bzla, sort));
   setup_node_and_add_to_id_table(bzla, exp);
   connect_child_exp(bzla, exp, e0, 0);
@@ -2449,12 +2637,9 @@ new_binary_fp_conversion_node(
   assert(bzla == bzla_node_real_addr(e0)->bzla);
   assert(bzla == bzla_node_real_addr(e1)->bzla);
 
-  BzlaNode *exp = 0;
+  BzlaNode *exp;
 
-  BZLA_CNEW(bzla->mm, exp);
-  set_kind(bzla, (BzlaNode *) exp, kind);
-  exp->bytes = sizeof *exp;
-  exp->arity = 2;
+  exp = new_nary_node(bzla, kind, 2);
   bzla_node_set_sort_id(exp, bzla_sort_copy(bzla, sort));
   setup_node_and_add_to_id_table(bzla, exp);
   connect_child_exp(bzla, exp, e0, 0);
@@ -2629,21 +2814,18 @@ new_args_exp_node(Bzla *bzla, uint32_t arity, BzlaNode *e[])
   assert(e);
 
   uint32_t i;
-  BzlaArgsNode *exp;
+  BzlaNode *exp;
   BzlaSortIdStack sorts;
   BzlaTupleSortIterator it;
 #ifndef NDEBUG
   for (i = 0; i < arity; i++) assert(e[i]);
 #endif
 
-  BZLA_CNEW(bzla->mm, exp);
-  set_kind(bzla, (BzlaNode *) exp, BZLA_ARGS_NODE);
-  exp->bytes = sizeof(*exp);
-  exp->arity = arity;
+  exp = new_nary_node(bzla, BZLA_ARGS_NODE, arity);
   setup_node_and_add_to_id_table(bzla, exp);
 
   for (i = 0; i < arity; i++)
-    connect_child_exp(bzla, (BzlaNode *) exp, e[i], i);
+    connect_child_exp(bzla, exp, e[i], i);
 
   /* create tuple sort for argument node */
   BZLA_INIT_STACK(bzla->mm, sorts);
@@ -2661,10 +2843,10 @@ new_args_exp_node(Bzla *bzla, uint32_t arity, BzlaNode *e[])
       BZLA_PUSH_STACK(sorts, bzla_node_get_sort_id(e[i]));
   }
   bzla_node_set_sort_id(
-      (BzlaNode *) exp,
+      exp,
       bzla_sort_tuple(bzla, sorts.start, BZLA_COUNT_STACK(sorts)));
   BZLA_RELEASE_STACK(sorts);
-  return (BzlaNode *) exp;
+  return exp;
 }
 
 static BzlaNode *
@@ -2694,13 +2876,7 @@ new_node(Bzla *bzla, BzlaNodeKind kind, uint32_t arity, BzlaNode *e[])
   }
 #endif
 
-  BZLA_CNEW(bzla->mm, exp);
-  set_kind(bzla, exp, kind);
-  exp->arity = arity;
-  assert(exp->arity > 0);
-  assert(exp->arity <= BZLA_NODE_MAX_CHILDREN);
-  assert(sizeof(*exp) <= UINT8_MAX);
-  exp->bytes = sizeof(*exp);
+  exp = new_nary_node(bzla, kind, arity);
   setup_node_and_add_to_id_table(bzla, exp);
 
   switch (kind)
@@ -2783,8 +2959,8 @@ create_exp(Bzla *bzla, BzlaNodeKind kind, uint32_t arity, BzlaNode *e[])
   assert(e);
 
   uint32_t i;
-  uint32_t binder_hash;
-  BzlaNode **lookup, *simp_e[BZLA_NODE_MAX_CHILDREN], *simp;
+  uint32_t hash;
+  BzlaNode **lookup, *simp_e[BZLA_NODE_MAX_CHILDREN], *simp, *res;
   BzlaIntHashTable *params = 0;
 
   for (i = 0; i < arity; i++)
@@ -2798,72 +2974,65 @@ create_exp(Bzla *bzla, BzlaNodeKind kind, uint32_t arity, BzlaNode *e[])
       || kind == BZLA_FORALL_NODE || kind == BZLA_EXISTS_NODE)
     params = bzla_hashint_table_new(bzla->mm);
 
-  lookup = find_exp(bzla, kind, simp_e, arity, &binder_hash, params);
-  if (!*lookup)
+  lookup = find_exp(bzla, kind, simp_e, arity, &hash, params);
+  res    = *lookup;
+  if (!res)
   {
     if (BZLA_FULL_UNIQUE_TABLE(bzla->nodes_unique_table))
     {
       enlarge_nodes_unique_table(bzla);
-      lookup = find_exp(bzla, kind, simp_e, arity, &binder_hash, 0);
+      lookup = find_exp(bzla, kind, simp_e, arity, &hash, 0);
     }
 
     switch (kind)
     {
       case BZLA_LAMBDA_NODE:
         assert(arity == 2);
-        *lookup = new_lambda_exp_node(bzla, simp_e[0], simp_e[1]);
-        bzla_hashptr_table_get(bzla->lambdas, *lookup)->data.as_int =
-            binder_hash;
+        res = new_lambda_exp_node(bzla, simp_e[0], simp_e[1]);
         BZLALOG(2,
                 "new lambda: %s (hash: %u, param: %u)",
-                bzla_util_node2string(*lookup),
-                binder_hash,
-                (*lookup)->parameterized);
+                bzla_util_node2string(res),
+                hash,
+                res->parameterized);
         break;
       case BZLA_FORALL_NODE:
       case BZLA_EXISTS_NODE:
         assert(arity == 2);
-        *lookup = new_quantifier_exp_node(bzla, kind, e[0], e[1]);
-        bzla_hashptr_table_get(bzla->quantifiers, *lookup)->data.as_int =
-            binder_hash;
+        res = new_quantifier_exp_node(bzla, kind, e[0], e[1]);
         break;
       case BZLA_ARGS_NODE:
-        *lookup = new_args_exp_node(bzla, arity, simp_e);
+        res = new_args_exp_node(bzla, arity, simp_e);
         break;
-      default: *lookup = new_node(bzla, kind, arity, simp_e);
+      default: res = new_node(bzla, kind, arity, simp_e);
     }
+    add_to_nodes_unique_table(bzla, lookup, res, hash);
 
     if (params)
     {
-      assert(bzla_node_is_binder(*lookup));
+      assert(bzla_node_is_binder(res));
       if (params->count > 0)
       {
-        bzla_hashptr_table_add(bzla->parameterized, *lookup)->data.as_ptr =
-            params;
-        (*lookup)->parameterized = 1;
+        bzla_hashptr_table_add(bzla->parameterized, res)->data.as_ptr = params;
+        res->parameterized = 1;
       }
       else
         bzla_hashint_table_delete(params);
     }
-
-    assert(bzla->nodes_unique_table.num_elements < INT32_MAX);
-    bzla->nodes_unique_table.num_elements++;
-    (*lookup)->unique = 1;
   }
   else
   {
-    inc_exp_ref_counter(bzla, *lookup);
+    inc_exp_ref_counter(bzla, res);
     if (params) bzla_hashint_table_delete(params);
   }
-  assert(bzla_node_is_regular(*lookup));
-  if (bzla_node_is_simplified(*lookup))
+  assert(bzla_node_is_regular(res));
+  if (bzla_node_is_simplified(res))
   {
     assert(bzla_opt_get(bzla, BZLA_OPT_PP_NONDESTR_SUBST));
-    simp = bzla_node_copy(bzla, bzla_node_get_simplified(bzla, *lookup));
-    bzla_node_release(bzla, *lookup);
+    simp = bzla_node_copy(bzla, bzla_node_get_simplified(bzla, res));
+    bzla_node_release(bzla, res);
     return simp;
   }
-  return *lookup;
+  return res;
 }
 
 /*------------------------------------------------------------------------*/
@@ -2876,7 +3045,8 @@ bzla_node_create_bv_const(Bzla *bzla, const BzlaBitVector *bits)
 
   bool inv;
   BzlaBitVector *lookupbits;
-  BzlaNode **lookup;
+  uint32_t hash;
+  BzlaNode **lookup, *res;
 
   /* normalize constants, constants are always even */
   if (bzla_bv_get_bit(bits, 0))
@@ -2890,30 +3060,29 @@ bzla_node_create_bv_const(Bzla *bzla, const BzlaBitVector *bits)
     inv        = false;
   }
 
-  lookup = find_bv_const_exp(bzla, lookupbits);
-  if (!*lookup)
+  lookup = find_bv_const_exp(bzla, lookupbits, &hash);
+  res    = *lookup;
+  if (!res)
   {
     if (BZLA_FULL_UNIQUE_TABLE(bzla->nodes_unique_table))
     {
       enlarge_nodes_unique_table(bzla);
-      lookup = find_bv_const_exp(bzla, lookupbits);
+      lookup = find_bv_const_exp(bzla, lookupbits, &hash);
     }
-    *lookup = new_bv_const_exp_node(bzla, lookupbits);
-    assert(bzla->nodes_unique_table.num_elements < INT32_MAX);
-    bzla->nodes_unique_table.num_elements += 1;
-    (*lookup)->unique = 1;
+    res = new_bv_const_exp_node(bzla, lookupbits);
+    add_to_nodes_unique_table(bzla, lookup, res, hash);
   }
   else
   {
-    inc_exp_ref_counter(bzla, *lookup);
+    inc_exp_ref_counter(bzla, res);
   }
 
-  assert(bzla_node_is_regular(*lookup));
+  assert(bzla_node_is_regular(res));
 
   bzla_bv_free(bzla->mm, lookupbits);
 
-  if (inv) return bzla_node_invert(*lookup);
-  return *lookup;
+  if (inv) return bzla_node_invert(res);
+  return res;
 }
 
 BzlaNode *
@@ -2922,27 +3091,27 @@ bzla_node_create_rm_const(Bzla *bzla, const BzlaRoundingMode rm)
   assert(bzla);
   assert(bzla_rm_is_valid(rm));
 
-  BzlaNode **lookup;
+  uint32_t hash;
+  BzlaNode **lookup, *res;
 
-  lookup = find_rm_const_exp(bzla, rm);
-  if (!*lookup)
+  lookup = find_rm_const_exp(bzla, rm, &hash);
+  res    = *lookup;
+  if (!res)
   {
     if (BZLA_FULL_UNIQUE_TABLE(bzla->nodes_unique_table))
     {
       enlarge_nodes_unique_table(bzla);
-      lookup = find_rm_const_exp(bzla, rm);
+      lookup = find_rm_const_exp(bzla, rm, &hash);
     }
-    *lookup = new_rm_const_exp_node(bzla, rm);
-    assert(bzla->nodes_unique_table.num_elements < INT32_MAX);
-    bzla->nodes_unique_table.num_elements += 1;
-    (*lookup)->unique = 1;
+    res = new_rm_const_exp_node(bzla, rm);
+    add_to_nodes_unique_table(bzla, lookup, res, hash);
   }
   else
   {
-    inc_exp_ref_counter(bzla, *lookup);
+    inc_exp_ref_counter(bzla, res);
   }
-  assert(bzla_node_is_regular(*lookup));
-  return *lookup;
+  assert(bzla_node_is_regular(res));
+  return res;
 }
 
 BzlaNode *
@@ -2951,27 +3120,27 @@ bzla_node_create_fp_const(Bzla *bzla, const BzlaFloatingPoint *fp)
   assert(bzla);
   assert(fp);
 
-  BzlaNode **lookup;
+  uint32_t hash;
+  BzlaNode **lookup, *res;
 
-  lookup = find_fp_const_exp(bzla, fp);
-  if (!*lookup)
+  lookup = find_fp_const_exp(bzla, fp, &hash);
+  res    = *lookup;
+  if (!res)
   {
     if (BZLA_FULL_UNIQUE_TABLE(bzla->nodes_unique_table))
     {
       enlarge_nodes_unique_table(bzla);
-      lookup = find_fp_const_exp(bzla, fp);
+      lookup = find_fp_const_exp(bzla, fp, &hash);
     }
-    *lookup = new_fp_const_exp_node(bzla, fp);
-    assert(bzla->nodes_unique_table.num_elements < INT32_MAX);
-    bzla->nodes_unique_table.num_elements += 1;
-    (*lookup)->unique = 1;
+    res = new_fp_const_exp_node(bzla, fp);
+    add_to_nodes_unique_table(bzla, lookup, res, hash);
   }
   else
   {
-    inc_exp_ref_counter(bzla, *lookup);
+    inc_exp_ref_counter(bzla, res);
   }
-  assert(bzla_node_is_regular(*lookup));
-  return *lookup;
+  assert(bzla_node_is_regular(res));
+  return res;
 }
 
 /*------------------------------------------------------------------------*/
@@ -3259,7 +3428,8 @@ unary_exp_slice_exp(Bzla *bzla, BzlaNode *exp, uint32_t upper, uint32_t lower)
   assert(bzla == bzla_node_real_addr(exp)->bzla);
 
   bool inv;
-  BzlaNode **lookup;
+  uint32_t hash;
+  BzlaNode **lookup, *res;
 
   exp = bzla_simplify_exp(bzla, exp);
 
@@ -3275,26 +3445,25 @@ unary_exp_slice_exp(Bzla *bzla, BzlaNode *exp, uint32_t upper, uint32_t lower)
   else
     inv = false;
 
-  lookup = find_slice_exp(bzla, exp, upper, lower);
-  if (!*lookup)
+  lookup = find_slice_exp(bzla, exp, upper, lower, &hash);
+  res    = *lookup;
+  if (!res)
   {
     if (BZLA_FULL_UNIQUE_TABLE(bzla->nodes_unique_table))
     {
       enlarge_nodes_unique_table(bzla);
-      lookup = find_slice_exp(bzla, exp, upper, lower);
+      lookup = find_slice_exp(bzla, exp, upper, lower, &hash);
     }
-    *lookup = new_slice_exp_node(bzla, exp, upper, lower);
-    assert(bzla->nodes_unique_table.num_elements < INT32_MAX);
-    bzla->nodes_unique_table.num_elements++;
-    (*lookup)->unique = 1;
+    res = new_slice_exp_node(bzla, exp, upper, lower);
+    add_to_nodes_unique_table(bzla, lookup, res, hash);
   }
   else
   {
-    inc_exp_ref_counter(bzla, *lookup);
+    inc_exp_ref_counter(bzla, res);
   }
-  assert(bzla_node_is_regular(*lookup));
-  if (inv) return bzla_node_invert(*lookup);
-  return *lookup;
+  assert(bzla_node_is_regular(res));
+  if (inv) return bzla_node_invert(res);
+  return res;
 }
 
 static BzlaNode *
@@ -3305,32 +3474,33 @@ unary_exp_to_fp_exp(Bzla *bzla, BzlaNode *exp, BzlaSortId sort)
   assert(bzla == bzla_node_real_addr(exp)->bzla);
   assert(bzla_sort_is_fp(bzla, sort));
 
-  BzlaNode **lookup;
+  uint32_t hash;
+  BzlaNode **lookup, *res;
 
   exp = bzla_simplify_exp(bzla, exp);
 
   assert(bzla_node_is_bv(bzla, exp));
 
-  lookup = find_fp_conversion_exp(bzla, BZLA_FP_TO_FP_BV_NODE, exp, 0, sort);
-  if (!*lookup)
+  lookup = find_fp_conversion_exp(
+      bzla, BZLA_FP_TO_FP_BV_NODE, exp, 0, sort, &hash);
+  res    = *lookup;
+  if (!res)
   {
     if (BZLA_FULL_UNIQUE_TABLE(bzla->nodes_unique_table))
     {
       enlarge_nodes_unique_table(bzla);
-      lookup =
-          find_fp_conversion_exp(bzla, BZLA_FP_TO_FP_BV_NODE, exp, 0, sort);
+      lookup = find_fp_conversion_exp(
+          bzla, BZLA_FP_TO_FP_BV_NODE, exp, 0, sort, &hash);
     }
-    *lookup = new_unary_to_fp_exp_node(bzla, exp, sort);
-    assert(bzla->nodes_unique_table.num_elements < INT32_MAX);
-    bzla->nodes_unique_table.num_elements++;
-    (*lookup)->unique = 1;
+    res = new_unary_to_fp_exp_node(bzla, exp, sort);
+    add_to_nodes_unique_table(bzla, lookup, res, hash);
   }
   else
   {
-    inc_exp_ref_counter(bzla, *lookup);
+    inc_exp_ref_counter(bzla, res);
   }
-  assert(bzla_node_is_regular(*lookup));
-  return *lookup;
+  assert(bzla_node_is_regular(res));
+  return res;
 }
 
 static BzlaNode *
@@ -3350,7 +3520,8 @@ binary_exp_fp_conversion_exp(
   assert((kind != BZLA_FP_TO_SBV_NODE && kind != BZLA_FP_TO_UBV_NODE)
          || bzla_sort_is_bv(bzla, sort));
 
-  BzlaNode **lookup;
+  uint32_t hash;
+  BzlaNode **lookup, *res;
 
   e0 = bzla_simplify_exp(bzla, e0);
   e1 = bzla_simplify_exp(bzla, e1);
@@ -3358,25 +3529,24 @@ binary_exp_fp_conversion_exp(
   assert(bzla_node_is_rm(bzla, e0));
   assert(bzla_node_is_bv(bzla, e1) || bzla_node_is_fp(bzla, e1));
 
-  lookup = find_fp_conversion_exp(bzla, kind, e0, e1, sort);
-  if (!*lookup)
+  lookup = find_fp_conversion_exp(bzla, kind, e0, e1, sort, &hash);
+  res    = *lookup;
+  if (!res)
   {
     if (BZLA_FULL_UNIQUE_TABLE(bzla->nodes_unique_table))
     {
       enlarge_nodes_unique_table(bzla);
-      lookup = find_fp_conversion_exp(bzla, kind, e0, e1, sort);
+      lookup = find_fp_conversion_exp(bzla, kind, e0, e1, sort, &hash);
     }
-    *lookup = new_binary_fp_conversion_node(bzla, kind, e0, e1, sort);
-    assert(bzla->nodes_unique_table.num_elements < INT32_MAX);
-    bzla->nodes_unique_table.num_elements++;
-    (*lookup)->unique = 1;
+    res = new_binary_fp_conversion_node(bzla, kind, e0, e1, sort);
+    add_to_nodes_unique_table(bzla, lookup, res, hash);
   }
   else
   {
-    inc_exp_ref_counter(bzla, *lookup);
+    inc_exp_ref_counter(bzla, res);
   }
-  assert(bzla_node_is_regular(*lookup));
-  return *lookup;
+  assert(bzla_node_is_regular(res));
+  return res;
 }
 
 BzlaNode *
@@ -115,6 +115,29 @@ extern const char *const g_bzla_op2str[BZLA_NUM_OPS_NODE];
 
 /*------------------------------------------------------------------------*/
 
+/* By default, the parents of a node are kept in a doubly-linked list that is
+ * threaded through the parents, see BZLA_ADDITIONAL_NODE_STRUCT. If compiled
+ * with BZLA_COMPACT_PARENTS, every node instead keeps a vector with the ids
+ * of its parents, which is more compact but makes removing a parent linear
+ * in the number of parents. In both cases, apply parents are kept at the
+ * end, all other parents are ordered from the most recently added one. */
+#ifdef BZLA_COMPACT_PARENTS
+#define BZLA_NODE_PARENTS_STRUCT                                        \
+  struct                                                                \
+  {                                                                     \
+    int32_t *parent_ids;    /* ids of parents, apply parents last */    \
+    uint32_t parents_size;  /* allocated size of parent_ids */          \
+    uint32_t apply_parents; /* number of apply parents in parent_ids */ \
+  }
+#else
+#define BZLA_NODE_PARENTS_STRUCT                      \
+  struct                                              \
+  {                                                   \
+    BzlaNode *first_parent; /* head of parent list */ \
+    BzlaNode *last_parent;  /* tail of parent list */ \
+  }
+#endif
+
 #define BZLA_NODE_STRUCT                                                   \
   struct                                                                   \
   {                                                                        \
@@ -138,30 +161,44 @@ extern const char *const g_bzla_op2str[BZLA_NUM_OPS_NODE];
     uint32_t ext_refs;            /* external references counter */        \
     uint32_t parents;             /* number of parents */                  \
     BzlaSortId sort_id;           /* sort id */                            \
+    uint32_t hash;                /* hash value in unique table */         \
     union                                                                  \
     {                                                                      \
       BzlaAIGVec *av;        /* synthesized AIG vector */                  \
       BzlaPtrHashTable *rho; /* for finding array conflicts */             \
     };                                                                     \
-    BzlaNode *next;         /* next in unique table */                     \
-    BzlaNode *simplified;   /* simplified expression */                    \
-    Bzla *bzla;             /* bitwuzla instance */                        \
-    BzlaNode *first_parent; /* head of parent list */                      \
-    BzlaNode *last_parent;  /* tail of parent list */                      \
+    BzlaNode *next;       /* next in unique table */                       \
+    BzlaNode *simplified; /* simplified expression */                      \
+    Bzla *bzla;           /* bitwuzla instance */                          \
+    BZLA_NODE_PARENTS_STRUCT;                                              \
   }
 
 #define BZLA_NODE_MAX_CHILDREN 4
 
-#define BZLA_ADDITIONAL_NODE_STRUCT                                          \
-  struct                                                                     \
-  {                                                                          \
-    BzlaNode *e[BZLA_NODE_MAX_CHILDREN];           /* expression children */ \
-    BzlaNode *prev_parent[BZLA_NODE_MAX_CHILDREN]; /* prev in parent list of \
-                                                      child i */             \
-    BzlaNode *next_parent[BZLA_NODE_MAX_CHILDREN]; /* next in parent list of \
-                                                      child i */             \
+#ifdef BZLA_COMPACT_PARENTS
+#define BZLA_NODE_LINKS_PER_CHILD 1
+#else
+#define BZLA_NODE_LINKS_PER_CHILD 3
+#endif
+
+/* The children of a node with the given arity. Unless compiled with
+ * BZLA_COMPACT_PARENTS, the children are followed by the links of the node
+ * in the parent lists of its children: e[arity + i] is the previous and
+ * e[2 * arity + i] the next parent in the parent list of child i. Nodes are
+ * only allocated with room for 'arity' children and their links, hence the
+ * position of the links depends on the arity and must only be accessed via
+ * BZLA_NODE_PREV_PARENT and BZLA_NODE_NEXT_PARENT. */
+#define BZLA_ADDITIONAL_NODE_STRUCT(arity)                           \
+  struct                                                             \
+  {                                                                  \
+    BzlaNode *e[BZLA_NODE_LINKS_PER_CHILD * (arity)]; /* children */ \
   }
 
+#ifndef BZLA_COMPACT_PARENTS
+#define BZLA_NODE_PREV_PARENT(exp, i) ((exp)->e[(exp)->arity + (i)])
+#define BZLA_NODE_NEXT_PARENT(exp, i) ((exp)->e[2 * (exp)->arity + (i)])
+#endif
+
 /*------------------------------------------------------------------------*/
 
 struct BzlaBVVarNode
@@ -187,7 +224,7 @@ typedef struct BzlaBVConstNode BzlaBVConstNode;
 struct BzlaBVSliceNode
 {
   BZLA_NODE_STRUCT;
-  BZLA_ADDITIONAL_NODE_STRUCT;
+  BZLA_ADDITIONAL_NODE_STRUCT(1);
   uint32_t upper;
   uint32_t lower;
 };
@@ -198,7 +235,7 @@ typedef struct BzlaBVSliceNode BzlaBVSliceNode;
 struct BzlaNode
 {
   BZLA_NODE_STRUCT;
-  BZLA_ADDITIONAL_NODE_STRUCT;
+  BZLA_ADDITIONAL_NODE_STRUCT(BZLA_NODE_MAX_CHILDREN);
 };
 
 /*------------------------------------------------------------------------*/
@@ -225,7 +262,7 @@ typedef struct BzlaFPConstNode BzlaFPConstNode;
   struct                                                     \
   {                                                          \
     BZLA_NODE_STRUCT;                                        \
-    BZLA_ADDITIONAL_NODE_STRUCT;                             \
+    BZLA_ADDITIONAL_NODE_STRUCT(2);                          \
     BzlaNode *body; /* short-cut for curried binder terms */ \
   }
 
@@ -253,7 +290,7 @@ typedef struct BzlaParamNode BzlaParamNode;
 struct BzlaArgsNode
 {
   BZLA_NODE_STRUCT;
-  BZLA_ADDITIONAL_NODE_STRUCT;
+  BZLA_ADDITIONAL_NODE_STRUCT(BZLA_NODE_MAX_CHILDREN);
 };
 typedef struct BzlaArgsNode BzlaArgsNode;
 
@@ -272,7 +309,7 @@ bool bzla_node_fp_needs_word_blast(Bzla *bzla, const BzlaNode *exp);
 
 /**
  * Tag parent 'node' (to be linked in 'first_parent', 'last_parent',
- * 'prev_parent[tag]' and 'next_parent[tag] of the child node) with
+ * BZLA_NODE_PREV_PARENT and BZLA_NODE_NEXT_PARENT of the child node) with
  * its index to identify its position in the 'parents' array of the child node.
  */
 static inline BzlaNode *
@@ -308,7 +345,7 @@ bzla_node_is_inverted(const BzlaNode *node)
  *
  * Node pointers can be tagged as inverted (any) or with the index position in
  * the parents array (if they are accessed via 'first_parent', 'last_parent',
- * 'prev_parent[]', 'next_parent[]').
+ * BZLA_NODE_PREV_PARENT and BZLA_NODE_NEXT_PARENT).
  */
 static inline BzlaNode *
 bzla_node_real_addr(const BzlaNode *node)
@@ -1177,6 +1214,12 @@ BzlaNode *bzla_node_get_by_id(Bzla *bzla, int32_t id);
  */
 BzlaNode *bzla_node_match_by_id(Bzla *bzla, int32_t id);
 
+/**
+ * Get the first parent of given node as returned by the parent iterator,
+ * 0 if it does not have any parents.
+ */
+BzlaNode *bzla_node_get_first_parent(const BzlaNode *exp);
+
 /*------------------------------------------------------------------------*/
 
 /** Gets the symbol of an expression. */
@@ -277,7 +277,8 @@ bzla_opt_init_opts(Bzla *bzla)
                opts,
                "prop",
                BZLA_ENGINE_PROP,
-               "use the propagation-based local search engine (QF_BV only)");
+               "use the propagation-based local search engine (QF_BV and "
+               "QF_BVFP)");
   add_opt_help(mm,
                opts,
                "sls",
@@ -405,6 +406,16 @@ bzla_opt_init_opts(Bzla *bzla)
       0,
       1,
       "Print CNF formula sent to SAT solver in DIMACS format and terminate.");
+  init_opt(bzla,
+           BZLA_OPT_BMC_KMAX,
+           false,
+           false,
+           "bmc-kmax",
+           0,
+           20,
+           0,
+           UINT32_MAX,
+           "maximum bound for bounded model checking of BTOR2 models");
 
   /* rewriting / preprocessing (expert options) ----------------------------- */
   init_opt(bzla,
@@ -437,6 +448,17 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            1,
            "add ackermann constraints");
+  init_opt(bzla,
+           BZLA_OPT_PP_ACKERMANN_SPARSE,
+           true,
+           true,
+           "ackermannize-sparse",
+           "acks",
+           0,
+           0,
+           1,
+           "skip ackermann constraints for applications with distinct "
+           "arguments");
   init_opt(bzla,
            BZLA_OPT_PP_BETA_REDUCE,
            true,
@@ -770,6 +792,17 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            1,
            "represent array store as lambda");
+  init_opt(bzla,
+           BZLA_OPT_FUN_SAT_PHASES,
+           true,
+           true,
+           "fun-sat-phases",
+           0,
+           1,
+           0,
+           1,
+           "initialize phases of the SAT solver with the current model values "
+           "of bit-blasted inputs");
 
   /* SLS engine (expert options) -------------------------------------------- */
   init_opt(bzla,
@@ -782,6 +815,16 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            UINT32_MAX,
            "number of bit-flips used as a limit for sls engine");
+  init_opt(bzla,
+           BZLA_OPT_SLS_N_THREADS,
+           true,
+           false,
+           "sls-n-threads",
+           0,
+           1,
+           1,
+           UINT32_MAX,
+           "number of threads to use for scoring moves in the sls engine");
 
   init_opt(bzla,
            BZLA_OPT_SLS_STRATEGY,
@@ -1055,6 +1098,16 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            1,
            "use domain propagators to determine constant bits");
+  init_opt(bzla,
+           BZLA_OPT_PROP_CONST_DOMAINS_LIMIT,
+           true,
+           true,
+           "prop-const-domains-limit",
+           0,
+           0,
+           0,
+           UINT32_MAX,
+           "limit for domain propagator applications (0 for no limit)");
 #if 0
   init_opt (bzla,
             BZLA_OPT_PROP_DOMAINS,
@@ -1383,6 +1436,16 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            1,
            "synthesize quantifier instantiations");
+  init_opt(bzla,
+           BZLA_OPT_QUANT_SYNTH_N_THREADS,
+           true,
+           false,
+           "quant-synth-n-threads",
+           0,
+           1,
+           1,
+           UINT32_MAX,
+           "number of threads to use for term enumeration in synthesis");
   init_opt(bzla,
            BZLA_OPT_QUANT_SKOLEM_UF,
            true,
@@ -1413,6 +1476,16 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            1,
            "enable model-based quantifier instantiation");
+  init_opt(bzla,
+           BZLA_OPT_QUANT_CE_N_THREADS,
+           true,
+           false,
+           "quant-ce-n-threads",
+           0,
+           1,
+           1,
+           UINT32_MAX,
+           "number of threads to use for counterexample checks");
 
   init_opt(bzla,
            BZLA_OPT_QUANT_MODE,
@@ -1488,6 +1561,17 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            1,
            "interactive parse mode");
+  init_opt(bzla,
+           BZLA_OPT_LS_SHARE_CONST_BITS,
+           true,
+           true,
+           "ls-share-const-bits",
+           0,
+           0,
+           0,
+           1,
+           "share constant bits determined via domain propagation with "
+           "bit-blasting engine");
   init_opt(bzla,
            BZLA_OPT_LS_SHARE_SAT,
            true,
@@ -25,6 +25,7 @@ enum BzlaOption
 {
   /* General options */
   BZLA_OPT_AUTO_CLEANUP,
+  BZLA_OPT_BMC_KMAX,
   BZLA_OPT_ENGINE,
   BZLA_OPT_EXIT_CODES,
   BZLA_OPT_INCREMENTAL,
@@ -42,6 +43,7 @@ enum BzlaOption
 
   /* Rewriting/preprocessing (expert) */
   BZLA_OPT_PP_ACKERMANN,
+  BZLA_OPT_PP_ACKERMANN_SPARSE,
   BZLA_OPT_PP_BETA_REDUCE,
   BZLA_OPT_PP_ELIMINATE_EXTRACTS,
   BZLA_OPT_PP_ELIMINATE_ITES,
@@ -66,6 +68,7 @@ enum BzlaOption
 
   BZLA_OPT_FUN_PREPROP,
   BZLA_OPT_FUN_PRESLS,
+  BZLA_OPT_FUN_SAT_PHASES,
   BZLA_OPT_FUN_DUAL_PROP,
   BZLA_OPT_FUN_DUAL_PROP_QSORT,
   BZLA_OPT_FUN_JUST,
@@ -89,6 +92,7 @@ enum BzlaOption
   BZLA_OPT_SLS_MOVE_RANGE,
   BZLA_OPT_SLS_MOVE_SEGMENT,
   BZLA_OPT_SLS_NFLIPS,
+  BZLA_OPT_SLS_N_THREADS,
   BZLA_OPT_SLS_PROB_MOVE_RAND_WALK,
   BZLA_OPT_SLS_STRATEGY,
   BZLA_OPT_SLS_USE_BANDIT,
@@ -99,6 +103,7 @@ enum BzlaOption
   BZLA_OPT_PROP_ASHR,
   BZLA_OPT_PROP_CONST_BITS,
   BZLA_OPT_PROP_CONST_DOMAINS,
+  BZLA_OPT_PROP_CONST_DOMAINS_LIMIT,
 #if 0
   BZLA_OPT_PROP_DOMAINS,
 #endif
@@ -135,9 +140,11 @@ enum BzlaOption
   /* Quantifier engine (expert) */
   BZLA_OPT_QUANT_SYNTH_SK,
   BZLA_OPT_QUANT_SYNTH_QI,
+  BZLA_OPT_QUANT_SYNTH_N_THREADS,
   BZLA_OPT_QUANT_SKOLEM_UF,
   BZLA_OPT_QUANT_EAGER_SKOLEM,
   BZLA_OPT_QUANT_MBQI,
+  BZLA_OPT_QUANT_CE_N_THREADS,
   BZLA_OPT_QUANT_MODE,
 
   /* Other expert options */
@@ -146,6 +153,7 @@ enum BzlaOption
   BZLA_OPT_CHECK_UNCONSTRAINED,
   BZLA_OPT_CHECK_UNSAT_ASSUMPTIONS,
   BZLA_OPT_DECLSORT_BV_WIDTH,
+  BZLA_OPT_LS_SHARE_CONST_BITS,
   BZLA_OPT_LS_SHARE_SAT,
   BZLA_OPT_PARSE_INTERACTIVE,
   BZLA_OPT_SAT_ENGINE_CADICAL_FREEZE,
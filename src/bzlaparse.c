@@ -19,6 +19,7 @@
 #include "parser/bzlasmt2.h"
 #include "utils/bzlamem.h"
 #include "utils/bzlastack.h"
+#include "utils/bzlautil.h"
 
 static bool
 has_compressed_suffix(const char *str, const char *suffix)
@@ -55,9 +56,13 @@ parse_aux(Bitwuzla *bitwuzla,
   BzlaParser *parser;
   BzlaParseResult parse_res;
   int32_t res;
+  double start, start_sat;
 
   BzlaMsg *bmsg = bitwuzla_get_bzla_msg(bitwuzla);
+  Bzla *bzla    = bitwuzla_get_bzla(bitwuzla);
 
+  start      = bzla_util_monotonic_time();
+  start_sat  = bzla->time.sat;
   res        = BITWUZLA_UNKNOWN;
   *error_msg = 0;
 
@@ -96,6 +101,9 @@ parse_aux(Bitwuzla *bitwuzla,
   /* cleanup */
   parser_api->reset(parser);
 
+  /* do not count solving time of check-sat commands executed while parsing */
+  bzla->time.parse +=
+      bzla_util_monotonic_time() - start - (bzla->time.sat - start_sat);
   return res;
 }
 
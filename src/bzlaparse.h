@@ -78,4 +78,5 @@ int32_t bzla_parse_smt2(Bitwuzla *bitwuzla,
                         BitwuzlaResult *status);
 
 BzlaMsg *bitwuzla_get_bzla_msg(Bitwuzla *bitwuzla);
+Bzla *bitwuzla_get_bzla(Bitwuzla *bitwuzla);
 #endif
@@ -13,13 +13,16 @@
 #include "bzlabv.h"
 #include "bzlaconsutils.h"
 #include "bzlaessutils.h"
+#include "bzlafp.h"
 #include "bzlainvutils.h"
 #include "bzlalsutils.h"
 #include "bzlanode.h"
 #include "bzlaprintmodel.h"
+#include "bzlarm.h"
 #include "bzlaslsutils.h"
 #include "bzlaslvprop.h"
 #include "bzlaslvsls.h"
+#include "bzlasort.h"
 #include "utils/bzlahash.h"
 #include "utils/bzlanodeiter.h"
 #include "utils/bzlastack.h"
@@ -7065,6 +7068,658 @@ bzla_proputils_inv_cond_const(Bzla *bzla, BzlaPropInfo *pi)
   return res;
 }
 
+/* ========================================================================== */
+/* Value computation for floating-point operations                            */
+/* ========================================================================== */
+
+/* Floating-point and rounding mode values are represented by their IEEE-754
+ * bit-vector value (as produced by the word-blaster). Inverse values are
+ * computed algebraically on the native floating-point values and verified by
+ * evaluating the operation, we do not maintain invertibility conditions. */
+
+/* Max. distance (in ulps) to search around an inverse value candidate that
+ * does not evaluate to the target value due to rounding. */
+#define BZLA_PROPUTILS_FP_MAX_ULP_DIST 2
+
+enum BzlaPropFPClass
+{
+  BZLA_PROP_FP_CLASS_ZERO,
+  BZLA_PROP_FP_CLASS_SUBNORMAL,
+  BZLA_PROP_FP_CLASS_NORMAL,
+  BZLA_PROP_FP_CLASS_INF,
+  BZLA_PROP_FP_CLASS_NAN,
+  BZLA_PROP_FP_CLASS_MAX,
+};
+typedef enum BzlaPropFPClass BzlaPropFPClass;
+
+static bool
+is_const_node(BzlaNode *n)
+{
+  return bzla_node_is_bv_const(n) || bzla_node_is_fp_const(n)
+         || bzla_node_is_rm_const(n);
+}
+
+static bool
+fp_bv_is(Bzla *bzla,
+         BzlaSortId sort,
+         const BzlaBitVector *bv,
+         bool (*fun)(Bzla *, const BzlaFloatingPoint *))
+{
+  bool res;
+  BzlaFloatingPoint *fp;
+
+  fp  = bzla_fp_from_bv(bzla, sort, bv);
+  res = fun(bzla, fp);
+  bzla_fp_free(bzla, fp);
+  return res;
+}
+
+/**
+ * Map an IEEE-754 bit-vector value to an unsigned bit-vector that preserves
+ * the order of non-NaN floating-point values (-0 is ordered before +0).
+ */
+static BzlaBitVector *
+fp_bv_to_ordered(BzlaMemMgr *mm, const BzlaBitVector *bv)
+{
+  uint32_t bw;
+  BzlaBitVector *res;
+
+  bw = bzla_bv_get_width(bv);
+  if (bzla_bv_get_bit(bv, bw - 1)) return bzla_bv_not(mm, bv);
+  res = bzla_bv_copy(mm, bv);
+  bzla_bv_set_bit(res, bw - 1, 1);
+  return res;
+}
+
+/** Inverse of fp_bv_to_ordered. */
+static BzlaBitVector *
+fp_bv_from_ordered(BzlaMemMgr *mm, const BzlaBitVector *bv)
+{
+  uint32_t bw;
+  BzlaBitVector *res;
+
+  bw = bzla_bv_get_width(bv);
+  if (!bzla_bv_get_bit(bv, bw - 1)) return bzla_bv_not(mm, bv);
+  res = bzla_bv_copy(mm, bv);
+  bzla_bv_set_bit(res, bw - 1, 0);
+  return res;
+}
+
+static BzlaBitVector *
+fp_new_random_non_zero(BzlaMemMgr *mm, BzlaRNG *rng, uint32_t bw)
+{
+  BzlaBitVector *from, *to, *res;
+
+  from = bzla_bv_one(mm, bw);
+  to   = bzla_bv_ones(mm, bw);
+  res  = bzla_bv_new_random_range(mm, rng, bw, from, to);
+  bzla_bv_free(mm, from);
+  bzla_bv_free(mm, to);
+  return res;
+}
+
+/** Create a random IEEE-754 bit-vector value of the given class and sign. */
+static BzlaBitVector *
+fp_new_of_class(Bzla *bzla, BzlaSortId sort, BzlaPropFPClass cls, bool sign)
+{
+  uint32_t ew, sw;
+  BzlaBitVector *bvsign, *bvexp, *bvsig, *from, *to, *tmp, *res;
+  BzlaMemMgr *mm;
+
+  mm = bzla->mm;
+  ew = bzla_sort_fp_get_exp_width(bzla, sort);
+  sw = bzla_sort_fp_get_sig_width(bzla, sort) - 1;
+
+  if (cls == BZLA_PROP_FP_CLASS_NAN)
+  {
+    /* all NaNs are equal in SMT-LIB, always use the canonical one */
+    BzlaFloatingPoint *nan = bzla_fp_nan(bzla, sort);
+    res                    = bzla_fp_as_bv(bzla, nan);
+    bzla_fp_free(bzla, nan);
+    return res;
+  }
+
+  bvsign = sign ? bzla_bv_one(mm, 1) : bzla_bv_zero(mm, 1);
+  switch (cls)
+  {
+    case BZLA_PROP_FP_CLASS_ZERO:
+      bvexp = bzla_bv_zero(mm, ew);
+      bvsig = bzla_bv_zero(mm, sw);
+      break;
+    case BZLA_PROP_FP_CLASS_SUBNORMAL:
+      bvexp = bzla_bv_zero(mm, ew);
+      bvsig = fp_new_random_non_zero(mm, bzla->rng, sw);
+      break;
+    case BZLA_PROP_FP_CLASS_NORMAL:
+      from  = bzla_bv_one(mm, ew);
+      tmp   = bzla_bv_ones(mm, ew);
+      to    = bzla_bv_dec(mm, tmp);
+      bvexp = bzla_bv_new_random_range(mm, bzla->rng, ew, from, to);
+      bvsig = bzla_bv_new_random(mm, bzla->rng, sw);
+      bzla_bv_free(mm, from);
+      bzla_bv_free(mm, tmp);
+      bzla_bv_free(mm, to);
+      break;
+    default:
+      assert(cls == BZLA_PROP_FP_CLASS_INF);
+      bvexp = bzla_bv_ones(mm, ew);
+      bvsig = bzla_bv_zero(mm, sw);
+  }
+  tmp = bzla_bv_concat(mm, bvsign, bvexp);
+  res = bzla_bv_concat(mm, tmp, bvsig);
+  bzla_bv_free(mm, tmp);
+  bzla_bv_free(mm, bvsign);
+  bzla_bv_free(mm, bvexp);
+  bzla_bv_free(mm, bvsig);
+  return res;
+}
+
+static void
+fp_set_const_bits(Bzla *bzla, BzlaPropInfo *pi, BzlaBitVector **res)
+{
+  const BzlaBvDomain *d = pi->bvd[pi->pos_x];
+  if (d && bzla_bvdomain_has_fixed_bits(bzla->mm, d))
+  {
+    set_const_bits(bzla->mm, d, res);
+  }
+}
+
+/** Return true if operation 'exp' evaluates to the target value for 'x'. */
+static bool
+fp_is_inv_value(Bzla *bzla, BzlaPropInfo *pi, const BzlaBitVector *x)
+{
+  bool res;
+  uint32_t i;
+  BzlaBitVector *e[3], *val;
+
+  assert(pi->exp->arity <= 3);
+  for (i = 0; i < pi->exp->arity; i++)
+  {
+    e[i] = (BzlaBitVector *) (i == (uint32_t) pi->pos_x ? x : pi->bv[i]);
+  }
+  val = bzla_lsutils_fp_eval(bzla, (BzlaNode *) pi->exp, e);
+  res = bzla_bv_compare(val, pi->target_value) == 0;
+  bzla_bv_free(bzla->mm, val);
+  return res;
+}
+
+/**
+ * Search the floating-point values closest to 'x' (in ulps) for an inverse
+ * value. Compensates for rounding errors of the algebraic inverse.
+ */
+static BzlaBitVector *
+fp_search_inv_value(Bzla *bzla, BzlaPropInfo *pi, const BzlaBitVector *x)
+{
+  uint32_t i, bw;
+  BzlaBitVector *key, *dist, *tmp, *res = 0;
+  BzlaMemMgr *mm;
+
+  mm  = bzla->mm;
+  bw  = bzla_bv_get_width(x);
+  key = fp_bv_to_ordered(mm, x);
+  for (i = 1; !res && i <= 2 * BZLA_PROPUTILS_FP_MAX_ULP_DIST; i++)
+  {
+    dist = bzla_bv_uint64_to_bv(mm, (i + 1) / 2, bw);
+    tmp  = i % 2 ? bzla_bv_add(mm, key, dist) : bzla_bv_sub(mm, key, dist);
+    res  = fp_bv_from_ordered(mm, tmp);
+    fp_set_const_bits(bzla, pi, &res);
+    if (!fp_is_inv_value(bzla, pi, res))
+    {
+      bzla_bv_free(mm, res);
+      res = 0;
+    }
+    bzla_bv_free(mm, tmp);
+    bzla_bv_free(mm, dist);
+  }
+  bzla_bv_free(mm, key);
+  return res;
+}
+
+/** Inverse value for rounding mode 'x': try all rounding modes. */
+static BzlaBitVector *
+fp_inv_rm(Bzla *bzla, BzlaPropInfo *pi)
+{
+  uint32_t i, start;
+  BzlaBitVector *res;
+
+  start = bzla_rng_pick_rand(bzla->rng, 0, BZLA_RM_MAX - 1);
+  for (i = 0; i < BZLA_RM_MAX; i++)
+  {
+    res = bzla_bv_uint64_to_bv(
+        bzla->mm, (start + i) % BZLA_RM_MAX, BZLA_RM_BW);
+    if (fp_is_inv_value(bzla, pi, res)) return res;
+    bzla_bv_free(bzla->mm, res);
+  }
+  return 0;
+}
+
+/** Inverse value for 'x' given 'is_<class>(x) = t'. */
+static BzlaBitVector *
+fp_inv_class(Bzla *bzla, BzlaPropInfo *pi)
+{
+  bool target, neg;
+  uint32_t bw, cls, other;
+  BzlaSortId sort;
+  BzlaBitVector *res;
+  const BzlaBitVector *x;
+
+  sort   = bzla_node_get_sort_id(pi->exp->e[0]);
+  x      = pi->bv[0];
+  bw     = bzla_bv_get_width(x);
+  target = bzla_bv_is_true(pi->target_value);
+
+  if (pi->exp->kind == BZLA_FP_IS_NEG_NODE
+      || pi->exp->kind == BZLA_FP_IS_POS_NODE)
+  {
+    /* keep the magnitude of the current value, fix the sign bit */
+    neg = (pi->exp->kind == BZLA_FP_IS_NEG_NODE) == target;
+    if (fp_bv_is(bzla, sort, x, bzla_fp_is_nan))
+    {
+      return fp_new_of_class(bzla, sort, BZLA_PROP_FP_CLASS_NORMAL, neg);
+    }
+    res = bzla_bv_copy(bzla->mm, x);
+    bzla_bv_set_bit(res, bw - 1, neg);
+    return res;
+  }
+
+  switch (pi->exp->kind)
+  {
+    case BZLA_FP_IS_ZERO_NODE: cls = BZLA_PROP_FP_CLASS_ZERO; break;
+    case BZLA_FP_IS_SUBNORM_NODE: cls = BZLA_PROP_FP_CLASS_SUBNORMAL; break;
+    case BZLA_FP_IS_NORM_NODE: cls = BZLA_PROP_FP_CLASS_NORMAL; break;
+    case BZLA_FP_IS_INF_NODE: cls = BZLA_PROP_FP_CLASS_INF; break;
+    default:
+      assert(pi->exp->kind == BZLA_FP_IS_NAN_NODE);
+      cls = BZLA_PROP_FP_CLASS_NAN;
+  }
+  if (!target)
+  {
+    /* pick any other class */
+    other = bzla_rng_pick_rand(bzla->rng, 0, BZLA_PROP_FP_CLASS_MAX - 2);
+    cls   = other >= cls ? other + 1 : other;
+  }
+  return fp_new_of_class(
+      bzla, sort, (BzlaPropFPClass) cls, bzla_rng_flip_coin(bzla->rng));
+}
+
+/** Inverse value for 'x' given 'x = s = t' or 's = x = t'. */
+static BzlaBitVector *
+fp_inv_eq(Bzla *bzla, BzlaPropInfo *pi)
+{
+  BzlaSortId sort;
+  const BzlaBitVector *s;
+
+  sort = bzla_node_get_sort_id(pi->exp->e[pi->pos_x]);
+  s    = pi->bv[1 - pi->pos_x];
+
+  if (bzla_bv_is_true(pi->target_value))
+  {
+    return bzla_bv_copy(bzla->mm, s);
+  }
+  if (fp_bv_is(bzla, sort, s, bzla_fp_is_nan))
+  {
+    return fp_new_of_class(bzla,
+                           sort,
+                           BZLA_PROP_FP_CLASS_NORMAL,
+                           bzla_rng_flip_coin(bzla->rng));
+  }
+  return bzla_bv_flipped_bit(
+      bzla->mm,
+      s,
+      bzla_rng_pick_rand(bzla->rng, 0, bzla_bv_get_width(s) - 1));
+}
+
+/**
+ * Inverse value for 'x' given 'x < s = t', 's < x = t', 'x <= s = t' or
+ * 's <= x = t'.
+ */
+static BzlaBitVector *
+fp_inv_lt(Bzla *bzla, BzlaPropInfo *pi)
+{
+  bool target, below, strict;
+  BzlaSortId sort;
+  BzlaBitVector *s_lo, *s_hi, *lo, *hi, *tmp, *key, *res;
+  BzlaMemMgr *mm;
+  const BzlaBitVector *s;
+
+  mm     = bzla->mm;
+  sort   = bzla_node_get_sort_id(pi->exp->e[pi->pos_x]);
+  s      = pi->bv[1 - pi->pos_x];
+  target = bzla_bv_is_true(pi->target_value);
+
+  /* no value is ordered with respect to NaN */
+  if (fp_bv_is(bzla, sort, s, bzla_fp_is_nan)) return 0;
+
+  /* determine if x has to be below or above s, and if strictly */
+  below  = (pi->pos_x == 0) == target;
+  strict = (pi->exp->kind == BZLA_FP_LT_NODE) == target;
+
+  /* -0 and +0 are equal */
+  if (fp_bv_is(bzla, sort, s, bzla_fp_is_zero))
+  {
+    tmp  = fp_new_of_class(bzla, sort, BZLA_PROP_FP_CLASS_ZERO, true);
+    s_lo = fp_bv_to_ordered(mm, tmp);
+    bzla_bv_free(mm, tmp);
+    tmp  = fp_new_of_class(bzla, sort, BZLA_PROP_FP_CLASS_ZERO, false);
+    s_hi = fp_bv_to_ordered(mm, tmp);
+    bzla_bv_free(mm, tmp);
+  }
+  else
+  {
+    s_lo = fp_bv_to_ordered(mm, s);
+    s_hi = bzla_bv_copy(mm, s_lo);
+  }
+
+  if (below)
+  {
+    tmp = fp_new_of_class(bzla, sort, BZLA_PROP_FP_CLASS_INF, true);
+    lo  = fp_bv_to_ordered(mm, tmp);
+    hi  = strict ? bzla_bv_dec(mm, s_lo) : bzla_bv_copy(mm, s_hi);
+  }
+  else
+  {
+    tmp = fp_new_of_class(bzla, sort, BZLA_PROP_FP_CLASS_INF, false);
+    lo  = strict ? bzla_bv_inc(mm, s_hi) : bzla_bv_copy(mm, s_lo);
+    hi  = fp_bv_to_ordered(mm, tmp);
+  }
+  bzla_bv_free(mm, tmp);
+
+  res = 0;
+  if (bzla_bv_compare(lo, hi) <= 0)
+  {
+    /* values close to s are more likely to satisfy other constraints on s */
+    if (bzla_rng_pick_with_prob(bzla->rng, BZLA_PROB_50))
+    {
+      key = bzla_bv_copy(mm, below ? hi : lo);
+    }
+    else
+    {
+      key = bzla_bv_new_random_range(
+          mm, bzla->rng, bzla_bv_get_width(lo), lo, hi);
+    }
+    res = fp_bv_from_ordered(mm, key);
+    bzla_bv_free(mm, key);
+  }
+  bzla_bv_free(mm, s_lo);
+  bzla_bv_free(mm, s_hi);
+  bzla_bv_free(mm, lo);
+  bzla_bv_free(mm, hi);
+  return res;
+}
+
+/**
+ * Inverse value for 'x' of an arithmetic operation (add, mul, div, sqrt,
+ * to_fp): compute the algebraic inverse under the current rounding mode.
+ */
+static BzlaBitVector *
+fp_inv_arith(Bzla *bzla, BzlaPropInfo *pi)
+{
+  BzlaRoundingMode rm;
+  BzlaSortId sort_x;
+  BzlaFloatingPoint *t, *s = 0, *tmp, *res;
+  BzlaBitVector *bvres;
+
+  assert(pi->pos_x > 0);
+
+  rm     = bzla_rm_from_bv(pi->bv[0]);
+  sort_x = bzla_node_get_sort_id(pi->exp->e[pi->pos_x]);
+  t      = bzla_fp_from_bv(
+      bzla, bzla_node_get_sort_id(pi->exp), pi->target_value);
+  if (pi->exp->arity == 3)
+  {
+    s = bzla_fp_from_bv(bzla, sort_x, pi->bv[3 - pi->pos_x]);
+  }
+
+  switch (pi->exp->kind)
+  {
+    case BZLA_FP_ADD_NODE:
+      tmp = bzla_fp_neg(bzla, s);
+      res = bzla_fp_add(bzla, rm, t, tmp);
+      bzla_fp_free(bzla, tmp);
+      break;
+    case BZLA_FP_MUL_NODE: res = bzla_fp_div(bzla, rm, t, s); break;
+    case BZLA_FP_DIV_NODE:
+      res = pi->pos_x == 1 ? bzla_fp_mul(bzla, rm, t, s)
+                           : bzla_fp_div(bzla, rm, s, t);
+      break;
+    case BZLA_FP_SQRT_NODE: res = bzla_fp_mul(bzla, rm, t, t); break;
+    default:
+      assert(pi->exp->kind == BZLA_FP_TO_FP_FP_NODE);
+      res = bzla_fp_convert(bzla, sort_x, rm, t);
+  }
+  bvres = bzla_fp_as_bv(bzla, res);
+  bzla_fp_free(bzla, res);
+  bzla_fp_free(bzla, t);
+  if (s) bzla_fp_free(bzla, s);
+  return bvres;
+}
+
+/**
+ * Compute an inverse value for 'x'. Returns 0 if no inverse value could be
+ * determined.
+ */
+static BzlaBitVector *
+fp_inv_value(Bzla *bzla, BzlaPropInfo *pi)
+{
+  uint32_t bw;
+  BzlaNode *x;
+  BzlaBitVector *res, *tmp;
+  BzlaMemMgr *mm;
+
+  mm  = bzla->mm;
+  x   = pi->exp->e[pi->pos_x];
+  res = 0;
+
+  if (bzla_node_is_rm(bzla, x))
+  {
+    /* fp_inv_rm only returns verified values */
+    return fp_inv_rm(bzla, pi);
+  }
+
+  switch (pi->exp->kind)
+  {
+    case BZLA_FP_IS_INF_NODE:
+    case BZLA_FP_IS_NAN_NODE:
+    case BZLA_FP_IS_NEG_NODE:
+    case BZLA_FP_IS_NORM_NODE:
+    case BZLA_FP_IS_POS_NODE:
+    case BZLA_FP_IS_SUBNORM_NODE:
+    case BZLA_FP_IS_ZERO_NODE: res = fp_inv_class(bzla, pi); break;
+    case BZLA_FP_EQ_NODE: res = fp_inv_eq(bzla, pi); break;
+    case BZLA_FP_LT_NODE:
+    case BZLA_FP_LTE_NODE: res = fp_inv_lt(bzla, pi); break;
+    case BZLA_FP_ABS_NODE:
+      res = bzla_bv_copy(mm, pi->target_value);
+      bw  = bzla_bv_get_width(res);
+      bzla_bv_set_bit(res, bw - 1, bzla_rng_flip_coin(bzla->rng));
+      break;
+    case BZLA_FP_NEG_NODE:
+      bw  = bzla_bv_get_width(pi->target_value);
+      res = bzla_bv_flipped_bit(mm, pi->target_value, bw - 1);
+      break;
+    case BZLA_FP_TO_FP_BV_NODE:
+    case BZLA_FP_RTI_NODE: res = bzla_bv_copy(mm, pi->target_value); break;
+    case BZLA_FP_REM_NODE:
+      /* rem(x, s) = x if |x| <= |s| / 2 */
+      if (pi->pos_x == 0) res = bzla_bv_copy(mm, pi->target_value);
+      break;
+    case BZLA_FP_ADD_NODE:
+    case BZLA_FP_MUL_NODE:
+    case BZLA_FP_DIV_NODE:
+    case BZLA_FP_SQRT_NODE:
+    case BZLA_FP_TO_FP_FP_NODE: res = fp_inv_arith(bzla, pi); break;
+    default:
+      /* to_fp from signed/unsigned bit-vector: no inverse value */
+      break;
+  }
+
+  if (res)
+  {
+    fp_set_const_bits(bzla, pi, &res);
+    if (!fp_is_inv_value(bzla, pi, res))
+    {
+      tmp = bzla_node_is_fp(bzla, x) ? fp_search_inv_value(bzla, pi, res) : 0;
+      bzla_bv_free(mm, res);
+      res = tmp;
+    }
+  }
+  return res;
+}
+
+/** Compute a random value for 'x'. */
+static BzlaBitVector *
+fp_cons_value(Bzla *bzla, BzlaPropInfo *pi)
+{
+  BzlaNode *x;
+  BzlaSortId sort;
+  BzlaBitVector *res;
+  BzlaMemMgr *mm;
+
+  mm = bzla->mm;
+  x  = pi->exp->e[pi->pos_x];
+
+  if (bzla_node_is_rm(bzla, x))
+  {
+    res = bzla_bv_uint64_to_bv(
+        mm, bzla_rng_pick_rand(bzla->rng, 0, BZLA_RM_MAX - 1), BZLA_RM_BW);
+  }
+  else if (bzla_node_is_fp(bzla, x))
+  {
+    sort = bzla_node_get_sort_id(x);
+    /* random bit patterns rarely hit special values, pick them explicitly */
+    if (bzla_rng_pick_with_prob(bzla->rng, 100))
+    {
+      res = fp_new_of_class(
+          bzla,
+          sort,
+          (BzlaPropFPClass) bzla_rng_pick_rand(
+              bzla->rng, 0, BZLA_PROP_FP_CLASS_MAX - 1),
+          bzla_rng_flip_coin(bzla->rng));
+    }
+    else
+    {
+      res = bzla_bv_new_random(
+          mm, bzla->rng, bzla_sort_fp_get_bv_width(bzla, sort));
+    }
+  }
+  else
+  {
+    res = bzla_bv_new_random(mm, bzla->rng, bzla_node_bv_get_width(bzla, x));
+  }
+  fp_set_const_bits(bzla, pi, &res);
+  bzla_lsutils_fp_normalize_value(bzla, x, &res);
+  return res;
+}
+
+/**
+ * Return true if the value of given operation is determined by operand 'x'
+ * (and the rounding mode) only, i.e., if consistent values are inverse
+ * values.
+ */
+static bool
+fp_is_unary(Bzla *bzla, const BzlaNode *exp)
+{
+  uint32_t i, n;
+  for (i = 0, n = 0; i < exp->arity; i++)
+  {
+    if (!bzla_node_is_rm(bzla, exp->e[i])) n += 1;
+  }
+  return n == 1;
+}
+
+BzlaBitVector *
+bzla_proputils_cons_fp(Bzla *bzla, BzlaPropInfo *pi)
+{
+  assert(bzla);
+  assert(pi);
+  assert(bzla_node_is_regular(pi->exp));
+  assert(bzla_lsutils_is_fp_op(pi->exp));
+  assert(!is_const_node(pi->exp->e[pi->pos_x]));
+
+  BzlaBitVector *res = 0;
+
+  record_cons_stats(bzla, &BZLA_PROP_SOLVER(bzla)->stats.cons_fp);
+
+  if (fp_is_unary(bzla, pi->exp)
+      && !bzla_node_is_rm(bzla, pi->exp->e[pi->pos_x]))
+  {
+    res = fp_inv_value(bzla, pi);
+  }
+  if (!res)
+  {
+    res = fp_cons_value(bzla, pi);
+  }
+  return res;
+}
+
+BzlaBitVector *
+bzla_proputils_inv_fp(Bzla *bzla, BzlaPropInfo *pi)
+{
+  assert(bzla);
+  assert(pi);
+  assert(bzla_node_is_regular(pi->exp));
+  assert(bzla_lsutils_is_fp_op(pi->exp));
+  assert(!is_const_node(pi->exp->e[pi->pos_x]));
+
+  BzlaBitVector *res;
+
+  record_inv_stats(bzla, &BZLA_PROP_SOLVER(bzla)->stats.inv_fp);
+
+  res = fp_inv_value(bzla, pi);
+  if (!res)
+  {
+    /* no inverse value found, fall back to a random value */
+    res = fp_cons_value(bzla, pi);
+  }
+  return res;
+}
+
+/**
+ * Select path for floating-point operations. Operands that are not rounding
+ * modes are preferred since the rounding mode usually has only a small impact
+ * on the value of the operation.
+ */
+static int32_t
+select_path_fp(Bzla *bzla, BzlaPropInfo *pi)
+{
+  assert(bzla);
+  assert(pi);
+  assert(bzla_node_is_regular(pi->exp));
+
+  int32_t pos_x;
+  uint32_t i;
+  BzlaUIntStack all, non_rm;
+
+  BZLA_INIT_STACK(bzla->mm, all);
+  BZLA_INIT_STACK(bzla->mm, non_rm);
+  for (i = 0; i < pi->exp->arity; i++)
+  {
+    if (is_const_node(pi->exp->e[i])) continue;
+    BZLA_PUSH_STACK(all, i);
+    if (!bzla_node_is_rm(bzla, pi->exp->e[i])) BZLA_PUSH_STACK(non_rm, i);
+  }
+  assert(!BZLA_EMPTY_STACK(all));
+
+  if (!BZLA_EMPTY_STACK(non_rm) && !bzla_rng_pick_with_prob(bzla->rng, 100))
+  {
+    pos_x = BZLA_PEEK_STACK(
+        non_rm, bzla_rng_pick_rand(bzla->rng, 0, BZLA_COUNT_STACK(non_rm) - 1));
+  }
+  else
+  {
+    pos_x = BZLA_PEEK_STACK(
+        all, bzla_rng_pick_rand(bzla->rng, 0, BZLA_COUNT_STACK(all) - 1));
+  }
+  BZLA_RELEASE_STACK(all);
+  BZLA_RELEASE_STACK(non_rm);
+
+  pi->pos_x = pos_x;
+#ifndef NBZLALOG
+  select_path_log(bzla, pi);
+#endif
+  return pos_x;
+}
+
 /* ========================================================================== */
 /* Lookup tables.                                                             */
 /* ========================================================================== */
@@ -7101,6 +7756,30 @@ static BzlaPropComputeValueFun kind_to_cons[BZLA_NUM_OPS_NODE] = {
     [BZLA_BV_UDIV_NODE]   = bzla_proputils_cons_udiv,
     [BZLA_BV_UREM_NODE]   = bzla_proputils_cons_urem,
     [BZLA_COND_NODE]      = bzla_proputils_cons_cond,
+    /* floating-point operations */
+    [BZLA_RM_EQ_NODE]         = bzla_proputils_cons_fp,
+    [BZLA_FP_ABS_NODE]        = bzla_proputils_cons_fp,
+    [BZLA_FP_IS_INF_NODE]     = bzla_proputils_cons_fp,
+    [BZLA_FP_IS_NAN_NODE]     = bzla_proputils_cons_fp,
+    [BZLA_FP_IS_NEG_NODE]     = bzla_proputils_cons_fp,
+    [BZLA_FP_IS_NORM_NODE]    = bzla_proputils_cons_fp,
+    [BZLA_FP_IS_POS_NODE]     = bzla_proputils_cons_fp,
+    [BZLA_FP_IS_SUBNORM_NODE] = bzla_proputils_cons_fp,
+    [BZLA_FP_IS_ZERO_NODE]    = bzla_proputils_cons_fp,
+    [BZLA_FP_NEG_NODE]        = bzla_proputils_cons_fp,
+    [BZLA_FP_TO_FP_BV_NODE]   = bzla_proputils_cons_fp,
+    [BZLA_FP_EQ_NODE]         = bzla_proputils_cons_fp,
+    [BZLA_FP_LTE_NODE]        = bzla_proputils_cons_fp,
+    [BZLA_FP_LT_NODE]         = bzla_proputils_cons_fp,
+    [BZLA_FP_SQRT_NODE]       = bzla_proputils_cons_fp,
+    [BZLA_FP_REM_NODE]        = bzla_proputils_cons_fp,
+    [BZLA_FP_RTI_NODE]        = bzla_proputils_cons_fp,
+    [BZLA_FP_TO_FP_FP_NODE]   = bzla_proputils_cons_fp,
+    [BZLA_FP_TO_FP_SBV_NODE]  = bzla_proputils_cons_fp,
+    [BZLA_FP_TO_FP_UBV_NODE]  = bzla_proputils_cons_fp,
+    [BZLA_FP_ADD_NODE]        = bzla_proputils_cons_fp,
+    [BZLA_FP_MUL_NODE]        = bzla_proputils_cons_fp,
+    [BZLA_FP_DIV_NODE]        = bzla_proputils_cons_fp,
 };
 
 static BzlaPropComputeValueFun kind_to_cons_const[BZLA_NUM_OPS_NODE] = {
@@ -7117,6 +7796,30 @@ static BzlaPropComputeValueFun kind_to_cons_const[BZLA_NUM_OPS_NODE] = {
     [BZLA_BV_UDIV_NODE]   = bzla_proputils_cons_udiv_const,
     [BZLA_BV_UREM_NODE]   = bzla_proputils_cons_urem_const,
     [BZLA_COND_NODE]      = bzla_proputils_cons_cond_const,
+    /* floating-point operations */
+    [BZLA_RM_EQ_NODE]         = bzla_proputils_cons_fp,
+    [BZLA_FP_ABS_NODE]        = bzla_proputils_cons_fp,
+    [BZLA_FP_IS_INF_NODE]     = bzla_proputils_cons_fp,
+    [BZLA_FP_IS_NAN_NODE]     = bzla_proputils_cons_fp,
+    [BZLA_FP_IS_NEG_NODE]     = bzla_proputils_cons_fp,
+    [BZLA_FP_IS_NORM_NODE]    = bzla_proputils_cons_fp,
+    [BZLA_FP_IS_POS_NODE]     = bzla_proputils_cons_fp,
+    [BZLA_FP_IS_SUBNORM_NODE] = bzla_proputils_cons_fp,
+    [BZLA_FP_IS_ZERO_NODE]    = bzla_proputils_cons_fp,
+    [BZLA_FP_NEG_NODE]        = bzla_proputils_cons_fp,
+    [BZLA_FP_TO_FP_BV_NODE]   = bzla_proputils_cons_fp,
+    [BZLA_FP_EQ_NODE]         = bzla_proputils_cons_fp,
+    [BZLA_FP_LTE_NODE]        = bzla_proputils_cons_fp,
+    [BZLA_FP_LT_NODE]         = bzla_proputils_cons_fp,
+    [BZLA_FP_SQRT_NODE]       = bzla_proputils_cons_fp,
+    [BZLA_FP_REM_NODE]        = bzla_proputils_cons_fp,
+    [BZLA_FP_RTI_NODE]        = bzla_proputils_cons_fp,
+    [BZLA_FP_TO_FP_FP_NODE]   = bzla_proputils_cons_fp,
+    [BZLA_FP_TO_FP_SBV_NODE]  = bzla_proputils_cons_fp,
+    [BZLA_FP_TO_FP_UBV_NODE]  = bzla_proputils_cons_fp,
+    [BZLA_FP_ADD_NODE]        = bzla_proputils_cons_fp,
+    [BZLA_FP_MUL_NODE]        = bzla_proputils_cons_fp,
+    [BZLA_FP_DIV_NODE]        = bzla_proputils_cons_fp,
 };
 
 static BzlaPropComputeValueFun kind_to_inv[BZLA_NUM_OPS_NODE] = {
@@ -7133,6 +7836,30 @@ static BzlaPropComputeValueFun kind_to_inv[BZLA_NUM_OPS_NODE] = {
     [BZLA_BV_UDIV_NODE]   = bzla_proputils_inv_udiv,
     [BZLA_BV_UREM_NODE]   = bzla_proputils_inv_urem,
     [BZLA_COND_NODE]      = bzla_proputils_inv_cond,
+    /* floating-point operations */
+    [BZLA_RM_EQ_NODE]         = bzla_proputils_inv_fp,
+    [BZLA_FP_ABS_NODE]        = bzla_proputils_inv_fp,
+    [BZLA_FP_IS_INF_NODE]     = bzla_proputils_inv_fp,
+    [BZLA_FP_IS_NAN_NODE]     = bzla_proputils_inv_fp,
+    [BZLA_FP_IS_NEG_NODE]     = bzla_proputils_inv_fp,
+    [BZLA_FP_IS_NORM_NODE]    = bzla_proputils_inv_fp,
+    [BZLA_FP_IS_POS_NODE]     = bzla_proputils_inv_fp,
+    [BZLA_FP_IS_SUBNORM_NODE] = bzla_proputils_inv_fp,
+    [BZLA_FP_IS_ZERO_NODE]    = bzla_proputils_inv_fp,
+    [BZLA_FP_NEG_NODE]        = bzla_proputils_inv_fp,
+    [BZLA_FP_TO_FP_BV_NODE]   = bzla_proputils_inv_fp,
+    [BZLA_FP_EQ_NODE]         = bzla_proputils_inv_fp,
+    [BZLA_FP_LTE_NODE]        = bzla_proputils_inv_fp,
+    [BZLA_FP_LT_NODE]         = bzla_proputils_inv_fp,
+    [BZLA_FP_SQRT_NODE]       = bzla_proputils_inv_fp,
+    [BZLA_FP_REM_NODE]        = bzla_proputils_inv_fp,
+    [BZLA_FP_RTI_NODE]        = bzla_proputils_inv_fp,
+    [BZLA_FP_TO_FP_FP_NODE]   = bzla_proputils_inv_fp,
+    [BZLA_FP_TO_FP_SBV_NODE]  = bzla_proputils_inv_fp,
+    [BZLA_FP_TO_FP_UBV_NODE]  = bzla_proputils_inv_fp,
+    [BZLA_FP_ADD_NODE]        = bzla_proputils_inv_fp,
+    [BZLA_FP_MUL_NODE]        = bzla_proputils_inv_fp,
+    [BZLA_FP_DIV_NODE]        = bzla_proputils_inv_fp,
 };
 
 static BzlaPropComputeValueFun kind_to_inv_const[BZLA_NUM_OPS_NODE] = {
@@ -7149,6 +7876,30 @@ static BzlaPropComputeValueFun kind_to_inv_const[BZLA_NUM_OPS_NODE] = {
     [BZLA_BV_UDIV_NODE]   = bzla_proputils_inv_udiv_const,
     [BZLA_BV_UREM_NODE]   = bzla_proputils_inv_urem_const,
     [BZLA_COND_NODE]      = bzla_proputils_inv_cond_const,
+    /* floating-point operations */
+    [BZLA_RM_EQ_NODE]         = bzla_proputils_inv_fp,
+    [BZLA_FP_ABS_NODE]        = bzla_proputils_inv_fp,
+    [BZLA_FP_IS_INF_NODE]     = bzla_proputils_inv_fp,
+    [BZLA_FP_IS_NAN_NODE]     = bzla_proputils_inv_fp,
+    [BZLA_FP_IS_NEG_NODE]     = bzla_proputils_inv_fp,
+    [BZLA_FP_IS_NORM_NODE]    = bzla_proputils_inv_fp,
+    [BZLA_FP_IS_POS_NODE]     = bzla_proputils_inv_fp,
+    [BZLA_FP_IS_SUBNORM_NODE] = bzla_proputils_inv_fp,
+    [BZLA_FP_IS_ZERO_NODE]    = bzla_proputils_inv_fp,
+    [BZLA_FP_NEG_NODE]        = bzla_proputils_inv_fp,
+    [BZLA_FP_TO_FP_BV_NODE]   = bzla_proputils_inv_fp,
+    [BZLA_FP_EQ_NODE]         = bzla_proputils_inv_fp,
+    [BZLA_FP_LTE_NODE]        = bzla_proputils_inv_fp,
+    [BZLA_FP_LT_NODE]         = bzla_proputils_inv_fp,
+    [BZLA_FP_SQRT_NODE]       = bzla_proputils_inv_fp,
+    [BZLA_FP_REM_NODE]        = bzla_proputils_inv_fp,
+    [BZLA_FP_RTI_NODE]        = bzla_proputils_inv_fp,
+    [BZLA_FP_TO_FP_FP_NODE]   = bzla_proputils_inv_fp,
+    [BZLA_FP_TO_FP_SBV_NODE]  = bzla_proputils_inv_fp,
+    [BZLA_FP_TO_FP_UBV_NODE]  = bzla_proputils_inv_fp,
+    [BZLA_FP_ADD_NODE]        = bzla_proputils_inv_fp,
+    [BZLA_FP_MUL_NODE]        = bzla_proputils_inv_fp,
+    [BZLA_FP_DIV_NODE]        = bzla_proputils_inv_fp,
 };
 
 static BzlaPropIsInvFun kind_to_is_inv[BZLA_NUM_OPS_NODE] = {
@@ -7579,9 +8330,9 @@ bzla_proputils_select_move_prop(Bzla *bzla,
       BzlaBvDomain *d =
           bzla_hashint_map_get(slv->domains, real_cur->id)->as_ptr;
       assert(bzla_bv_get_width(d->hi)
-             == bzla_node_bv_get_width(bzla, real_cur));
+             == bzla_lsutils_get_bv_width(bzla, real_cur));
       assert(bzla_bv_get_width(d->lo)
-             == bzla_node_bv_get_width(bzla, real_cur));
+             == bzla_lsutils_get_bv_width(bzla, real_cur));
       if (opt_prop_const_bits
           && !bzla_opt_get(bzla, BZLA_OPT_PROP_CONST_DOMAINS))
       {
@@ -7608,13 +8359,13 @@ bzla_proputils_select_move_prop(Bzla *bzla,
                                                : bzla_bv_copy(bzla->mm, bv_t);
       break;
     }
-    else if (bzla_node_is_bv_const(cur))
+    else if (is_const_node(cur))
     {
       break;
     }
     else
     {
-      assert(!bzla_node_is_bv_const(cur));
+      assert(!is_const_node(cur));
 
       if (bzla_node_is_inverted(cur))
       {
@@ -7669,7 +8420,7 @@ bzla_proputils_select_move_prop(Bzla *bzla,
       {
         bv_s[i]  = (BzlaBitVector *) bzla_model_get_bv(bzla, children[i]);
         pi.bv[i] = bv_s[i];
-        if (bzla_node_is_bv_const(children[i])) nconst += 1;
+        if (is_const_node(children[i])) nconst += 1;
       }
 
       if (nconst > arity - 1) break;
@@ -7734,6 +8485,10 @@ bzla_proputils_select_move_prop(Bzla *bzla,
       {
         pos_x = select_path_cond(bzla, &pi);
       }
+      else if (bzla_lsutils_is_fp_op(real_cur))
+      {
+        pos_x = select_path_fp(bzla, &pi);
+      }
       else
       {
         pos_x = select_path(bzla, &pi, opt_prop_const_bits);
@@ -587,5 +587,27 @@ BzlaBitVector* bzla_proputils_inv_slice_const(Bzla* bzla, BzlaPropInfo* pi);
  */
 BzlaBitVector* bzla_proputils_inv_cond_const(Bzla* bzla, BzlaPropInfo* pi);
 
+/*------------------------------------------------------------------------*/
+/* Value computation functions for floating-point operations.             */
+/*------------------------------------------------------------------------*/
+
+/**
+ * Determine consistent value for 'x' of a floating-point or rounding mode
+ * operation. Considers const bits in x if a domain for x is given.
+ *
+ * pi: The struct containing all information for consistent value computation.
+ */
+BzlaBitVector* bzla_proputils_cons_fp(Bzla* bzla, BzlaPropInfo* pi);
+
+/**
+ * Determine inverse value for 'x' of a floating-point or rounding mode
+ * operation. Considers const bits in x if a domain for x is given.
+ *
+ * Falls back to a consistent value if no inverse value could be determined.
+ *
+ * pi: The struct containing all information for inverse value computation.
+ */
+BzlaBitVector* bzla_proputils_inv_fp(Bzla* bzla, BzlaPropInfo* pi);
+
 /*========================================================================*/
 #endif
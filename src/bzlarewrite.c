@@ -120,12 +120,13 @@
 //{fprintf (stderr, "apply: %s (%s)\n", #rw_rule, __FUNCTION__);
 
 #define BZLA_START_REWRITE_TIMER \
-  double timer_start = (bzla->rec_rw_calls == 0 ? bzla_util_time_stamp() : 0)
+  double timer_start =           \
+      (bzla->rec_rw_calls == 0 ? bzla_util_monotonic_time() : 0)
 
-#define BZLA_STOP_REWRITE_TIMER                                 \
-  if (bzla->rec_rw_calls == 0)                                  \
-  {                                                             \
-    bzla->time.rewrite += bzla_util_time_stamp() - timer_start; \
+#define BZLA_STOP_REWRITE_TIMER                                     \
+  if (bzla->rec_rw_calls == 0)                                      \
+  {                                                                 \
+    bzla->time.rewrite += bzla_util_monotonic_time() - timer_start; \
   }
 
 /* -------------------------------------------------------------------------- */
@@ -49,6 +49,19 @@ add(BzlaSATMgr *smgr, int32_t lit)
   smgr->api.add(smgr, lit);
 }
 
+static inline void
+add_clauses(BzlaSATMgr *smgr, const int32_t *lits, size_t n)
+{
+  size_t i;
+  if (smgr->api.add_clauses)
+  {
+    smgr->api.add_clauses(smgr, lits, n);
+    return;
+  }
+  assert(smgr->api.add);
+  for (i = 0; i < n; i++) smgr->api.add(smgr, lits[i]);
+}
+
 static inline void
 assume(BzlaSATMgr *smgr, int32_t lit)
 {
@@ -96,6 +109,12 @@ fixed(BzlaSATMgr *smgr, int32_t lit)
   return 0;
 }
 
+static inline void
+phase(BzlaSATMgr *smgr, int32_t lit)
+{
+  if (smgr->api.phase) smgr->api.phase(smgr, lit);
+}
+
 static inline int32_t
 inc_max_var(BzlaSATMgr *smgr)
 {
@@ -394,6 +413,24 @@ bzla_sat_add(BzlaSATMgr *smgr, int32_t lit)
   add(smgr, lit);
 }
 
+void
+bzla_sat_add_clauses(BzlaSATMgr *smgr, const int32_t *lits, size_t n)
+{
+  size_t i;
+
+  assert(smgr != NULL);
+  assert(smgr->initialized);
+  assert(!smgr->satcalls || smgr->inc_required);
+  assert(!n || lits[n - 1] == 0);
+
+  for (i = 0; i < n; i++)
+  {
+    assert(abs(lits[i]) <= smgr->maxvar);
+    if (!lits[i]) smgr->clauses++;
+  }
+  add_clauses(smgr, lits, n);
+}
+
 BzlaSolverResult
 bzla_sat_check_sat(BzlaSATMgr *smgr, int32_t limit)
 {
@@ -401,7 +438,7 @@ bzla_sat_check_sat(BzlaSATMgr *smgr, int32_t limit)
   assert(smgr->initialized);
   assert(!smgr->inc_required || bzla_sat_mgr_has_incremental_support(smgr));
 
-  double start = bzla_util_time_stamp();
+  double start = bzla_util_monotonic_time();
   int32_t sat_res;
   BzlaSolverResult res;
   BZLA_MSG(smgr->bzla->msg,
@@ -413,7 +450,7 @@ bzla_sat_check_sat(BzlaSATMgr *smgr, int32_t limit)
   smgr->satcalls++;
   setterm(smgr);
   sat_res = sat(smgr, limit);
-  smgr->sat_time += bzla_util_time_stamp() - start;
+  smgr->sat_time += bzla_util_monotonic_time() - start;
   switch (sat_res)
   {
     case 10: res = BZLA_RESULT_SAT; break;
@@ -465,6 +502,16 @@ bzla_sat_fixed(BzlaSATMgr *smgr, int32_t lit)
   return res;
 }
 
+void
+bzla_sat_phase(BzlaSATMgr *smgr, int32_t lit)
+{
+  assert(smgr != NULL);
+  assert(smgr->initialized);
+  assert(lit != 0);
+  assert(abs(lit) <= smgr->maxvar);
+  phase(smgr, lit);
+}
+
 /*------------------------------------------------------------------------*/
 
 void
@@ -562,6 +609,13 @@ dimacs_printer_fixed(BzlaSATMgr *smgr, int32_t lit)
   return fixed(printer->smgr, lit);
 }
 
+static void
+dimacs_printer_phase(BzlaSATMgr *smgr, int32_t lit)
+{
+  BzlaCnfPrinter *printer = (BzlaCnfPrinter *) smgr->solver;
+  phase(printer->smgr, lit);
+}
+
 static void
 dimacs_printer_reset(BzlaSATMgr *smgr)
 {
@@ -739,6 +793,7 @@ enable_dimacs_printer(BzlaSATMgr *smgr)
   smgr->api.inc_max_var      = dimacs_printer_inc_max_var;
   smgr->api.init             = dimacs_printer_init;
   smgr->api.melt             = dimacs_printer_melt;
+  smgr->api.phase            = dimacs_printer_phase;
   smgr->api.repr             = dimacs_printer_repr;
   smgr->api.reset            = dimacs_printer_reset;
   smgr->api.sat              = dimacs_printer_sat;
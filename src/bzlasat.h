@@ -58,6 +58,7 @@ struct BzlaSATMgr
   struct
   {
     void (*add)(BzlaSATMgr *, int32_t); /* required */
+    void (*add_clauses)(BzlaSATMgr *, const int32_t *, size_t);
     void (*assume)(BzlaSATMgr *, int32_t);
     int32_t (*deref)(BzlaSATMgr *, int32_t); /* required */
     void (*enable_verbosity)(BzlaSATMgr *, int32_t);
@@ -66,6 +67,7 @@ struct BzlaSATMgr
     int32_t (*inc_max_var)(BzlaSATMgr *);
     void *(*init)(BzlaSATMgr *); /* required */
     void (*melt)(BzlaSATMgr *, int32_t);
+    void (*phase)(BzlaSATMgr *, int32_t);
     int32_t (*repr)(BzlaSATMgr *, int32_t);
     void (*reset)(BzlaSATMgr *);           /* required */
     int32_t (*sat)(BzlaSATMgr *, int32_t); /* required */
@@ -141,6 +143,12 @@ void bzla_sat_print_stats(BzlaSATMgr *smgr);
  */
 void bzla_sat_add(BzlaSATMgr *smgr, int32_t lit);
 
+/* Adds a sequence of 'n' literals to the SAT solver in one call, equivalent
+ * to calling 'bzla_sat_add' on each literal. The sequence consists of
+ * 0-terminated clauses.
+ */
+void bzla_sat_add_clauses(BzlaSATMgr *smgr, const int32_t *lits, size_t n);
+
 /* Adds assumption to SAT solver.
  * Requires that SAT solver supports this.
  */
@@ -174,6 +182,12 @@ int32_t bzla_sat_repr(BzlaSATMgr *smgr, int32_t lit);
  */
 int32_t bzla_sat_fixed(BzlaSATMgr *smgr, int32_t lit);
 
+/* Sets the preferred phase of the variable of a literal to the polarity of
+ * the literal for subsequent SAT solver calls.
+ * This is only a hint and ignored if the SAT solver does not support it.
+ */
+void bzla_sat_phase(BzlaSATMgr *smgr, int32_t lit);
+
 /* Resets the status of the SAT solver. */
 void bzla_sat_reset(BzlaSATMgr *smgr);
 
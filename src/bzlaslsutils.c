@@ -57,7 +57,9 @@
  * ========================================================================== */
 
 static uint32_t
-hamming_distance(Bzla *bzla, BzlaBitVector *bv1, BzlaBitVector *bv2)
+hamming_distance(BzlaMemMgr *mm,
+                 const BzlaBitVector *bv1,
+                 const BzlaBitVector *bv2)
 {
   assert(bv1);
   assert(bv2);
@@ -67,20 +69,20 @@ hamming_distance(Bzla *bzla, BzlaBitVector *bv1, BzlaBitVector *bv2)
   BzlaBitVector *bv, *bvdec = 0, *zero, *ones, *tmp;
 
   bw   = bzla_bv_get_width(bv1);
-  zero = bzla_bv_new(bzla->mm, bw);
-  ones = bzla_bv_ones(bzla->mm, bw);
-  bv   = bzla_bv_xor(bzla->mm, bv1, bv2);
+  zero = bzla_bv_new(mm, bw);
+  ones = bzla_bv_ones(mm, bw);
+  bv   = bzla_bv_xor(mm, bv1, bv2);
   for (res = 0; !bzla_bv_is_zero(bv); res++)
   {
-    bvdec = bzla_bv_add(bzla->mm, bv, ones);
+    bvdec = bzla_bv_add(mm, bv, ones);
     tmp   = bv;
-    bv    = bzla_bv_and(bzla->mm, bv, bvdec);
-    bzla_bv_free(bzla->mm, tmp);
-    bzla_bv_free(bzla->mm, bvdec);
+    bv    = bzla_bv_and(mm, bv, bvdec);
+    bzla_bv_free(mm, tmp);
+    bzla_bv_free(mm, bvdec);
   }
-  bzla_bv_free(bzla->mm, bv);
-  bzla_bv_free(bzla->mm, ones);
-  bzla_bv_free(bzla->mm, zero);
+  bzla_bv_free(mm, bv);
+  bzla_bv_free(mm, ones);
+  bzla_bv_free(mm, zero);
   return res;
 }
 
@@ -89,7 +91,7 @@ hamming_distance(Bzla *bzla, BzlaBitVector *bv1, BzlaBitVector *bv2)
 // bits in bv1 s.t. bv1 < bv2 (if bv2 is 0, we need to flip 1 bit in bv2, too,
 // which we do not consider to prevent negative scores)
 static uint32_t
-min_flip(Bzla *bzla, BzlaBitVector *bv1, BzlaBitVector *bv2)
+min_flip(BzlaMemMgr *mm, const BzlaBitVector *bv1, const BzlaBitVector *bv2)
 {
   assert(bv1);
   assert(bv2);
@@ -99,10 +101,10 @@ min_flip(Bzla *bzla, BzlaBitVector *bv1, BzlaBitVector *bv2)
   BzlaBitVector *tmp;
 
   if (bzla_bv_is_zero(bv2))
-    res = hamming_distance(bzla, bv1, bv2);
+    res = hamming_distance(mm, bv1, bv2);
   else
   {
-    tmp = bzla_bv_copy(bzla->mm, bv1);
+    tmp = bzla_bv_copy(mm, bv1);
     bw  = bzla_bv_get_width(tmp);
     for (res = 0, i = 0, j = bw - 1; i < bw; i++, j--)
     {
@@ -112,14 +114,16 @@ min_flip(Bzla *bzla, BzlaBitVector *bv1, BzlaBitVector *bv2)
       if (bzla_bv_compare(tmp, bv2) < 0) break;
     }
     if (bzla_bv_is_zero(bv2)) res += 1;
-    bzla_bv_free(bzla->mm, tmp);
+    bzla_bv_free(mm, tmp);
   }
   assert(res <= bzla_bv_get_width(bv1));
   return res;
 }
 
 static uint32_t
-min_flip_inv(Bzla *bzla, BzlaBitVector *bv1, BzlaBitVector *bv2)
+min_flip_inv(BzlaMemMgr *mm,
+             const BzlaBitVector *bv1,
+             const BzlaBitVector *bv2)
 {
   assert(bv1);
   assert(bv2);
@@ -128,7 +132,7 @@ min_flip_inv(Bzla *bzla, BzlaBitVector *bv1, BzlaBitVector *bv2)
   uint32_t i, j, res, bw;
   BzlaBitVector *tmp;
 
-  tmp = bzla_bv_copy(bzla->mm, bv1);
+  tmp = bzla_bv_copy(mm, bv1);
   bw  = bzla_bv_get_width(tmp);
   for (res = 0, i = 0, j = bw - 1; i < bw; i++, j--)
   {
@@ -137,10 +141,87 @@ min_flip_inv(Bzla *bzla, BzlaBitVector *bv1, BzlaBitVector *bv2)
     bzla_bv_set_bit(tmp, j, 1);
     if (bzla_bv_compare(tmp, bv2) >= 0) break;
   }
-  bzla_bv_free(bzla->mm, tmp);
+  bzla_bv_free(mm, tmp);
   return res;
 }
 
+static double
+score_and(double s0, double s1)
+{
+  double res = (s0 + s1) / 2.0;
+  /* fix rounding errors (eg. (0.999+1.0)/2 = 1.0) ->
+     choose minimum (else it might again result in 1.0) */
+  if (res == 1.0 && (s0 < 1.0 || s1 < 1.0)) res = s0 < s1 ? s0 : s1;
+  return res;
+}
+
+static double
+score_or(double s0, double s1)
+{
+  return s0 > s1 ? s0 : s1;
+}
+
+static double
+score_eq(BzlaMemMgr *mm,
+         bool inverted,
+         const BzlaBitVector *bv0,
+         const BzlaBitVector *bv1)
+{
+  if (inverted) return !bzla_bv_compare(bv0, bv1) ? 0.0 : 1.0;
+  return !bzla_bv_compare(bv0, bv1)
+             ? 1.0
+             : BZLA_SLS_SCORE_CFACT
+                   * (1.0
+                      - hamming_distance(mm, bv0, bv1)
+                            / (double) bzla_bv_get_width(bv0));
+}
+
+static double
+score_ult(BzlaMemMgr *mm,
+          bool inverted,
+          const BzlaBitVector *bv0,
+          const BzlaBitVector *bv1)
+{
+  if (inverted)
+    return bzla_bv_compare(bv0, bv1) >= 0
+               ? 1.0
+               : BZLA_SLS_SCORE_CFACT
+                     * (1.0
+                        - min_flip_inv(mm, bv0, bv1)
+                              / (double) bzla_bv_get_width(bv0));
+  return bzla_bv_compare(bv0, bv1) < 0
+             ? 1.0
+             : BZLA_SLS_SCORE_CFACT
+                   * (1.0
+                      - min_flip(mm, bv0, bv1)
+                            / (double) bzla_bv_get_width(bv0));
+}
+
+/* Compute the score of 'exp' from the scores 's0' and 's1' of its children if
+ * 'exp' is a bit-vector and (or), from the assignments 'bv0' and 'bv1' of its
+ * children if 'exp' is an equality or unsigned less than, and from its own
+ * assignment 'bv0' otherwise. */
+static double
+score_node_aux(BzlaMemMgr *mm,
+               BzlaNode *exp,
+               double s0,
+               double s1,
+               const BzlaBitVector *bv0,
+               const BzlaBitVector *bv1)
+{
+  bool inverted;
+  BzlaNode *real_exp;
+
+  real_exp = bzla_node_real_addr(exp);
+  inverted = bzla_node_is_inverted(exp);
+
+  if (bzla_node_is_bv_and(real_exp))
+    return inverted ? score_or(s0, s1) : score_and(s0, s1);
+  if (bzla_node_is_bv_eq(real_exp)) return score_eq(mm, inverted, bv0, bv1);
+  if (bzla_node_is_bv_ult(real_exp)) return score_ult(mm, inverted, bv0, bv1);
+  return bzla_bv_get_bit(bv0, 0);
+}
+
 double
 bzla_slsutils_compute_score_node(Bzla *bzla,
                                  BzlaIntHashTable *bv_model,
@@ -164,7 +245,10 @@ bzla_slsutils_compute_score_node(Bzla *bzla,
   mm = bzla->mm;
 #endif
 
-  res      = 0.0;
+  s0       = 0.0;
+  s1       = 0.0;
+  bv0      = 0;
+  bv1      = 0;
   real_exp = bzla_node_real_addr(exp);
 
   BZLALOG(3, "");
@@ -204,7 +288,6 @@ bzla_slsutils_compute_score_node(Bzla *bzla,
         BZLALOG(3, "      sls score e[1]: %f", s1);
       }
 #endif
-      res = s0 > s1 ? s0 : s1;
     }
     /* ---------------------------------------------------------------------- */
     /* AND                                                                    */
@@ -238,10 +321,6 @@ bzla_slsutils_compute_score_node(Bzla *bzla,
         BZLALOG(3, "      sls score e[1]: %f", s1);
       }
 #endif
-      res = (s0 + s1) / 2.0;
-      /* fix rounding errors (eg. (0.999+1.0)/2 = 1.0) ->
-         choose minimum (else it might again result in 1.0) */
-      if (res == 1.0 && (s0 < 1.0 || s1 < 1.0)) res = s0 < s1 ? s0 : s1;
     }
   }
   /* ------------------------------------------------------------------------ */
@@ -270,15 +349,6 @@ bzla_slsutils_compute_score_node(Bzla *bzla,
       bzla_mem_freestr(mm, a1);
     }
 #endif
-    if (bzla_node_is_inverted(exp))
-      res = !bzla_bv_compare(bv0, bv1) ? 0.0 : 1.0;
-    else
-      res = !bzla_bv_compare(bv0, bv1)
-                ? 1.0
-                : BZLA_SLS_SCORE_CFACT
-                      * (1.0
-                         - hamming_distance(bzla, bv0, bv1)
-                               / (double) bzla_bv_get_width(bv0));
   }
   /* ------------------------------------------------------------------------ */
   /* ULT                                                                      */
@@ -306,20 +376,6 @@ bzla_slsutils_compute_score_node(Bzla *bzla,
       bzla_mem_freestr(mm, a1);
     }
 #endif
-    if (bzla_node_is_inverted(exp))
-      res = bzla_bv_compare(bv0, bv1) >= 0
-                ? 1.0
-                : BZLA_SLS_SCORE_CFACT
-                      * (1.0
-                         - min_flip_inv(bzla, bv0, bv1)
-                               / (double) bzla_bv_get_width(bv0));
-    else
-      res = bzla_bv_compare(bv0, bv1) < 0
-                ? 1.0
-                : BZLA_SLS_SCORE_CFACT
-                      * (1.0
-                         - min_flip(bzla, bv0, bv1)
-                               / (double) bzla_bv_get_width(bv0));
   }
   /* ------------------------------------------------------------------------ */
   /* other BOOLEAN                                                            */
@@ -338,16 +394,92 @@ bzla_slsutils_compute_score_node(Bzla *bzla,
       bzla_mem_freestr(mm, a0);
     }
 #endif
-    res = bzla_bv_get_bit(((BzlaBitVector *) bzla_model_get_bv_aux(
-                              bzla, bv_model, fun_model, exp)),
-                          0);
+    bv0 = (BzlaBitVector *) bzla_model_get_bv_aux(
+        bzla, bv_model, fun_model, exp);
   }
 
+  res = score_node_aux(bzla->mm, exp, s0, s1, bv0, bv1);
   BZLALOG(3, "      sls score : %f", res);
   assert(res >= 0.0 && res <= 1.0);
   return res;
 }
 
+/* Get the score of node 'id', looked up in 'delta_score' first. */
+static bool
+get_score_delta(BzlaIntHashTable *score,
+                BzlaIntHashTable *delta_score,
+                int32_t id,
+                double *res)
+{
+  BzlaHashTableData *d;
+
+  if (!(d = bzla_hashint_map_get(delta_score, id))
+      && !(d = bzla_hashint_map_get(score, id)))
+  {
+    return false;
+  }
+  *res = d->as_dbl;
+  return true;
+}
+
+bool
+bzla_slsutils_compute_score_node_delta(BzlaMemMgr *mm,
+                                       BzlaIntHashTable *bv_model,
+                                       BzlaIntHashTable *score,
+                                       BzlaIntHashTable *delta_model,
+                                       BzlaIntHashTable *delta_score,
+                                       BzlaNode *exp,
+                                       double *res)
+{
+  assert(mm);
+  assert(bv_model);
+  assert(score);
+  assert(delta_model);
+  assert(delta_score);
+  assert(exp);
+  assert(res);
+
+  bool inverted, found;
+  int32_t id0, id1;
+  double s0, s1;
+  BzlaNode *real_exp;
+  BzlaBitVector *bv0, *bv1;
+
+  real_exp = bzla_node_real_addr(exp);
+  inverted = bzla_node_is_inverted(exp);
+  s0       = 0.0;
+  s1       = 0.0;
+  bv0      = 0;
+  bv1      = 0;
+
+  if (bzla_node_is_bv_and(real_exp))
+  {
+    id0   = bzla_node_get_id(real_exp->e[0]);
+    id1   = bzla_node_get_id(real_exp->e[1]);
+    found = get_score_delta(score, delta_score, inverted ? -id0 : id0, &s0)
+            && get_score_delta(score, delta_score, inverted ? -id1 : id1, &s1);
+  }
+  else if (bzla_node_is_bv_eq(real_exp) || bzla_node_is_bv_ult(real_exp))
+  {
+    bv0 =
+        bzla_lsutils_get_bv_delta(mm, bv_model, delta_model, real_exp->e[0]);
+    bv1 =
+        bzla_lsutils_get_bv_delta(mm, bv_model, delta_model, real_exp->e[1]);
+    found = bv0 && bv1;
+  }
+  else
+  {
+    bv0   = bzla_lsutils_get_bv_delta(mm, bv_model, delta_model, exp);
+    found = bv0 != 0;
+  }
+
+  if (found) *res = score_node_aux(mm, exp, s0, s1, bv0, bv1);
+  if (bv0) bzla_bv_free(mm, bv0);
+  if (bv1) bzla_bv_free(mm, bv1);
+  assert(!found || (*res >= 0.0 && *res <= 1.0));
+  return found;
+}
+
 static double
 recursively_compute_sls_score_node(Bzla *bzla,
                                    BzlaIntHashTable *bv_model,
@@ -487,7 +619,9 @@ bzla_slsutils_compute_sls_scores(Bzla *bzla,
     {
       assert(d->as_int == 0);
       d->as_int = 1;
-      if (bzla_node_bv_get_width(bzla, real_cur) != 1) continue;
+      if (!bzla_node_is_bv(bzla, real_cur)
+          || bzla_node_bv_get_width(bzla, real_cur) != 1)
+        continue;
       (void) recursively_compute_sls_score_node(
           bzla, bv_model, fun_model, score, cur);
       (void) recursively_compute_sls_score_node(
@@ -20,6 +20,22 @@ double bzla_slsutils_compute_score_node(Bzla *bzla,
                                         BzlaIntHashTable *score,
                                         BzlaNode *exp);
 
+/**
+ * Compute the sls score of 'exp' w.r.t. the model values and scores in
+ * 'delta_model' and 'delta_score', which take precedence over 'bv_model' and
+ * 'score'. Does not modify any of the given maps and allocates temporary
+ * values via 'mm' only, hence it can be used concurrently with a separate
+ * memory manager per thread. Returns false (and no score) if a required model
+ * value or score is missing.
+ */
+bool bzla_slsutils_compute_score_node_delta(BzlaMemMgr *mm,
+                                            BzlaIntHashTable *bv_model,
+                                            BzlaIntHashTable *score,
+                                            BzlaIntHashTable *delta_model,
+                                            BzlaIntHashTable *delta_score,
+                                            BzlaNode *exp,
+                                            double *res);
+
 void bzla_slsutils_compute_sls_scores(Bzla *bzla,
                                       BzlaIntHashTable *bv_model,
                                       BzlaIntHashTable *fun_model,
@@ -257,6 +257,49 @@ configure_sat_mgr(Bzla *bzla)
              smgr->name);
 }
 
+/* Set the phases of the CNF variables of all bit-blasted inputs to their
+ * current model values. The bit-vector model at this point is either the
+ * model of the previous refinement iteration or the (partial) model
+ * determined by the prop/sls preprocessing engine. */
+static void
+set_sat_phases(Bzla *bzla)
+{
+  assert(bzla);
+
+  uint32_t i, width;
+  int32_t lit;
+  BzlaNode *var;
+  BzlaAIGVec *av;
+  BzlaAIG *aig;
+  BzlaHashTableData *d;
+  const BzlaBitVector *bv;
+  BzlaSATMgr *smgr;
+  BzlaPtrHashTableIterator it;
+
+  if (!bzla->bv_model || !bzla->bv_model->count) return;
+
+  smgr = bzla_get_sat_mgr(bzla);
+  bzla_iter_hashptr_init(&it, bzla->bv_vars);
+  while (bzla_iter_hashptr_has_next(&it))
+  {
+    var = bzla_node_real_addr(bzla_iter_hashptr_next(&it));
+    if (!bzla_node_is_synth(var)) continue;
+    if (!(d = bzla_hashint_map_get(bzla->bv_model, var->id))) continue;
+    bv    = d->as_ptr;
+    av    = var->av;
+    width = av->width;
+    assert(bzla_bv_get_width(bv) == width);
+    for (i = 0; i < width; i++)
+    {
+      aig = av->aigs[i];
+      if (bzla_aig_is_const(aig)) continue;
+      if (!(lit = bzla_aig_get_cnf_id(aig))) continue;
+      /* MSB is at index 0 */
+      bzla_sat_phase(smgr, bzla_bv_get_bit(bv, width - 1 - i) ? lit : -lit);
+    }
+  }
+}
+
 static BzlaSolverResult
 timed_sat_sat(Bzla *bzla, int32_t limit)
 {
@@ -279,7 +322,11 @@ timed_sat_sat(Bzla *bzla, int32_t limit)
            amgr->num_cnf_clauses);
   smgr  = bzla_get_sat_mgr(bzla);
   start = bzla_util_time_stamp();
-  res   = bzla_sat_check_sat(smgr, limit);
+  if (bzla_opt_get(bzla, BZLA_OPT_FUN_SAT_PHASES) && smgr->initialized)
+  {
+    set_sat_phases(bzla);
+  }
+  res = bzla_sat_check_sat(smgr, limit);
   delta = bzla_util_time_stamp() - start;
   BZLA_FUN_SOLVER(bzla)->time.sat += delta;
 
@@ -2687,7 +2734,8 @@ sat_fun_solver(BzlaFunSolver *slv)
 
   bzla      = slv->bzla;
   mm        = bzla->mm;
-  opt_prels = bzla_opt_get(bzla, BZLA_OPT_FUN_PREPROP)
+  opt_prels = (bzla_opt_get(bzla, BZLA_OPT_FUN_PREPROP)
+               && bzla_lsutils_fp_supported(bzla))
               || bzla_opt_get(bzla, BZLA_OPT_FUN_PRESLS);
   opt_prop_const_bits = bzla_opt_get(bzla, BZLA_OPT_PROP_CONST_BITS) != 0;
 
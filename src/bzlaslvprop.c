@@ -31,6 +31,7 @@
 #include "utils/bzlahash.h"
 #include "utils/bzlahashint.h"
 #include "utils/bzlahashptr.h"
+#include "utils/bzlanodeiter.h"
 #include "utils/bzlautil.h"
 
 /*------------------------------------------------------------------------*/
@@ -256,6 +257,7 @@ move(Bzla *bzla, uint64_t nprops)
       bzla_opt_get(bzla, BZLA_OPT_PROP_USE_BANDIT) ? slv->score : 0,
       exps,
       true,
+      0,
       &slv->stats.updates,
       &slv->time.update_cone,
       &slv->time.update_cone_reset,
@@ -410,7 +412,9 @@ bzla_prop_solver_init_domains(Bzla *bzla,
       assert(!real_cur->parameterized);
       data->flag = true;
 
-      bw     = bzla_node_bv_get_width(bzla, real_cur);
+      /* floating-point and rounding mode nodes are represented by the
+       * bit-vector domain of their word-blasted IEEE-754 representation */
+      bw     = bzla_lsutils_get_bv_width(bzla, real_cur);
       domain = bzla_bvdomain_new_init(mm, bw);
       bzla_hashint_map_add(domains, real_cur->id)->as_ptr = domain;
       /* inverted nodes are additionally stored with negative id */
@@ -443,14 +447,19 @@ bzla_prop_solver_init_domains(Bzla *bzla,
   BZLA_RELEASE_STACK(visit);
 }
 
+/* Marks entries of the word-level domains array that are not loaded yet. */
+static const BzlaBvDomainWord word_domain_unset = {1, 0};
+
 static bool
 update_domain(Bzla *bzla,
               BzlaIntHashTable *domains,
+              BzlaBvDomainWord *word_domains,
               const BzlaNode *n,
               BzlaBvDomain *old_domain,
               BzlaBvDomain *new_domain)
 {
   assert(domains);
+  assert(word_domains);
   assert(n);
   assert(old_domain);
 
@@ -462,7 +471,8 @@ update_domain(Bzla *bzla,
   if (bzla_bvdomain_is_equal(old_domain, new_domain)) return false;
 
   mm = bzla->mm;
-  id = bzla_node_get_id(bzla_node_real_addr(n));
+  /* 'new_domain' is the domain of the inverted node if 'n' is inverted */
+  id = bzla_node_get_id(n);
   d  = bzla_hashint_map_get(domains, id);
   assert(d);
   bzla_bvdomain_free(mm, d->as_ptr);
@@ -472,168 +482,571 @@ update_domain(Bzla *bzla,
   assert(d);
   bzla_bvdomain_free(mm, d->as_ptr);
   d->as_ptr = bzla_bvdomain_not(mm, new_domain);
+
+  word_domains[bzla_node_real_addr(n)->id] = word_domain_unset;
+  return true;
+}
+
+static BzlaBvDomainWord
+word_domain_not(const BzlaBvDomainWord *d, uint32_t bw)
+{
+  BzlaBvDomainWord res;
+  uint64_t mask = bw == 64 ? ~UINT64_C(0) : (UINT64_C(1) << bw) - 1;
+  res.lo        = ~d->hi & mask;
+  res.hi        = ~d->lo & mask;
+  return res;
+}
+
+/* Get the word-level domain of node 'n', which is loaded from 'domains' on
+ * first access. */
+static BzlaBvDomainWord
+get_word_domain(Bzla *bzla,
+                BzlaIntHashTable *domains,
+                BzlaBvDomainWord *word_domains,
+                const BzlaNode *n)
+{
+  int32_t id;
+  BzlaBvDomainWord *res;
+
+  id  = bzla_node_real_addr(n)->id;
+  res = &word_domains[id];
+  if (res->lo & ~res->hi)
+  {
+    assert(bzla_hashint_map_contains(domains, id));
+    bzla_bvdomain_to_word(bzla_hashint_map_get(domains, id)->as_ptr, res);
+  }
+  if (bzla_node_is_inverted(n))
+  {
+    return word_domain_not(res, bzla_node_bv_get_width(bzla, n));
+  }
+  return *res;
+}
+
+static bool
+update_word_domain(Bzla *bzla,
+                   BzlaIntHashTable *domains,
+                   BzlaBvDomainWord *word_domains,
+                   const BzlaNode *n,
+                   const BzlaBvDomainWord *new_domain)
+{
+  int32_t id;
+  uint32_t bw;
+  BzlaBvDomainWord *d, domain, not_domain;
+  BzlaHashTableData *hd;
+  BzlaMemMgr *mm;
+
+  mm = bzla->mm;
+  id = bzla_node_real_addr(n)->id;
+  bw = bzla_node_bv_get_width(bzla, n);
+  d  = &word_domains[id];
+
+  /* 'new_domain' is the domain of the inverted node if 'n' is inverted */
+  if (bzla_node_is_inverted(n))
+    domain = word_domain_not(new_domain, bw);
+  else
+    domain = *new_domain;
+  if (d->lo == domain.lo && d->hi == domain.hi) return false;
+
+  *d         = domain;
+  not_domain = word_domain_not(&domain, bw);
+
+  hd = bzla_hashint_map_get(domains, id);
+  assert(hd);
+  bzla_bvdomain_free(mm, hd->as_ptr);
+  hd->as_ptr = bzla_bvdomain_new_from_word(mm, d, bw);
+
+  hd = bzla_hashint_map_get(domains, -id);
+  assert(hd);
+  bzla_bvdomain_free(mm, hd->as_ptr);
+  hd->as_ptr = bzla_bvdomain_new_from_word(mm, &not_domain, bw);
+  return true;
+}
+
+/* Check if the domains of node 'n' can be propagated via the word-level
+ * propagators, i.e., if the operator is supported and all of its operands
+ * are at most BZLA_BVDOMAIN_WORD_MAX_WIDTH bits wide. */
+static bool
+is_word_propagatable(Bzla *bzla, const BzlaNode *n)
+{
+  assert(bzla_node_is_regular(n));
+
+  uint32_t i;
+
+  if (!bzla_node_is_bv_slice(n) && !bzla_node_is_bv_and(n)
+      && !bzla_node_is_bv_eq(n) && !bzla_node_is_bv_add(n)
+      && !bzla_node_is_bv_ult(n) && !bzla_node_is_bv_sll(n)
+      && !bzla_node_is_bv_srl(n) && !bzla_node_is_bv_concat(n)
+      && !bzla_node_is_bv_cond(n))
+  {
+    return false;
+  }
+  if (bzla_node_bv_get_width(bzla, n) > BZLA_BVDOMAIN_WORD_MAX_WIDTH)
+  {
+    return false;
+  }
+  for (i = 0; i < n->arity; ++i)
+  {
+    if (bzla_node_bv_get_width(bzla, n->e[i]) > BZLA_BVDOMAIN_WORD_MAX_WIDTH)
+    {
+      return false;
+    }
+  }
   return true;
 }
 
 static void
-propagate_domains(Bzla *bzla,
-                  BzlaNode *root,
-                  BzlaIntHashTable *domains,
-                  BzlaIntHashTable *cache)
+propagate_word_domains(Bzla *bzla,
+                       BzlaNode *real_cur,
+                       BzlaIntHashTable *domains,
+                       BzlaBvDomainWord *word_domains,
+                       BzlaNodePtrStack *changed)
+{
+  assert(is_word_propagatable(bzla, real_cur));
+
+  bool valid;
+  uint32_t i, bw;
+  BzlaBvDomainWord d_cur, d_e[3];
+  BzlaPropSolver *slv;
+
+  slv = BZLA_PROP_SOLVER(bzla);
+
+  d_cur = get_word_domain(bzla, domains, word_domains, real_cur);
+  for (i = 0; i < real_cur->arity; ++i)
+  {
+    d_e[i] = get_word_domain(bzla, domains, word_domains, real_cur->e[i]);
+  }
+  bw = bzla_node_bv_get_width(bzla, real_cur->e[0]);
+
+  if (bzla_node_is_bv_slice(real_cur))
+  {
+    valid = bzla_bvprop_word_slice(bw,
+                                   &d_e[0],
+                                   &d_cur,
+                                   bzla_node_bv_slice_get_upper(real_cur),
+                                   bzla_node_bv_slice_get_lower(real_cur));
+  }
+  else if (bzla_node_is_bv_and(real_cur))
+  {
+    valid = bzla_bvprop_word_and(bw, &d_e[0], &d_e[1], &d_cur);
+  }
+  else if (bzla_node_is_bv_eq(real_cur))
+  {
+    valid = bzla_bvprop_word_eq(bw, &d_e[0], &d_e[1], &d_cur);
+  }
+  else if (bzla_node_is_bv_add(real_cur))
+  {
+    valid = bzla_bvprop_word_add(bw, &d_e[0], &d_e[1], &d_cur);
+  }
+  else if (bzla_node_is_bv_ult(real_cur))
+  {
+    valid = bzla_bvprop_word_ult(bw, &d_e[0], &d_e[1], &d_cur);
+  }
+  else if (bzla_node_is_bv_sll(real_cur))
+  {
+    valid = bzla_bvprop_word_sll(bw, &d_e[0], &d_e[1], &d_cur);
+  }
+  else if (bzla_node_is_bv_srl(real_cur))
+  {
+    valid = bzla_bvprop_word_srl(bw, &d_e[0], &d_e[1], &d_cur);
+  }
+  else if (bzla_node_is_bv_concat(real_cur))
+  {
+    valid =
+        bzla_bvprop_word_concat(bw,
+                                bzla_node_bv_get_width(bzla, real_cur->e[1]),
+                                &d_e[0],
+                                &d_e[1],
+                                &d_cur);
+  }
+  else
+  {
+    assert(bzla_node_is_bv_cond(real_cur));
+    valid = bzla_bvprop_word_cond(bzla_node_bv_get_width(bzla, real_cur),
+                                  &d_e[1],
+                                  &d_e[2],
+                                  &d_cur,
+                                  &d_e[0]);
+  }
+
+  /* conflicting domains are not propagated */
+  if (!valid) return;
+
+  if (update_word_domain(bzla, domains, word_domains, real_cur, &d_cur))
+  {
+    ++slv->stats.updated_domains;
+    BZLA_PUSH_STACK(*changed, real_cur);
+  }
+  for (i = 0; i < real_cur->arity; ++i)
+  {
+    if (update_word_domain(
+            bzla, domains, word_domains, real_cur->e[i], &d_e[i]))
+    {
+      ++slv->stats.updated_domains_children;
+      BZLA_PUSH_STACK(*changed, bzla_node_real_addr(real_cur->e[i]));
+    }
+  }
+}
+
+/* Apply the domain propagator of node 'real_cur' once. Nodes whose domains
+ * were updated are pushed onto 'changed'. */
+static void
+propagate_domain(Bzla *bzla,
+                 BzlaNode *real_cur,
+                 BzlaIntHashTable *domains,
+                 BzlaBvDomainWord *word_domains,
+                 BzlaNodePtrStack *changed)
 {
+  assert(bzla_node_is_regular(real_cur));
+
+  bool valid = true;
   int32_t id, child_id;
   uint32_t i;
-  BzlaNode *cur, *real_cur;
-  BzlaNodePtrStack visit;
   BzlaBvDomain *d_cur, *d_res_cur, *d_e[3], *d_res_e[3];
   BzlaMemMgr *mm;
   BzlaPropSolver *slv;
 
+  if (is_word_propagatable(bzla, real_cur))
+  {
+    propagate_word_domains(bzla, real_cur, domains, word_domains, changed);
+    return;
+  }
+
   slv = BZLA_PROP_SOLVER(bzla);
   mm  = bzla->mm;
-  BZLA_INIT_STACK(mm, visit);
-  BZLA_PUSH_STACK(visit, root);
+  id  = bzla_node_get_id(real_cur);
 
-  do
-  {
-    cur      = BZLA_POP_STACK(visit);
-    real_cur = bzla_node_real_addr(cur);
-    id       = bzla_node_get_id(real_cur);
+  assert(bzla_hashint_map_contains(domains, id));
+  assert(bzla_hashint_map_contains(domains, -id));
 
-    if (bzla_hashint_table_contains(cache, id))
-    {
-      continue;
-    }
+  d_cur = bzla_hashint_map_get(domains, id)->as_ptr;
+  assert(d_cur);
 
-    bzla_hashint_table_add(cache, id);
+  for (i = 0; i < real_cur->arity; ++i)
+  {
+    child_id = bzla_node_get_id(real_cur->e[i]);
+    assert(bzla_hashint_map_contains(domains, child_id));
+    d_e[i]     = bzla_hashint_map_get(domains, child_id)->as_ptr;
+    d_res_e[i] = 0;
+  }
+  d_res_cur = 0;
 
-    assert(bzla_hashint_map_contains(domains, id));
-    assert(bzla_hashint_map_contains(domains, -id));
-    d_cur = bzla_hashint_map_get(domains, id)->as_ptr;
-    assert(d_cur);
+  if (bzla_node_is_bv_slice(real_cur))
+  {
+    valid = bzla_bvprop_slice(mm,
+                              d_e[0],
+                              d_cur,
+                              bzla_node_bv_slice_get_upper(real_cur),
+                              bzla_node_bv_slice_get_lower(real_cur),
+                              &d_res_e[0],
+                              &d_res_cur);
+  }
+  else if (bzla_node_is_bv_and(real_cur))
+  {
+    valid = bzla_bvprop_and(
+        mm, d_e[0], d_e[1], d_cur, &d_res_e[0], &d_res_e[1], &d_res_cur);
+  }
+  else if (bzla_node_is_bv_eq(real_cur))
+  {
+    valid = bzla_bvprop_eq(
+        mm, d_e[0], d_e[1], d_cur, &d_res_e[0], &d_res_e[1], &d_res_cur);
+  }
+  else if (bzla_node_is_bv_add(real_cur))
+  {
+    valid = bzla_bvprop_add(
+        mm, d_e[0], d_e[1], d_cur, &d_res_e[0], &d_res_e[1], &d_res_cur);
+  }
+  else if (bzla_node_is_bv_mul(real_cur))
+  {
+    valid = bzla_bvprop_mul(
+        mm, d_e[0], d_e[1], d_cur, &d_res_e[0], &d_res_e[1], &d_res_cur);
+  }
+  else if (bzla_node_is_bv_ult(real_cur))
+  {
+    valid = bzla_bvprop_ult(
+        mm, d_e[0], d_e[1], d_cur, &d_res_e[0], &d_res_e[1], &d_res_cur);
+  }
+  else if (bzla_node_is_bv_sll(real_cur))
+  {
+    valid = bzla_bvprop_sll(
+        mm, d_e[0], d_e[1], d_cur, &d_res_e[0], &d_res_e[1], &d_res_cur);
+  }
+  else if (bzla_node_is_bv_srl(real_cur))
+  {
+    valid = bzla_bvprop_srl(
+        mm, d_e[0], d_e[1], d_cur, &d_res_e[0], &d_res_e[1], &d_res_cur);
+  }
+  else if (bzla_node_is_bv_udiv(real_cur))
+  {
+    valid = bzla_bvprop_udiv(
+        mm, d_e[0], d_e[1], d_cur, &d_res_e[0], &d_res_e[1], &d_res_cur);
+  }
+  else if (bzla_node_is_bv_urem(real_cur))
+  {
+    valid = bzla_bvprop_urem(
+        mm, d_e[0], d_e[1], d_cur, &d_res_e[0], &d_res_e[1], &d_res_cur);
+  }
+  else if (bzla_node_is_bv_concat(real_cur))
+  {
+    valid = bzla_bvprop_concat(
+        mm, d_e[0], d_e[1], d_cur, &d_res_e[0], &d_res_e[1], &d_res_cur);
+  }
+  else if (bzla_node_is_bv_cond(real_cur))
+  {
+    valid = bzla_bvprop_cond(mm,
+                             d_e[1],
+                             d_e[2],
+                             d_cur,
+                             d_e[0],
+                             &d_res_e[1],
+                             &d_res_e[2],
+                             &d_res_cur,
+                             &d_res_e[0]);
+  }
 
-    for (i = 0; i < real_cur->arity; ++i)
-    {
-      child_id = bzla_node_get_id(real_cur->e[i]);
-      assert(bzla_hashint_map_contains(domains, child_id));
-      d_e[i]     = bzla_hashint_map_get(domains, child_id)->as_ptr;
-      d_res_e[i] = 0;
-    }
-    d_res_cur = 0;
+  /* conflicting domains are not propagated */
+  if (!valid) goto DONE;
 
-    if (bzla_node_is_bv_slice(real_cur))
-    {
-      bzla_bvprop_slice(mm,
-                        d_e[0],
-                        d_cur,
-                        bzla_node_bv_slice_get_upper(real_cur),
-                        bzla_node_bv_slice_get_lower(real_cur),
-                        &d_res_e[0],
-                        &d_res_cur);
-    }
-    else if (bzla_node_is_bv_and(real_cur))
-    {
-      bzla_bvprop_and(
-          mm, d_e[0], d_e[1], d_cur, &d_res_e[0], &d_res_e[1], &d_res_cur);
-    }
-    else if (bzla_node_is_bv_eq(real_cur))
-    {
-      bzla_bvprop_eq(
-          mm, d_e[0], d_e[1], d_cur, &d_res_e[0], &d_res_e[1], &d_res_cur);
-    }
-    else if (bzla_node_is_bv_add(real_cur))
-    {
-      bzla_bvprop_add(
-          mm, d_e[0], d_e[1], d_cur, &d_res_e[0], &d_res_e[1], &d_res_cur);
-    }
-    else if (bzla_node_is_bv_mul(real_cur))
-    {
-      bzla_bvprop_mul(
-          mm, d_e[0], d_e[1], d_cur, &d_res_e[0], &d_res_e[1], &d_res_cur);
-    }
-    else if (bzla_node_is_bv_ult(real_cur))
-    {
-      bzla_bvprop_ult(
-          mm, d_e[0], d_e[1], d_cur, &d_res_e[0], &d_res_e[1], &d_res_cur);
-    }
-    else if (bzla_node_is_bv_sll(real_cur))
-    {
-      bzla_bvprop_sll(
-          mm, d_e[0], d_e[1], d_cur, &d_res_e[0], &d_res_e[1], &d_res_cur);
-    }
-    else if (bzla_node_is_bv_srl(real_cur))
-    {
-      bzla_bvprop_srl(
-          mm, d_e[0], d_e[1], d_cur, &d_res_e[0], &d_res_e[1], &d_res_cur);
-    }
-    else if (bzla_node_is_bv_udiv(real_cur))
+#ifndef NDEBUG
+  if (d_res_cur)
+  {
+    assert(bzla_bvdomain_is_valid(mm, d_res_cur));
+  }
+  for (i = 0; i < real_cur->arity; ++i)
+  {
+    if (d_res_e[i])
     {
-      bzla_bvprop_udiv(
-          mm, d_e[0], d_e[1], d_cur, &d_res_e[0], &d_res_e[1], &d_res_cur);
+      assert(bzla_bvdomain_is_valid(mm, d_res_e[i]));
     }
-    else if (bzla_node_is_bv_urem(real_cur))
+  }
+#endif
+
+  if (update_domain(bzla, domains, word_domains, real_cur, d_cur, d_res_cur))
+  {
+    ++slv->stats.updated_domains;
+    BZLA_PUSH_STACK(*changed, real_cur);
+  }
+  for (i = 0; i < real_cur->arity; ++i)
+  {
+    if (update_domain(bzla,
+                      domains,
+                      word_domains,
+                      real_cur->e[i],
+                      d_e[i],
+                      d_res_e[i]))
     {
-      bzla_bvprop_urem(
-          mm, d_e[0], d_e[1], d_cur, &d_res_e[0], &d_res_e[1], &d_res_cur);
+      ++slv->stats.updated_domains_children;
+      BZLA_PUSH_STACK(*changed, bzla_node_real_addr(real_cur->e[i]));
     }
-    else if (bzla_node_is_bv_concat(real_cur))
+  }
+
+DONE:
+  if (d_res_cur)
+  {
+    bzla_bvdomain_free(mm, d_res_cur);
+  }
+  for (i = 0; i < real_cur->arity; ++i)
+  {
+    if (d_res_e[i])
     {
-      bzla_bvprop_concat(
-          mm, d_e[0], d_e[1], d_cur, &d_res_e[0], &d_res_e[1], &d_res_cur);
+      bzla_bvdomain_free(mm, d_res_e[i]);
     }
-    else if (bzla_node_is_bv_cond(real_cur))
+  }
+}
+
+/* Schedule node 'n' for propagation if it has a propagator and is not
+ * scheduled yet. */
+static void
+schedule_domain(BzlaIntHashTable *domains,
+                BzlaNode *n,
+                BzlaNodePtrQueue *queue,
+                bool *scheduled)
+{
+  assert(bzla_node_is_regular(n));
+
+  if (scheduled[n->id] || n->arity == 0 || bzla_lsutils_is_leaf_node(n)
+      || !bzla_hashint_map_contains(domains, n->id))
+  {
+    return;
+  }
+  scheduled[n->id] = true;
+  BZLA_ENQUEUE(*queue, n);
+}
+
+/* Propagate the domains of all nodes in the cones of 'roots' to a fixed point.
+ * Domains only ever get more precise, and a node is only rescheduled if the
+ * domain of one of its operands or of the node itself changed. If 'limit' is
+ * greater than 0, propagation stops after 'limit' propagator applications. */
+static void
+propagate_domains(Bzla *bzla,
+                  BzlaNodePtrStack *roots,
+                  BzlaIntHashTable *domains,
+                  BzlaBvDomainWord *word_domains,
+                  uint32_t size,
+                  uint64_t limit)
+{
+  uint32_t i;
+  uint64_t nprops;
+  bool *scheduled;
+  BzlaNode *cur, *real_cur;
+  BzlaNodePtrStack visit, changed;
+  BzlaNodePtrQueue queue;
+  BzlaNodeIterator it;
+  BzlaBvDomainWord d_root;
+  BzlaMemMgr *mm;
+  BzlaPropSolver *slv;
+
+  slv = BZLA_PROP_SOLVER(bzla);
+  mm  = bzla->mm;
+  BZLA_CNEWN(mm, scheduled, size);
+  BZLA_INIT_STACK(mm, visit);
+  BZLA_INIT_STACK(mm, changed);
+  BZLA_INIT_QUEUE(mm, queue);
+
+  /* roots are asserted, i.e., their domains can be fixed to true */
+  for (i = 0; i < BZLA_COUNT_STACK(*roots); ++i)
+  {
+    cur    = BZLA_PEEK_STACK(*roots, i);
+    d_root = get_word_domain(bzla, domains, word_domains, cur);
+    if (d_root.hi == 0) continue;
+    d_root.lo = 1;
+    update_word_domain(bzla, domains, word_domains, cur, &d_root);
+  }
+
+  /* initially schedule all nodes top-down */
+  for (i = 0; i < BZLA_COUNT_STACK(*roots); ++i)
+  {
+    BZLA_PUSH_STACK(visit, BZLA_PEEK_STACK(*roots, i));
+  }
+  while (!BZLA_EMPTY_STACK(visit))
+  {
+    real_cur = bzla_node_real_addr(BZLA_POP_STACK(visit));
+    if (scheduled[real_cur->id]) continue;
+    schedule_domain(domains, real_cur, &queue, scheduled);
+    if (!scheduled[real_cur->id]) continue;
+    for (i = 0; i < real_cur->arity; ++i)
     {
-      bzla_bvprop_cond(mm,
-                       d_e[1],
-                       d_e[2],
-                       d_cur,
-                       d_e[0],
-                       &d_res_e[1],
-                       &d_res_e[2],
-                       &d_res_cur,
-                       &d_res_e[0]);
+      BZLA_PUSH_STACK(visit, real_cur->e[i]);
     }
+  }
 
-#ifndef NDEBUG
-    if (d_res_cur)
+  nprops = 0;
+  while (!BZLA_EMPTY_QUEUE(queue))
+  {
+    if (limit && nprops >= limit)
     {
-      assert(bzla_bvdomain_is_valid(mm, d_res_cur));
+      ++slv->stats.domain_limit_reached;
+      break;
     }
-    for (i = 0; i < real_cur->arity; ++i)
+    real_cur = BZLA_DEQUEUE(queue);
+    assert(scheduled[real_cur->id]);
+    scheduled[real_cur->id] = false;
+    ++nprops;
+    ++slv->stats.domain_props;
+
+    propagate_domain(bzla, real_cur, domains, word_domains, &changed);
+
+    /* reschedule the changed nodes and their parents */
+    while (!BZLA_EMPTY_STACK(changed))
     {
-      if (d_res_e[i])
+      cur = BZLA_POP_STACK(changed);
+      schedule_domain(domains, cur, &queue, scheduled);
+      bzla_iter_parent_init(&it, cur);
+      while (bzla_iter_parent_has_next(&it))
       {
-        assert(bzla_bvdomain_is_valid(mm, d_res_e[i]));
+        schedule_domain(domains, bzla_iter_parent_next(&it), &queue, scheduled);
       }
     }
-#endif
+  }
 
-    if (update_domain(bzla, domains, real_cur, d_cur, d_res_cur))
-    {
-      ++slv->stats.updated_domains;
-    }
+  BZLA_RELEASE_QUEUE(queue);
+  BZLA_RELEASE_STACK(changed);
+  BZLA_RELEASE_STACK(visit);
+  BZLA_DELETEN(mm, scheduled, size);
+}
 
-    if (d_res_cur)
-    {
-      bzla_bvdomain_free(mm, d_res_cur);
-    }
+void
+bzla_prop_solver_propagate_domains(Bzla *bzla, BzlaIntHashTable *domains)
+{
+  assert(bzla);
+  assert(domains);
 
-    for (i = 0; i < real_cur->arity; ++i)
+  uint32_t i, size;
+  BzlaBvDomainWord *word_domains;
+  BzlaNodePtrStack roots;
+  BzlaPtrHashTableIterator it;
+
+  /* word-level domains of nodes with width <= 64, indexed by node id */
+  size = BZLA_COUNT_STACK(bzla->nodes_id_table);
+  BZLA_NEWN(bzla->mm, word_domains, size);
+  for (i = 0; i < size; i++)
+  {
+    word_domains[i] = word_domain_unset;
+  }
+  BZLA_INIT_STACK(bzla->mm, roots);
+  bzla_iter_hashptr_init(&it, bzla->unsynthesized_constraints);
+  bzla_iter_hashptr_queue(&it, bzla->synthesized_constraints);
+  bzla_iter_hashptr_queue(&it, bzla->assumptions);
+  while (bzla_iter_hashptr_has_next(&it))
+  {
+    BZLA_PUSH_STACK(roots, bzla_iter_hashptr_next(&it));
+  }
+  propagate_domains(bzla,
+                    &roots,
+                    domains,
+                    word_domains,
+                    size,
+                    bzla_opt_get(bzla, BZLA_OPT_PROP_CONST_DOMAINS_LIMIT));
+  BZLA_RELEASE_STACK(roots);
+  BZLA_DELETEN(bzla->mm, word_domains, size);
+}
+
+/* Assert the constant bits of all domains that are not constant in the AIG
+ * layer as units to the SAT solver. The domains must be derived from the
+ * constraints only, i.e., they must not depend on any assumptions. */
+static void
+share_const_bits(Bzla *bzla)
+{
+  assert(bzla->assumptions->count == 0);
+  assert(bzla_sat_is_initialized(bzla_get_sat_mgr(bzla)));
+
+  int32_t id;
+  uint32_t i, bw, nshared;
+  BzlaNode *n;
+  BzlaAIG *aig;
+  BzlaBvDomain *d;
+  BzlaAIGMgr *amgr;
+  BzlaIntHashTable *domains;
+  BzlaIntHashTableIterator it;
+
+  amgr    = bzla_get_aig_mgr(bzla);
+  domains = BZLA_PROP_SOLVER(bzla)->domains;
+  nshared = 0;
+
+  bzla_iter_hashint_init(&it, domains);
+  while (bzla_iter_hashint_has_next(&it))
+  {
+    id = bzla_iter_hashint_next(&it);
+    if (id < 0) continue;
+    n = bzla_node_get_by_id(bzla, id);
+    assert(n);
+    if (!n->av) continue;
+    d  = bzla_hashint_map_get(domains, id)->as_ptr;
+    bw = n->av->width;
+    for (i = 0; i < bw; i++)
     {
-      if (update_domain(bzla, domains, real_cur->e[i], d_e[i], d_res_e[i]))
-      {
-        ++slv->stats.updated_domains_children;
-      }
-      if (d_res_e[i])
+      aig = n->av->aigs[i];
+      if (bzla_aig_is_const(aig)) continue;
+      if (!bzla_bvdomain_is_fixed_bit(d, bw - 1 - i)) continue;
+      if (bzla_bvdomain_is_fixed_bit_false(d, bw - 1 - i))
       {
-        bzla_bvdomain_free(mm, d_res_e[i]);
+        aig = BZLA_INVERT_AIG(aig);
       }
-
-      BZLA_PUSH_STACK(visit, real_cur->e[i]);
+      bzla_aig_add_toplevel_to_sat(amgr, aig);
+      nshared++;
     }
-  } while (!BZLA_EMPTY_STACK(visit));
-
-  BZLA_RELEASE_STACK(visit);
+  }
+  BZLA_PROP_SOLVER(bzla)->stats.shared_bits += nshared;
+  BZLA_MSG(bzla->msg, 1, "asserting %u constant bits", nshared);
 }
 
 /* Note: We only want to synthesize the constraints but don't want to add them
@@ -687,7 +1100,6 @@ bzla_prop_solver_sat(Bzla *bzla)
   BzlaPtrHashTableIterator it;
   BzlaIntHashTableIterator iit;
   BzlaPropSolver *slv;
-  BzlaIntHashTable *cache;
 
   slv = BZLA_PROP_SOLVER(bzla);
   assert(slv);
@@ -753,16 +1165,7 @@ bzla_prop_solver_sat(Bzla *bzla)
 
   if (opt_prop_const_bits && bzla_opt_get(bzla, BZLA_OPT_PROP_CONST_DOMAINS))
   {
-    cache = bzla_hashint_table_new(bzla->mm);
-    bzla_iter_hashptr_init(&it, bzla->unsynthesized_constraints);
-    bzla_iter_hashptr_queue(&it, bzla->synthesized_constraints);
-    bzla_iter_hashptr_queue(&it, bzla->assumptions);
-    while (bzla_iter_hashptr_has_next(&it))
-    {
-      root = bzla_iter_hashptr_next(&it);
-      propagate_domains(bzla, root, slv->domains, cache);
-    }
-    bzla_hashint_table_delete(cache);
+    bzla_prop_solver_propagate_domains(bzla, slv->domains);
   }
 
   for (;;)
@@ -877,6 +1280,15 @@ DONE:
   // TODO: domains shouldn't be deleted after every sat call
   if (slv->domains)
   {
+    /* Share constant bits with the bit-blasting engine. Domains derived in
+     * the presence of assumptions do not hold in general. */
+    if (sat_result == BZLA_RESULT_UNKNOWN && slv->domains->count
+        && bzla_opt_get(bzla, BZLA_OPT_LS_SHARE_CONST_BITS)
+        && !bzla->assumptions->count
+        && bzla_sat_is_initialized(bzla_get_sat_mgr(bzla)))
+    {
+      share_const_bits(bzla);
+    }
     bzla_iter_hashint_init(&iit, slv->domains);
     while (bzla_iter_hashint_has_next(&iit))
     {
@@ -939,6 +1351,7 @@ generate_model_prop_solver(BzlaPropSolver *slv,
   if (!reset && bzla->bv_model) return;
   bzla_lsutils_initialize_bv_model((BzlaSolver *) slv);
   bzla_model_init_fun(bzla, &bzla->fun_model);
+  bzla_lsutils_initialize_fp_model(bzla, bzla->bv_model);
   bzla_model_generate(
       bzla, bzla->bv_model, bzla->fun_model, model_for_all_nodes);
 }
@@ -1026,6 +1439,7 @@ print_stats_prop_solver(BzlaPropSolver *slv)
   BZLA_MSG(bzla->msg, 1, "%s (slice): %u", s_cons, slv->stats.cons_slice);
   BZLA_MSG(bzla->msg, 1, "%s (cond): %u", s_cons, slv->stats.cons_cond);
   BZLA_MSG(bzla->msg, 1, "%s (xor): %u", s_cons, slv->stats.cons_xor);
+  BZLA_MSG(bzla->msg, 1, "%s (fp): %u", s_cons, slv->stats.cons_fp);
 
   /* Inverse value computation stats. */
   BZLA_MSG(bzla->msg, 1, "");
@@ -1046,6 +1460,7 @@ print_stats_prop_solver(BzlaPropSolver *slv)
   BZLA_MSG(bzla->msg, 1, "%s (slice): %u", s_inv, slv->stats.inv_slice);
   BZLA_MSG(bzla->msg, 1, "%s (cond): %u", s_inv, slv->stats.inv_cond);
   BZLA_MSG(bzla->msg, 1, "%s (xor): %u", s_inv, slv->stats.inv_xor);
+  BZLA_MSG(bzla->msg, 1, "%s (fp): %u", s_inv, slv->stats.inv_fp);
 #endif
 
   if (bzla_opt_get(bzla, BZLA_OPT_PROP_CONST_BITS))
@@ -1067,6 +1482,17 @@ print_stats_prop_solver(BzlaPropSolver *slv)
              1,
              "updated domains (children): %zu",
              slv->stats.updated_domains_children);
+    BZLA_MSG(bzla->msg, 1, "domain propagations: %zu", slv->stats.domain_props);
+    BZLA_MSG(bzla->msg,
+             1,
+             "domain propagation limit reached: %u",
+             slv->stats.domain_limit_reached);
+  }
+
+  if (bzla_opt_get(bzla, BZLA_OPT_LS_SHARE_CONST_BITS))
+  {
+    BZLA_MSG(bzla->msg, 1, "");
+    BZLA_MSG(bzla->msg, 1, "shared constant bits: %zu", slv->stats.shared_bits);
   }
 }
 
@@ -107,6 +107,7 @@ struct BzlaPropSolver
     uint32_t inv_slice;
     uint32_t inv_cond;
     uint32_t inv_xor;
+    uint32_t inv_fp;
 
     /* Number of calls to consistent value computation functions. */
     uint32_t cons_add;
@@ -124,12 +125,16 @@ struct BzlaPropSolver
     uint32_t cons_slice;
     uint32_t cons_cond;
     uint32_t cons_xor;
+    uint32_t cons_fp;
 
     /* constant bit information */
     uint64_t fixed_bits;
     uint64_t total_bits;
     uint64_t updated_domains;
     uint64_t updated_domains_children;
+    uint64_t domain_props;
+    uint32_t domain_limit_reached;
+    uint64_t shared_bits;
   } stats;
 
   struct
@@ -152,6 +157,10 @@ void bzla_prop_solver_init_domains(Bzla *bzla,
                                    BzlaIntHashTable *domains,
                                    BzlaNode *root);
 
+/* Propagate the domains initialized via bzla_prop_solver_init_domains()
+ * over the cones of all constraints and assumptions. */
+void bzla_prop_solver_propagate_domains(Bzla *bzla, BzlaIntHashTable *domains);
+
 int32_t bzla_prop_solver_sat(Bzla *bzla);
 /*------------------------------------------------------------------------*/
 
@@ -23,15 +23,21 @@ extern "C" {
 #include "utils/bzlahashint.h"
 #include "utils/bzlahashptr.h"
 #include "utils/bzlanodeiter.h"
+#include "utils/bzlanodemap.h"
 #include "utils/bzlautil.h"
 }
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <cstdarg>
 #include <iomanip>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <sstream>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -73,6 +79,23 @@ template <typename T>
 using NodeMap = std::unordered_map<BzlaNode *, T>;
 using NodeSet = std::unordered_set<BzlaNode *>;
 
+struct BvValueHash
+{
+  size_t operator()(const BzlaBitVector *bv) const { return bzla_bv_hash(bv); }
+};
+
+struct BvValueEqual
+{
+  bool operator()(const BzlaBitVector *a, const BzlaBitVector *b) const
+  {
+    return bzla_bv_compare(a, b) == 0;
+  }
+};
+
+/* Maps model values to a representative term with that value. */
+using ValueIndex = std::
+    unordered_map<const BzlaBitVector *, BzlaNode *, BvValueHash, BvValueEqual>;
+
 /*------------------------------------------------------------------------*/
 
 std::ostream &
@@ -186,6 +209,66 @@ SynthData::~SynthData()
   }
 }
 
+/** Clone of the ground solver, owned by one counterexample check thread. */
+struct CeClone
+{
+  CeClone(Bzla *bzla);
+  ~CeClone();
+
+  /**
+   * Get the node of the clone that corresponds to node `n` of the ground
+   * solver `bzla`. Nodes created after cloning are rebuilt in the clone.
+   * Must only be called from the main thread.
+   */
+  BzlaNode *get_node(Bzla *bzla, BzlaNode *n);
+
+  Bzla *d_bzla;
+  BzlaNodeMap *d_map;
+  /* Termination flag of the clone, set by the main thread if the ground
+   * solver is terminated. */
+  std::atomic<int32_t> d_terminate;
+};
+
+static int32_t
+terminate_ce_clone(void *state)
+{
+  return static_cast<CeClone *>(state)->d_terminate.load();
+}
+
+CeClone::CeClone(Bzla *bzla) : d_map(nullptr), d_terminate(0)
+{
+  d_bzla = bzla_clone_exp_layer(bzla, &d_map, true);
+  assert(d_bzla->slv);
+  bzla_opt_set(d_bzla, BZLA_OPT_VERBOSITY, 0);
+  bzla_opt_set(d_bzla, BZLA_OPT_LOGLEVEL, 0);
+  /* The termination callback of the ground solver is not thread-safe, it is
+   * only called by the main thread, which forwards it via d_terminate. */
+  bzla_set_term(d_bzla, terminate_ce_clone, this);
+  /* Model assumptions are set per round. */
+  bzla_reset_assumptions(d_bzla);
+}
+
+CeClone::~CeClone()
+{
+  bzla_nodemap_delete(d_map);
+  bzla_delete(d_bzla);
+}
+
+BzlaNode *
+CeClone::get_node(Bzla *bzla, BzlaNode *n)
+{
+  BzlaNode *res = bzla_nodemap_mapped(d_map, n);
+  if (!res)
+  {
+    /* Rebuild with rewrite level 0 to get the exact expression. */
+    res = bzla_clone_recursively_rebuild_exp(bzla, d_bzla, n, d_map, 0);
+    bzla_node_release(d_bzla, res);
+    res = bzla_nodemap_mapped(d_map, n);
+  }
+  assert(res);
+  return res;
+}
+
 enum class LemmaKind
 {
   COUNTEREXAMPLE,
@@ -224,6 +307,15 @@ class QuantSolverState
   bool check_active_quantifiers();
   BzlaSolverResult check_ground_formulas();
 
+  /**
+   * Check quantifiers `to_check` for counterexamples concurrently on clones
+   * of the ground solver and add instantiation lemmas for all found
+   * counterexamples. Returns the number of quantifiers without
+   * counterexamples.
+   */
+  size_t check_counterexamples_parallel(
+      const std::vector<BzlaNode *> &to_check);
+
   void set_inactive(BzlaNode *q);
   bool is_inactive(BzlaNode *q);
 
@@ -274,6 +366,11 @@ class QuantSolverState
 
   BzlaNode *instantiate(BzlaNode *q, const NodeMap<BzlaNode *> &substs);
 
+  /** Get the value of `n` in the current model. */
+  const BzlaBitVector *get_model_bv(BzlaNode *n);
+  /** Get the value of `n` in the current model as value node. */
+  BzlaNode *get_model_value(BzlaNode *n);
+
   bool add_lemma(BzlaNode *lem, LemmaKind k);
   void assert_lemmas();
   void add_value_instantiation_lemma(BzlaNode *q);
@@ -293,6 +390,13 @@ class QuantSolverState
   void synthesize_terms();
   void store_synthesized_term(BzlaNode *sk, BzlaNode *term);
   void synthesize_qi(BzlaNode *q);
+
+  /**
+   * Find a ground term of sort `sort_id` in d_term_map whose value in the
+   * current model is `value`. Returns nullptr if there is no such term.
+   */
+  BzlaNode *find_term_with_value(BzlaSortId sort_id,
+                                 const BzlaBitVector *value);
   void mbqi(BzlaNode *q);
 
   void print_statistics() const;
@@ -383,6 +487,26 @@ class QuantSolverState
    */
   std::unordered_map<BzlaSortId, std::vector<BzlaNode *>> d_term_map;
 
+  /**
+   * Maps sort ids to an index from model values to terms in d_term_map.
+   * Built on demand per sort and cleared whenever the model changes, since
+   * the model values used as keys are owned by the model.
+   */
+  std::unordered_map<BzlaSortId, ValueIndex> d_term_value_index;
+
+  /**
+   * Model values of a counterexample found by a parallel counterexample
+   * check. If set, model values are queried from here instead of the model of
+   * the ground solver.
+   */
+  const NodeMap<BzlaBitVector *> *d_ce_values = nullptr;
+
+  /**
+   * Clones of the ground solver for the parallel counterexample checks. Kept
+   * alive across rounds, all lemmas are asserted in the clones, too.
+   */
+  std::vector<std::unique_ptr<CeClone>> d_ce_clones;
+
   NodeSet d_constants;
 
   std::unordered_map<BzlaNode *, SynthData> d_synth_qi_data;
@@ -392,6 +516,7 @@ class QuantSolverState
   bool d_opt_skolem_uf;
   bool d_opt_eager_skolem;
   bool d_opt_mbqi;
+  uint32_t d_opt_ce_n_threads;
   BzlaOptQuantMode d_opt_mode;
 };
 
@@ -402,6 +527,7 @@ QuantSolverState::QuantSolverState(Bzla *bzla)
       d_opt_skolem_uf(bzla_opt_get(bzla, BZLA_OPT_QUANT_SKOLEM_UF) == 1),
       d_opt_eager_skolem(bzla_opt_get(bzla, BZLA_OPT_QUANT_EAGER_SKOLEM) == 1),
       d_opt_mbqi(bzla_opt_get(bzla, BZLA_OPT_QUANT_MBQI) == 1),
+      d_opt_ce_n_threads(bzla_opt_get(bzla, BZLA_OPT_QUANT_CE_N_THREADS)),
       d_opt_mode(static_cast<BzlaOptQuantMode>(
           bzla_opt_get(bzla, BZLA_OPT_QUANT_MODE))){};
 
@@ -507,6 +633,8 @@ QuantSolverState::reset()
   d_opt_mode =
       static_cast<BzlaOptQuantMode>(bzla_opt_get(d_bzla, BZLA_OPT_QUANT_MODE));
   d_synth_qi_data.clear();
+  /* The formula may have changed since the last check-sat call. */
+  d_ce_clones.clear();
 }
 
 /*------------------------------------------------------------------------*/
@@ -523,12 +651,14 @@ struct BzlaQuantSolver
 BzlaSolverResult
 QuantSolverState::check_sat_ground()
 {
+  d_term_value_index.clear();
   return d_bzla->slv->api.sat(d_bzla->slv);
 }
 
 void
 QuantSolverState::generate_model_ground()
 {
+  d_term_value_index.clear();
   d_bzla->slv->api.generate_model(d_bzla->slv, false, false);
 }
 
@@ -1258,6 +1388,45 @@ get_value(Bzla *bzla, BzlaNode *n)
   return bzla_model_get_value(bzla, n);
 }
 
+/** Check whether floating-point or rounding mode sorts were created. */
+static bool
+has_fp_sorts(Bzla *bzla)
+{
+  const BzlaSortPtrStack &sorts = bzla->sorts_unique_table.id2sort;
+  for (size_t i = 0; i < BZLA_COUNT_STACK(sorts); ++i)
+  {
+    BzlaSort *sort = BZLA_PEEK_STACK(sorts, i);
+    if (sort && (sort->kind == BZLA_FP_SORT || sort->kind == BZLA_RM_SORT))
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+const BzlaBitVector *
+QuantSolverState::get_model_bv(BzlaNode *n)
+{
+  if (d_ce_values)
+  {
+    auto it = d_ce_values->find(n);
+    assert(it != d_ce_values->end());
+    return it->second;
+  }
+  return bzla_model_get_bv(d_bzla, n);
+}
+
+BzlaNode *
+QuantSolverState::get_model_value(BzlaNode *n)
+{
+  if (d_ce_values)
+  {
+    return bzla_node_mk_value(
+        d_bzla, bzla_node_get_sort_id(n), get_model_bv(n));
+  }
+  return get_value(d_bzla, n);
+}
+
 bool
 QuantSolverState::add_lemma(BzlaNode *lem, LemmaKind k)
 {
@@ -1286,6 +1455,11 @@ QuantSolverState::assert_lemmas()
   {
     qlog("  Lemma: %s\n", bzla_util_node2string(lem));
     bzla_assert_exp(d_bzla, lem);
+    for (auto &clone : d_ce_clones)
+    {
+      clone->d_bzla->valid_assignments = 0;
+      bzla_assert_exp(clone->d_bzla, clone->get_node(d_bzla, lem));
+    }
   }
   d_lemmas.clear();
 }
@@ -1307,7 +1481,7 @@ QuantSolverState::add_value_instantiation_lemma(BzlaNode *q)
   {
     cur   = bzla_iter_binder_next(&it);
     ic    = get_inst_constant(cur);
-    value = get_value(d_bzla, ic);
+    value = get_model_value(ic);
     map.emplace(cur->e[0], value);
     qlog("  %s -> %s\n",
          bzla_util_node2string(cur->e[0]),
@@ -1614,7 +1788,7 @@ QuantSolverState::synthesize_qi(BzlaNode *q)
       std::vector<const BzlaBitVector *> input_values;
 
       synth_data.d_values_out.push_back(
-          bzla_bv_copy(d_bzla->mm, bzla_model_get_bv(d_bzla, ic)));
+          bzla_bv_copy(d_bzla->mm, get_model_bv(ic)));
 
       // TODO: remove duplicate inputs
 
@@ -1630,7 +1804,7 @@ QuantSolverState::synthesize_qi(BzlaNode *q)
           assert(!bzla_node_is_proxy(c));
           assert(bzla_node_is_bv_var(c));
           inputs.push_back(c);
-          input_values.push_back(bzla_model_get_bv(d_bzla, c));
+          input_values.push_back(get_model_bv(c));
           assert(input_values.back());
         }
       }
@@ -1649,7 +1823,7 @@ QuantSolverState::synthesize_qi(BzlaNode *q)
           if (bzla_node_is_bv(d_bzla, dep))
           {
             inputs.push_back(dep);
-            input_values.push_back(bzla_model_get_bv(d_bzla, dep));
+            input_values.push_back(get_model_bv(dep));
             assert(input_values.back());
           }
         }
@@ -1697,7 +1871,7 @@ QuantSolverState::synthesize_qi(BzlaNode *q)
     }
     else
     {
-      map[cur_q->e[0]] = get_value(d_bzla, ic);
+      map[cur_q->e[0]] = get_model_value(ic);
     }
   }
 
@@ -1729,6 +1903,37 @@ QuantSolverState::synthesize_qi(BzlaNode *q)
   bzla_node_release(d_bzla, lem);
 }
 
+BzlaNode *
+QuantSolverState::find_term_with_value(BzlaSortId sort_id,
+                                       const BzlaBitVector *value)
+{
+  auto it = d_term_value_index.find(sort_id);
+  if (it == d_term_value_index.end())
+  {
+    it = d_term_value_index.emplace(sort_id, ValueIndex()).first;
+
+    auto tit = d_term_map.find(sort_id);
+    if (tit != d_term_map.end())
+    {
+      ValueIndex &index = it->second;
+      index.reserve(tit->second.size());
+      for (BzlaNode *t : tit->second)
+      {
+        assert(bzla_node_is_regular(t));
+        const BzlaBitVector *val = get_model_bv(t);
+        if (val)
+        {
+          /* Keeps the first term with a value, same as a linear scan. */
+          index.emplace(val, t);
+        }
+      }
+    }
+  }
+
+  auto vit = it->second.find(value);
+  return vit != it->second.end() ? vit->second : nullptr;
+}
+
 void
 QuantSolverState::mbqi(BzlaNode *q)
 {
@@ -1742,27 +1947,10 @@ QuantSolverState::mbqi(BzlaNode *q)
   {
     cur_q       = bzla_iter_binder_next(&nit);
     ic          = get_inst_constant(cur_q);
-    auto ic_val = bzla_model_get_bv(d_bzla, ic);
-
-    BzlaNode *t = nullptr;
+    auto ic_val = get_model_bv(ic);
 
     // Find terms with same value as ic.
-    BzlaSortId sort_id = bzla_node_get_sort_id(ic);
-    auto it            = d_term_map.find(sort_id);
-    if (it != d_term_map.end())
-    {
-      auto &consts = it->second;
-      for (BzlaNode *c : consts)
-      {
-        assert(bzla_node_is_regular(c));
-        auto val = bzla_model_get_bv(d_bzla, c);
-        if (bzla_bv_compare(val, ic_val) == 0)
-        {
-          t = c;
-          break;
-        }
-      }
-    }
+    BzlaNode *t = find_term_with_value(bzla_node_get_sort_id(ic), ic_val);
 
     if (t)
     {
@@ -1774,7 +1962,7 @@ QuantSolverState::mbqi(BzlaNode *q)
     }
     else
     {
-      map[cur_q->e[0]] = get_value(d_bzla, ic);
+      map[cur_q->e[0]] = get_model_value(ic);
       qlog("mbqi inst: %s -> %s\n",
            bzla_util_node2string(cur_q->e[0]),
            bzla_util_node2string(map[cur_q->e[0]]));
@@ -1916,26 +2104,340 @@ QuantSolverState::check_active_quantifiers()
   // Check for counterexamples under current candidate model.
   start               = bzla_util_time_stamp();
   size_t num_inactive = 0;
-  for (BzlaNode *q : to_check)
+  if (d_opt_ce_n_threads > 1 && to_check.size() > 1 && !has_fp_sorts(d_bzla))
   {
-    if (d_bzla->inconsistent)
+    num_inactive = check_counterexamples_parallel(to_check);
+  }
+  else
+  {
+    for (BzlaNode *q : to_check)
     {
-      break;
+      if (d_bzla->inconsistent)
+      {
+        break;
+      }
+
+      ++d_statistics.num_counterexample_checks;
+      qlog("***\n");
+
+      lit = get_ce_literal(q);
+      bool assumed = assume(lit);
+
+      qlog("Check for counterexamples (%s): ", bzla_util_node2string(q));
+      res = check_sat_ground();
+      // Counterexample found, add new instantiation.
+      if (res == BZLA_RESULT_SAT)
+      {
+        qlog("sat\n");
+        generate_model_ground();
+        add_value_instantiation_lemma(q);
+        if (d_opt_synth_qi)
+        {
+          synthesize_qi(q);
+        }
+        if (d_opt_mbqi)
+        {
+          mbqi(q);
+        }
+        assert_lemmas();
+      }
+      // No counterexamples found anymore, set quantifier to inactive.
+      else if (res == BZLA_RESULT_UNSAT)
+      {
+        qlog("unsat\n");
+        if (bzla_failed_exp(d_bzla, lit))
+        {
+          ++num_inactive;
+          //set_inactive(q);
+        }
+      }
+
+      if (assumed)
+      {
+        pop_assumption();
+      }
+      qlog("***\n");
     }
+  }
+  done = num_inactive == to_check.size();
 
-    ++d_statistics.num_counterexample_checks;
-    qlog("***\n");
+  reset_assumptions();
+
+  d_statistics.time_check_counterexamples += bzla_util_time_stamp() - start;
+
+  return done;
+}
+
+namespace {
 
-    lit = get_ce_literal(q);
-    bool assumed = assume(lit);
+/** Counterexample check of a quantifier on a clone of the ground solver. */
+struct CeCheck
+{
+  /* The quantifier, true in the current model of the ground solver. */
+  BzlaNode *d_q = nullptr;
+  /* Counterexample literal of the quantifier. */
+  BzlaNode *d_lit = nullptr;
+  /* Nodes whose counterexample values are needed for instantiation. */
+  std::vector<BzlaNode *> d_nodes;
+  /* Values of d_nodes, allocated with the memory manager of the clone. */
+  std::vector<BzlaBitVector *> d_values;
+  BzlaSolverResult d_result = BZLA_RESULT_UNKNOWN;
+  bool d_failed             = false;
+  /* Index of the clone the check was performed on. */
+  size_t d_clone = 0;
+};
 
+/**
+ * Assume `n` on `bzla` if it is not assumed yet, returns the simplified
+ * assumption to pass to pop_ce_assumption() or nullptr.
+ */
+BzlaNode *
+push_ce_assumption(Bzla *bzla, BzlaNode *n)
+{
+  if (bzla_is_assumption_exp(bzla, n))
+  {
+    return nullptr;
+  }
+  bzla->valid_assignments = 0;
+  bzla_assume_exp(bzla, n);
+  return bzla_node_copy(bzla, bzla_simplify_exp(bzla, n));
+}
+
+/** Remove assumption `n`, see QuantSolverState::pop_assumption(). */
+void
+pop_ce_assumption(Bzla *bzla, BzlaNode *n, BzlaNode *simp)
+{
+  if (!simp)
+  {
+    return;
+  }
+  if (bzla_hashptr_table_get(bzla->orig_assumptions, n))
+  {
+    bzla_hashptr_table_remove(bzla->orig_assumptions, n, 0, 0);
+    bzla_node_release(bzla, n);
+  }
+  if (bzla_hashptr_table_get(bzla->assumptions, simp))
+  {
+    bzla_hashptr_table_remove(bzla->assumptions, simp, 0, 0);
+    bzla_node_release(bzla, simp);
+  }
+  bzla_node_release(bzla, simp);
+}
+
+void
+check_counterexample(CeClone &clone, CeCheck &check)
+{
+  Bzla *bzla    = clone.d_bzla;
+  BzlaNode *q   = bzla_nodemap_mapped(clone.d_map, check.d_q);
+  BzlaNode *lit = bzla_nodemap_mapped(clone.d_map, check.d_lit);
+  BzlaNode *simp_q, *simp_lit;
+  assert(q);
+  assert(lit);
+
+  if (clone.d_terminate)
+  {
+    return;
+  }
+
+  /* The ground solver keeps the quantifier true via its saved phases, the
+   * clone has to assume it. Otherwise, it may falsify the quantifier and
+   * return counterexamples that are already instantiated. */
+  simp_q   = push_ce_assumption(bzla, q);
+  simp_lit = push_ce_assumption(bzla, lit);
+
+  check.d_result        = bzla->slv->api.sat(bzla->slv);
+  bzla->last_sat_result = check.d_result;
+  if (check.d_result == BZLA_RESULT_SAT)
+  {
+    bzla->slv->api.generate_model(bzla->slv, false, false);
+    for (BzlaNode *n : check.d_nodes)
+    {
+      const BzlaBitVector *bv =
+          bzla_model_get_bv(bzla, bzla_nodemap_mapped(clone.d_map, n));
+      assert(bv);
+      check.d_values.push_back(bzla_bv_copy(bzla->mm, bv));
+    }
+  }
+  else if (check.d_result == BZLA_RESULT_UNSAT)
+  {
+    check.d_failed = bzla_failed_exp(bzla, lit);
+  }
+
+  pop_ce_assumption(bzla, lit, simp_lit);
+  pop_ce_assumption(bzla, q, simp_q);
+}
+
+}  // namespace
+
+size_t
+QuantSolverState::check_counterexamples_parallel(
+    const std::vector<BzlaNode *> &to_check)
+{
+  BzlaNodeIterator nit;
+  BzlaNode *cur_q, *ic;
+  size_t num_inactive = 0;
+  size_t num_clones   = std::min<size_t>(d_opt_ce_n_threads, to_check.size());
+  size_t num_running  = num_clones;
+  std::vector<CeCheck> checks(to_check.size());
+  std::vector<std::thread> workers;
+  std::mutex mutex;
+  std::condition_variable cv;
+
+  if (d_bzla->inconsistent)
+  {
+    return 0;
+  }
+
+  /* Collect nodes whose values are queried when instantiating a quantifier
+   * with a counterexample, see add_value_instantiation_lemma(),
+   * synthesize_qi() and mbqi(). */
+  for (size_t i = 0; i < to_check.size(); ++i)
+  {
+    BzlaNode *q    = to_check[i];
+    CeCheck &check = checks[i];
+    NodeSet cache;
+
+    auto add_node = [&check, &cache](BzlaNode *n) {
+      if (cache.emplace(n).second)
+      {
+        check.d_nodes.push_back(n);
+      }
+    };
+
+    check.d_q   = q;
+    check.d_lit = get_ce_literal(q);
+    bzla_iter_binder_init(&nit, q);
+    while (bzla_iter_binder_has_next(&nit))
+    {
+      cur_q = bzla_iter_binder_next(&nit);
+      ic    = get_inst_constant(cur_q);
+      add_node(ic);
+
+      BzlaSortId sort_id = bzla_node_get_sort_id(ic);
+      if (d_opt_synth_qi)
+      {
+        auto it = d_const_map.find(sort_id);
+        if (it != d_const_map.end())
+        {
+          for (BzlaNode *c : it->second)
+          {
+            add_node(c);
+          }
+        }
+        auto itd = d_deps.find(q);
+        if (itd != d_deps.end())
+        {
+          for (BzlaNode *dep : itd->second)
+          {
+            if (bzla_node_is_bv(d_bzla, dep))
+            {
+              add_node(dep);
+            }
+          }
+        }
+      }
+      if (d_opt_mbqi)
+      {
+        auto it = d_term_map.find(sort_id);
+        if (it != d_term_map.end())
+        {
+          for (BzlaNode *t : it->second)
+          {
+            add_node(t);
+          }
+        }
+      }
+    }
+  }
+
+  /* The clones are created once and kept in sync with the ground solver by
+   * assert_lemmas(). Their SAT solvers are incremental, the model
+   * assumptions of the current round are assumed in each clone. */
+  while (d_ce_clones.size() < num_clones)
+  {
+    d_ce_clones.emplace_back(new CeClone(d_bzla));
+  }
+  for (size_t i = 0; i < num_clones; ++i)
+  {
+    CeClone &clone    = *d_ce_clones[i];
+    clone.d_terminate = 0;
+    bzla_reset_assumptions(clone.d_bzla);
+    clone.d_bzla->valid_assignments = 0;
+    for (BzlaNode *a : d_assumptions)
+    {
+      bzla_assume_exp(clone.d_bzla, clone.get_node(d_bzla, a));
+    }
+  }
+  /* Checks are statically assigned to the clones to keep the results
+   * independent of thread scheduling. */
+  for (size_t i = 0; i < checks.size(); ++i)
+  {
+    CeCheck &check = checks[i];
+    CeClone &clone = *d_ce_clones[i % num_clones];
+    check.d_clone  = i % num_clones;
+    clone.get_node(d_bzla, check.d_q);
+    clone.get_node(d_bzla, check.d_lit);
+    for (BzlaNode *n : check.d_nodes)
+    {
+      clone.get_node(d_bzla, n);
+    }
+  }
+
+  auto check_worker = [this, &checks, &num_running, &mutex, &cv, num_clones](
+                          size_t idx) {
+    for (size_t i = idx; i < checks.size(); i += num_clones)
+    {
+      check_counterexample(*d_ce_clones[idx], checks[i]);
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    --num_running;
+    cv.notify_one();
+  };
+  for (size_t i = 0; i < num_clones; ++i)
+  {
+    workers.emplace_back(check_worker, i);
+  }
+  /* Poll the termination callback of the ground solver on the main thread
+   * and forward it to the clones. */
+  if (d_bzla->cbs.term.fun)
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (!cv.wait_for(lock, std::chrono::milliseconds(10), [&num_running] {
+      return num_running == 0;
+    }))
+    {
+      if (bzla_terminate(d_bzla))
+      {
+        for (size_t i = 0; i < num_clones; ++i)
+        {
+          d_ce_clones[i]->d_terminate = 1;
+        }
+      }
+    }
+  }
+  for (std::thread &t : workers)
+  {
+    t.join();
+  }
+
+  /* Add instantiation lemmas in the order of to_check. */
+  for (size_t i = 0; i < to_check.size(); ++i)
+  {
+    BzlaNode *q    = to_check[i];
+    CeCheck &check = checks[i];
+
+    ++d_statistics.num_counterexample_checks;
     qlog("Check for counterexamples (%s): ", bzla_util_node2string(q));
-    res = check_sat_ground();
-    // Counterexample found, add new instantiation.
-    if (res == BZLA_RESULT_SAT)
+    if (check.d_result == BZLA_RESULT_SAT)
     {
       qlog("sat\n");
-      generate_model_ground();
+      NodeMap<BzlaBitVector *> values;
+      for (size_t j = 0; j < check.d_nodes.size(); ++j)
+      {
+        values.emplace(check.d_nodes[j], check.d_values[j]);
+      }
+      d_ce_values = &values;
+      d_term_value_index.clear();
       add_value_instantiation_lemma(q);
       if (d_opt_synth_qi)
       {
@@ -1945,32 +2447,27 @@ QuantSolverState::check_active_quantifiers()
       {
         mbqi(q);
       }
-      assert_lemmas();
+      d_ce_values = nullptr;
+      d_term_value_index.clear();
     }
-    // No counterexamples found anymore, set quantifier to inactive.
     else
     {
-      qlog("unsat\n");
-      if (bzla_failed_exp(d_bzla, lit))
+      qlog("%s\n", check.d_result == BZLA_RESULT_UNSAT ? "unsat" : "unknown");
+      if (check.d_failed)
       {
         ++num_inactive;
-        //set_inactive(q);
       }
     }
 
-    if (assumed)
+    BzlaMemMgr *mm = d_ce_clones[check.d_clone]->d_bzla->mm;
+    for (BzlaBitVector *bv : check.d_values)
     {
-      pop_assumption();
+      bzla_bv_free(mm, bv);
     }
-    qlog("***\n");
   }
-  done = num_inactive == to_check.size();
-
-  reset_assumptions();
+  assert_lemmas();
 
-  d_statistics.time_check_counterexamples += bzla_util_time_stamp() - start;
-
-  return done;
+  return num_inactive;
 }
 
 void
@@ -2076,6 +2573,9 @@ QuantSolverState::collect_info(std::vector<BzlaNode *> &quantifiers)
 {
   std::vector<BzlaNode *> visit;
 
+  // Terms may be added to d_term_map, invalidate value index.
+  d_term_value_index.clear();
+
   // TODO: cache visited constraints to avoid traversal of already seen
   // constraints
   BzlaPtrHashTableIterator it;
@@ -2268,6 +2768,13 @@ QuantSolverState::check_ground_formulas()
       }
       break;
     }
+    // Terminated.
+    else if (res == BZLA_RESULT_UNKNOWN)
+    {
+      qlog("unknown\n");
+      reset_assumptions();
+      break;
+    }
     else
     {
       d_last_ground_check_ok = false;
@@ -2407,7 +2914,7 @@ check_sat_quant_solver(BzlaQuantSolver *slv)
     }
     else
     {
-      res = BZLA_RESULT_UNSAT;
+      /* Unsat, or unknown if terminated. */
       break;
     }
   }
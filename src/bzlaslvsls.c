@@ -50,24 +50,27 @@
 
 /*------------------------------------------------------------------------*/
 
-static double
-compute_sls_score_formula(Bzla *bzla, BzlaIntHashTable *score, bool *done)
+void
+bzla_sls_solver_compute_score_formula(Bzla *bzla,
+                                      double *weighted_score,
+                                      uint32_t *num_unsat)
 {
   assert(bzla);
-  assert(score);
+  assert(weighted_score);
+  assert(num_unsat);
 
-  double res, sc, weight;
+  double sc, weight;
   int32_t id;
   BzlaSLSSolver *slv;
   BzlaIntHashTableIterator it;
 
   slv = BZLA_SLS_SOLVER(bzla);
   assert(slv);
-  assert(slv->roots);
+  assert(slv->score);
   assert(slv->weights);
 
-  res = 0.0;
-  if (done) *done = true;
+  *weighted_score = 0.0;
+  *num_unsat      = 0;
 
   bzla_iter_hashint_init(&it, slv->weights);
   while (bzla_iter_hashint_has_next(&it))
@@ -76,14 +79,59 @@ compute_sls_score_formula(Bzla *bzla, BzlaIntHashTable *score, bool *done)
         (double) ((BzlaSLSConstrData *) slv->weights->data[it.cur_pos].as_ptr)
             ->weight;
     id = bzla_iter_hashint_next(&it);
-    sc = bzla_hashint_map_get(score, id)->as_dbl;
+    sc = bzla_hashint_map_get(slv->score, id)->as_dbl;
     assert(sc >= 0.0 && sc <= 1.0);
-    if (done && sc < 1.0) *done = false;
-    res += weight * sc;
+    if (sc < 1.0) *num_unsat += 1;
+    *weighted_score += weight * sc;
+  }
+}
+
+void
+bzla_sls_solver_update_score_formula(BzlaSLSSolver *slv,
+                                     BzlaLsUndoEntryStack *log,
+                                     BzlaIntHashTable *score,
+                                     double *weighted_score,
+                                     uint32_t *num_unsat)
+{
+  assert(slv);
+  assert(slv->weights);
+  assert(log);
+  assert(score);
+  assert(weighted_score);
+  assert(num_unsat);
+
+  double sc;
+  uint32_t i;
+  BzlaLsUndoEntry *e;
+  BzlaHashTableData *d;
+
+  for (i = 0; i < BZLA_COUNT_STACK(*log); i++)
+  {
+    e = log->start + i;
+    if (!e->is_score) continue;
+    if (!(d = bzla_hashint_map_get(slv->weights, e->id))) continue;
+    sc = bzla_hashint_map_get(score, e->id)->as_dbl;
+    assert(sc >= 0.0 && sc <= 1.0);
+    *weighted_score +=
+        (double) ((BzlaSLSConstrData *) d->as_ptr)->weight * (sc - e->score);
+    if (e->score < 1.0) *num_unsat -= 1;
+    if (sc < 1.0) *num_unsat += 1;
   }
-  return res;
 }
 
+#ifndef NDEBUG
+static void
+check_sls_score_formula(Bzla *bzla, double weighted_score, uint32_t num_unsat)
+{
+  double sc;
+  uint32_t n;
+
+  bzla_sls_solver_compute_score_formula(bzla, &sc, &n);
+  assert(num_unsat == n);
+  assert(fabs(weighted_score - sc) <= 1e-6 * (1.0 + sc));
+}
+#endif
+
 static BzlaNode *
 select_candidate_constraint(Bzla *bzla, uint32_t nmoves)
 {
@@ -258,6 +306,7 @@ update_assertion_weights(Bzla *bzla)
 {
   assert(bzla);
 
+  double sc;
   int32_t id;
   BzlaSLSConstrData *d;
   BzlaIntHashTableIterator it;
@@ -274,49 +323,54 @@ update_assertion_weights(Bzla *bzla)
       d  = (BzlaSLSConstrData *) slv->weights->data[it.cur_pos].as_ptr;
       id = bzla_iter_hashint_next(&it);
       assert(bzla_hashint_table_contains(slv->score, id));
-      if (bzla_hashint_map_get(slv->score, id)->as_dbl == 0.0) continue;
-      if (d->weight > 1) d->weight -= 1;
+      sc = bzla_hashint_map_get(slv->score, id)->as_dbl;
+      if (sc == 0.0) continue;
+      if (d->weight > 1)
+      {
+        d->weight -= 1;
+        slv->weighted_score -= sc;
+      }
     }
   }
   else
   {
-    /* increase the weight of all unsatisfied assertions */
-    bzla_iter_hashint_init(&it, slv->weights);
+    /* increase the weight of all unsatisfied assertions, which are exactly
+     * the (up-to-date) unsatisfied roots in slv->roots */
+    bzla_iter_hashint_init(&it, slv->roots);
     while (bzla_iter_hashint_has_next(&it))
     {
-      d  = (BzlaSLSConstrData *) slv->weights->data[it.cur_pos].as_ptr;
       id = bzla_iter_hashint_next(&it);
-      assert(bzla_hashint_table_contains(slv->score, id));
-      if (bzla_hashint_map_get(slv->score, id)->as_dbl == 1.0) continue;
+      assert(bzla_hashint_map_contains(slv->weights, id));
+      d  = bzla_hashint_map_get(slv->weights, id)->as_ptr;
+      sc = bzla_hashint_map_get(slv->score, id)->as_dbl;
+      assert(sc < 1.0);
       d->weight += 1;
+      slv->weighted_score += sc;
     }
   }
+#ifndef NDEBUG
+  check_sls_score_formula(bzla, slv->weighted_score, slv->num_unsat);
+#endif
 }
 
-static inline double
-try_move(Bzla *bzla,
-         BzlaIntHashTable *bv_model,
-         BzlaIntHashTable *score,
-         BzlaIntHashTable *cans,
-         bool *done)
+/* Evaluate the score of a move without performing it. The cone of the move is
+ * updated with an undo log that is reverted before returning, the current
+ * model and scores are thus unchanged. */
+static double
+compute_move_score(Bzla *bzla, BzlaIntHashTable *cans, bool *done)
 {
   assert(bzla);
-  assert(bv_model);
-  assert(score);
   assert(cans);
   assert(cans->count);
   assert(done);
 
+  double sc;
+  uint32_t num_unsat;
   BzlaSLSSolver *slv;
 
   slv = BZLA_SLS_SOLVER(bzla);
   assert(slv);
-  if (slv->nflips && slv->stats.flips >= slv->nflips)
-  {
-    slv->terminate = true;
-    return 0.0;
-  }
-  slv->stats.flips += 1;
+  assert(BZLA_EMPTY_STACK(slv->undo));
 
 #ifndef NBZLALOG
   char *a;
@@ -346,18 +400,49 @@ try_move(Bzla *bzla,
 #endif
 
   bzla_lsutils_update_cone(bzla,
-                           bv_model,
+                           bzla->bv_model,
                            slv->roots,
-                           score,
+                           slv->score,
                            cans,
                            false,
+                           &slv->undo,
                            &slv->stats.updates,
                            &slv->time.update_cone,
                            &slv->time.update_cone_reset,
                            &slv->time.update_cone_model_gen,
                            &slv->time.update_cone_compute_score);
 
-  return compute_sls_score_formula(bzla, score, done);
+  sc        = slv->weighted_score;
+  num_unsat = slv->num_unsat;
+  bzla_sls_solver_update_score_formula(
+      slv, &slv->undo, slv->score, &sc, &num_unsat);
+#ifndef NDEBUG
+  check_sls_score_formula(bzla, sc, num_unsat);
+#endif
+  *done = num_unsat == 0;
+  bzla_lsutils_undo(bzla, bzla->bv_model, slv->score, &slv->undo);
+  return sc;
+}
+
+static inline double
+try_move(Bzla *bzla, BzlaIntHashTable *cans, bool *done)
+{
+  assert(bzla);
+  assert(cans);
+  assert(cans->count);
+  assert(done);
+
+  BzlaSLSSolver *slv;
+
+  slv = BZLA_SLS_SOLVER(bzla);
+  assert(slv);
+  if (slv->nflips && slv->stats.flips >= slv->nflips)
+  {
+    slv->terminate = true;
+    return 0.0;
+  }
+  slv->stats.flips += 1;
+  return compute_move_score(bzla, cans, done);
 }
 
 static int32_t
@@ -423,6 +508,129 @@ cmp_sls_moves_qsort(const void *move1, const void *move2)
     }                                                                        \
   } while (0)
 
+/* Record move 'cans' of kind 'mk' to be scored in parallel in
+ * select_batch_move. Moves beyond the bit-flip limit are dropped. */
+static void
+add_batch_move(Bzla *bzla, BzlaIntHashTable *cans, BzlaSLSMoveKind mk)
+{
+  BzlaSLSMove *m;
+  BzlaIntHashTableIterator iit;
+  BzlaSLSSolver *slv;
+
+  slv = BZLA_SLS_SOLVER(bzla);
+  assert(slv->pool);
+
+  if (slv->nflips
+      && slv->stats.flips + BZLA_COUNT_STACK(slv->batch) >= slv->nflips)
+  {
+    slv->terminate = true;
+    BZLA_SLS_DELETE_CANS(cans);
+    return;
+  }
+  BZLA_CNEW(bzla->mm, m);
+  m->cans = cans;
+  m->kind = mk;
+  BZLA_PUSH_STACK(slv->batch, m);
+}
+
+/* Thread pool job, scores move 'idx' of the current batch on the cone deltas
+ * of thread 'worker'. The model and scores are read-only while scoring. */
+static void
+score_batch_move(void *state, uint32_t idx, uint32_t worker)
+{
+  Bzla *bzla;
+  uint32_t num_unsat;
+  BzlaSLSMove *m;
+  BzlaSLSWorker *w;
+  BzlaSLSSolver *slv;
+
+  bzla = (Bzla *) state;
+  slv  = BZLA_SLS_SOLVER(bzla);
+  m    = BZLA_PEEK_STACK(slv->batch, idx);
+  w    = &slv->workers[worker];
+
+  m->scored = bzla_lsutils_compute_cone_delta(bzla,
+                                              w->mm,
+                                              bzla->bv_model,
+                                              slv->score,
+                                              m->cans,
+                                              w->delta_model,
+                                              w->delta_score,
+                                              &w->log,
+                                              &w->updates);
+  if (m->scored)
+  {
+    m->sc     = slv->weighted_score;
+    num_unsat = slv->num_unsat;
+    bzla_sls_solver_update_score_formula(
+        slv, &w->log, w->delta_score, &m->sc, &num_unsat);
+    m->done = num_unsat == 0;
+  }
+  bzla_lsutils_delta_reset(w->mm, w->delta_model, w->delta_score, &w->log);
+}
+
+/* Score all moves of the current batch in parallel and select the best move
+ * as if the moves were tried one after another in the order they were
+ * generated. Moves that can not be scored in parallel are scored here. */
+static bool
+select_batch_move(Bzla *bzla, int32_t gw)
+{
+  size_t i;
+  uint32_t j, sls_strat;
+  bool done = false;
+  double sc;
+  BzlaSLSMove *m;
+  BzlaSLSMoveKind mk, skip_kind = BZLA_SLS_MOVE_DONE;
+  BzlaIntHashTable *cans;
+  BzlaIntHashTableIterator iit;
+  BzlaSLSSolver *slv;
+
+  slv       = BZLA_SLS_SOLVER(bzla);
+  sls_strat = bzla_opt_get(bzla, BZLA_OPT_SLS_STRATEGY);
+  assert(slv->pool);
+
+  bzla_thread_pool_run(
+      slv->pool, BZLA_COUNT_STACK(slv->batch), score_batch_move, bzla);
+  for (j = 0; j < bzla_thread_pool_get_num_threads(slv->pool); j++)
+  {
+    slv->stats.updates += slv->workers[j].updates;
+    slv->workers[j].updates = 0;
+  }
+
+  for (i = 0; i < BZLA_COUNT_STACK(slv->batch); i++)
+  {
+    m = BZLA_PEEK_STACK(slv->batch, i);
+    /* moves of a kind are generated consecutively */
+    if (m->kind == skip_kind) continue;
+    slv->stats.flips += 1;
+    if (!m->scored) m->sc = compute_move_score(bzla, m->cans, &m->done);
+    cans = m->cans;
+    sc   = m->sc;
+    done = m->done;
+    mk   = m->kind;
+    BZLA_DELETE(bzla->mm, m);
+    BZLA_POKE_STACK(slv->batch, i, 0);
+    BZLA_SLS_SELECT_MOVE_CHECK_SCORE(sc);
+    continue;
+  DONE:
+    /* As in the sequential case, an improving move with strategy
+     * BZLA_SLS_STRAT_FIRST_BEST_MOVE only skips the remaining moves of its
+     * kind, the moves of the following kinds are still tried. */
+    if (done) break;
+    skip_kind = mk;
+  }
+
+  /* release skipped moves and moves that were not tried */
+  for (i = 0; i < BZLA_COUNT_STACK(slv->batch); i++)
+  {
+    if (!(m = BZLA_PEEK_STACK(slv->batch, i))) continue;
+    BZLA_SLS_DELETE_CANS(m->cans);
+    BZLA_DELETE(bzla->mm, m);
+  }
+  BZLA_RESET_STACK(slv->batch);
+  return done;
+}
+
 static inline bool
 select_inc_dec_not_move(Bzla *bzla,
                         BzlaBitVector *(*fun)(BzlaMemMgr *,
@@ -438,7 +646,7 @@ select_inc_dec_not_move(Bzla *bzla,
   BzlaSLSMoveKind mk;
   BzlaBitVector *ass, *max_neigh;
   BzlaNode *can;
-  BzlaIntHashTable *cans, *bv_model, *score;
+  BzlaIntHashTable *cans;
   BzlaIntHashTableIterator iit;
   BzlaSLSSolver *slv;
 
@@ -456,10 +664,6 @@ select_inc_dec_not_move(Bzla *bzla,
     mk = BZLA_SLS_MOVE_NOT;
   }
 
-  bv_model = bzla_model_clone_bv(bzla, bzla->bv_model, true);
-  score =
-      bzla_hashint_map_clone(bzla->mm, slv->score, bzla_clone_data_as_dbl, 0);
-
   cans = bzla_hashint_map_new(bzla->mm);
 
   for (i = 0; i < BZLA_COUNT_STACK(*candidates); i++)
@@ -481,7 +685,12 @@ select_inc_dec_not_move(Bzla *bzla,
             : fun(bzla->mm, ass);
   }
 
-  sc = try_move(bzla, bv_model, score, cans, &done);
+  if (slv->pool)
+  {
+    add_batch_move(bzla, cans, mk);
+    goto DONE;
+  }
+  sc = try_move(bzla, cans, &done);
   if (slv->terminate)
   {
     BZLA_SLS_DELETE_CANS(cans);
@@ -490,8 +699,6 @@ select_inc_dec_not_move(Bzla *bzla,
   BZLA_SLS_SELECT_MOVE_CHECK_SCORE(sc);
 
 DONE:
-  bzla_model_delete_bv(bzla, &bv_model);
-  bzla_hashint_map_delete(score);
   return done;
 }
 
@@ -506,7 +713,7 @@ select_flip_move(Bzla *bzla, BzlaNodePtrStack *candidates, int32_t gw)
   BzlaSLSMoveKind mk;
   BzlaBitVector *ass, *max_neigh;
   BzlaNode *can;
-  BzlaIntHashTable *cans, *bv_model, *score;
+  BzlaIntHashTable *cans;
   BzlaIntHashTableIterator iit;
   BzlaSLSSolver *slv;
 
@@ -515,10 +722,6 @@ select_flip_move(Bzla *bzla, BzlaNodePtrStack *candidates, int32_t gw)
 
   mk = BZLA_SLS_MOVE_FLIP;
 
-  bv_model = bzla_model_clone_bv(bzla, bzla->bv_model, true);
-  score =
-      bzla_hashint_map_clone(bzla->mm, slv->score, bzla_clone_data_as_dbl, 0);
-
   for (pos = 0, n_endpos = 0; n_endpos < BZLA_COUNT_STACK(*candidates); pos++)
   {
     cans = bzla_hashint_map_new(bzla->mm);
@@ -545,7 +748,13 @@ select_flip_move(Bzla *bzla, BzlaNodePtrStack *candidates, int32_t gw)
               : bzla_bv_flipped_bit(bzla->mm, ass, cpos);
     }
 
-    sc = try_move(bzla, bv_model, score, cans, &done);
+    if (slv->pool)
+    {
+      add_batch_move(bzla, cans, mk);
+      if (slv->terminate) goto DONE;
+      continue;
+    }
+    sc = try_move(bzla, cans, &done);
     if (slv->terminate)
     {
       BZLA_SLS_DELETE_CANS(cans);
@@ -555,8 +764,6 @@ select_flip_move(Bzla *bzla, BzlaNodePtrStack *candidates, int32_t gw)
   }
 
 DONE:
-  bzla_model_delete_bv(bzla, &bv_model);
-  bzla_hashint_map_delete(score);
   return done;
 }
 
@@ -571,7 +778,7 @@ select_flip_range_move(Bzla *bzla, BzlaNodePtrStack *candidates, int32_t gw)
   BzlaSLSMoveKind mk;
   BzlaBitVector *ass, *max_neigh;
   BzlaNode *can;
-  BzlaIntHashTable *cans, *bv_model, *score;
+  BzlaIntHashTable *cans;
   BzlaIntHashTableIterator iit;
   BzlaSLSSolver *slv;
 
@@ -580,10 +787,6 @@ select_flip_range_move(Bzla *bzla, BzlaNodePtrStack *candidates, int32_t gw)
 
   mk = BZLA_SLS_MOVE_FLIP_RANGE;
 
-  bv_model = bzla_model_clone_bv(bzla, bzla->bv_model, true);
-  score =
-      bzla_hashint_map_clone(bzla->mm, slv->score, bzla_clone_data_as_dbl, 0);
-
   for (up = 1, n_endpos = 0; n_endpos < BZLA_COUNT_STACK(*candidates);
        up = 2 * up + 1)
   {
@@ -625,7 +828,13 @@ select_flip_range_move(Bzla *bzla, BzlaNodePtrStack *candidates, int32_t gw)
               : bzla_bv_flipped_bit_range(bzla->mm, ass, cup, clo);
     }
 
-    sc = try_move(bzla, bv_model, score, cans, &done);
+    if (slv->pool)
+    {
+      add_batch_move(bzla, cans, mk);
+      if (slv->terminate) goto DONE;
+      continue;
+    }
+    sc = try_move(bzla, cans, &done);
     if (slv->terminate)
     {
       BZLA_SLS_DELETE_CANS(cans);
@@ -635,8 +844,6 @@ select_flip_range_move(Bzla *bzla, BzlaNodePtrStack *candidates, int32_t gw)
   }
 
 DONE:
-  bzla_model_delete_bv(bzla, &bv_model);
-  bzla_hashint_map_delete(score);
   return done;
 }
 
@@ -652,7 +859,7 @@ select_flip_segment_move(Bzla *bzla, BzlaNodePtrStack *candidates, int32_t gw)
   BzlaSLSMoveKind mk;
   BzlaBitVector *ass, *max_neigh;
   BzlaNode *can;
-  BzlaIntHashTable *cans, *bv_model, *score;
+  BzlaIntHashTable *cans;
   BzlaIntHashTableIterator iit;
   BzlaSLSSolver *slv;
 
@@ -661,10 +868,6 @@ select_flip_segment_move(Bzla *bzla, BzlaNodePtrStack *candidates, int32_t gw)
 
   mk = BZLA_SLS_MOVE_FLIP_SEGMENT;
 
-  bv_model = bzla_model_clone_bv(bzla, bzla->bv_model, true);
-  score =
-      bzla_hashint_map_clone(bzla->mm, slv->score, bzla_clone_data_as_dbl, 0);
-
   for (seg = 2; seg <= 8; seg <<= 1)
   {
     for (lo = 0, up = seg - 1, n_endpos = 0;
@@ -712,7 +915,13 @@ select_flip_segment_move(Bzla *bzla, BzlaNodePtrStack *candidates, int32_t gw)
                 : bzla_bv_flipped_bit_range(bzla->mm, ass, cup, clo);
       }
 
-      sc = try_move(bzla, bv_model, score, cans, &done);
+      if (slv->pool)
+      {
+        add_batch_move(bzla, cans, mk);
+        if (slv->terminate) goto DONE;
+        continue;
+      }
+      sc = try_move(bzla, cans, &done);
       if (slv->terminate)
       {
         BZLA_SLS_DELETE_CANS(cans);
@@ -723,8 +932,6 @@ select_flip_segment_move(Bzla *bzla, BzlaNodePtrStack *candidates, int32_t gw)
   }
 
 DONE:
-  bzla_model_delete_bv(bzla, &bv_model);
-  bzla_hashint_map_delete(score);
   return done;
 }
 
@@ -739,7 +946,7 @@ select_rand_range_move(Bzla *bzla, BzlaNodePtrStack *candidates, int32_t gw)
   BzlaSLSMoveKind mk;
   BzlaBitVector *ass;
   BzlaNode *can;
-  BzlaIntHashTable *cans, *bv_model, *score;
+  BzlaIntHashTable *cans;
   BzlaIntHashTableIterator iit;
   BzlaSLSSolver *slv;
 
@@ -749,10 +956,6 @@ select_rand_range_move(Bzla *bzla, BzlaNodePtrStack *candidates, int32_t gw)
 
   mk = BZLA_SLS_MOVE_RAND;
 
-  bv_model = bzla_model_clone_bv(bzla, bzla->bv_model, true);
-  score =
-      bzla_hashint_map_clone(bzla->mm, slv->score, bzla_clone_data_as_dbl, 0);
-
   for (up = 1, n_endpos = 0; n_endpos < BZLA_COUNT_STACK(*candidates);
        up = 2 * up + 1)
   {
@@ -786,7 +989,7 @@ select_rand_range_move(Bzla *bzla, BzlaNodePtrStack *candidates, int32_t gw)
           bzla_bv_new_random_bit_range(bzla->mm, bzla->rng, bw, cup, clo);
     }
 
-    sc = try_move(bzla, bv_model, score, cans, &done);
+    sc = try_move(bzla, cans, &done);
     if (slv->terminate)
     {
       BZLA_SLS_DELETE_CANS(cans);
@@ -802,8 +1005,6 @@ select_rand_range_move(Bzla *bzla, BzlaNodePtrStack *candidates, int32_t gw)
   }
 
 DONE:
-  bzla_model_delete_bv(bzla, &bv_model);
-  bzla_hashint_map_delete(score);
   return done;
 }
 
@@ -822,7 +1023,7 @@ select_move_aux(Bzla *bzla, BzlaNodePtrStack *candidates, int32_t gw)
 
   for (mk = 0; mk < BZLA_SLS_MOVE_DONE; mk++)
   {
-    if (slv->nflips && slv->stats.flips >= slv->nflips)
+    if (slv->terminate || (slv->nflips && slv->stats.flips >= slv->nflips))
     {
       slv->terminate = true;
       break;
@@ -862,6 +1063,9 @@ select_move_aux(Bzla *bzla, BzlaNodePtrStack *candidates, int32_t gw)
     }
   }
 
+  /* moves are only collected if they are scored in parallel */
+  if (slv->pool) done = select_batch_move(bzla, gw);
+
   return done;
 }
 
@@ -962,12 +1166,12 @@ select_move(Bzla *bzla, BzlaNodePtrStack *candidates)
       {
         can = BZLA_PEEK_STACK(*candidates, r);
         assert(bzla_node_is_regular(can));
-        if (bzla_node_bv_get_width(bzla, can) == 1)
+        if (bzla_lsutils_get_bv_width(bzla, can) == 1)
           neigh = bzla_bv_flipped_bit(
               bzla->mm, (BzlaBitVector *) bzla_model_get_bv(bzla, can), 0);
         else
           neigh = bzla_bv_new_random(
-              bzla->mm, bzla->rng, bzla_node_bv_get_width(bzla, can));
+              bzla->mm, bzla->rng, bzla_lsutils_get_bv_width(bzla, can));
 
         bzla_hashint_map_add(slv->max_cans, can->id)->as_ptr = neigh;
       }
@@ -982,7 +1186,7 @@ select_move(Bzla *bzla, BzlaNodePtrStack *candidates)
           bzla_rng_pick_rand(bzla->rng, 0, BZLA_COUNT_STACK(*candidates) - 1));
       assert(bzla_node_is_regular(can));
 
-      if (bzla_node_bv_get_width(bzla, can) == 1)
+      if (bzla_lsutils_get_bv_width(bzla, can) == 1)
       {
         neigh = bzla_bv_flipped_bit(
             bzla->mm, (BzlaBitVector *) bzla_model_get_bv(bzla, can), 0);
@@ -1000,7 +1204,7 @@ select_move(Bzla *bzla, BzlaNodePtrStack *candidates)
       else
       {
         neigh = bzla_bv_new_random(
-            bzla->mm, bzla->rng, bzla_node_bv_get_width(bzla, can));
+            bzla->mm, bzla->rng, bzla_lsutils_get_bv_width(bzla, can));
         bzla_hashint_map_add(slv->max_cans, can->id)->as_ptr = neigh;
       }
 
@@ -1201,7 +1405,7 @@ move(Bzla *bzla, uint32_t nmoves)
       goto DONE;
     }
 
-    slv->max_score = compute_sls_score_formula(bzla, slv->score, 0);
+    slv->max_score = slv->weighted_score;
     slv->max_move  = BZLA_SLS_MOVE_DONE;
     slv->max_gw    = -1;
 
@@ -1257,11 +1461,22 @@ move(Bzla *bzla, uint32_t nmoves)
                            slv->score,
                            slv->max_cans,
                            true,
+                           &slv->undo,
                            &slv->stats.updates,
                            &slv->time.update_cone,
                            &slv->time.update_cone_reset,
                            &slv->time.update_cone_model_gen,
                            &slv->time.update_cone_compute_score);
+  bzla_sls_solver_update_score_formula(slv,
+                                       &slv->undo,
+                                       slv->score,
+                                       &slv->weighted_score,
+                                       &slv->num_unsat);
+  bzla_lsutils_undo_discard(bzla, &slv->undo);
+#ifndef NDEBUG
+  check_sls_score_formula(bzla, slv->weighted_score, slv->num_unsat);
+  assert((slv->num_unsat == 0) == (slv->roots->count == 0));
+#endif
 
   slv->stats.moves += 1;
 
@@ -1363,6 +1578,10 @@ clone_sls_solver(Bzla *clone, BzlaSLSSolver *slv, BzlaNodeMap *exp_map)
       bzla_hashint_map_clone(clone->mm, slv->score, bzla_clone_data_as_dbl, 0);
 
   BZLA_INIT_STACK(clone->mm, res->moves);
+  BZLA_INIT_STACK(clone->mm, res->undo);
+  BZLA_INIT_STACK(clone->mm, res->batch);
+  res->pool    = 0;
+  res->workers = 0;
   assert(BZLA_SIZE_STACK(slv->moves) || !BZLA_COUNT_STACK(slv->moves));
   if (BZLA_SIZE_STACK(slv->moves))
   {
@@ -1431,6 +1650,11 @@ delete_sls_solver(BzlaSLSSolver *slv)
     bzla_hashint_map_delete(m->cans);
   }
   BZLA_RELEASE_STACK(slv->moves);
+  assert(BZLA_EMPTY_STACK(slv->undo));
+  BZLA_RELEASE_STACK(slv->undo);
+  assert(!slv->pool);
+  assert(BZLA_EMPTY_STACK(slv->batch));
+  BZLA_RELEASE_STACK(slv->batch);
   if (slv->max_cans)
   {
     bzla_iter_hashint_init(&it, slv->max_cans);
@@ -1446,6 +1670,52 @@ delete_sls_solver(BzlaSLSSolver *slv)
 
 /* Note: failed assumptions -> no handling necessary, sls only works for SAT
  * Note: limits are currently unused */
+static void
+init_workers(BzlaSLSSolver *slv, uint32_t num_threads)
+{
+  assert(slv);
+  assert(!slv->pool);
+  assert(num_threads > 1);
+
+  uint32_t i;
+  BzlaSLSWorker *w;
+
+  BZLA_CNEWN(slv->bzla->mm, slv->workers, num_threads);
+  for (i = 0; i < num_threads; i++)
+  {
+    w              = &slv->workers[i];
+    w->mm          = bzla_mem_mgr_new();
+    w->delta_model = bzla_hashint_map_new(w->mm);
+    w->delta_score = bzla_hashint_map_new(w->mm);
+    BZLA_INIT_STACK(w->mm, w->log);
+  }
+  slv->pool = bzla_thread_pool_new(num_threads);
+}
+
+static void
+delete_workers(BzlaSLSSolver *slv)
+{
+  assert(slv);
+  assert(slv->pool);
+
+  uint32_t i, num_threads;
+  BzlaSLSWorker *w;
+
+  num_threads = bzla_thread_pool_get_num_threads(slv->pool);
+  bzla_thread_pool_delete(slv->pool);
+  for (i = 0; i < num_threads; i++)
+  {
+    w = &slv->workers[i];
+    BZLA_RELEASE_STACK(w->log);
+    bzla_hashint_map_delete(w->delta_score);
+    bzla_hashint_map_delete(w->delta_model);
+    bzla_mem_mgr_delete(w->mm);
+  }
+  BZLA_DELETEN(slv->bzla->mm, slv->workers, num_threads);
+  slv->pool    = 0;
+  slv->workers = 0;
+}
+
 static BzlaSolverResult
 sat_sls_solver(BzlaSLSSolver *slv)
 {
@@ -1454,7 +1724,7 @@ sat_sls_solver(BzlaSLSSolver *slv)
   assert(slv->bzla);
 
   int32_t j, max_steps, id, nmoves;
-  uint32_t nprops;
+  uint32_t nprops, nthreads;
   BzlaSolverResult sat_result;
   BzlaNode *root;
   BzlaSLSConstrData *d;
@@ -1467,6 +1737,7 @@ sat_sls_solver(BzlaSLSSolver *slv)
   nmoves      = 0;
   nprops      = bzla_opt_get(bzla, BZLA_OPT_PROP_NPROPS);
   slv->nflips = bzla_opt_get(bzla, BZLA_OPT_SLS_NFLIPS);
+  nthreads    = bzla_opt_get(bzla, BZLA_OPT_SLS_N_THREADS);
 
   if (bzla_terminate(bzla))
   {
@@ -1474,6 +1745,12 @@ sat_sls_solver(BzlaSLSSolver *slv)
     goto DONE;
   }
 
+  /* Score moves in parallel. With the inc move test enabled, the neighbors
+   * of a move depend on the best previously tried move, hence moves can
+   * not be generated up front. */
+  if (nthreads > 1 && !bzla_opt_get(bzla, BZLA_OPT_SLS_MOVE_INC_MOVE_TEST))
+    init_workers(slv, nthreads);
+
   /* Generate intial model, all bv vars are initialized with zero. We do
    * not have to consider model_for_all_nodes, but let this be handled by
    * the model generation (if enabled) after SAT has been determined. */
@@ -1555,6 +1832,8 @@ sat_sls_solver(BzlaSLSSolver *slv)
     /* compute initial sls score */
     bzla_slsutils_compute_sls_scores(
         bzla, bzla->bv_model, bzla->fun_model, slv->score);
+    bzla_sls_solver_compute_score_formula(
+        bzla, &slv->weighted_score, &slv->num_unsat);
 
     if (!slv->roots->count) goto SAT;
 
@@ -1593,6 +1872,7 @@ UNSAT:
   sat_result = BZLA_RESULT_UNSAT;
 
 DONE:
+  if (slv->pool) delete_workers(slv);
   if (slv->roots)
   {
     bzla_hashint_map_delete(slv->roots);
@@ -1632,6 +1912,7 @@ generate_model_sls_solver(BzlaSLSSolver *slv,
   if (!reset && bzla->bv_model) return;
   bzla_lsutils_initialize_bv_model((BzlaSolver *) slv);
   bzla_model_init_fun(bzla, &bzla->fun_model);
+  bzla_lsutils_initialize_fp_model(bzla, bzla->bv_model);
   bzla_model_generate(
       bzla, bzla->bv_model, bzla->fun_model, model_for_all_nodes);
 }
@@ -1744,6 +2025,8 @@ bzla_new_sls_solver(Bzla *bzla)
   slv->domains = bzla_hashint_map_new(bzla->mm);
 
   BZLA_INIT_STACK(bzla->mm, slv->moves);
+  BZLA_INIT_STACK(bzla->mm, slv->undo);
+  BZLA_INIT_STACK(bzla->mm, slv->batch);
 
   slv->api.clone          = (BzlaSolverClone) clone_sls_solver;
   slv->api.delet          = (BzlaSolverDelete) delete_sls_solver;
@@ -16,9 +16,11 @@
 #include "bzlabv.h"
 #endif
 
+#include "bzlalsutils.h"
 #include "bzlaslv.h"
 #include "utils/bzlahashint.h"
 #include "utils/bzlastack.h"
+#include "utils/bzlathreadpool.h"
 
 enum BzlaSLSMoveKind
 {
@@ -39,6 +41,10 @@ struct BzlaSLSMove
 {
   BzlaIntHashTable *cans;
   double sc;
+  /* the following are only used for moves scored in parallel */
+  BzlaSLSMoveKind kind;
+  bool done;   /* all roots are satisfied after the move */
+  bool scored; /* false if the move must be scored sequentially */
 };
 typedef struct BzlaSLSMove BzlaSLSMove;
 
@@ -51,6 +57,17 @@ typedef struct BzlaSLSConstrData BzlaSLSConstrData;
 
 BZLA_DECLARE_STACK(BzlaSLSMovePtr, BzlaSLSMove *);
 
+/* Thread-local data for scoring moves in parallel. */
+struct BzlaSLSWorker
+{
+  BzlaMemMgr *mm;                /* not shared with other threads */
+  BzlaIntHashTable *delta_model; /* model values changed by the move */
+  BzlaIntHashTable *delta_score; /* scores changed by the move */
+  BzlaLsUndoEntryStack log;      /* previous scores of 'delta_score' */
+  uint64_t updates;              /* number of updated nodes */
+};
+typedef struct BzlaSLSWorker BzlaSLSWorker;
+
 /*------------------------------------------------------------------------*/
 
 #define BZLA_SLS_SOLVER(bzla) ((BzlaSLSSolver *) (bzla)->slv)
@@ -64,6 +81,11 @@ struct BzlaSLSSolver
   BzlaIntHashTable *weights; /* also maintains assertion weights */
   BzlaIntHashTable *score;   /* sls score */
 
+  /* The score of the formula, maintained incrementally from the score
+   * changes of the roots in update_cone. */
+  double weighted_score; /* sum of weight * score of all roots */
+  uint32_t num_unsat;    /* number of roots with score < 1.0 */
+
   /* Map, maintains constant bits.
    * Maps node id to its bit-vector domain (BzlaBvDomain*). Only used by by
    * the propagation-based strategy if BZLA_OPT_PROP_CONST_BITS is enabled. */
@@ -76,6 +98,14 @@ struct BzlaSLSSolver
   uint32_t npropmoves;       /* record #no moves for prop moves */
   uint32_t nslsmoves;        /* record #no moves for sls moves */
   double sum_score;          /* record sum of all scores for prob rand walk */
+  BzlaLsUndoEntryStack undo; /* undo log for tentative moves (try_move) */
+
+  /* Parallel scoring of moves (BZLA_OPT_SLS_N_THREADS > 1). Candidate moves
+   * are collected in 'batch' and scored concurrently against the current
+   * model, which is read-only while scoring. */
+  BzlaThreadPool *pool;
+  BzlaSLSWorker *workers; /* one per thread of 'pool' */
+  BzlaSLSMovePtrStack batch;
 
   /* prop moves only */
   uint32_t prop_flip_cond_const_prob;
@@ -132,4 +162,23 @@ typedef struct BzlaSLSSolver BzlaSLSSolver;
 
 BzlaSolver *bzla_new_sls_solver(Bzla *bzla);
 
+/* Compute the score of the formula, i.e., the weighted sum of the scores of
+ * all roots, and the number of unsatisfied roots from scratch. */
+void bzla_sls_solver_compute_score_formula(Bzla *bzla,
+                                           double *weighted_score,
+                                           uint32_t *num_unsat);
+
+/* Update the score of the formula and the number of unsatisfied roots w.r.t.
+ * the score changes recorded in 'log' (by update_cone or compute_cone_delta),
+ * where 'score' maps the nodes in 'log' to their new score. Only roots
+ * contribute to the score, hence this is linear in the size of the cone of
+ * the move rather than in the number of roots. Note that the previous score
+ * of each node is recorded at most once. Does not modify the solver and may
+ * be called concurrently. */
+void bzla_sls_solver_update_score_formula(BzlaSLSSolver *slv,
+                                          BzlaLsUndoEntryStack *log,
+                                          BzlaIntHashTable *score,
+                                          double *weighted_score,
+                                          uint32_t *num_unsat);
+
 #endif
@@ -0,0 +1,919 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * This file is part of Bitwuzla.
+ *
+ * Copyright (C) 2007-2022 by the authors listed in the AUTHORS file.
+ *
+ * See COPYING for more information on using this software.
+ */
+
+#include "bzlastate.h"
+
+#include <assert.h>
+#include <string.h>
+
+#include "bzlabv.h"
+#include "bzlacore.h"
+#include "bzlaexp.h"
+#include "bzlasort.h"
+#include "utils/bzlaabort.h"
+#include "utils/bzlahashint.h"
+#include "utils/bzlahashptr.h"
+#include "utils/bzlastack.h"
+
+/*------------------------------------------------------------------------*/
+
+/* A state file is a sequence of 32 bit words in host byte order:
+ *
+ *   header:        magic, version
+ *   options:       n, n x (name, value)
+ *   status:        inconsistent, num_push_pop
+ *   sorts:         n, n x (kind, payload)
+ *   nodes:         n, n x (kind, flags, sort, arity, children, payload)
+ *   static rho:    n, n x (lambda, m, m x (args, value))
+ *   inputs:        n, n x (data, input)
+ *   substitutions: n, n x (input, simplified)
+ *   constraints:   n, n x constraint
+ *   assertions:    n, n x assertion, m, m x trail
+ *
+ * Strings are written as length + 1 followed by the characters, 0 denotes
+ * a NULL string. Sorts and nodes are written in post-order and referenced by
+ * their (1-based) index, negative node references denote inverted nodes. */
+
+#define BZLA_STATE_MAGIC 0x414c5a42u /* "BZLA" */
+#define BZLA_STATE_VERSION 1
+
+#define BZLA_STATE_FLAG_IS_ARRAY 1u
+
+struct BzlaStateWriter
+{
+  Bzla *bzla;
+  FILE *file;
+  BzlaIntHashTable *sort_map; /* maps sort ids to sort indices */
+  BzlaIntHashTable *node_map; /* maps node ids to node indices */
+  BzlaSortIdStack sorts;      /* sorts in post-order */
+  BzlaNodePtrStack nodes;     /* nodes in post-order */
+  BzlaNodePtrStack rhos;      /* lambdas with static_rho */
+  BzlaNodePtrStack substs;    /* inputs with a simplified expression */
+  BzlaNodePtrStack roots;     /* constraints */
+};
+
+typedef struct BzlaStateWriter BzlaStateWriter;
+
+struct BzlaStateReader
+{
+  Bzla *bzla;
+  FILE *file;
+  uint32_t num_sorts;
+  BzlaSortId *sorts;
+  uint32_t num_nodes;
+  BzlaNode **nodes;
+};
+
+typedef struct BzlaStateReader BzlaStateReader;
+
+/*------------------------------------------------------------------------*/
+
+static void
+write_u32(BzlaStateWriter *w, uint32_t val)
+{
+  BZLA_ABORT(fwrite(&val, sizeof(val), 1, w->file) != 1,
+             "failed to write state file");
+}
+
+static void
+write_i32(BzlaStateWriter *w, int32_t val)
+{
+  write_u32(w, (uint32_t) val);
+}
+
+static void
+write_str(BzlaStateWriter *w, const char *str)
+{
+  size_t len;
+
+  if (!str)
+  {
+    write_u32(w, 0);
+    return;
+  }
+  len = strlen(str);
+  write_u32(w, (uint32_t) len + 1);
+  BZLA_ABORT(len && fwrite(str, 1, len, w->file) != len,
+             "failed to write state file");
+}
+
+static uint32_t
+read_u32(BzlaStateReader *r)
+{
+  uint32_t res;
+  BZLA_ABORT(fread(&res, sizeof(res), 1, r->file) != 1,
+             "invalid state file: unexpected end of file");
+  return res;
+}
+
+static int32_t
+read_i32(BzlaStateReader *r)
+{
+  return (int32_t) read_u32(r);
+}
+
+/* Returns a string allocated with the memory manager of 'r->bzla' or 0. */
+static char *
+read_str(BzlaStateReader *r)
+{
+  uint32_t len;
+  char *res;
+
+  len = read_u32(r);
+  if (!len) return 0;
+  BZLA_NEWN(r->bzla->mm, res, len);
+  BZLA_ABORT(len > 1 && fread(res, 1, len - 1, r->file) != len - 1,
+             "invalid state file: unexpected end of file");
+  res[len - 1] = 0;
+  return res;
+}
+
+/*------------------------------------------------------------------------*/
+
+/* Returns true if 'exp' is an input that was substituted, these inputs are
+ * saved as leaves and re-asserted to be equal to their simplified
+ * expression. */
+static bool
+is_subst_input(BzlaStateWriter *w, BzlaNode *exp)
+{
+  BzlaNode *real_exp = bzla_node_real_addr(exp);
+  return real_exp->simplified
+         && bzla_hashptr_table_get(w->bzla->inputs, real_exp);
+}
+
+static void
+collect_sort(BzlaStateWriter *w, BzlaSortId id)
+{
+  uint32_t i;
+  BzlaSort *s;
+  BzlaSortPtrStack visit;
+  BzlaHashTableData *d;
+
+  if (bzla_hashint_map_contains(w->sort_map, id)) return;
+
+  BZLA_INIT_STACK(w->bzla->mm, visit);
+  BZLA_PUSH_STACK(visit, bzla_sort_get_by_id(w->bzla, id));
+  while (!BZLA_EMPTY_STACK(visit))
+  {
+    s = BZLA_POP_STACK(visit);
+    d = bzla_hashint_map_get(w->sort_map, s->id);
+    if (!d)
+    {
+      bzla_hashint_map_add(w->sort_map, s->id);
+      BZLA_PUSH_STACK(visit, s);
+      switch (s->kind)
+      {
+        case BZLA_BOOL_SORT:
+        case BZLA_BV_SORT: break;
+        case BZLA_FUN_SORT:
+          BZLA_PUSH_STACK(visit, s->fun.codomain);
+          BZLA_PUSH_STACK(visit, s->fun.domain);
+          break;
+        case BZLA_TUPLE_SORT:
+          for (i = 0; i < s->tuple.num_elements; i++)
+            BZLA_PUSH_STACK(visit, s->tuple.elements[i]);
+          break;
+        default:
+          BZLA_ABORT(true, "saving sorts of kind %u is not supported", s->kind);
+      }
+    }
+    else if (!d->as_int)
+    {
+      BZLA_PUSH_STACK(w->sorts, s->id);
+      d->as_int = BZLA_COUNT_STACK(w->sorts);
+    }
+  }
+  BZLA_RELEASE_STACK(visit);
+}
+
+static void
+collect_node(BzlaStateWriter *w, BzlaNode *exp)
+{
+  uint32_t i;
+  Bzla *bzla;
+  BzlaNode *cur;
+  BzlaNodePtrStack visit;
+  BzlaHashTableData *d;
+  BzlaPtrHashTableIterator it;
+
+  bzla = w->bzla;
+  BZLA_INIT_STACK(bzla->mm, visit);
+  BZLA_PUSH_STACK(visit, exp);
+  while (!BZLA_EMPTY_STACK(visit))
+  {
+    cur = bzla_node_real_addr(BZLA_POP_STACK(visit));
+    d   = bzla_hashint_map_get(w->node_map, cur->id);
+    if (!d)
+    {
+      bzla_hashint_map_add(w->node_map, cur->id);
+      BZLA_PUSH_STACK(visit, cur);
+      if (is_subst_input(w, cur))
+      {
+        BZLA_PUSH_STACK(w->substs, cur);
+        BZLA_PUSH_STACK(visit, bzla_node_get_simplified(bzla, cur));
+        continue;
+      }
+      assert(!bzla_node_is_proxy(cur));
+      for (i = 0; i < cur->arity; i++)
+      {
+        BZLA_PUSH_STACK(visit, bzla_node_get_simplified(bzla, cur->e[i]));
+      }
+      if (bzla_node_is_lambda(cur) && bzla_node_lambda_get_static_rho(cur))
+      {
+        BZLA_PUSH_STACK(w->rhos, cur);
+        bzla_iter_hashptr_init(&it, bzla_node_lambda_get_static_rho(cur));
+        while (bzla_iter_hashptr_has_next(&it))
+        {
+          BZLA_PUSH_STACK(
+              visit, bzla_node_get_simplified(bzla, it.bucket->data.as_ptr));
+          BZLA_PUSH_STACK(
+              visit,
+              bzla_node_get_simplified(bzla, bzla_iter_hashptr_next(&it)));
+        }
+      }
+    }
+    else if (!d->as_int)
+    {
+      collect_sort(w, cur->sort_id);
+      BZLA_PUSH_STACK(w->nodes, cur);
+      d->as_int = BZLA_COUNT_STACK(w->nodes);
+    }
+  }
+  BZLA_RELEASE_STACK(visit);
+}
+
+static int32_t
+node_ref(BzlaStateWriter *w, BzlaNode *exp)
+{
+  BzlaHashTableData *d;
+  d = bzla_hashint_map_get(w->node_map, bzla_node_real_addr(exp)->id);
+  assert(d);
+  assert(d->as_int > 0);
+  return bzla_node_is_inverted(exp) ? -d->as_int : d->as_int;
+}
+
+static int32_t
+simplified_node_ref(BzlaStateWriter *w, BzlaNode *exp)
+{
+  return node_ref(w, bzla_node_get_simplified(w->bzla, exp));
+}
+
+static uint32_t
+sort_ref(BzlaStateWriter *w, BzlaSortId id)
+{
+  BzlaHashTableData *d;
+  d = bzla_hashint_map_get(w->sort_map, id);
+  assert(d);
+  assert(d->as_int > 0);
+  return d->as_int;
+}
+
+static void
+write_sort(BzlaStateWriter *w, BzlaSortId id)
+{
+  uint32_t i;
+  BzlaSort *s;
+
+  s = bzla_sort_get_by_id(w->bzla, id);
+  write_u32(w, s->kind);
+  switch (s->kind)
+  {
+    case BZLA_BOOL_SORT: break;
+    case BZLA_BV_SORT: write_u32(w, s->bitvec.width); break;
+    case BZLA_FUN_SORT:
+      write_u32(w, s->fun.is_array);
+      write_u32(w, sort_ref(w, s->fun.domain->id));
+      write_u32(w, sort_ref(w, s->fun.codomain->id));
+      break;
+    default:
+      assert(s->kind == BZLA_TUPLE_SORT);
+      write_u32(w, s->tuple.num_elements);
+      for (i = 0; i < s->tuple.num_elements; i++)
+        write_u32(w, sort_ref(w, s->tuple.elements[i]->id));
+  }
+}
+
+static void
+write_node(BzlaStateWriter *w, BzlaNode *exp)
+{
+  assert(bzla_node_is_regular(exp));
+
+  uint32_t i, width;
+  Bzla *bzla;
+  BzlaNodeKind kind;
+  BzlaBitVector *bits;
+  uint32_t word;
+
+  bzla = w->bzla;
+  kind = exp->kind;
+  if (is_subst_input(w, exp))
+  {
+    /* Substituted inputs may have been turned into proxies. */
+    kind = bzla_sort_is_fun(bzla, exp->sort_id) ? BZLA_UF_NODE : BZLA_VAR_NODE;
+    write_u32(w, kind);
+    write_u32(w, exp->is_array ? BZLA_STATE_FLAG_IS_ARRAY : 0);
+    write_u32(w, sort_ref(w, exp->sort_id));
+    write_u32(w, 0);
+    write_str(w, bzla_node_get_symbol(bzla, exp));
+    return;
+  }
+
+  write_u32(w, kind);
+  write_u32(w, exp->is_array ? BZLA_STATE_FLAG_IS_ARRAY : 0);
+  write_u32(w, sort_ref(w, exp->sort_id));
+  write_u32(w, exp->arity);
+  for (i = 0; i < exp->arity; i++)
+  {
+    write_i32(w, simplified_node_ref(w, exp->e[i]));
+  }
+
+  switch (kind)
+  {
+    case BZLA_BV_CONST_NODE:
+      bits  = bzla_node_bv_const_get_bits(exp);
+      width = bzla_bv_get_width(bits);
+      for (i = 0, word = 0; i < width; i++)
+      {
+        word |= bzla_bv_get_bit(bits, i) << (i % 32);
+        if (i % 32 == 31 || i + 1 == width)
+        {
+          write_u32(w, word);
+          word = 0;
+        }
+      }
+      break;
+    case BZLA_VAR_NODE:
+    case BZLA_PARAM_NODE:
+    case BZLA_UF_NODE: write_str(w, bzla_node_get_symbol(bzla, exp)); break;
+    case BZLA_BV_SLICE_NODE:
+      write_u32(w, bzla_node_bv_slice_get_upper(exp));
+      write_u32(w, bzla_node_bv_slice_get_lower(exp));
+      break;
+    case BZLA_BV_AND_NODE:
+    case BZLA_BV_EQ_NODE:
+    case BZLA_FUN_EQ_NODE:
+    case BZLA_BV_ADD_NODE:
+    case BZLA_BV_MUL_NODE:
+    case BZLA_BV_ULT_NODE:
+    case BZLA_BV_SLT_NODE:
+    case BZLA_BV_SLL_NODE:
+    case BZLA_BV_SRL_NODE:
+    case BZLA_BV_UDIV_NODE:
+    case BZLA_BV_UREM_NODE:
+    case BZLA_BV_CONCAT_NODE:
+    case BZLA_LAMBDA_NODE:
+    case BZLA_APPLY_NODE:
+    case BZLA_ARGS_NODE:
+    case BZLA_EXISTS_NODE:
+    case BZLA_FORALL_NODE:
+    case BZLA_COND_NODE:
+    case BZLA_UPDATE_NODE: break;
+    default:
+      BZLA_ABORT(true,
+                 "saving terms of kind '%s' is not supported",
+                 g_bzla_op2str[kind]);
+  }
+}
+
+void
+bzla_state_save(Bzla *bzla, FILE *file)
+{
+  assert(bzla);
+  assert(file);
+
+  uint32_t i;
+  BzlaOption o;
+  BzlaMemMgr *mm;
+  BzlaNode *cur;
+  BzlaStateWriter w;
+  BzlaPtrHashTable *rho;
+  BzlaPtrHashTableIterator it;
+
+  mm = bzla->mm;
+
+  w.bzla     = bzla;
+  w.file     = file;
+  w.sort_map = bzla_hashint_map_new(mm);
+  w.node_map = bzla_hashint_map_new(mm);
+  BZLA_INIT_STACK(mm, w.sorts);
+  BZLA_INIT_STACK(mm, w.nodes);
+  BZLA_INIT_STACK(mm, w.rhos);
+  BZLA_INIT_STACK(mm, w.substs);
+  BZLA_INIT_STACK(mm, w.roots);
+
+  /* Collect all sorts and nodes in post-order. */
+  bzla_iter_hashptr_init(&it, bzla->inputs);
+  while (bzla_iter_hashptr_has_next(&it))
+  {
+    collect_node(&w, bzla_iter_hashptr_next(&it));
+  }
+  /* The keys of varsubst_constraints are the substituted inputs, the
+   * corresponding equalities are also in the constraint tables below. */
+  bzla_iter_hashptr_init(&it, bzla->embedded_constraints);
+  bzla_iter_hashptr_queue(&it, bzla->unsynthesized_constraints);
+  bzla_iter_hashptr_queue(&it, bzla->synthesized_constraints);
+  while (bzla_iter_hashptr_has_next(&it))
+  {
+    cur = bzla_node_get_simplified(bzla, bzla_iter_hashptr_next(&it));
+    BZLA_PUSH_STACK(w.roots, cur);
+    collect_node(&w, cur);
+  }
+  for (i = 0; i < BZLA_COUNT_STACK(bzla->assertions); i++)
+  {
+    collect_node(&w,
+                 bzla_node_get_simplified(
+                     bzla, BZLA_PEEK_STACK(bzla->assertions, i)));
+  }
+
+  write_u32(&w, BZLA_STATE_MAGIC);
+  write_u32(&w, BZLA_STATE_VERSION);
+
+  for (i = 0, o = bzla_opt_first(bzla); bzla_opt_is_valid(bzla, o);
+       o = bzla_opt_next(bzla, o))
+  {
+    if (bzla_opt_get(bzla, o) != bzla_opt_get_dflt(bzla, o)) i++;
+  }
+  write_u32(&w, i);
+  for (o = bzla_opt_first(bzla); bzla_opt_is_valid(bzla, o);
+       o = bzla_opt_next(bzla, o))
+  {
+    if (bzla_opt_get(bzla, o) == bzla_opt_get_dflt(bzla, o)) continue;
+    write_str(&w, bzla_opt_get_lng(bzla, o));
+    write_u32(&w, bzla_opt_get(bzla, o));
+  }
+
+  write_u32(&w, bzla->inconsistent);
+  write_u32(&w, bzla->num_push_pop);
+
+  write_u32(&w, BZLA_COUNT_STACK(w.sorts));
+  for (i = 0; i < BZLA_COUNT_STACK(w.sorts); i++)
+  {
+    write_sort(&w, BZLA_PEEK_STACK(w.sorts, i));
+  }
+
+  write_u32(&w, BZLA_COUNT_STACK(w.nodes));
+  for (i = 0; i < BZLA_COUNT_STACK(w.nodes); i++)
+  {
+    write_node(&w, BZLA_PEEK_STACK(w.nodes, i));
+  }
+
+  write_u32(&w, BZLA_COUNT_STACK(w.rhos));
+  for (i = 0; i < BZLA_COUNT_STACK(w.rhos); i++)
+  {
+    cur = BZLA_PEEK_STACK(w.rhos, i);
+    rho = bzla_node_lambda_get_static_rho(cur);
+    write_i32(&w, node_ref(&w, cur));
+    write_u32(&w, rho->count);
+    bzla_iter_hashptr_init(&it, rho);
+    while (bzla_iter_hashptr_has_next(&it))
+    {
+      cur = it.bucket->data.as_ptr;
+      write_i32(&w, simplified_node_ref(&w, bzla_iter_hashptr_next(&it)));
+      write_i32(&w, simplified_node_ref(&w, cur));
+    }
+  }
+
+  write_u32(&w, bzla->inputs->count);
+  bzla_iter_hashptr_init(&it, bzla->inputs);
+  while (bzla_iter_hashptr_has_next(&it))
+  {
+    write_i32(&w, it.bucket->data.as_int);
+    write_i32(&w, node_ref(&w, bzla_iter_hashptr_next(&it)));
+  }
+
+  write_u32(&w, BZLA_COUNT_STACK(w.substs));
+  for (i = 0; i < BZLA_COUNT_STACK(w.substs); i++)
+  {
+    cur = BZLA_PEEK_STACK(w.substs, i);
+    write_i32(&w, node_ref(&w, cur));
+    write_i32(&w, simplified_node_ref(&w, cur));
+  }
+
+  write_u32(&w, BZLA_COUNT_STACK(w.roots));
+  for (i = 0; i < BZLA_COUNT_STACK(w.roots); i++)
+  {
+    write_i32(&w, node_ref(&w, BZLA_PEEK_STACK(w.roots, i)));
+  }
+
+  write_u32(&w, BZLA_COUNT_STACK(bzla->assertions));
+  for (i = 0; i < BZLA_COUNT_STACK(bzla->assertions); i++)
+  {
+    write_i32(&w,
+              simplified_node_ref(&w, BZLA_PEEK_STACK(bzla->assertions, i)));
+  }
+  write_u32(&w, BZLA_COUNT_STACK(bzla->assertions_trail));
+  for (i = 0; i < BZLA_COUNT_STACK(bzla->assertions_trail); i++)
+  {
+    write_u32(&w, BZLA_PEEK_STACK(bzla->assertions_trail, i));
+  }
+
+  bzla_hashint_map_delete(w.sort_map);
+  bzla_hashint_map_delete(w.node_map);
+  BZLA_RELEASE_STACK(w.sorts);
+  BZLA_RELEASE_STACK(w.nodes);
+  BZLA_RELEASE_STACK(w.rhos);
+  BZLA_RELEASE_STACK(w.substs);
+  BZLA_RELEASE_STACK(w.roots);
+}
+
+/*------------------------------------------------------------------------*/
+
+static BzlaSortId
+read_sort_ref(BzlaStateReader *r, uint32_t limit)
+{
+  uint32_t ref = read_u32(r);
+  BZLA_ABORT(ref == 0 || ref > limit, "invalid state file: invalid sort");
+  return r->sorts[ref - 1];
+}
+
+/* Reads a reference to one of the first 'limit' nodes. */
+static BzlaNode *
+read_node_ref(BzlaStateReader *r, uint32_t limit)
+{
+  int32_t ref      = read_i32(r);
+  uint32_t abs_ref = ref < 0 ? -(uint32_t) ref : (uint32_t) ref;
+  BZLA_ABORT(ref == 0 || abs_ref > limit, "invalid state file: invalid node");
+  return ref < 0 ? bzla_node_invert(r->nodes[abs_ref - 1])
+                 : r->nodes[abs_ref - 1];
+}
+
+static BzlaSortId
+read_sort(BzlaStateReader *r, uint32_t idx)
+{
+  uint32_t i, kind, n, is_array;
+  Bzla *bzla;
+  BzlaSortId res = 0, domain, codomain, *elements;
+
+  bzla = r->bzla;
+  kind = read_u32(r);
+  switch (kind)
+  {
+    case BZLA_BOOL_SORT: res = bzla_sort_bool(bzla); break;
+    case BZLA_BV_SORT:
+      n = read_u32(r);
+      BZLA_ABORT(n == 0, "invalid state file: invalid bit-vector width");
+      res = bzla_sort_bv(bzla, n);
+      break;
+    case BZLA_FUN_SORT:
+      is_array = read_u32(r);
+      domain   = read_sort_ref(r, idx);
+      codomain = read_sort_ref(r, idx);
+      BZLA_ABORT(!bzla_sort_is_tuple(bzla, domain),
+                 "invalid state file: invalid function sort");
+      if (is_array)
+      {
+        BZLA_ABORT(bzla_sort_tuple_get_arity(bzla, domain) != 1,
+                   "invalid state file: invalid array sort");
+        res = bzla_sort_array(
+            bzla,
+            bzla_sort_get_by_id(bzla, domain)->tuple.elements[0]->id,
+            codomain);
+      }
+      else
+      {
+        res = bzla_sort_fun(bzla, domain, codomain);
+      }
+      break;
+    case BZLA_TUPLE_SORT:
+      n = read_u32(r);
+      BZLA_ABORT(n == 0, "invalid state file: invalid tuple sort");
+      BZLA_NEWN(bzla->mm, elements, n);
+      for (i = 0; i < n; i++) elements[i] = read_sort_ref(r, idx);
+      res = bzla_sort_tuple(bzla, elements, n);
+      BZLA_DELETEN(bzla->mm, elements, n);
+      break;
+    default:
+      BZLA_ABORT(true, "invalid state file: invalid sort kind %u", kind);
+  }
+  return res;
+}
+
+/* Returns true if 'e' is an admissible list of 'arity' children of a node of
+ * kind 'kind', i.e., if the corresponding node constructor can be applied. */
+static bool
+is_valid_children(Bzla *bzla, uint32_t kind, uint32_t arity, BzlaNode *e[])
+{
+  uint32_t i;
+  BzlaSortId s0, s1, s2;
+
+  for (i = 0; i < arity; i++)
+  {
+    /* functions and argument lists can not be inverted */
+    if (bzla_node_is_inverted(e[i]) && !bzla_node_is_bv(bzla, e[i]))
+      return false;
+  }
+  s0 = arity > 0 ? bzla_node_get_sort_id(e[0]) : 0;
+  s1 = arity > 1 ? bzla_node_get_sort_id(e[1]) : 0;
+  s2 = arity > 2 ? bzla_node_get_sort_id(e[2]) : 0;
+
+  switch (kind)
+  {
+    case BZLA_BV_CONST_NODE:
+    case BZLA_VAR_NODE:
+    case BZLA_PARAM_NODE:
+    case BZLA_UF_NODE: return arity == 0;
+    case BZLA_BV_SLICE_NODE: return arity == 1 && bzla_sort_is_bv(bzla, s0);
+    case BZLA_BV_AND_NODE:
+    case BZLA_BV_ADD_NODE:
+    case BZLA_BV_MUL_NODE:
+    case BZLA_BV_ULT_NODE:
+    case BZLA_BV_SLT_NODE:
+    case BZLA_BV_SLL_NODE:
+    case BZLA_BV_SRL_NODE:
+    case BZLA_BV_UDIV_NODE:
+    case BZLA_BV_UREM_NODE:
+      return arity == 2 && bzla_sort_is_bv(bzla, s0) && s0 == s1;
+    case BZLA_BV_EQ_NODE:
+    case BZLA_FUN_EQ_NODE:
+      return arity == 2 && !bzla_sort_is_tuple(bzla, s0) && s0 == s1
+             && bzla_node_real_addr(e[0])->is_array
+                    == bzla_node_real_addr(e[1])->is_array;
+    case BZLA_BV_CONCAT_NODE:
+      return arity == 2 && bzla_sort_is_bv(bzla, s0)
+             && bzla_sort_is_bv(bzla, s1)
+             && (uint64_t) bzla_sort_bv_get_width(bzla, s0)
+                        + bzla_sort_bv_get_width(bzla, s1)
+                    <= INT32_MAX;
+    case BZLA_LAMBDA_NODE:
+      return arity == 2 && bzla_node_is_regular(e[0])
+             && bzla_node_is_param(e[0]) && !bzla_sort_is_tuple(bzla, s1);
+    case BZLA_EXISTS_NODE:
+    case BZLA_FORALL_NODE:
+      return arity == 2 && bzla_node_is_regular(e[0])
+             && bzla_node_is_param(e[0]) && bzla_sort_is_bool(bzla, s1);
+    case BZLA_APPLY_NODE:
+      return arity == 2 && bzla_sort_is_fun(bzla, s0)
+             && bzla_node_is_args(e[1])
+             && bzla_sort_fun_get_domain(bzla, s0) == s1;
+    case BZLA_ARGS_NODE:
+      for (i = 0; i < arity; i++)
+      {
+        if (bzla_node_is_fun(bzla_node_real_addr(e[i]))) return false;
+      }
+      return arity > 0;
+    case BZLA_COND_NODE:
+      return arity == 3 && bzla_sort_is_bool(bzla, s0) && s1 == s2
+             && !bzla_sort_is_tuple(bzla, s1)
+             && bzla_node_real_addr(e[1])->is_array
+                    == bzla_node_real_addr(e[2])->is_array;
+    case BZLA_UPDATE_NODE:
+      return arity == 3 && bzla_sort_is_fun(bzla, s0)
+             && bzla_node_is_args(e[1])
+             && bzla_sort_fun_get_domain(bzla, s0) == s1
+             && bzla_sort_fun_get_codomain(bzla, s0) == s2;
+    default: return false;
+  }
+}
+
+static BzlaNode *
+read_node(BzlaStateReader *r, uint32_t idx)
+{
+  uint32_t i, kind, flags, arity, width, upper, lower, word;
+  char *symbol;
+  Bzla *bzla;
+  BzlaNode *res = 0, *e[BZLA_NODE_MAX_CHILDREN];
+  BzlaSortId sort;
+  BzlaBitVector *bits;
+
+  bzla  = r->bzla;
+  kind  = read_u32(r);
+  flags = read_u32(r);
+  sort  = read_sort_ref(r, r->num_sorts);
+  arity = read_u32(r);
+  BZLA_ABORT(arity > BZLA_NODE_MAX_CHILDREN,
+             "invalid state file: invalid number of children");
+  for (i = 0; i < arity; i++) e[i] = read_node_ref(r, idx);
+  BZLA_ABORT(!is_valid_children(bzla, kind, arity, e),
+             "invalid state file: invalid children of node %u",
+             idx + 1);
+
+  switch (kind)
+  {
+    case BZLA_BV_CONST_NODE:
+      BZLA_ABORT(!bzla_sort_is_bv(bzla, sort),
+                 "invalid state file: invalid constant");
+      width = bzla_sort_bv_get_width(bzla, sort);
+      bits  = bzla_bv_new(bzla->mm, width);
+      for (i = 0, word = 0; i < width; i++)
+      {
+        if (i % 32 == 0) word = read_u32(r);
+        bzla_bv_set_bit(bits, i, (word >> (i % 32)) & 1);
+      }
+      res = bzla_exp_bv_const(bzla, bits);
+      bzla_bv_free(bzla->mm, bits);
+      break;
+    case BZLA_VAR_NODE:
+    case BZLA_PARAM_NODE:
+    case BZLA_UF_NODE:
+      symbol = read_str(r);
+      if (kind == BZLA_VAR_NODE)
+        res = bzla_exp_var(bzla, sort, symbol);
+      else if (kind == BZLA_PARAM_NODE)
+        res = bzla_exp_param(bzla, sort, symbol);
+      else
+        res = bzla_exp_uf(bzla, sort, symbol);
+      if (symbol) bzla_mem_freestr(bzla->mm, symbol);
+      break;
+    case BZLA_BV_SLICE_NODE:
+      upper = read_u32(r);
+      lower = read_u32(r);
+      BZLA_ABORT(upper < lower || upper >= bzla_node_bv_get_width(bzla, e[0]),
+                 "invalid state file: invalid slice");
+      res   = bzla_exp_bv_slice(bzla, e[0], upper, lower);
+      break;
+    case BZLA_BV_AND_NODE: res = bzla_exp_bv_and(bzla, e[0], e[1]); break;
+    case BZLA_BV_EQ_NODE:
+    case BZLA_FUN_EQ_NODE: res = bzla_exp_eq(bzla, e[0], e[1]); break;
+    case BZLA_BV_ADD_NODE: res = bzla_exp_bv_add(bzla, e[0], e[1]); break;
+    case BZLA_BV_MUL_NODE: res = bzla_exp_bv_mul(bzla, e[0], e[1]); break;
+    case BZLA_BV_ULT_NODE: res = bzla_exp_bv_ult(bzla, e[0], e[1]); break;
+    case BZLA_BV_SLT_NODE: res = bzla_exp_bv_slt(bzla, e[0], e[1]); break;
+    case BZLA_BV_SLL_NODE: res = bzla_exp_bv_sll(bzla, e[0], e[1]); break;
+    case BZLA_BV_SRL_NODE: res = bzla_exp_bv_srl(bzla, e[0], e[1]); break;
+    case BZLA_BV_UDIV_NODE: res = bzla_exp_bv_udiv(bzla, e[0], e[1]); break;
+    case BZLA_BV_UREM_NODE: res = bzla_exp_bv_urem(bzla, e[0], e[1]); break;
+    case BZLA_BV_CONCAT_NODE:
+      res = bzla_exp_bv_concat(bzla, e[0], e[1]);
+      break;
+    case BZLA_LAMBDA_NODE: res = bzla_exp_lambda(bzla, e[0], e[1]); break;
+    case BZLA_APPLY_NODE:
+      /* see bzla_clone_recursively_rebuild_exp */
+      res = bzla_node_create_apply(bzla, e[0], e[1]);
+      break;
+    case BZLA_ARGS_NODE: res = bzla_exp_args(bzla, e, arity); break;
+    case BZLA_EXISTS_NODE: res = bzla_exp_exists(bzla, e[0], e[1]); break;
+    case BZLA_FORALL_NODE: res = bzla_exp_forall(bzla, e[0], e[1]); break;
+    case BZLA_COND_NODE: res = bzla_exp_cond(bzla, e[0], e[1], e[2]); break;
+    case BZLA_UPDATE_NODE:
+      res = bzla_exp_update(bzla, e[0], e[1], e[2]);
+      break;
+    default:
+      BZLA_ABORT(true, "invalid state file: invalid node kind %u", kind);
+  }
+  BZLA_ABORT(bzla_node_get_sort_id(res) != sort
+                 || bzla_node_real_addr(res)->arity != arity,
+             "invalid state file: invalid node");
+  if (flags & BZLA_STATE_FLAG_IS_ARRAY) bzla_node_real_addr(res)->is_array = 1;
+  return res;
+}
+
+void
+bzla_state_load(Bzla *bzla, FILE *file)
+{
+  assert(bzla);
+  assert(file);
+
+  uint32_t i, j, n, m, val, rwl, inconsistent, num_push_pop;
+  int32_t data;
+  char *name;
+  BzlaOption o;
+  BzlaMemMgr *mm;
+  BzlaNode *cur, *args, *value, *eq;
+  BzlaStateReader r;
+  BzlaPtrHashBucket *b;
+  BzlaPtrHashTable *rho;
+
+  BZLA_ABORT(bzla->inputs->count > 0
+                 || !BZLA_EMPTY_STACK(bzla->assertions_trail),
+             "state can only be loaded into an instance without inputs and "
+             "context levels");
+
+  mm     = bzla->mm;
+  r.bzla = bzla;
+  r.file = file;
+
+  BZLA_ABORT(read_u32(&r) != BZLA_STATE_MAGIC,
+             "invalid state file: wrong magic number or byte order");
+  BZLA_ABORT(read_u32(&r) != BZLA_STATE_VERSION,
+             "invalid state file: unsupported version");
+
+  n = read_u32(&r);
+  for (i = 0; i < n; i++)
+  {
+    name = read_str(&r);
+    val  = read_u32(&r);
+    BZLA_ABORT(!name, "invalid state file: invalid option");
+    b = bzla_hashptr_table_get(bzla->str2opt, name);
+    BZLA_ABORT(!b, "invalid state file: unknown option '%s'", name);
+    o = b->data.as_int;
+    BZLA_ABORT(
+        val < bzla_opt_get_min(bzla, o) || val > bzla_opt_get_max(bzla, o),
+        "invalid state file: invalid value %u for option '%s'",
+        val,
+        name);
+    bzla_opt_set(bzla, o, val);
+    bzla_mem_freestr(mm, name);
+  }
+
+  inconsistent = read_u32(&r);
+  num_push_pop = read_u32(&r);
+
+  /* Nodes are rebuilt as saved, simplifications are applied when asserting
+   * the constraints below. */
+  rwl = bzla_opt_get(bzla, BZLA_OPT_RW_LEVEL);
+  bzla_opt_set(bzla, BZLA_OPT_RW_LEVEL, 0);
+
+  r.sorts     = 0;
+  r.num_sorts = read_u32(&r);
+  if (r.num_sorts) BZLA_CNEWN(mm, r.sorts, r.num_sorts);
+  for (i = 0; i < r.num_sorts; i++) r.sorts[i] = read_sort(&r, i);
+
+  r.nodes     = 0;
+  r.num_nodes = read_u32(&r);
+  if (r.num_nodes) BZLA_CNEWN(mm, r.nodes, r.num_nodes);
+  for (i = 0; i < r.num_nodes; i++) r.nodes[i] = read_node(&r, i);
+
+  n = read_u32(&r);
+  for (i = 0; i < n; i++)
+  {
+    cur = read_node_ref(&r, r.num_nodes);
+    BZLA_ABORT(bzla_node_is_inverted(cur) || !bzla_node_is_lambda(cur),
+               "invalid state file: invalid lambda");
+    rho = bzla_node_lambda_get_static_rho(cur);
+    if (!rho)
+    {
+      rho = bzla_hashptr_table_new(mm,
+                                   (BzlaHashPtr) bzla_node_hash_by_id,
+                                   (BzlaCmpPtr) bzla_node_compare_by_id);
+      bzla_node_lambda_set_static_rho(cur, rho);
+    }
+    m = read_u32(&r);
+    for (j = 0; j < m; j++)
+    {
+      args  = read_node_ref(&r, r.num_nodes);
+      value = read_node_ref(&r, r.num_nodes);
+      if (bzla_hashptr_table_get(rho, args)) continue;
+      b              = bzla_hashptr_table_add(rho, bzla_node_copy(bzla, args));
+      b->data.as_ptr = bzla_node_copy(bzla, value);
+    }
+  }
+
+  n = read_u32(&r);
+  for (i = 0; i < n; i++)
+  {
+    data = read_i32(&r);
+    cur  = read_node_ref(&r, r.num_nodes);
+    BZLA_ABORT(bzla_node_is_inverted(cur)
+                   || (!bzla_node_is_uf(cur) && !bzla_node_is_var(cur)),
+               "invalid state file: invalid input");
+    if (bzla_hashptr_table_get(bzla->inputs, cur)) continue;
+    bzla_hashptr_table_add(bzla->inputs, bzla_node_copy(bzla, cur))
+        ->data.as_int = data;
+  }
+
+  bzla_opt_set(bzla, BZLA_OPT_RW_LEVEL, rwl);
+
+  n = read_u32(&r);
+  for (i = 0; i < n; i++)
+  {
+    cur   = read_node_ref(&r, r.num_nodes);
+    value = read_node_ref(&r, r.num_nodes);
+    eq    = bzla_exp_eq(bzla, cur, value);
+    bzla_assert_exp(bzla, eq);
+    bzla_node_release(bzla, eq);
+  }
+
+  n = read_u32(&r);
+  for (i = 0; i < n; i++)
+  {
+    bzla_assert_exp(bzla, read_node_ref(&r, r.num_nodes));
+  }
+  if (inconsistent)
+  {
+    bzla_assert_exp(bzla, bzla_node_invert(bzla->true_exp));
+  }
+
+  n = read_u32(&r);
+  for (i = 0; i < n; i++)
+  {
+    cur = read_node_ref(&r, r.num_nodes);
+    if (bzla_hashint_table_contains(bzla->assertions_cache,
+                                    bzla_node_get_id(cur)))
+    {
+      continue;
+    }
+    BZLA_PUSH_STACK(bzla->assertions, bzla_node_copy(bzla, cur));
+    bzla_hashint_table_add(bzla->assertions_cache, bzla_node_get_id(cur));
+  }
+  n = read_u32(&r);
+  for (i = 0; i < n; i++)
+  {
+    val = read_u32(&r);
+    BZLA_ABORT(val > BZLA_COUNT_STACK(bzla->assertions),
+               "invalid state file: invalid assertion trail");
+    BZLA_PUSH_STACK(bzla->assertions_trail, val);
+  }
+  bzla->num_push_pop = num_push_pop;
+
+  for (i = 0; i < r.num_nodes; i++) bzla_node_release(bzla, r.nodes[i]);
+  if (r.nodes) BZLA_DELETEN(mm, r.nodes, r.num_nodes);
+  for (i = 0; i < r.num_sorts; i++) bzla_sort_release(bzla, r.sorts[i]);
+  if (r.sorts) BZLA_DELETEN(mm, r.sorts, r.num_sorts);
+}
@@ -0,0 +1,31 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * This file is part of Bitwuzla.
+ *
+ * Copyright (C) 2007-2022 by the authors listed in the AUTHORS file.
+ *
+ * See COPYING for more information on using this software.
+ */
+
+#ifndef BZLASTATE_H_INCLUDED
+#define BZLASTATE_H_INCLUDED
+
+#include <stdio.h>
+
+#include "bzlatypes.h"
+
+/* Save the state of 'bzla' to 'file' in a compact binary format: options that
+ * differ from their default value, all sorts and nodes reachable from the
+ * inputs and constraints, static_rho of array lambdas, the inputs with their
+ * BTOR ids, variable substitutions, the current constraints and the
+ * assertions on the context level stack. SAT solver state, models and caches
+ * are not saved. Aborts on floating-point terms. */
+void bzla_state_save(Bzla *bzla, FILE *file);
+
+/* Load a state saved with bzla_state_save() into 'bzla', which must not have
+ * any inputs yet. Constraints and substitutions are re-asserted, hence they
+ * are simplified again w.r.t. the loaded options. Aborts on invalid files. */
+void bzla_state_load(Bzla *bzla, FILE *file);
+
+#endif
@@ -22,9 +22,13 @@ extern "C" {
 #include "utils/bzlautil.h"
 }
 
-#include <iostream>  // debug
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <thread>
 #include <unordered_map>
-#include <unordered_set>
 
 namespace bzla {
 namespace synth {
@@ -33,10 +37,38 @@ typedef BzlaNode *(*BzlaUnOp)(Bzla *, BzlaNode *);
 typedef BzlaNode *(*BzlaBinOp)(Bzla *, BzlaNode *, BzlaNode *);
 typedef BzlaNode *(*BzlaTerOp)(Bzla *, BzlaNode *, BzlaNode *, BzlaNode *);
 
+/** The minimum fraction of output values a candidate has to match to be
+ * returned as (partial) solution. */
+static const double MATCH_THRESHOLD = 0.3;
+
+/** The kind of an operator, determines how the values of a term are computed
+ * from the values of its arguments. */
+enum class OpKind
+{
+  NOT,
+  ULT,
+  SLT,
+  EQ,
+  AND,
+  ADD,
+  SUB,
+  MUL,
+  UDIV,
+  SDIV,
+  UREM,
+  SREM,
+  SMOD,
+  SLL,
+  SRA,
+  SRL,
+  ITE
+};
+
 struct Op
 {
   bool assoc;
   uint8_t arity;
+  OpKind kind;
   union
   {
     BzlaUnOp un;
@@ -50,17 +82,102 @@ struct Op
 
 typedef struct Op Op;
 
+/**
+ * An enumerated candidate term.
+ *
+ * Candidates are not represented as nodes but as an operator applied to
+ * previously enumerated candidates, together with their values under all
+ * input examples. A node is only constructed for the candidate that is
+ * eventually returned.
+ */
+struct Candidate
+{
+  /** The node of a leaf (input or constant), nullptr for operator terms. */
+  BzlaNode *node;
+  /** The index of the operator in the operator array. */
+  uint32_t op;
+  /** The number of arguments, 0 for leaves. */
+  uint8_t arity;
+  /** The indices of the argument candidates. */
+  uint32_t args[3];
+  /** The sort of the candidate. */
+  BzlaSortId sort;
+  /** The bit-width of the candidate. */
+  uint32_t width;
+  /** True if the candidate consists of constants only or is folded into a
+   * constant by the rewriter. */
+  bool is_const;
+  /** The hash value of the signature of the candidate. */
+  uint64_t hash;
+  /** The offset of the values of the candidate in the packed value storage
+   * (width <= 64) or the bit-vector value storage (width > 64). */
+  size_t values;
+};
+
+/**
+ * A unit of work of the enumeration of one level: the applications of an
+ * operator to the terms of a partition of the level, restricted to a range
+ * of the outermost argument list.
+ */
+struct WorkItem
+{
+  /** The index of the operator in the operator array. */
+  uint32_t op;
+  /** The levels of the arguments. */
+  uint32_t levels[3];
+  /** The sort of the arguments (of the branches for ITE). */
+  BzlaSortId sort;
+  /** The range of the outermost argument list. */
+  size_t begin, end;
+};
+
+/** A candidate enumerated by a worker thread, committed after the level. */
+struct PendingCandidate
+{
+  Candidate cand;
+  /** The position in sequential enumeration order. */
+  uint64_t order;
+  /** The packed values of the candidate. */
+  std::unique_ptr<uint64_t[]> values;
+};
+
+/** The state shared between the worker threads enumerating one level. */
+struct LevelState
+{
+  /** The work items of the level. */
+  std::vector<WorkItem> items;
+  /** The index of the next work item to process. */
+  std::atomic<size_t> next_item{0};
+  /** The number of checks performed so far, shared check limit. */
+  std::atomic<uint64_t> num_checks{0};
+  uint64_t max_checks = 0;
+  /** True if enumeration of this level is stopped early. */
+  std::atomic<bool> stop{false};
+  /** True if termination was requested via the termination callback. */
+  bool terminated = false;
+
+  /** Protects the members below. */
+  std::mutex mutex;
+  /** Enumerated candidates with new signatures. */
+  std::vector<PendingCandidate> pending;
+  /** Maps hash values of signatures to indices in `pending`. */
+  std::unordered_multimap<uint64_t, size_t> pending_sigs;
+  /** The index of the matching candidate in `pending`, SIZE_MAX if none. */
+  size_t found = SIZE_MAX;
+};
+
 //////////////////////////////////////////////////////////////////////////////
 
 class TermDb
 {
  public:
-  TermDb(Bzla *bzla) : d_bzla(bzla) { d_stats.narity.resize(3); }
-  ~TermDb();
+  TermDb() { d_stats.narity.resize(3); }
+
+  void add(uint32_t idx, BzlaSortId sid, uint32_t arity, uint32_t level);
 
-  void add(BzlaNode *n, uint32_t level);
+  void init_level(uint32_t level);
 
-  std::unordered_map<BzlaSortId, std::vector<BzlaNode *>> &get(uint32_t level);
+  std::unordered_map<BzlaSortId, std::vector<uint32_t>> &get(uint32_t level);
 
   size_t size() const;
 
@@ -71,51 +188,38 @@ class TermDb
   } d_stats;
 
  private:
-  Bzla *d_bzla;
-  std::vector<std::unordered_map<BzlaSortId, std::vector<BzlaNode *>>> d_terms;
-  std::unordered_set<BzlaNode *> d_term_cache;  // TODO: check if really needed
+  std::vector<std::unordered_map<BzlaSortId, std::vector<uint32_t>>> d_terms;
+  size_t d_size = 0;
 };
 
-TermDb::~TermDb()
-{
-  for (auto t : d_term_cache)
-  {
-    bzla_node_release(d_bzla, t);
-  }
-}
-
 void
-TermDb::add(BzlaNode *n, uint32_t level)
+TermDb::add(uint32_t idx, BzlaSortId sid, uint32_t arity, uint32_t level)
 {
   assert(level > 0);
 
-  if (d_term_cache.find(n) != d_term_cache.end())
-  {
-    return;
-  }
+  init_level(level);
 
-  d_term_cache.insert(bzla_node_copy(d_bzla, n));
+  auto [it, inserted] = d_terms[level].emplace(sid, std::vector<uint32_t>());
+  it->second.push_back(idx);
+  ++d_size;
 
-  BzlaSortId sid = bzla_node_get_sort_id(n);
+  d_stats.narity.resize(std::max<size_t>(d_stats.narity.size(), arity + 1));
+  ++d_stats.narity[arity];
+
+  d_stats.nlevel.resize(std::max<size_t>(d_stats.nlevel.size(), level + 1));
+  ++d_stats.nlevel[level];
+}
 
+void
+TermDb::init_level(uint32_t level)
+{
   if (d_terms.size() <= level)
   {
     d_terms.resize(level + 1);
   }
-
-  auto [it, inserted] = d_terms[level].emplace(sid, std::vector<BzlaNode *>());
-  it->second.push_back(n);
-
-  uint32_t arity = bzla_node_real_addr(n)->arity;
-
-  d_stats.narity.resize(arity + 1);
-  ++d_stats.narity[arity];
-
-  d_stats.nlevel.resize(level + 1);
-  ++d_stats.nlevel[level];
 }
 
-std::unordered_map<BzlaSortId, std::vector<BzlaNode *>> &
+std::unordered_map<BzlaSortId, std::vector<uint32_t>> &
 TermDb::get(uint32_t level)
 {
   assert(level < d_terms.size());
@@ -125,9 +229,230 @@ TermDb::get(uint32_t level)
 size_t
 TermDb::size() const
 {
-  return d_term_cache.size();
+  return d_size;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static inline uint64_t
+bv_mask(uint32_t width)
+{
+  assert(width > 0 && width <= 64);
+  return width == 64 ? ~UINT64_C(0) : (UINT64_C(1) << width) - 1;
 }
 
+/**
+ * Compute the values of an operator of kind `kind` applied to the packed
+ * values `a`, `b` and `c` of `n` input examples, where `width` is the
+ * bit-width of the operands. The loop bodies do not depend on each other,
+ * which allows the compiler to vectorize them.
+ */
+static void
+eval_packed(OpKind kind,
+            uint32_t width,
+            size_t n,
+            const uint64_t *a,
+            const uint64_t *b,
+            const uint64_t *c,
+            uint64_t *res)
+{
+  uint64_t m = bv_mask(width), msb = UINT64_C(1) << (width - 1);
+
+  switch (kind)
+  {
+    case OpKind::NOT:
+      for (size_t i = 0; i < n; ++i) res[i] = ~a[i] & m;
+      break;
+
+    case OpKind::ULT:
+      for (size_t i = 0; i < n; ++i) res[i] = a[i] < b[i];
+      break;
+
+    case OpKind::SLT:
+      for (size_t i = 0; i < n; ++i) res[i] = (a[i] ^ msb) < (b[i] ^ msb);
+      break;
+
+    case OpKind::EQ:
+      for (size_t i = 0; i < n; ++i) res[i] = a[i] == b[i];
+      break;
+
+    case OpKind::AND:
+      for (size_t i = 0; i < n; ++i) res[i] = a[i] & b[i];
+      break;
+
+    case OpKind::ADD:
+      for (size_t i = 0; i < n; ++i) res[i] = (a[i] + b[i]) & m;
+      break;
+
+    case OpKind::SUB:
+      for (size_t i = 0; i < n; ++i) res[i] = (a[i] - b[i]) & m;
+      break;
+
+    case OpKind::MUL:
+      for (size_t i = 0; i < n; ++i) res[i] = (a[i] * b[i]) & m;
+      break;
+
+    case OpKind::UDIV:
+      for (size_t i = 0; i < n; ++i) res[i] = b[i] == 0 ? m : a[i] / b[i];
+      break;
+
+    case OpKind::UREM:
+      for (size_t i = 0; i < n; ++i) res[i] = b[i] == 0 ? a[i] : a[i] % b[i];
+      break;
+
+    case OpKind::SDIV:
+      for (size_t i = 0; i < n; ++i)
+      {
+        uint64_t sa = a[i] & msb, sb = b[i] & msb;
+        uint64_t ua = sa ? -a[i] & m : a[i];
+        uint64_t ub = sb ? -b[i] & m : b[i];
+        uint64_t q  = ub == 0 ? m : ua / ub;
+        res[i]      = (sa ^ sb) ? -q & m : q;
+      }
+      break;
+
+    case OpKind::SREM:
+      for (size_t i = 0; i < n; ++i)
+      {
+        uint64_t sa = a[i] & msb, sb = b[i] & msb;
+        uint64_t ua = sa ? -a[i] & m : a[i];
+        uint64_t ub = sb ? -b[i] & m : b[i];
+        uint64_t r  = ub == 0 ? ua : ua % ub;
+        res[i]      = sa ? -r & m : r;
+      }
+      break;
+
+    case OpKind::SMOD:
+      for (size_t i = 0; i < n; ++i)
+      {
+        uint64_t sa = a[i] & msb, sb = b[i] & msb;
+        uint64_t ua = sa ? -a[i] & m : a[i];
+        uint64_t ub = sb ? -b[i] & m : b[i];
+        uint64_t r  = ub == 0 ? ua : ua % ub;
+        if (r == 0 || (!sa && !sb))
+          res[i] = r;
+        else if (sa && !sb)
+          res[i] = (b[i] - r) & m;
+        else if (!sa && sb)
+          res[i] = (r + b[i]) & m;
+        else
+          res[i] = -r & m;
+      }
+      break;
+
+    case OpKind::SLL:
+      for (size_t i = 0; i < n; ++i)
+        res[i] = b[i] >= width ? 0 : (a[i] << b[i]) & m;
+      break;
+
+    case OpKind::SRL:
+      for (size_t i = 0; i < n; ++i) res[i] = b[i] >= width ? 0 : a[i] >> b[i];
+      break;
+
+    case OpKind::SRA:
+      for (size_t i = 0; i < n; ++i)
+      {
+        uint64_t s = (a[i] & msb) ? m : 0;
+        res[i]     = b[i] >= width ? s : ((a[i] ^ s) >> b[i]) ^ s;
+      }
+      break;
+
+    default:
+      assert(kind == OpKind::ITE);
+      for (size_t i = 0; i < n; ++i) res[i] = a[i] ? b[i] : c[i];
+  }
+}
+
+static BzlaBitVector *
+bv_smod(BzlaMemMgr *mm, const BzlaBitVector *a, const BzlaBitVector *b)
+{
+  uint32_t width;
+  bool sa, sb;
+  BzlaBitVector *ua, *ub, *r, *tmp, *res;
+
+  width = bzla_bv_get_width(a);
+  sa    = bzla_bv_get_bit(a, width - 1);
+  sb    = bzla_bv_get_bit(b, width - 1);
+  ua    = sa ? bzla_bv_neg(mm, a) : bzla_bv_copy(mm, a);
+  ub    = sb ? bzla_bv_neg(mm, b) : bzla_bv_copy(mm, b);
+  r     = bzla_bv_urem(mm, ua, ub);
+
+  if (bzla_bv_is_zero(r) || (!sa && !sb))
+  {
+    res = bzla_bv_copy(mm, r);
+  }
+  else if (sa && !sb)
+  {
+    tmp = bzla_bv_neg(mm, r);
+    res = bzla_bv_add(mm, tmp, b);
+    bzla_bv_free(mm, tmp);
+  }
+  else if (!sa && sb)
+  {
+    res = bzla_bv_add(mm, r, b);
+  }
+  else
+  {
+    res = bzla_bv_neg(mm, r);
+  }
+  bzla_bv_free(mm, ua);
+  bzla_bv_free(mm, ub);
+  bzla_bv_free(mm, r);
+  return res;
+}
+
+/**
+ * Compute the values of an operator of kind `kind` applied to the
+ * bit-vector values `a` and `b` of `n` input examples with bit-width > 64.
+ * Values of predicates are stored in `res_packed`, all other values in `res`.
+ */
+static void
+eval_wide(BzlaMemMgr *mm,
+          OpKind kind,
+          size_t n,
+          BzlaBitVector *const *a,
+          BzlaBitVector *const *b,
+          uint64_t *res_packed,
+          BzlaBitVector **res)
+{
+  BzlaBitVector *tmp;
+
+  for (size_t i = 0; i < n; ++i)
+  {
+    switch (kind)
+    {
+      case OpKind::NOT: res[i] = bzla_bv_not(mm, a[i]); break;
+      case OpKind::AND: res[i] = bzla_bv_and(mm, a[i], b[i]); break;
+      case OpKind::ADD: res[i] = bzla_bv_add(mm, a[i], b[i]); break;
+      case OpKind::SUB: res[i] = bzla_bv_sub(mm, a[i], b[i]); break;
+      case OpKind::MUL: res[i] = bzla_bv_mul(mm, a[i], b[i]); break;
+      case OpKind::UDIV: res[i] = bzla_bv_udiv(mm, a[i], b[i]); break;
+      case OpKind::UREM: res[i] = bzla_bv_urem(mm, a[i], b[i]); break;
+      case OpKind::SDIV: res[i] = bzla_bv_sdiv(mm, a[i], b[i]); break;
+      case OpKind::SREM: res[i] = bzla_bv_srem(mm, a[i], b[i]); break;
+      case OpKind::SMOD: res[i] = bv_smod(mm, a[i], b[i]); break;
+      case OpKind::SLL: res[i] = bzla_bv_sll(mm, a[i], b[i]); break;
+      case OpKind::SRL: res[i] = bzla_bv_srl(mm, a[i], b[i]); break;
+      case OpKind::SRA: res[i] = bzla_bv_sra(mm, a[i], b[i]); break;
+
+      default:
+        if (kind == OpKind::ULT)
+          tmp = bzla_bv_ult(mm, a[i], b[i]);
+        else if (kind == OpKind::SLT)
+          tmp = bzla_bv_slt(mm, a[i], b[i]);
+        else
+        {
+          assert(kind == OpKind::EQ);
+          tmp = bzla_bv_eq(mm, a[i], b[i]);
+        }
+        res_packed[i] = bzla_bv_is_true(tmp);
+        bzla_bv_free(mm, tmp);
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 class TermSynthesizer
 {
  public:
@@ -135,31 +460,134 @@ class TermSynthesizer
                   std::vector<BzlaNode *> &inputs,
                   std::vector<BzlaBitVectorTuple *> &values_in,
                   std::vector<BzlaBitVector *> &values_out,
-                  std::vector<BzlaNode *> &consts);
+                  std::vector<BzlaNode *> &consts,
+                  uint32_t num_threads);
+  ~TermSynthesizer();
 
   /** Synthesize candidate terms. */
-  std::vector<BzlaNode *> synthesize_terms();
-
-  // aux
   BzlaNode *synthesize_terms(Op ops[],
                              uint32_t nops,
                              uint32_t max_checks,
                              uint32_t max_level,
                              BzlaNode *prev_synth);
 
-  bool check_term(uint32_t cur_level,
-                  BzlaNode *exp,
-                  BzlaPtrHashTable *sigs,
-                  Op *op);
-
-  std::tuple<bool, size_t, BzlaBitVectorTuple *> check_signature(BzlaNode *exp);
-
   BzlaBitVector *eval_candidate(BzlaNode *candidate,
                                 BzlaBitVectorTuple *value_in);
 
  private:
-  /** Check candidate terms. */
-  bool check();
+  /** Check leaf `n` (input or constant) and add it to level 1. */
+  bool check_leaf(BzlaNode *n, bool is_const);
+
+  /** Check the application of `ops[op]` to candidates `a0`, `a1`, `a2`. */
+  bool check_op(uint32_t cur_level,
+                Op ops[],
+                uint32_t op,
+                uint32_t a0,
+                uint32_t a1,
+                uint32_t a2);
+
+  /**
+   * Check candidate `cand` with its values in the value buffers. Adds the
+   * candidate to the term database if its signature was not seen before.
+   * Returns true if the candidate matches the output values.
+   */
+  bool check_candidate(uint32_t cur_level, Candidate &cand, Op *op);
+
+  /**
+   * Compute the values of operator candidate `cand` into `res` (width <= 64)
+   * or `res_wide` (width > 64).
+   */
+  void eval_op(OpKind kind,
+               const Candidate &cand,
+               uint64_t *res,
+               BzlaBitVector **res_wide) const;
+
+  uint64_t hash_values(const Candidate &cand,
+                       const uint64_t *values,
+                       BzlaBitVector *const *values_wide) const;
+  bool equal_values(const Candidate &cand,
+                    const uint64_t *values,
+                    BzlaBitVector *const *values_wide,
+                    const Candidate &other) const;
+
+  /** Signature hash set, open addressing with linear probing. */
+  bool find_signature(const Candidate &cand,
+                      const uint64_t *values,
+                      BzlaBitVector *const *values_wide) const;
+  void insert_signature(uint32_t idx);
+
+  /** Returns true if the values of `cand` match the output values. */
+  bool matches_output(const Candidate &cand,
+                      const uint64_t *values,
+                      BzlaBitVector *const *values_wide) const;
+
+  /** Initialize candidate for the application of `ops[op]` to `a0`, `a1`,
+   * `a2` and determine its sort. */
+  void init_op_candidate(Op ops[],
+                         uint32_t op,
+                         uint32_t a0,
+                         uint32_t a1,
+                         uint32_t a2,
+                         Candidate &cand);
+
+  /**
+   * Check the application of `ops[op]` to `a0`, `a1`, `a2` during sequential
+   * enumeration. Returns false if enumeration stops, i.e., if a matching
+   * candidate was found, the check limit was reached, or termination was
+   * requested.
+   */
+  bool check_next(uint32_t cur_level,
+                  Op ops[],
+                  uint32_t op,
+                  uint32_t a0,
+                  uint32_t a1,
+                  uint32_t a2,
+                  uint32_t max_checks,
+                  double start,
+                  bool &found);
+
+  /** Collect the work items of level `cur_level`. */
+  void collect_items(uint32_t cur_level,
+                     Op ops[],
+                     uint32_t nops,
+                     std::vector<WorkItem> &items);
+
+  /**
+   * Call `check` on all argument combinations of work item `item`.
+   * Returns false if `check` returned false.
+   */
+  template <typename F>
+  bool enumerate_item(Op ops[], const WorkItem &item, F check);
+
+  /**
+   * Enumerate the work items of level `cur_level` with `d_num_threads`
+   * threads. Returns true if a matching candidate was found, sets `stop` if
+   * enumeration is stopped for other reasons.
+   */
+  bool enumerate_parallel(uint32_t cur_level,
+                          Op ops[],
+                          std::vector<WorkItem> &items,
+                          uint32_t max_checks,
+                          double start,
+                          bool &stop);
+
+  /** The worker function of parallel enumeration. */
+  void enumerate_worker(Op ops[], LevelState &state, bool main_thread);
+
+  /** Construct the node of candidate `idx`. */
+  BzlaNode *materialize(Op ops[], uint32_t idx);
+
+  const uint64_t *packed(const Candidate &cand) const
+  {
+    assert(cand.width <= 64);
+    return d_packed.data() + cand.values;
+  }
+
+  BzlaBitVector *const *wide(const Candidate &cand) const
+  {
+    assert(cand.width > 64);
+    return d_wide.data() + cand.values;
+  }
 
   Bzla *d_bzla;
   std::vector<BzlaNode *> d_inputs;
@@ -167,8 +595,27 @@ class TermSynthesizer
   std::vector<BzlaBitVector *> &d_values_out;
   std::unordered_map<BzlaNode *, size_t> d_values_in_map;
   std::vector<BzlaNode *> d_consts;
-
-  std::unordered_set<int32_t> d_term_cache;
+  BzlaSortId d_bool_sort = 0;
+
+  /** Enumerated candidates. */
+  std::vector<Candidate> d_candidates;
+  /** Values of candidates with width <= 64, one word per input example. */
+  std::vector<uint64_t> d_packed;
+  /** Values of candidates with width > 64. */
+  std::vector<BzlaBitVector *> d_wide;
+  /** Value buffers of the currently checked candidate. */
+  std::vector<uint64_t> d_packed_buf;
+  std::vector<BzlaBitVector *> d_wide_buf;
+  /** Packed output values if the output width is <= 64. */
+  std::vector<uint64_t> d_packed_out;
+  uint32_t d_width_out = 0;
+  /** Signature hash set, stores candidate indices + 1 (0 is empty). */
+  std::vector<uint32_t> d_sigs;
+  size_t d_num_sigs = 0;
+  /** The index of the candidate that matches the output values. */
+  uint32_t d_found = 0;
+  /** The number of threads used for enumeration. */
+  uint32_t d_num_threads;
 
   TermDb d_terms;
 
@@ -182,18 +629,43 @@ TermSynthesizer::TermSynthesizer(Bzla *bzla,
                                  std::vector<BzlaNode *> &inputs,
                                  std::vector<BzlaBitVectorTuple *> &values_in,
                                  std::vector<BzlaBitVector *> &values_out,
-                                 std::vector<BzlaNode *> &consts)
+                                 std::vector<BzlaNode *> &consts,
+                                 uint32_t num_threads)
     : d_bzla(bzla),
       d_inputs(inputs),
       d_values_in(values_in),
       d_values_out(values_out),
       d_consts(consts),
-      d_terms(bzla)
+      d_num_threads(num_threads)
 {
   for (size_t i = 0; i < d_inputs.size(); ++i)
   {
     d_values_in_map.emplace(d_inputs[i], i);
   }
+
+  d_packed_buf.resize(d_values_in.size());
+  d_wide_buf.resize(d_values_in.size());
+  d_sigs.resize(1024);
+
+  if (!d_values_out.empty())
+  {
+    d_width_out = bzla_bv_get_width(d_values_out[0]);
+    if (d_width_out <= 64)
+    {
+      for (BzlaBitVector *bv : d_values_out)
+      {
+        d_packed_out.push_back(bzla_bv_to_uint64(bv));
+      }
+    }
+  }
+}
+
+TermSynthesizer::~TermSynthesizer()
+{
+  for (BzlaBitVector *bv : d_wide)
+  {
+    bzla_bv_free(d_bzla->mm, bv);
+  }
 }
 
 /* ------------------------------------------------------------------------- */
@@ -343,81 +815,372 @@ TermSynthesizer::eval_candidate(BzlaNode *candidate,
   return result;
 }
 
-std::tuple<bool, size_t, BzlaBitVectorTuple *>
-TermSynthesizer::check_signature(BzlaNode *exp)
+void
+TermSynthesizer::eval_op(OpKind kind,
+                         const Candidate &cand,
+                         uint64_t *res,
+                         BzlaBitVector **res_wide) const
 {
-  size_t nmatches = 0;
-  BzlaBitVectorTuple *inputs, *sig;
-  BzlaBitVector *output, *res;
-  BzlaMemMgr *mm;
+  assert(!cand.node);
+  assert(cand.arity > 0);
 
-  mm             = d_bzla->mm;
-  size_t nvalues = d_values_in.size();
-  sig            = bzla_bv_new_tuple(mm, nvalues);
+  size_t n           = d_values_in.size();
+  const Candidate &a = d_candidates[cand.args[0]];
+  const Candidate *b = cand.arity > 1 ? &d_candidates[cand.args[1]] : nullptr;
+  const Candidate *c = cand.arity > 2 ? &d_candidates[cand.args[2]] : nullptr;
+  BzlaMemMgr *mm     = d_bzla->mm;
 
-  // TODO: optimization: only construct bit-vector instead of full signature
-  for (size_t i = 0; i < nvalues; i++)
+  if (kind == OpKind::ITE)
+  {
+    assert(a.width == 1);
+    assert(b && c);
+    if (cand.width <= 64)
+    {
+      eval_packed(
+          kind, cand.width, n, packed(a), packed(*b), packed(*c), res);
+    }
+    else
+    {
+      const uint64_t *cond = packed(a);
+      for (size_t i = 0; i < n; ++i)
+      {
+        res_wide[i] = bzla_bv_copy(mm, cond[i] ? wide(*b)[i] : wide(*c)[i]);
+      }
+    }
+  }
+  else if (a.width <= 64)
+  {
+    eval_packed(
+        kind, a.width, n, packed(a), b ? packed(*b) : nullptr, nullptr, res);
+  }
+  else
   {
-    inputs = d_values_in[i];
-    output = d_values_out[i];
+    eval_wide(mm, kind, n, wide(a), b ? wide(*b) : nullptr, res, res_wide);
+  }
+}
 
-    res = eval_candidate(exp, inputs);
+uint64_t
+TermSynthesizer::hash_values(const Candidate &cand,
+                             const uint64_t *values,
+                             BzlaBitVector *const *values_wide) const
+{
+  size_t n   = d_values_in.size();
+  uint64_t h = cand.sort;
 
-    if (bzla_bv_compare(res, output) == 0)
+  if (cand.width <= 64)
+  {
+    for (size_t i = 0; i < n; ++i)
+    {
+      h = (h ^ values[i]) * UINT64_C(0x100000001b3);
+    }
+  }
+  else
+  {
+    for (size_t i = 0; i < n; ++i)
     {
-      nmatches++;
+      h = (h ^ bzla_bv_hash(values_wide[i])) * UINT64_C(0x100000001b3);
     }
+  }
+  /* Mix high bits into the low bits used for probing. */
+  h ^= h >> 33;
+  h *= UINT64_C(0xff51afd7ed558ccd);
+  h ^= h >> 33;
+  return h;
+}
+
+bool
+TermSynthesizer::equal_values(const Candidate &cand,
+                              const uint64_t *values,
+                              BzlaBitVector *const *values_wide,
+                              const Candidate &other) const
+{
+  if (cand.hash != other.hash || cand.sort != other.sort) return false;
 
-    bzla_bv_add_to_tuple(mm, sig, res, i);
-    bzla_bv_free(mm, res);
+  size_t n = d_values_in.size();
+  if (cand.width <= 64)
+  {
+    return std::equal(values, values + n, packed(other));
+  }
+  BzlaBitVector *const *other_wide = wide(other);
+  for (size_t i = 0; i < n; ++i)
+  {
+    if (bzla_bv_compare(values_wide[i], other_wide[i])) return false;
   }
-  return std::make_tuple(nmatches == nvalues, nmatches, sig);
+  return true;
 }
 
 bool
-TermSynthesizer::check_term(uint32_t cur_level,
-                            BzlaNode *exp,
-                            BzlaPtrHashTable *sigs,
-                            Op *op)
+TermSynthesizer::find_signature(const Candidate &cand,
+                                const uint64_t *values,
+                                BzlaBitVector *const *values_wide) const
 {
-  int32_t id;
-  BzlaMemMgr *mm;
+  size_t mask = d_sigs.size() - 1;
 
-  id = bzla_node_get_id(exp);
-  mm = d_bzla->mm;
+  for (size_t pos = cand.hash & mask;; pos = (pos + 1) & mask)
+  {
+    uint32_t e = d_sigs[pos];
+    if (e == 0) return false;
+    if (equal_values(cand, values, values_wide, d_candidates[e - 1]))
+    {
+      return true;
+    }
+  }
+}
 
-  ++d_stats.num_checks;
+void
+TermSynthesizer::insert_signature(uint32_t idx)
+{
+  size_t mask;
 
-  if (bzla_node_is_bv_const(exp) || d_term_cache.find(id) != d_term_cache.end())
+  if (2 * (d_num_sigs + 1) > d_sigs.size())
   {
-    return false;
+    std::vector<uint32_t> sigs(2 * d_sigs.size(), 0);
+    mask = sigs.size() - 1;
+    for (uint32_t e : d_sigs)
+    {
+      if (e == 0) continue;
+      size_t pos = d_candidates[e - 1].hash & mask;
+      while (sigs[pos]) pos = (pos + 1) & mask;
+      sigs[pos] = e;
+    }
+    d_sigs.swap(sigs);
   }
 
-  auto [found_term, nmatches, sig] = check_signature(exp);
+  mask       = d_sigs.size() - 1;
+  size_t pos = d_candidates[idx].hash & mask;
+  while (d_sigs[pos]) pos = (pos + 1) & mask;
+  d_sigs[pos] = idx + 1;
+  ++d_num_sigs;
+}
+
+bool
+TermSynthesizer::matches_output(const Candidate &cand,
+                                const uint64_t *values,
+                                BzlaBitVector *const *values_wide) const
+{
+  size_t nmatches = 0, nvalues = d_values_in.size();
+
+  if (cand.is_const || cand.width != d_width_out)
+  {
+    return false;
+  }
 
-  // TODO: option for threshold
-  size_t nvalues = d_values_in.size();
-  if (nmatches / (double) nvalues >= 0.3)
+  if (cand.width <= 64)
+  {
+    for (size_t i = 0; i < nvalues; ++i)
+    {
+      nmatches += values[i] == d_packed_out[i];
+    }
+  }
+  else
   {
-    found_term = true;
+    for (size_t i = 0; i < nvalues; ++i)
+    {
+      nmatches += bzla_bv_compare(values_wide[i], d_values_out[i]) == 0;
+    }
   }
 
-  if (bzla_hashptr_table_get(sigs, sig))
+  return nmatches > 0
+         && (nmatches == nvalues
+             || nmatches / (double) nvalues >= MATCH_THRESHOLD);
+}
+
+bool
+TermSynthesizer::check_candidate(uint32_t cur_level, Candidate &cand, Op *op)
+{
+  bool found_term;
+  uint32_t idx;
+  BzlaMemMgr *mm = d_bzla->mm;
+
+  cand.hash = hash_values(cand, d_packed_buf.data(), d_wide_buf.data());
+
+  if (find_signature(cand, d_packed_buf.data(), d_wide_buf.data()))
   {
-    assert(!found_term);
-    bzla_bv_free_tuple(mm, sig);
+    if (cand.width > 64)
+    {
+      for (BzlaBitVector *bv : d_wide_buf) bzla_bv_free(mm, bv);
+    }
     return false;
   }
 
-  bzla_hashptr_table_add(sigs, sig);
-  d_term_cache.insert(id);
+  found_term = matches_output(cand, d_packed_buf.data(), d_wide_buf.data());
+
+  idx = d_candidates.size();
+  if (cand.width <= 64)
+  {
+    cand.values = d_packed.size();
+    d_packed.insert(d_packed.end(), d_packed_buf.begin(), d_packed_buf.end());
+  }
+  else
+  {
+    /* Ownership of the values is transferred to the value storage. */
+    cand.values = d_wide.size();
+    d_wide.insert(d_wide.end(), d_wide_buf.begin(), d_wide_buf.end());
+  }
+  d_candidates.push_back(cand);
+  insert_signature(idx);
 
   if (op) op->num_added++;
 
-  d_terms.add(exp, cur_level);
+  d_terms.add(idx, cand.sort, cand.arity, cur_level);
+
+  if (found_term)
+  {
+    d_found = idx;
+  }
   return found_term;
 }
 
+bool
+TermSynthesizer::check_leaf(BzlaNode *n, bool is_const)
+{
+  Candidate cand;
+  BzlaBitVector *bv;
+
+  cand.node     = n;
+  cand.op       = 0;
+  cand.arity    = 0;
+  cand.sort     = bzla_node_get_sort_id(n);
+  cand.width    = bzla_node_bv_get_width(d_bzla, n);
+  cand.is_const = is_const;
+
+  if (!is_const) ++d_stats.num_checks;
+
+  for (size_t i = 0; i < d_values_in.size(); ++i)
+  {
+    bv = eval_candidate(n, d_values_in[i]);
+    if (cand.width <= 64)
+    {
+      d_packed_buf[i] = bzla_bv_to_uint64(bv);
+      bzla_bv_free(d_bzla->mm, bv);
+    }
+    else
+    {
+      d_wide_buf[i] = bv;
+    }
+  }
+  return check_candidate(1, cand, 0);
+}
+
+void
+TermSynthesizer::init_op_candidate(Op ops[],
+                                   uint32_t op,
+                                   uint32_t a0,
+                                   uint32_t a1,
+                                   uint32_t a2,
+                                   Candidate &cand)
+{
+  cand.node     = nullptr;
+  cand.op       = op;
+  cand.arity    = ops[op].arity;
+  cand.args[0]  = a0;
+  cand.args[1]  = a1;
+  cand.args[2]  = a2;
+  cand.is_const = true;
+  for (uint32_t i = 0; i < cand.arity; ++i)
+  {
+    cand.is_const = cand.is_const && d_candidates[cand.args[i]].is_const;
+  }
+  /* Applications to identical arguments that the rewriter folds into
+   * constants, e.g., x - x or x < x. */
+  if (cand.arity == 2 && a0 == a1)
+  {
+    switch (ops[op].kind)
+    {
+      case OpKind::ULT:
+      case OpKind::SLT:
+      case OpKind::EQ:
+      case OpKind::SUB:
+      case OpKind::UREM:
+      case OpKind::SRL: cand.is_const = true; break;
+      default: break;
+    }
+  }
+
+  switch (ops[op].kind)
+  {
+    case OpKind::ULT:
+    case OpKind::SLT:
+    case OpKind::EQ:
+      cand.sort  = d_bool_sort;
+      cand.width = 1;
+      break;
+
+    case OpKind::ITE:
+      cand.sort  = d_candidates[a1].sort;
+      cand.width = d_candidates[a1].width;
+      break;
+
+    default:
+      cand.sort  = d_candidates[a0].sort;
+      cand.width = d_candidates[a0].width;
+  }
+}
+
+bool
+TermSynthesizer::check_op(uint32_t cur_level,
+                          Op ops[],
+                          uint32_t op,
+                          uint32_t a0,
+                          uint32_t a1,
+                          uint32_t a2)
+{
+  Candidate cand;
+
+  init_op_candidate(ops, op, a0, a1, a2, cand);
+
+  ++d_stats.num_checks;
+
+  /* Terms that are folded into constants by the rewriter are never
+   * considered. */
+  if (cand.is_const)
+  {
+    return false;
+  }
+
+  eval_op(ops[op].kind, cand, d_packed_buf.data(), d_wide_buf.data());
+  return check_candidate(cur_level, cand, &ops[op]);
+}
+
+BzlaNode *
+TermSynthesizer::materialize(Op ops[], uint32_t idx)
+{
+  assert(idx < d_candidates.size());
+
+  BzlaNode *args[3], *result;
+  const Candidate &cand = d_candidates[idx];
+
+  if (cand.node)
+  {
+    return bzla_node_copy(d_bzla, cand.node);
+  }
+
+  for (uint32_t i = 0; i < cand.arity; ++i)
+  {
+    args[i] = materialize(ops, cand.args[i]);
+  }
+
+  if (cand.arity == 1)
+  {
+    result = ops[cand.op].un(d_bzla, args[0]);
+  }
+  else if (cand.arity == 2)
+  {
+    result = ops[cand.op].bin(d_bzla, args[0], args[1]);
+  }
+  else
+  {
+    assert(cand.arity == 3);
+    result = ops[cand.op].ter(d_bzla, args[0], args[1], args[2]);
+  }
+
+  for (uint32_t i = 0; i < cand.arity; ++i)
+  {
+    bzla_node_release(d_bzla, args[i]);
+  }
+  return result;
+}
+
 static inline void
 report_stats(Bzla *bzla,
              double start,
@@ -451,29 +1214,361 @@ report_op_stats(Bzla *bzla, Op ops[], uint32_t nops)
   }
 }
 
-#define CHECK_DONE(exp)                                                    \
-  {                                                                        \
-    found_candidate = check_term(cur_level, exp, sigs, &ops[i]);           \
-    if (found_candidate)                                                   \
-    {                                                                      \
-      goto DONE;                                                           \
-    }                                                                      \
-    bzla_node_release(d_bzla, exp);                                        \
-    if (d_stats.num_checks % 10000 == 0)                                   \
-    {                                                                      \
-      report_stats(d_bzla, start, cur_level, d_stats.num_checks, d_terms); \
-    }                                                                      \
-    if (d_stats.num_checks % 1000 == 0 && bzla_terminate(d_bzla))          \
-    {                                                                      \
-      BZLA_MSG(d_bzla->msg, 1, "terminate");                               \
-      goto DONE;                                                           \
-    }                                                                      \
-    if (d_stats.num_checks >= max_checks)                                  \
-    {                                                                      \
-      BZLA_MSG(d_bzla->msg, 2, "Check limit of %u reached", max_checks);   \
-      goto DONE;                                                           \
-    }                                                                      \
+bool
+TermSynthesizer::check_next(uint32_t cur_level,
+                            Op ops[],
+                            uint32_t op,
+                            uint32_t a0,
+                            uint32_t a1,
+                            uint32_t a2,
+                            uint32_t max_checks,
+                            double start,
+                            bool &found)
+{
+  found = check_op(cur_level, ops, op, a0, a1, a2);
+  if (found)
+  {
+    return false;
+  }
+  if (d_stats.num_checks % 10000 == 0)
+  {
+    report_stats(d_bzla, start, cur_level, d_stats.num_checks, d_terms);
+  }
+  if (d_stats.num_checks % 1000 == 0 && bzla_terminate(d_bzla))
+  {
+    BZLA_MSG(d_bzla->msg, 1, "terminate");
+    return false;
+  }
+  if (d_stats.num_checks >= max_checks)
+  {
+    BZLA_MSG(d_bzla->msg, 2, "Check limit of %u reached", max_checks);
+    return false;
+  }
+  return true;
+}
+
+void
+TermSynthesizer::collect_items(uint32_t cur_level,
+                               Op ops[],
+                               uint32_t nops,
+                               std::vector<WorkItem> &items)
+{
+  /* Number of elements of the outermost argument list per work item. */
+  const size_t chunk_size = 16;
+
+  uint32_t *tuple;
+  BzlaPartitionGenerator pg;
+
+  auto add = [&](uint32_t op, uint32_t *levels, BzlaSortId sid, size_t n) {
+    for (size_t begin = 0; begin < n; begin += chunk_size)
+    {
+      WorkItem item;
+      item.op = op;
+      std::copy(levels, levels + ops[op].arity, item.levels);
+      item.sort  = sid;
+      item.begin = begin;
+      item.end   = std::min(n, begin + chunk_size);
+      items.push_back(item);
+    }
+  };
+
+  for (uint32_t i = 0; i < nops; i++)
+  {
+    // Apply unary operators to terms from previous level.
+    if (ops[i].arity == 1)
+    {
+      uint32_t level = cur_level - 1;
+      for (auto &[sid, terms] : d_terms.get(level))
+      {
+        add(i, &level, sid, terms.size());
+      }
+    }
+    else if (ops[i].arity == 2)
+    {
+      // partition generator: generates level partitions
+      bzla_init_part_gen(&pg, cur_level, 2, !ops[i].assoc);
+      while (bzla_has_next_part_gen(&pg))
+      {
+        tuple           = bzla_next_part_gen(&pg);
+        auto &term_map1 = d_terms.get(tuple[0]);
+        auto &term_map2 = d_terms.get(tuple[1]);
+
+        for (auto &[sid, terms1] : term_map1)
+        {
+          if (term_map2.find(sid) == term_map2.end())
+          {
+            // continue; // this is what should be done TODO: increase levels
+            break;  // this is what cart_prod implementation does
+          }
+          add(i, tuple, sid, terms1.size());
+        }
+      }
+    }
+    else if (cur_level > 2)
+    {
+      // Note: ITE only right now
+      assert(ops[i].arity == 3);
+      assert(ops[i].ter == bzla_exp_cond);
+
+      bzla_init_part_gen(&pg, cur_level, 3, true);
+      while (bzla_has_next_part_gen(&pg))
+      {
+        tuple           = bzla_next_part_gen(&pg);
+        auto &term_map1 = d_terms.get(tuple[0]);
+        auto &term_map2 = d_terms.get(tuple[1]);
+        auto &term_map3 = d_terms.get(tuple[2]);
+
+        // No Boolean term in level `tuple[0]`.
+        if (term_map1.find(d_bool_sort) == term_map1.end())
+        {
+          continue;
+        }
+
+        for (auto &[sid, terms2] : term_map2)
+        {
+          if (term_map3.find(sid) == term_map3.end())
+          {
+            // continue; // this is what should be done TODO: increase levels
+            break;  // this is what cart_prod implementation does
+          }
+          add(i, tuple, sid, terms2.size());
+        }
+      }
+    }
   }
+}
+
+template <typename F>
+bool
+TermSynthesizer::enumerate_item(Op ops[], const WorkItem &item, F check)
+{
+  if (ops[item.op].arity == 1)
+  {
+    auto &terms = d_terms.get(item.levels[0]).at(item.sort);
+    for (size_t k = item.begin; k < item.end; ++k)
+    {
+      if (!check(terms[k], 0, 0)) return false;
+    }
+  }
+  else if (ops[item.op].arity == 2)
+  {
+    auto &terms1 = d_terms.get(item.levels[0]).at(item.sort);
+    auto &terms2 = d_terms.get(item.levels[1]).at(item.sort);
+    for (size_t k = item.begin; k < item.end; ++k)
+    {
+      for (uint32_t t2 : terms2)
+      {
+        if (!check(terms1[k], t2, 0)) return false;
+      }
+    }
+  }
+  else
+  {
+    assert(ops[item.op].arity == 3);
+    auto &terms1 = d_terms.get(item.levels[0]).at(d_bool_sort);
+    auto &terms2 = d_terms.get(item.levels[1]).at(item.sort);
+    auto &terms3 = d_terms.get(item.levels[2]).at(item.sort);
+    for (size_t k = item.begin; k < item.end; ++k)
+    {
+      for (uint32_t t3 : terms3)
+      {
+        for (uint32_t t1 : terms1)
+        {
+          if (!check(t1, terms2[k], t3)) return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
+void
+TermSynthesizer::enumerate_worker(Op ops[], LevelState &state, bool main_thread)
+{
+  size_t i, n = d_values_in.size();
+  uint32_t op    = 0;
+  uint64_t order = 0, num_checks = 0;
+  std::vector<uint64_t> values(n);
+
+  auto check = [&](uint32_t a0, uint32_t a1, uint32_t a2) {
+    bool found;
+    size_t idx;
+    Candidate cand;
+
+    if (state.stop.load(std::memory_order_relaxed)) return false;
+    if (state.num_checks.fetch_add(1, std::memory_order_relaxed)
+        >= state.max_checks)
+    {
+      state.stop = true;
+      return false;
+    }
+    /* Only the main thread calls the termination callback. */
+    if (main_thread && ++num_checks % 1000 == 0 && bzla_terminate(d_bzla))
+    {
+      state.terminated = true;
+      state.stop       = true;
+      return false;
+    }
+
+    order += 1;
+    init_op_candidate(ops, op, a0, a1, a2, cand);
+    if (cand.is_const)
+    {
+      return true;
+    }
+
+    eval_op(ops[op].kind, cand, values.data(), nullptr);
+    cand.hash = hash_values(cand, values.data(), nullptr);
+    /* Candidates of previous levels are not modified while enumerating the
+     * current level and can be accessed without locking. */
+    if (find_signature(cand, values.data(), nullptr))
+    {
+      return true;
+    }
+    found = matches_output(cand, values.data(), nullptr);
+
+    std::lock_guard<std::mutex> lock(state.mutex);
+    auto range = state.pending_sigs.equal_range(cand.hash);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+      PendingCandidate &p = state.pending[it->second];
+      if (p.cand.sort == cand.sort
+          && std::equal(values.begin(), values.end(), p.values.get()))
+      {
+        /* Keep the candidate that comes first in sequential enumeration
+         * order, independent of thread scheduling. */
+        if (order < p.order)
+        {
+          p.cand  = cand;
+          p.order = order;
+        }
+        return true;
+      }
+    }
+    idx = state.pending.size();
+    state.pending.push_back({cand, order, std::make_unique<uint64_t[]>(n)});
+    std::copy(values.begin(), values.end(), state.pending.back().values.get());
+    state.pending_sigs.emplace(cand.hash, idx);
+    if (found)
+    {
+      if (state.found == SIZE_MAX || order < state.pending[state.found].order)
+      {
+        state.found = idx;
+      }
+      state.stop = true;
+      return false;
+    }
+    return true;
+  };
+
+  while (!state.stop.load(std::memory_order_relaxed)
+         && (i = state.next_item.fetch_add(1)) < state.items.size())
+  {
+    op    = state.items[i].op;
+    order = static_cast<uint64_t>(i) << 32;
+    if (!enumerate_item(ops, state.items[i], check)) break;
+  }
+}
+
+bool
+TermSynthesizer::enumerate_parallel(uint32_t cur_level,
+                                    Op ops[],
+                                    std::vector<WorkItem> &items,
+                                    uint32_t max_checks,
+                                    double start,
+                                    bool &stop)
+{
+  bool found = false;
+  size_t n   = d_values_in.size();
+  uint32_t idx;
+  LevelState state;
+  std::vector<WorkItem> items_wide;
+  std::vector<std::thread> workers;
+  std::vector<size_t> pending;
+
+  /* Values of bit-vectors with more than 64 bits are allocated via the memory
+   * manager, which is not thread-safe. Work items over these sorts are
+   * enumerated sequentially after the parallel phase. */
+  for (const WorkItem &item : items)
+  {
+    if (bzla_sort_bv_get_width(d_bzla, item.sort) > 64)
+    {
+      items_wide.push_back(item);
+    }
+    else
+    {
+      state.items.push_back(item);
+    }
+  }
+  state.num_checks = d_stats.num_checks;
+  state.max_checks = max_checks;
+
+  for (uint32_t i = 1; i < d_num_threads; ++i)
+  {
+    workers.emplace_back(
+        [this, ops, &state]() { enumerate_worker(ops, state, false); });
+  }
+  enumerate_worker(ops, state, true);
+  for (std::thread &t : workers)
+  {
+    t.join();
+  }
+
+  d_stats.num_checks = std::min<uint64_t>(state.num_checks, max_checks);
+
+  /* Commit new candidates in sequential enumeration order. */
+  pending.resize(state.pending.size());
+  std::iota(pending.begin(), pending.end(), 0);
+  std::sort(pending.begin(), pending.end(), [&state](size_t i, size_t j) {
+    return state.pending[i].order < state.pending[j].order;
+  });
+  for (size_t i : pending)
+  {
+    PendingCandidate &p = state.pending[i];
+    idx                 = d_candidates.size();
+    p.cand.values       = d_packed.size();
+    d_packed.insert(d_packed.end(), p.values.get(), p.values.get() + n);
+    d_candidates.push_back(p.cand);
+    insert_signature(idx);
+    ops[p.cand.op].num_added++;
+    d_terms.add(idx, p.cand.sort, p.cand.arity, cur_level);
+    if (i == state.found)
+    {
+      d_found = idx;
+    }
+  }
+
+  if (state.found != SIZE_MAX)
+  {
+    return true;
+  }
+  if (state.terminated)
+  {
+    BZLA_MSG(d_bzla->msg, 1, "terminate");
+    stop = true;
+    return false;
+  }
+  if (d_stats.num_checks >= max_checks)
+  {
+    BZLA_MSG(d_bzla->msg, 2, "Check limit of %u reached", max_checks);
+    stop = true;
+    return false;
+  }
+
+  for (const WorkItem &item : items_wide)
+  {
+    auto check = [&](uint32_t a0, uint32_t a1, uint32_t a2) {
+      return check_next(
+          cur_level, ops, item.op, a0, a1, a2, max_checks, start, found);
+    };
+    if (!enumerate_item(ops, item, check))
+    {
+      stop = true;
+      return found;
+    }
+  }
+  return false;
+}
 
 BzlaNode *
 TermSynthesizer::synthesize_terms(Op ops[],
@@ -486,33 +1581,26 @@ TermSynthesizer::synthesize_terms(Op ops[],
   assert(nops > 0);
 
   double start;
-  bool found_candidate = false, equal;
-  uint32_t i, *tuple, cur_level = 1;
-  BzlaNode *exp, *result = 0;
-  BzlaPtrHashTable *sigs;
-  BzlaMemMgr *mm;
-  BzlaPartitionGenerator pg;
-  BzlaPtrHashTableIterator it;
-  BzlaSortId bool_sort;
+  bool found_candidate = false, stop = false, equal;
+  uint32_t cur_level = 1;
+  BzlaNode *result   = 0;
+  std::vector<WorkItem> items;
 
-  start     = bzla_util_time_stamp();
-  mm        = d_bzla->mm;
-  bool_sort = bzla_sort_bool(d_bzla);
-  sigs      = bzla_hashptr_table_new(
-      mm, (BzlaHashPtr) bzla_bv_hash_tuple, (BzlaCmpPtr) bzla_bv_compare_tuple);
+  start       = bzla_util_time_stamp();
+  d_bool_sort = bzla_sort_bool(d_bzla);
 
   /* generate target signature */
   // Note: currently unused
   if (prev_synth)
   {
-    found_candidate = check_term(cur_level, prev_synth, sigs, 0);
+    found_candidate =
+        check_leaf(prev_synth, bzla_node_is_bv_const(prev_synth));
     if (d_stats.num_checks % 10000 == 0)
     {
       report_stats(d_bzla, start, cur_level, d_stats.num_checks, d_terms);
     }
     if (found_candidate)
     {
-      exp = bzla_node_copy(d_bzla, prev_synth);
       BZLA_MSG(d_bzla->msg, 2, "previously synthesized term matches");
       goto DONE;
     }
@@ -521,14 +1609,13 @@ TermSynthesizer::synthesize_terms(Op ops[],
   // Check if any of the inputs matches the output values.
   for (BzlaNode *t : d_inputs)
   {
-    found_candidate = check_term(cur_level, t, sigs, 0);
+    found_candidate = check_leaf(t, false);
     if (d_stats.num_checks % 10000 == 0)
     {
       report_stats(d_bzla, start, cur_level, d_stats.num_checks, d_terms);
     }
     if (found_candidate)
     {
-      exp = bzla_node_copy(d_bzla, t);
       goto DONE;
     }
   }
@@ -546,15 +1633,14 @@ TermSynthesizer::synthesize_terms(Op ops[],
   if (equal)
   {
     found_candidate = true;
-    exp             = bzla_exp_bv_const(d_bzla, d_values_out[0]);
-    d_terms.add(exp, 1);
+    result          = bzla_exp_bv_const(d_bzla, d_values_out[0]);
     goto DONE;
   }
 
   // Add provided constants to level 1.
   for (auto c : d_consts)
   {
-    d_terms.add(c, 1);
+    check_leaf(c, true);
   }
 
   // Enumerate terms of size 2+
@@ -562,94 +1648,38 @@ TermSynthesizer::synthesize_terms(Op ops[],
   {
     /* initialize current level */
     report_stats(d_bzla, start, cur_level, d_stats.num_checks, d_terms);
+    d_terms.init_level(cur_level);
 
     size_t num_added = d_terms.size();
-    for (i = 0; i < nops; i++)
+    items.clear();
+    collect_items(cur_level, ops, nops, items);
+    if (d_num_threads > 1)
     {
-      // Apply unary operators to terms from previous level.
-      if (ops[i].arity == 1)
-      {
-        auto &term_map = d_terms.get(cur_level - 1);
-        for (auto &[sid, terms] : term_map)
-        {
-          for (BzlaNode *t : terms)
-          {
-            exp = ops[i].un(d_bzla, t);
-            CHECK_DONE(exp);
-          }
-        }
-      }
-      else if (ops[i].arity == 2)
+      found_candidate =
+          enumerate_parallel(cur_level, ops, items, max_checks, start, stop);
+      if (found_candidate || stop)
       {
-        // partition generator: generates level partitions
-        bzla_init_part_gen(&pg, cur_level, 2, !ops[i].assoc);
-        while (bzla_has_next_part_gen(&pg))
-        {
-          tuple           = bzla_next_part_gen(&pg);
-          auto &term_map1 = d_terms.get(tuple[0]);
-          auto &term_map2 = d_terms.get(tuple[1]);
-
-          for (auto [sid, terms1] : term_map1)
-          {
-            auto it2 = term_map2.find(sid);
-            if (it2 == term_map2.end())
-            {
-              // continue; // this is what should be done TODO: increase levels
-              break;  // this is what cart_prod implementation does
-            }
-
-            for (auto t1 : terms1)
-            {
-              for (auto t2 : it2->second)
-              {
-                exp = ops[i].bin(d_bzla, t1, t2);
-                CHECK_DONE(exp);
-              }
-            }
-          }
-        }
+        goto DONE;
       }
-      else if (cur_level > 2)
+    }
+    else
+    {
+      for (const WorkItem &item : items)
       {
-        // Note: ITE only right now
-        assert(ops[i].arity == 3);
-        assert(ops[i].ter == bzla_exp_cond);
-
-        bzla_init_part_gen(&pg, cur_level, 3, true);
-        while (bzla_has_next_part_gen(&pg))
+        auto check = [&](uint32_t a0, uint32_t a1, uint32_t a2) {
+          return check_next(cur_level,
+                            ops,
+                            item.op,
+                            a0,
+                            a1,
+                            a2,
+                            max_checks,
+                            start,
+                            found_candidate);
+        };
+        if (!enumerate_item(ops, item, check))
         {
-          tuple   = bzla_next_part_gen(&pg);
-          auto &term_map1 = d_terms.get(tuple[0]);
-          auto &term_map2 = d_terms.get(tuple[1]);
-          auto &term_map3 = d_terms.get(tuple[2]);
-
-          // No Boolean term in level `tuple[0]`.
-          auto it1 = term_map1.find(bool_sort);
-          if (it1 == term_map1.end())
-          {
-            continue;
-          }
-
-          for (auto [sid, terms2] : term_map2)
-          {
-            auto it3 = term_map3.find(sid);
-            if (it3 == term_map3.end())
-            {
-              // continue; // this is what should be done TODO: increase levels
-              break;  // this is what cart_prod implementation does
-            }
-            for (auto t2 : terms2)
-            {
-              for (auto t3 : it3->second)
-              {
-                for (auto t1 : it1->second)
-                {
-                  exp = ops[i].ter(d_bzla, t1, t2, t3);
-                  CHECK_DONE(exp);
-                }
-              }
-            }
-          }
+          goto DONE;
         }
       }
     }
@@ -663,7 +1693,11 @@ DONE:
 
   if (found_candidate)
   {
-    result = exp;
+    // Only the matching candidate is constructed as a node.
+    if (!result)
+    {
+      result = materialize(ops, d_found);
+    }
   }
   else
   {
@@ -695,14 +1729,7 @@ DONE:
     BZLA_MSG(d_bzla->msg, 2, "no candidate found");
   }
 
-  bzla_iter_hashptr_init(&it, sigs);
-  while (bzla_iter_hashptr_has_next(&it))
-    bzla_bv_free_tuple(
-        mm, static_cast<BzlaBitVectorTuple *>(bzla_iter_hashptr_next(&it)));
-
-  bzla_hashptr_table_delete(sigs);
-
-  bzla_sort_release(d_bzla, bool_sort);
+  bzla_sort_release(d_bzla, d_bool_sort);
   return result;
 }
 
@@ -716,34 +1743,37 @@ DONE:
     i += 1;                         \
   }
 
-#define INIT_OP_UN(ARITY, ASSOC, FPTR) \
-  {                                    \
-    ops[i].arity     = ARITY;          \
-    ops[i].assoc     = ASSOC;          \
-    ops[i].un        = FPTR;           \
-    ops[i].num_added = 0;              \
-    ops[i].name      = #FPTR;          \
-    i += 1;                            \
+#define INIT_OP_UN(ARITY, ASSOC, FPTR, KIND) \
+  {                                          \
+    ops[i].arity     = ARITY;                \
+    ops[i].assoc     = ASSOC;                \
+    ops[i].kind      = OpKind::KIND;         \
+    ops[i].un        = FPTR;                 \
+    ops[i].num_added = 0;                    \
+    ops[i].name      = #FPTR;                \
+    i += 1;                                  \
   }
 
-#define INIT_OP_BIN(ARITY, ASSOC, FPTR) \
-  {                                     \
-    ops[i].arity     = ARITY;           \
-    ops[i].assoc     = ASSOC;           \
-    ops[i].bin       = FPTR;            \
-    ops[i].num_added = 0;               \
-    ops[i].name      = #FPTR;           \
-    i += 1;                             \
+#define INIT_OP_BIN(ARITY, ASSOC, FPTR, KIND) \
+  {                                           \
+    ops[i].arity     = ARITY;                 \
+    ops[i].assoc     = ASSOC;                 \
+    ops[i].kind      = OpKind::KIND;          \
+    ops[i].bin       = FPTR;                  \
+    ops[i].num_added = 0;                     \
+    ops[i].name      = #FPTR;                 \
+    i += 1;                                   \
   }
 
-#define INIT_OP_TER(ARITY, ASSOC, FPTR) \
-  {                                     \
-    ops[i].arity     = ARITY;           \
-    ops[i].assoc     = ASSOC;           \
-    ops[i].ter       = FPTR;            \
-    ops[i].num_added = 0;               \
-    ops[i].name      = #FPTR;           \
-    i += 1;                             \
+#define INIT_OP_TER(ARITY, ASSOC, FPTR, KIND) \
+  {                                           \
+    ops[i].arity     = ARITY;                 \
+    ops[i].assoc     = ASSOC;                 \
+    ops[i].kind      = OpKind::KIND;          \
+    ops[i].ter       = FPTR;                  \
+    ops[i].num_added = 0;                     \
+    ops[i].name      = #FPTR;                 \
+    i += 1;                                   \
   }
 
 static uint32_t
@@ -751,7 +1781,7 @@ init_ops(Bzla *bzla, Op *ops)
 {
   uint32_t i = 0;
 
-  INIT_OP_UN(1, false, bzla_exp_bv_not);
+  INIT_OP_UN(1, false, bzla_exp_bv_not, NOT);
   //  INIT_OP (1, false, bzla_neg_exp);
   //  INIT_OP (1, false, bzla_redor_exp);
   //  INIT_OP (1, false, bzla_redxor_exp);
@@ -760,39 +1790,39 @@ init_ops(Bzla *bzla, Op *ops)
   //  INIT_OP (1, false, bzla_dec_exp);
 
   /* boolean ops */
-  INIT_OP_BIN(2, false, bzla_exp_bv_ult);
-  INIT_OP_BIN(2, false, bzla_exp_bv_slt);
-  INIT_OP_BIN(2, true, bzla_exp_eq);
+  INIT_OP_BIN(2, false, bzla_exp_bv_ult, ULT);
+  INIT_OP_BIN(2, false, bzla_exp_bv_slt, SLT);
+  INIT_OP_BIN(2, true, bzla_exp_eq, EQ);
 
   /* bv ops */
   if (bzla->ops[BZLA_BV_AND_NODE].cur > 0)
   {
-    INIT_OP_BIN(2, true, bzla_exp_bv_and);
+    INIT_OP_BIN(2, true, bzla_exp_bv_and, AND);
   }
   if (bzla->ops[BZLA_BV_ADD_NODE].cur > 0)
   {
-    INIT_OP_BIN(2, true, bzla_exp_bv_add);
-    INIT_OP_BIN(2, false, bzla_exp_bv_sub);
+    INIT_OP_BIN(2, true, bzla_exp_bv_add, ADD);
+    INIT_OP_BIN(2, false, bzla_exp_bv_sub, SUB);
   }
   if (bzla->ops[BZLA_BV_MUL_NODE].cur > 0)
   {
-    INIT_OP_BIN(2, true, bzla_exp_bv_mul);
+    INIT_OP_BIN(2, true, bzla_exp_bv_mul, MUL);
   }
   if (bzla->ops[BZLA_BV_UDIV_NODE].cur > 0)
   {
-    INIT_OP_BIN(2, false, bzla_exp_bv_udiv);
-    INIT_OP_BIN(2, false, bzla_exp_bv_sdiv);
+    INIT_OP_BIN(2, false, bzla_exp_bv_udiv, UDIV);
+    INIT_OP_BIN(2, false, bzla_exp_bv_sdiv, SDIV);
   }
   if (bzla->ops[BZLA_BV_UREM_NODE].cur > 0)
   {
-    INIT_OP_BIN(2, false, bzla_exp_bv_urem);
-    INIT_OP_BIN(2, false, bzla_exp_bv_srem);
-    INIT_OP_BIN(2, false, bzla_exp_bv_smod);
+    INIT_OP_BIN(2, false, bzla_exp_bv_urem, UREM);
+    INIT_OP_BIN(2, false, bzla_exp_bv_srem, SREM);
+    INIT_OP_BIN(2, false, bzla_exp_bv_smod, SMOD);
   }
 
-  INIT_OP_BIN(2, false, bzla_exp_bv_sll);
-  INIT_OP_BIN(2, false, bzla_exp_bv_sra);
-  INIT_OP_BIN(2, false, bzla_exp_bv_srl);
+  INIT_OP_BIN(2, false, bzla_exp_bv_sll, SLL);
+  INIT_OP_BIN(2, false, bzla_exp_bv_sra, SRA);
+  INIT_OP_BIN(2, false, bzla_exp_bv_srl, SRL);
 #if 0
   INIT_OP (2, true,  bzla_ne_exp);
   INIT_OP (2, true,  bzla_xor_exp);
@@ -821,7 +1851,7 @@ init_ops(Bzla *bzla, Op *ops)
   INIT_OP (2, false, bzla_exp_bv_smod);
   INIT_OP (2, false, bzla_concat_exp);
 #endif
-  INIT_OP_TER(3, false, bzla_exp_cond);
+  INIT_OP_TER(3, false, bzla_exp_cond, ITE);
   return i;
 }
 
@@ -844,7 +1874,12 @@ bzla_synthesize_term(Bzla *bzla,
   nops = init_ops(bzla, ops);
   assert(nops);
 
-  TermSynthesizer sy(bzla, params, value_in, value_out, consts);
+  TermSynthesizer sy(bzla,
+                     params,
+                     value_in,
+                     value_out,
+                     consts,
+                     bzla_opt_get(bzla, BZLA_OPT_QUANT_SYNTH_N_THREADS));
 
   result = sy.synthesize_terms(ops, nops, max_checks, max_level, prev_synth);
 
@@ -18,10 +18,15 @@
 #include "bzlatypes.h"
 #include "utils/bzlahashint.h"
 #include "utils/bzlamem.h"
+#include "utils/bzlastack.h"
 #include "utils/bzlautil.h"
 
 /*------------------------------------------------------------------------*/
 
+BZLA_DECLARE_STACK(BitwuzlaTermConstPtr, const BitwuzlaTerm *);
+
+/*------------------------------------------------------------------------*/
+
 void bitwuzla_set_bzla_id(Bitwuzla *bitwuzla,
                           const BitwuzlaTerm *term,
                           int32_t id);
@@ -36,6 +41,15 @@ struct BzlaBTOR2Parser
   char *error;
   const char *infile_name;
   Btor2Parser *bfr;
+  /* Sequential model, checked via bounded model checking. States and inputs
+   * are the constants of the current frame, 'inits' and 'nexts' are indexed
+   * by state (0 if not given). */
+  BitwuzlaTermConstPtrStack states;
+  BitwuzlaTermConstPtrStack inits;
+  BitwuzlaTermConstPtrStack nexts;
+  BitwuzlaTermConstPtrStack inputs;
+  BitwuzlaTermConstPtrStack constraints;
+  BitwuzlaTermConstPtrStack bads;
 };
 
 typedef struct BzlaBTOR2Parser BzlaBTOR2Parser;
@@ -76,6 +90,13 @@ new_btor2_parser(Bitwuzla *bitwuzla)
   res->bitwuzla = bitwuzla;
   res->bfr      = btor2parser_new();
 
+  BZLA_INIT_STACK(mm, res->states);
+  BZLA_INIT_STACK(mm, res->inits);
+  BZLA_INIT_STACK(mm, res->nexts);
+  BZLA_INIT_STACK(mm, res->inputs);
+  BZLA_INIT_STACK(mm, res->constraints);
+  BZLA_INIT_STACK(mm, res->bads);
+
   return res;
 }
 
@@ -86,11 +107,318 @@ delete_btor2_parser(BzlaBTOR2Parser *parser)
 
   mm = parser->mm;
   btor2parser_delete(parser->bfr);
+  BZLA_RELEASE_STACK(parser->states);
+  BZLA_RELEASE_STACK(parser->inits);
+  BZLA_RELEASE_STACK(parser->nexts);
+  BZLA_RELEASE_STACK(parser->inputs);
+  BZLA_RELEASE_STACK(parser->constraints);
+  BZLA_RELEASE_STACK(parser->bads);
   bzla_mem_freestr(mm, parser->error);
   BZLA_DELETE(mm, parser);
   bzla_mem_mgr_delete(mm);
 }
 
+/*------------------------------------------------------------------------*/
+
+static const BitwuzlaTerm *
+mk_frame_const(BzlaBTOR2Parser *parser, const BitwuzlaTerm *term, uint32_t k)
+{
+  size_t len;
+  char *buf;
+  const char *symbol;
+  const BitwuzlaTerm *res;
+
+  symbol = bitwuzla_term_get_symbol(term);
+  if (!symbol)
+  {
+    return bitwuzla_mk_const(
+        parser->bitwuzla, bitwuzla_term_get_sort(term), 0);
+  }
+  len = strlen(symbol) + 12;
+  BZLA_NEWN(parser->mm, buf, len);
+  sprintf(buf, "%s@%u", symbol, k);
+  res = bitwuzla_mk_const(parser->bitwuzla, bitwuzla_term_get_sort(term), buf);
+  BZLA_DELETEN(parser->mm, buf, len);
+  return res;
+}
+
+/* Print the assignment of the frame constant 'term' of the state or input
+ * 'key' with index 'idx'. Assignments are labeled with the symbol of 'key',
+ * not with the frame-specific symbol of 'term'. */
+static void
+print_witness_assignment(BzlaBTOR2Parser *parser,
+                         FILE *outfile,
+                         uint32_t idx,
+                         const BitwuzlaTerm *key,
+                         const BitwuzlaTerm *term)
+{
+  size_t i, size;
+  char *index;
+  const char *symbol;
+  const BitwuzlaTerm **indices, **values, *default_value;
+
+  Bitwuzla *bitwuzla = parser->bitwuzla;
+
+  symbol = bitwuzla_term_get_symbol(key);
+  if (bitwuzla_term_is_array(term))
+  {
+    bitwuzla_get_array_value(
+        bitwuzla, term, &indices, &values, &size, &default_value);
+    for (i = 0; i < size; i++)
+    {
+      /* returned string is only valid until the next value query */
+      index = bzla_mem_strdup(parser->mm,
+                              bitwuzla_get_bv_value(bitwuzla, indices[i]));
+      fprintf(outfile,
+              "%u [%s] %s",
+              idx,
+              index,
+              bitwuzla_get_bv_value(bitwuzla, values[i]));
+      bzla_mem_freestr(parser->mm, index);
+      if (symbol) fprintf(outfile, " %s", symbol);
+      fputc('\n', outfile);
+    }
+  }
+  else
+  {
+    fprintf(outfile, "%u %s", idx, bitwuzla_get_bv_value(bitwuzla, term));
+    if (symbol) fprintf(outfile, " %s", symbol);
+    fputc('\n', outfile);
+  }
+}
+
+/* Print BTOR2 witness for a bad state reached at bound 'k'. 'frames' holds
+ * the state and input constants of frames 0 to 'k', 'bads' the bad state
+ * properties at frame 'k'. */
+static void
+print_witness(BzlaBTOR2Parser *parser,
+              FILE *outfile,
+              uint32_t k,
+              const BitwuzlaTerm **frames,
+              const BitwuzlaTerm **bads)
+{
+  uint32_t i, j, nstates, ninputs, nbads, nkeys;
+  bool first;
+
+  nstates = BZLA_COUNT_STACK(parser->states);
+  ninputs = BZLA_COUNT_STACK(parser->inputs);
+  nbads   = BZLA_COUNT_STACK(parser->bads);
+  nkeys   = nstates + ninputs;
+
+  fputs("sat\n", outfile);
+  for (i = 0, first = true; i < nbads; i++)
+  {
+    if (strcmp(bitwuzla_get_bv_value(parser->bitwuzla, bads[i]), "1")) continue;
+    fprintf(outfile, "%sb%u", first ? "" : " ", i);
+    first = false;
+  }
+  fputc('\n', outfile);
+  for (j = 0; j <= k; j++)
+  {
+    /* states without next function are unconstrained in every frame */
+    for (i = 0, first = true; i < nstates; i++)
+    {
+      if (j > 0 && BZLA_PEEK_STACK(parser->nexts, i)) continue;
+      if (first) fprintf(outfile, "#%u\n", j);
+      print_witness_assignment(parser,
+                               outfile,
+                               i,
+                               BZLA_PEEK_STACK(parser->states, i),
+                               frames[j * nkeys + i]);
+      first = false;
+    }
+    fprintf(outfile, "@%u\n", j);
+    for (i = 0; i < ninputs; i++)
+    {
+      print_witness_assignment(parser,
+                               outfile,
+                               i,
+                               BZLA_PEEK_STACK(parser->inputs, i),
+                               frames[j * nkeys + nstates + i]);
+    }
+  }
+  fputs(".\n", outfile);
+}
+
+/* Incremental bounded model checking of the sequential model collected while
+ * parsing. The model is unrolled frame by frame via substituting the state
+ * and input constants of the model with fresh constants of the current frame.
+ * The bad state properties of each frame are checked under assumptions, hence
+ * the frames asserted so far (and their bit-blasted encoding) are reused
+ * across bounds. */
+static void
+bmc_btor2_parser(BzlaBTOR2Parser *parser, FILE *outfile, BzlaParseResult *res)
+{
+  uint32_t i, j, k, kmax, nstates, ninputs, nbads, nkeys;
+  const BitwuzlaTerm *state, *prop, **keys;
+  BitwuzlaTermConstPtrStack frames, terms, next_values;
+  BitwuzlaResult result;
+  BzlaMsg *msg;
+
+  Bitwuzla *bitwuzla = parser->bitwuzla;
+  BzlaMemMgr *mm     = parser->mm;
+
+  msg     = bitwuzla_get_bzla_msg(bitwuzla);
+  kmax    = bitwuzla_get_option(bitwuzla, BITWUZLA_OPT_BMC_KMAX);
+  nstates = BZLA_COUNT_STACK(parser->states);
+  ninputs = BZLA_COUNT_STACK(parser->inputs);
+  nbads   = BZLA_COUNT_STACK(parser->bads);
+  nkeys   = nstates + ninputs;
+  result  = BITWUZLA_UNSAT;
+
+  BZLA_MSG(msg,
+           1,
+           "found %u states, %u inputs, %u bad state properties",
+           nstates,
+           ninputs,
+           nbads);
+
+  BZLA_NEWN(mm, keys, nkeys ? nkeys : 1);
+  for (i = 0; i < nstates; i++) keys[i] = BZLA_PEEK_STACK(parser->states, i);
+  for (i = 0; i < ninputs; i++)
+  {
+    keys[nstates + i] = BZLA_PEEK_STACK(parser->inputs, i);
+  }
+
+  BZLA_INIT_STACK(mm, frames);
+  BZLA_INIT_STACK(mm, terms);
+  BZLA_INIT_STACK(mm, next_values);
+
+  for (k = 0; nbads > 0 && k <= kmax; k++)
+  {
+    BZLA_MSG(msg, 1, "checking bound %u", k);
+
+    /* instantiate states and inputs of frame k */
+    for (i = 0; i < nstates; i++)
+    {
+      state = mk_frame_const(parser, keys[i], k);
+      BZLA_PUSH_STACK(frames, state);
+      if (k > 0 && BZLA_PEEK_STACK(next_values, i))
+      {
+        bitwuzla_assert(bitwuzla,
+                        bitwuzla_mk_term2(bitwuzla,
+                                          BITWUZLA_KIND_EQUAL,
+                                          state,
+                                          BZLA_PEEK_STACK(next_values, i)));
+      }
+    }
+    for (i = 0; i < ninputs; i++)
+    {
+      BZLA_PUSH_STACK(frames, mk_frame_const(parser, keys[nstates + i], k));
+    }
+
+    /* instantiate inits (first frame only), nexts, constraints and bad state
+     * properties of frame k */
+    BZLA_RESET_STACK(terms);
+    for (i = 0; k == 0 && i < nstates; i++)
+    {
+      if (!BZLA_PEEK_STACK(parser->inits, i)) continue;
+      BZLA_PUSH_STACK(terms, BZLA_PEEK_STACK(parser->inits, i));
+    }
+    for (i = 0; i < nstates; i++)
+    {
+      if (!BZLA_PEEK_STACK(parser->nexts, i)) continue;
+      BZLA_PUSH_STACK(terms, BZLA_PEEK_STACK(parser->nexts, i));
+    }
+    for (i = 0; i < BZLA_COUNT_STACK(parser->constraints); i++)
+    {
+      BZLA_PUSH_STACK(terms, BZLA_PEEK_STACK(parser->constraints, i));
+    }
+    for (i = 0; i < nbads; i++)
+    {
+      BZLA_PUSH_STACK(terms, BZLA_PEEK_STACK(parser->bads, i));
+    }
+    if (nkeys)
+    {
+      bitwuzla_substitute_terms(bitwuzla,
+                                BZLA_COUNT_STACK(terms),
+                                terms.start,
+                                nkeys,
+                                keys,
+                                frames.start + k * nkeys);
+    }
+
+    j = 0;
+    for (i = 0; k == 0 && i < nstates; i++)
+    {
+      if (!BZLA_PEEK_STACK(parser->inits, i)) continue;
+      bitwuzla_assert(bitwuzla,
+                      bitwuzla_mk_term2(bitwuzla,
+                                        BITWUZLA_KIND_EQUAL,
+                                        BZLA_PEEK_STACK(frames, i),
+                                        BZLA_PEEK_STACK(terms, j)));
+      j += 1;
+    }
+    BZLA_RESET_STACK(next_values);
+    for (i = 0; i < nstates; i++)
+    {
+      if (!BZLA_PEEK_STACK(parser->nexts, i))
+      {
+        BZLA_PUSH_STACK(next_values, 0);
+        continue;
+      }
+      BZLA_PUSH_STACK(next_values, BZLA_PEEK_STACK(terms, j));
+      j += 1;
+    }
+    for (i = 0; i < BZLA_COUNT_STACK(parser->constraints); i++)
+    {
+      bitwuzla_assert(bitwuzla, BZLA_PEEK_STACK(terms, j));
+      j += 1;
+    }
+    assert(j + nbads == BZLA_COUNT_STACK(terms));
+
+    /* check if any bad state is reachable at bound k */
+    prop = BZLA_PEEK_STACK(terms, j);
+    for (i = 1; i < nbads; i++)
+    {
+      prop = bitwuzla_mk_term2(
+          bitwuzla, BITWUZLA_KIND_BV_OR, prop, BZLA_PEEK_STACK(terms, j + i));
+    }
+    bitwuzla_assume(bitwuzla, prop);
+    result = bitwuzla_check_sat(bitwuzla);
+    res->nsatcalls += 1;
+
+    if (result == BITWUZLA_SAT)
+    {
+      BZLA_MSG(msg, 1, "bad state reachable at bound %u", k);
+      print_witness(parser, outfile, k, frames.start, terms.start + j);
+      break;
+    }
+    if (result != BITWUZLA_UNSAT)
+    {
+      BZLA_MSG(msg, 1, "unknown result at bound %u", k);
+      break;
+    }
+  }
+
+  /* without bad state properties the model is trivially safe, otherwise bad
+   * states may still be reachable at bounds greater than kmax */
+  if (result == BITWUZLA_UNSAT && nbads > 0)
+  {
+    BZLA_MSG(msg,
+             1,
+             "no bad state reachable up to bound %u, bmc-kmax reached",
+             kmax);
+    result = BITWUZLA_UNKNOWN;
+  }
+
+  if (result == BITWUZLA_UNSAT)
+  {
+    fputs("unsat\n", outfile);
+  }
+  else if (result == BITWUZLA_UNKNOWN)
+  {
+    fputs("unknown\n", outfile);
+  }
+  fflush(outfile);
+  res->result = result;
+
+  BZLA_DELETEN(mm, keys, nkeys ? nkeys : 1);
+  BZLA_RELEASE_STACK(frames);
+  BZLA_RELEASE_STACK(terms);
+  BZLA_RELEASE_STACK(next_values);
+}
+
 static const char *
 parse_btor2_parser(BzlaBTOR2Parser *parser,
                    BzlaIntStack *prefix,
@@ -103,15 +431,17 @@ parse_btor2_parser(BzlaBTOR2Parser *parser,
   assert(infile);
   assert(infile_name);
   (void) prefix;
-  (void) outfile;
 
+  bool bmc;
   uint32_t i;
   int64_t j, signed_arg, unsigned_arg;
   Btor2LineIterator lit;
   Btor2Line *line;
   BzlaIntHashTable *sortmap;
   BzlaIntHashTable *nodemap;
+  BzlaIntHashTable *statemap;
   BzlaIntHashTableIterator it;
+  BitwuzlaTermConstPtrStack *stack;
   const BitwuzlaTerm *e[3], *term, *tmp;
   const BitwuzlaSort *sort, *sort_index, *sort_elem;
   BzlaMemMgr *mm;
@@ -127,8 +457,10 @@ parse_btor2_parser(BzlaBTOR2Parser *parser,
 
   mm = parser->mm;
 
-  nodemap = 0;
-  sortmap = 0;
+  nodemap  = 0;
+  sortmap  = 0;
+  statemap = 0;
+  bmc      = false;
 
   parser->infile_name = infile_name;
 
@@ -147,8 +479,45 @@ parse_btor2_parser(BzlaBTOR2Parser *parser,
     goto DONE;
   }
 
-  sortmap = bzla_hashint_map_new(mm);
-  nodemap = bzla_hashint_map_new(mm);
+  /* sequential models are checked via bounded model checking */
+  lit = btor2parser_iter_init(parser->bfr);
+  while ((line = btor2parser_iter_next(&lit)))
+  {
+    if (line->tag == BTOR2_TAG_justice || line->tag == BTOR2_TAG_fair)
+    {
+      perr_btor2(parser,
+                 line->id,
+                 "justice and fairness properties not supported by bitwuzla, "
+                 "try btormc instead");
+      goto DONE;
+    }
+    if (line->tag == BTOR2_TAG_bad || line->tag == BTOR2_TAG_init
+        || line->tag == BTOR2_TAG_next || line->tag == BTOR2_TAG_state)
+    {
+      bmc = true;
+    }
+  }
+  if (bmc)
+  {
+    if (bitwuzla_get_option(bitwuzla,
+                            BITWUZLA_OPT_PP_UNCONSTRAINED_OPTIMIZATION))
+    {
+      perr_btor2(parser,
+                 0,
+                 "unconstrained optimization not supported for model "
+                 "checking");
+      goto DONE;
+    }
+    bitwuzla_set_option(bitwuzla, BITWUZLA_OPT_INCREMENTAL, 1);
+    if (!bitwuzla_get_option(bitwuzla, BITWUZLA_OPT_PRODUCE_MODELS))
+    {
+      bitwuzla_set_option(bitwuzla, BITWUZLA_OPT_PRODUCE_MODELS, 1);
+    }
+  }
+
+  sortmap  = bzla_hashint_map_new(mm);
+  nodemap  = bzla_hashint_map_new(mm);
+  statemap = bzla_hashint_map_new(mm);
 
   lit = btor2parser_iter_init(parser->bfr);
   while ((line = btor2parser_iter_next(&lit)))
@@ -214,6 +583,17 @@ parse_btor2_parser(BzlaBTOR2Parser *parser,
         term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_AND, e[0], e[1]);
         break;
 
+      case BTOR2_TAG_bad:
+        assert(line->nargs == 1);
+        if (!bitwuzla_term_is_bv(e[0])
+            || bitwuzla_sort_bv_get_size(bitwuzla_term_get_sort(e[0])) != 1)
+        {
+          perr_btor2(parser, line->id, "expected bit-vector of size 1");
+          goto DONE;
+        }
+        BZLA_PUSH_STACK(parser->bads, e[0]);
+        break;
+
       case BTOR2_TAG_concat:
         assert(line->nargs == 2);
         term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_CONCAT, e[0], e[1]);
@@ -272,7 +652,14 @@ parse_btor2_parser(BzlaBTOR2Parser *parser,
 
       case BTOR2_TAG_constraint:
         assert(line->nargs == 1);
-        bitwuzla_assert(bitwuzla, e[0]);
+        if (bmc)
+        {
+          BZLA_PUSH_STACK(parser->constraints, e[0]);
+        }
+        else
+        {
+          bitwuzla_assert(bitwuzla, e[0]);
+        }
         break;
 
       case BTOR2_TAG_dec:
@@ -300,10 +687,52 @@ parse_btor2_parser(BzlaBTOR2Parser *parser,
         term = bitwuzla_mk_term1(bitwuzla, BITWUZLA_KIND_BV_INC, e[0]);
         break;
 
+      case BTOR2_TAG_init:
+      case BTOR2_TAG_next:
+        assert(line->nargs == 2);
+        if (!bzla_hashint_map_contains(statemap, line->args[0]))
+        {
+          perr_btor2(parser,
+                     line->id,
+                     "expected state as first argument of '%s'",
+                     line->name);
+          goto DONE;
+        }
+        i     = bzla_hashint_map_get(statemap, line->args[0])->as_int;
+        stack = line->tag == BTOR2_TAG_init ? &parser->inits : &parser->nexts;
+        if (BZLA_PEEK_STACK(*stack, i))
+        {
+          perr_btor2(parser,
+                     line->id,
+                     "state '%" PRId64 "' has more than one '%s'",
+                     line->args[0],
+                     line->name);
+          goto DONE;
+        }
+        /* arrays may be initialized with a constant element value */
+        if (line->tag == BTOR2_TAG_init && bitwuzla_term_is_array(e[0])
+            && !bitwuzla_term_is_array(e[1]))
+        {
+          e[1] = bitwuzla_mk_const_array(
+              bitwuzla, bitwuzla_term_get_sort(e[0]), e[1]);
+        }
+        if (bitwuzla_term_get_sort(e[0]) != bitwuzla_term_get_sort(e[1]))
+        {
+          perr_btor2(parser,
+                     line->id,
+                     "sort of state '%" PRId64 "' does not match sort of '%s'",
+                     line->args[0],
+                     line->name);
+          goto DONE;
+        }
+        BZLA_POKE_STACK(*stack, i, e[1]);
+        break;
+
       case BTOR2_TAG_input:
         assert(line->nargs == 0);
         term = bitwuzla_mk_const(bitwuzla, sort, line->symbol);
         bitwuzla_set_bzla_id(bitwuzla, term, line->id);
+        BZLA_PUSH_STACK(parser->inputs, term);
         break;
 
       case BTOR2_TAG_ite:
@@ -520,6 +949,17 @@ parse_btor2_parser(BzlaBTOR2Parser *parser,
             bitwuzla, BITWUZLA_KIND_BV_SSUB_OVERFLOW, e[0], e[1]);
         break;
 
+      case BTOR2_TAG_state:
+        assert(line->nargs == 0);
+        term = bitwuzla_mk_const(bitwuzla, sort, line->symbol);
+        bitwuzla_set_bzla_id(bitwuzla, term, line->id);
+        bzla_hashint_map_add(statemap, line->id)->as_int =
+            BZLA_COUNT_STACK(parser->states);
+        BZLA_PUSH_STACK(parser->states, term);
+        BZLA_PUSH_STACK(parser->inits, 0);
+        BZLA_PUSH_STACK(parser->nexts, 0);
+        break;
+
       case BTOR2_TAG_sub:
         assert(line->nargs == 2);
         term = bitwuzla_mk_term2(bitwuzla, BITWUZLA_KIND_BV_SUB, e[0], e[1]);
@@ -601,13 +1041,11 @@ parse_btor2_parser(BzlaBTOR2Parser *parser,
         break;
 
       default:
-        assert(line->tag == BTOR2_TAG_bad || line->tag == BTOR2_TAG_fair
-               || line->tag == BTOR2_TAG_init || line->tag == BTOR2_TAG_justice
-               || line->tag == BTOR2_TAG_next || line->tag == BTOR2_TAG_state);
+        assert(line->tag == BTOR2_TAG_fair || line->tag == BTOR2_TAG_justice);
         perr_btor2(parser,
                    line->id,
-                   "model checking extensions not supported by bitwuzla, try "
-                   "btormc instead");
+                   "justice and fairness properties not supported by bitwuzla, "
+                   "try btormc instead");
         goto DONE;
     }
 
@@ -618,6 +1056,11 @@ parse_btor2_parser(BzlaBTOR2Parser *parser,
       bzla_hashint_map_add(nodemap, line->id)->as_ptr = (BitwuzlaTerm *) term;
     }
   }
+
+  if (bmc)
+  {
+    bmc_btor2_parser(parser, outfile, res);
+  }
 DONE:
   if (nodemap)
   {
@@ -634,6 +1077,10 @@ DONE:
     bzla_iter_hashint_init(&it, sortmap);
     bzla_hashint_map_delete(sortmap);
   }
+  if (statemap)
+  {
+    bzla_hashint_map_delete(statemap);
+  }
   if (res)
   {
     res->status = BITWUZLA_UNKNOWN;
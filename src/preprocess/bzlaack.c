@@ -10,30 +10,473 @@
 
 #include "preprocess/bzlaack.h"
 
+#include <inttypes.h>
+
+#include "bzlabvdomain.h"
 #include "bzlacore.h"
 #include "bzlaexp.h"
+#include "utils/bzlahashint.h"
 #include "utils/bzlanodeiter.h"
 #include "utils/bzlautil.h"
 
+/*------------------------------------------------------------------------*/
+
+static bool
+is_const_exp(BzlaNode *exp)
+{
+  return bzla_node_is_bv_const(exp) || bzla_node_is_fp_const(exp)
+         || bzla_node_is_rm_const(exp);
+}
+
+/* Returns a copy of the fixed bits domain of 'exp' stored in 'domains'. */
+static BzlaBvDomain *
+copy_const_bits(BzlaMemMgr *mm, BzlaIntHashTable *domains, BzlaNode *exp)
+{
+  BzlaBvDomain *d;
+
+  d = bzla_hashint_map_get(domains, bzla_node_real_addr(exp)->id)->as_ptr;
+  assert(d);
+  if (bzla_node_is_inverted(exp)) return bzla_bvdomain_not(mm, d);
+  return bzla_bvdomain_copy(mm, d);
+}
+
+/* Computes the fixed bits of bit-vector expression 'exp' from the domains of
+ * its children. Fixed bits are only derived structurally from constants via
+ * concats, slices, ands and ites, all other expressions are unconstrained. */
+static BzlaBvDomain *
+compute_const_bits_exp(Bzla *bzla, BzlaIntHashTable *domains, BzlaNode *exp)
+{
+  assert(bzla_node_is_regular(exp));
+  assert(bzla_node_is_bv(bzla, exp));
+
+  BzlaMemMgr *mm;
+  BzlaBvDomain *d0, *d1, *res;
+  BzlaBitVector *lo, *hi;
+
+  mm = bzla->mm;
+
+  if (bzla_node_is_bv_const(exp))
+    return bzla_bvdomain_new_fixed(mm, bzla_node_bv_const_get_bits(exp));
+
+  if (bzla_node_is_bv_slice(exp))
+  {
+    d0  = copy_const_bits(mm, domains, exp->e[0]);
+    res = bzla_bvdomain_slice(mm,
+                              d0,
+                              bzla_node_bv_slice_get_upper(exp),
+                              bzla_node_bv_slice_get_lower(exp));
+    bzla_bvdomain_free(mm, d0);
+    return res;
+  }
+
+  if (!bzla_node_is_bv_concat(exp) && !bzla_node_is_bv_and(exp)
+      && !bzla_node_is_bv_cond(exp))
+    return bzla_bvdomain_new_init(mm, bzla_node_bv_get_width(bzla, exp));
+
+  if (bzla_node_is_bv_cond(exp))
+  {
+    d0 = copy_const_bits(mm, domains, exp->e[1]);
+    d1 = copy_const_bits(mm, domains, exp->e[2]);
+    /* bits are fixed if they are fixed to the same value in both branches */
+    lo = bzla_bv_and(mm, d0->lo, d1->lo);
+    hi = bzla_bv_or(mm, d0->hi, d1->hi);
+  }
+  else
+  {
+    d0 = copy_const_bits(mm, domains, exp->e[0]);
+    d1 = copy_const_bits(mm, domains, exp->e[1]);
+    if (bzla_node_is_bv_concat(exp))
+    {
+      lo = bzla_bv_concat(mm, d0->lo, d1->lo);
+      hi = bzla_bv_concat(mm, d0->hi, d1->hi);
+    }
+    else
+    {
+      lo = bzla_bv_and(mm, d0->lo, d1->lo);
+      hi = bzla_bv_and(mm, d0->hi, d1->hi);
+    }
+  }
+  res = bzla_bvdomain_new(mm, lo, hi);
+  bzla_bv_free(mm, lo);
+  bzla_bv_free(mm, hi);
+  bzla_bvdomain_free(mm, d0);
+  bzla_bvdomain_free(mm, d1);
+  return res;
+}
+
+/* Computes the fixed bits of bit-vector expression 'root' and its relevant
+ * sub-expressions and stores them in 'domains'. */
+static void
+compute_const_bits(Bzla *bzla, BzlaIntHashTable *domains, BzlaNode *root)
+{
+  uint32_t i;
+  BzlaNode *cur;
+  BzlaNodePtrStack visit;
+  BzlaHashTableData *d;
+
+  BZLA_INIT_STACK(bzla->mm, visit);
+  BZLA_PUSH_STACK(visit, root);
+  while (!BZLA_EMPTY_STACK(visit))
+  {
+    cur = bzla_node_real_addr(BZLA_POP_STACK(visit));
+    d   = bzla_hashint_map_get(domains, cur->id);
+
+    if (d && d->as_ptr) continue;
+
+    if (!d)
+    {
+      bzla_hashint_map_add(domains, cur->id);
+      if (bzla_node_is_bv_cond(cur))
+      {
+        BZLA_PUSH_STACK(visit, cur);
+        BZLA_PUSH_STACK(visit, cur->e[1]);
+        BZLA_PUSH_STACK(visit, cur->e[2]);
+        continue;
+      }
+      if (bzla_node_is_bv_slice(cur) || bzla_node_is_bv_concat(cur)
+          || bzla_node_is_bv_and(cur))
+      {
+        BZLA_PUSH_STACK(visit, cur);
+        for (i = 0; i < cur->arity; i++) BZLA_PUSH_STACK(visit, cur->e[i]);
+        continue;
+      }
+    }
+    bzla_hashint_map_get(domains, cur->id)->as_ptr =
+        compute_const_bits_exp(bzla, domains, cur);
+  }
+  BZLA_RELEASE_STACK(visit);
+}
+
+/* Returns true if arguments 'a' and 'b' are known to be distinct, i.e., if
+ * they are different constants, if one is the negation of the other, or if
+ * they have conflicting fixed bits. */
+static bool
+is_distinct_arg(Bzla *bzla, BzlaIntHashTable *domains, BzlaNode *a, BzlaNode *b)
+{
+  bool res;
+  BzlaMemMgr *mm;
+  BzlaBvDomain *da, *db, *d;
+  BzlaBitVector *lo, *hi;
+
+  if (a == b) return false;
+  if (bzla_node_real_addr(a) == bzla_node_real_addr(b)) return true;
+  if (is_const_exp(a) && is_const_exp(b)) return true;
+  if (!bzla_node_is_bv(bzla, a)) return false;
+
+  mm = bzla->mm;
+  compute_const_bits(bzla, domains, a);
+  compute_const_bits(bzla, domains, b);
+  da = copy_const_bits(mm, domains, a);
+  db = copy_const_bits(mm, domains, b);
+  /* a and b are distinct if the intersection of their domains is empty */
+  lo  = bzla_bv_or(mm, da->lo, db->lo);
+  hi  = bzla_bv_and(mm, da->hi, db->hi);
+  d   = bzla_bvdomain_new(mm, lo, hi);
+  res = !bzla_bvdomain_is_valid(mm, d);
+  bzla_bv_free(mm, lo);
+  bzla_bv_free(mm, hi);
+  bzla_bvdomain_free(mm, da);
+  bzla_bvdomain_free(mm, db);
+  bzla_bvdomain_free(mm, d);
+  return res;
+}
+
+/* Returns true if applies 'app_i' and 'app_j' are known to have distinct
+ * arguments, in which case no Ackermann constraint is required. */
+static bool
+is_distinct_apply(Bzla *bzla,
+                  BzlaIntHashTable *domains,
+                  BzlaNode *app_i,
+                  BzlaNode *app_j)
+{
+  BzlaArgsIterator ait_i, ait_j;
+
+  bzla_iter_args_init(&ait_i, app_i->e[1]);
+  bzla_iter_args_init(&ait_j, app_j->e[1]);
+  while (bzla_iter_args_has_next(&ait_i))
+  {
+    assert(bzla_iter_args_has_next(&ait_j));
+    if (is_distinct_arg(bzla,
+                        domains,
+                        bzla_iter_args_next(&ait_i),
+                        bzla_iter_args_next(&ait_j)))
+      return true;
+  }
+  return false;
+}
+
+/* Returns the fixed bits of the concatenated bit-vector arguments of apply
+ * 'app', or 0 if 'app' has no bit-vector arguments. */
+static BzlaBvDomain *
+compute_const_bits_args(Bzla *bzla, BzlaIntHashTable *domains, BzlaNode *app)
+{
+  assert(bzla_node_is_apply(app));
+
+  BzlaMemMgr *mm;
+  BzlaNode *arg;
+  BzlaArgsIterator it;
+  BzlaBvDomain *d, *res;
+  BzlaBitVector *lo, *hi;
+
+  mm  = bzla->mm;
+  res = 0;
+  bzla_iter_args_init(&it, app->e[1]);
+  while (bzla_iter_args_has_next(&it))
+  {
+    arg = bzla_iter_args_next(&it);
+    if (!bzla_node_is_bv(bzla, arg)) continue;
+    compute_const_bits(bzla, domains, arg);
+    d = copy_const_bits(mm, domains, arg);
+    if (res)
+    {
+      lo = bzla_bv_concat(mm, res->lo, d->lo);
+      hi = bzla_bv_concat(mm, res->hi, d->hi);
+      bzla_bvdomain_free(mm, res);
+      bzla_bvdomain_free(mm, d);
+      d = bzla_bvdomain_new(mm, lo, hi);
+      bzla_bv_free(mm, lo);
+      bzla_bv_free(mm, hi);
+    }
+    res = d;
+  }
+  return res;
+}
+
+/* Returns the bucket key of an apply with argument domain 'd', i.e., the
+ * values of its argument bits at the positions set in 'mask'. Returns 0 if
+ * any of these bits is not fixed. */
+static BzlaBitVector *
+compute_bucket_key(BzlaMemMgr *mm, BzlaBvDomain *d, BzlaBitVector *mask)
+{
+  BzlaBitVector *unfixed, *tmp, *res;
+
+  if (!d) return 0;
+  res     = 0;
+  unfixed = bzla_bv_xor(mm, d->lo, d->hi);
+  tmp     = bzla_bv_and(mm, unfixed, mask);
+  if (bzla_bv_is_zero(tmp)) res = bzla_bv_and(mm, d->lo, mask);
+  bzla_bv_free(mm, tmp);
+  bzla_bv_free(mm, unfixed);
+  return res;
+}
+
+/* Adds Ackermann constraint args(app_i) = args(app_j) -> app_i = app_j. */
+static void
+add_ackermann_constraint(Bzla *bzla, BzlaNode *app_i, BzlaNode *app_j)
+{
+  BzlaNode *p, *c, *imp, *a_i, *a_j, *eq, *tmp;
+  BzlaArgsIterator ait_i, ait_j;
+
+  p = 0;
+  assert(bzla_node_get_sort_id(app_i->e[1])
+         == bzla_node_get_sort_id(app_j->e[1]));
+  bzla_iter_args_init(&ait_i, app_i->e[1]);
+  bzla_iter_args_init(&ait_j, app_j->e[1]);
+  while (bzla_iter_args_has_next(&ait_i))
+  {
+    a_i = bzla_iter_args_next(&ait_i);
+    a_j = bzla_iter_args_next(&ait_j);
+    eq  = bzla_exp_eq(bzla, a_i, a_j);
+
+    if (!p)
+      p = eq;
+    else
+    {
+      tmp = p;
+      p   = bzla_exp_bv_and(bzla, tmp, eq);
+      bzla_node_release(bzla, tmp);
+      bzla_node_release(bzla, eq);
+    }
+  }
+  c   = bzla_exp_eq(bzla, app_i, app_j);
+  imp = bzla_exp_implies(bzla, p, c);
+  bzla->stats.ackermann_constraints++;
+  bzla_assert_exp(bzla, imp);
+  bzla_node_release(bzla, p);
+  bzla_node_release(bzla, c);
+  bzla_node_release(bzla, imp);
+}
+
+/* Adds the Ackermann constraint for 'app_i' and 'app_j' unless their
+ * arguments are known to be distinct. Returns true if a constraint was
+ * added. */
+static bool
+add_ackermann_constraint_sparse(Bzla *bzla,
+                                BzlaIntHashTable *domains,
+                                BzlaNode *app_i,
+                                BzlaNode *app_j)
+{
+  bzla->stats.ackermann_pairs_checked++;
+  if (is_distinct_apply(bzla, domains, app_i, app_j)) return false;
+  add_ackermann_constraint(bzla, app_i, app_j);
+  return true;
+}
+
+/* Adds Ackermann constraints for the applies 'applies' of an uninterpreted
+ * function, skipping pairs that are known to have distinct arguments.
+ *
+ * Applies are hashed into buckets by the values of their fixed argument
+ * bits at a set of key positions. Applies with different keys have
+ * distinct arguments, hence pairs are only checked within a bucket.
+ * Applies with any key bit not fixed are wildcards and are checked against
+ * all other applies. The key positions are the argument bits that are
+ * fixed in at least half of the applies. Returns the number of added
+ * constraints. */
+static uint32_t
+add_ackermann_constraints_sparse(Bzla *bzla,
+                                 BzlaIntHashTable *domains,
+                                 BzlaNodePtrStack *applies)
+{
+  uint32_t i, j, k, n, bw, *fixed, res;
+  BzlaMemMgr *mm;
+  BzlaNode *app_i, *app_j;
+  BzlaBitVector *mask, *key;
+  BzlaBvDomain **args;
+  BzlaNodePtrStack wildcards, *bucket, *bucket_j;
+  BzlaPtrHashTable *buckets;
+  BzlaPtrHashTableIterator it, it_j;
+  BzlaPtrHashBucket *b;
+
+  mm  = bzla->mm;
+  n   = BZLA_COUNT_STACK(*applies);
+  res = 0;
+  if (n < 2) return res;
+
+  /* key positions */
+  BZLA_CNEWN(mm, args, n);
+  for (i = 0; i < n; i++)
+  {
+    args[i] =
+        compute_const_bits_args(bzla, domains, BZLA_PEEK_STACK(*applies, i));
+  }
+  mask = 0;
+  if (args[0])
+  {
+    bw = bzla_bv_get_width(args[0]->lo);
+    BZLA_CNEWN(mm, fixed, bw);
+    for (i = 0; i < n; i++)
+    {
+      for (j = 0; j < bw; j++)
+      {
+        if (bzla_bvdomain_is_fixed_bit(args[i], j)) fixed[j] += 1;
+      }
+    }
+    mask = bzla_bv_new(mm, bw);
+    for (j = 0; j < bw; j++)
+    {
+      if (2 * fixed[j] >= n) bzla_bv_set_bit(mask, j, 1);
+    }
+    BZLA_DELETEN(mm, fixed, bw);
+  }
+
+  /* hash applies into buckets */
+  BZLA_INIT_STACK(mm, wildcards);
+  buckets = bzla_hashptr_table_new(
+      mm, (BzlaHashPtr) bzla_bv_hash, (BzlaCmpPtr) bzla_bv_compare);
+  for (i = 0; i < n; i++)
+  {
+    app_i = BZLA_PEEK_STACK(*applies, i);
+    key   = compute_bucket_key(mm, args[i], mask);
+    if (!key)
+    {
+      BZLA_PUSH_STACK(wildcards, app_i);
+      continue;
+    }
+    if ((b = bzla_hashptr_table_get(buckets, key)))
+    {
+      bzla_bv_free(mm, key);
+      bucket = b->data.as_ptr;
+    }
+    else
+    {
+      BZLA_NEW(mm, bucket);
+      BZLA_INIT_STACK(mm, *bucket);
+      bzla_hashptr_table_add(buckets, key)->data.as_ptr = bucket;
+    }
+    BZLA_PUSH_STACK(*bucket, app_i);
+  }
+
+  /* pairs within a bucket */
+  bzla_iter_hashptr_init(&it, buckets);
+  while (bzla_iter_hashptr_has_next(&it))
+  {
+    bucket = bzla_iter_hashptr_next_data(&it)->as_ptr;
+    for (i = 0; i < BZLA_COUNT_STACK(*bucket); i++)
+    {
+      app_i = BZLA_PEEK_STACK(*bucket, i);
+      for (j = i + 1; j < BZLA_COUNT_STACK(*bucket); j++)
+      {
+        app_j = BZLA_PEEK_STACK(*bucket, j);
+        res += add_ackermann_constraint_sparse(bzla, domains, app_i, app_j);
+      }
+    }
+  }
+
+  /* pairs with a wildcard */
+  for (i = 0; i < BZLA_COUNT_STACK(wildcards); i++)
+  {
+    app_i = BZLA_PEEK_STACK(wildcards, i);
+    for (j = i + 1; j < BZLA_COUNT_STACK(wildcards); j++)
+    {
+      app_j = BZLA_PEEK_STACK(wildcards, j);
+      res += add_ackermann_constraint_sparse(bzla, domains, app_i, app_j);
+    }
+    bzla_iter_hashptr_init(&it_j, buckets);
+    while (bzla_iter_hashptr_has_next(&it_j))
+    {
+      bucket_j = bzla_iter_hashptr_next_data(&it_j)->as_ptr;
+      for (k = 0; k < BZLA_COUNT_STACK(*bucket_j); k++)
+      {
+        app_j = BZLA_PEEK_STACK(*bucket_j, k);
+        res += add_ackermann_constraint_sparse(bzla, domains, app_i, app_j);
+      }
+    }
+  }
+
+  bzla_iter_hashptr_init(&it, buckets);
+  while (bzla_iter_hashptr_has_next(&it))
+  {
+    bucket = it.bucket->data.as_ptr;
+    bzla_bv_free(mm, bzla_iter_hashptr_next(&it));
+    BZLA_RELEASE_STACK(*bucket);
+    BZLA_DELETE(mm, bucket);
+  }
+  bzla_hashptr_table_delete(buckets);
+  BZLA_RELEASE_STACK(wildcards);
+  if (mask) bzla_bv_free(mm, mask);
+  for (i = 0; i < n; i++)
+  {
+    if (args[i]) bzla_bvdomain_free(mm, args[i]);
+  }
+  BZLA_DELETEN(mm, args, n);
+  return res;
+}
+
+/*------------------------------------------------------------------------*/
+
 void
 bzla_add_ackermann_constraints(Bzla *bzla)
 {
   assert(bzla);
 
-  uint32_t i, j, num_constraints = 0;
+  bool sparse;
+  uint32_t i, j, n, num_constraints = 0;
+  uint64_t num_pairs = 0;
   double start, delta;
-  BzlaNode *uf, *app_i, *app_j, *p, *c, *imp, *a_i, *a_j, *eq, *tmp;
+  BzlaNode *uf, *app_i, *app_j;
   BzlaNode *cur;
-  BzlaArgsIterator ait_i, ait_j;
   BzlaNodeIterator nit;
   BzlaPtrHashTableIterator it;
+  BzlaIntHashTableIterator iit;
   BzlaNodePtrStack applies, visit;
-  BzlaIntHashTable *cache;
+  BzlaIntHashTable *cache, *domains;
   BzlaMemMgr *mm;
 
-  start = bzla_util_time_stamp();
-  mm    = bzla->mm;
-  cache = bzla_hashint_table_new(mm);
+  start   = bzla_util_time_stamp();
+  mm      = bzla->mm;
+  sparse  = bzla_opt_get(bzla, BZLA_OPT_PP_ACKERMANN_SPARSE) != 0;
+  cache   = bzla_hashint_table_new(mm);
+  domains = bzla_hashint_map_new(mm);
   BZLA_INIT_STACK(mm, visit);
 
   bzla_iter_hashptr_init(&it, bzla->unsynthesized_constraints);
@@ -68,51 +511,41 @@ bzla_add_ackermann_constraints(Bzla *bzla)
       BZLA_PUSH_STACK(applies, app_i);
     }
 
-    for (i = 0; i < BZLA_COUNT_STACK(applies); i++)
+    n = BZLA_COUNT_STACK(applies);
+    num_pairs += (uint64_t) n * (n - 1) / 2;
+    if (sparse)
+    {
+      num_constraints +=
+          add_ackermann_constraints_sparse(bzla, domains, &applies);
+    }
+    else
     {
-      app_i = BZLA_PEEK_STACK(applies, i);
-      for (j = i + 1; j < BZLA_COUNT_STACK(applies); j++)
+      for (i = 0; i < n; i++)
       {
-        app_j = BZLA_PEEK_STACK(applies, j);
-        p     = 0;
-        assert(bzla_node_get_sort_id(app_i->e[1])
-               == bzla_node_get_sort_id(app_j->e[1]));
-        bzla_iter_args_init(&ait_i, app_i->e[1]);
-        bzla_iter_args_init(&ait_j, app_j->e[1]);
-        while (bzla_iter_args_has_next(&ait_i))
+        app_i = BZLA_PEEK_STACK(applies, i);
+        for (j = i + 1; j < n; j++)
         {
-          a_i = bzla_iter_args_next(&ait_i);
-          a_j = bzla_iter_args_next(&ait_j);
-          eq  = bzla_exp_eq(bzla, a_i, a_j);
-
-          if (!p)
-            p = eq;
-          else
-          {
-            tmp = p;
-            p   = bzla_exp_bv_and(bzla, tmp, eq);
-            bzla_node_release(bzla, tmp);
-            bzla_node_release(bzla, eq);
-          }
+          app_j = BZLA_PEEK_STACK(applies, j);
+          add_ackermann_constraint(bzla, app_i, app_j);
+          num_constraints++;
         }
-        c   = bzla_exp_eq(bzla, app_i, app_j);
-        imp = bzla_exp_implies(bzla, p, c);
-        bzla->stats.ackermann_constraints++;
-        num_constraints++;
-        bzla_assert_exp(bzla, imp);
-        bzla_node_release(bzla, p);
-        bzla_node_release(bzla, c);
-        bzla_node_release(bzla, imp);
       }
     }
     BZLA_RELEASE_STACK(applies);
   }
   bzla_hashint_table_delete(cache);
+  bzla_iter_hashint_init(&iit, domains);
+  while (bzla_iter_hashint_has_next(&iit))
+    bzla_bvdomain_free(mm, bzla_iter_hashint_next_data(&iit)->as_ptr);
+  bzla_hashint_map_delete(domains);
+  bzla->stats.ackermann_constraints_skipped += num_pairs - num_constraints;
   delta = bzla_util_time_stamp() - start;
   BZLA_MSG(bzla->msg,
            1,
-           "added %d ackermann constraints in %.3f seconds",
+           "added %d ackermann constraints (%" PRIu64
+           " skipped) in %.3f seconds",
            num_constraints,
+           num_pairs - num_constraints,
            delta);
   bzla->time.ack += delta;
 }
@@ -52,7 +52,6 @@ bzla_eliminate_applies(Bzla *bzla)
   BzlaNodeIterator it;
   BzlaNodePtrStack lambdas;
   BzlaPtrHashTableIterator h_it;
-  BzlaPtrHashTable *cache;
   BzlaPtrHashTable *substs;
   BzlaIntHashTable *app_cache;
 
@@ -65,9 +64,6 @@ bzla_eliminate_applies(Bzla *bzla)
 
   start     = bzla_util_time_stamp();
   round     = 1;
-  cache     = bzla_hashptr_table_new(bzla->mm,
-                                 (BzlaHashPtr) bzla_node_pair_hash,
-                                 (BzlaCmpPtr) bzla_node_pair_compare);
   app_cache = bzla_hashint_table_new(bzla->mm);
   BZLA_INIT_STACK(bzla->mm, lambdas);
 
@@ -106,7 +102,7 @@ bzla_eliminate_applies(Bzla *bzla)
         if (bzla->quantifiers->count == 0 && app->parameterized) continue;
 
         num_applies++;
-        subst = bzla_beta_reduce_full(bzla, app, cache);
+        subst = bzla_beta_reduce_full(bzla, app);
         assert(!bzla_hashptr_table_get(substs, app));
         bzla_hashptr_table_add(substs, app)->data.as_ptr = subst;
         bzla_hashint_table_add(app_cache, bzla_node_get_id(app));
@@ -136,14 +132,6 @@ bzla_eliminate_applies(Bzla *bzla)
 
   bzla_hashint_table_delete(app_cache);
 
-  bzla_iter_hashptr_init(&h_it, cache);
-  while (bzla_iter_hashptr_has_next(&h_it))
-  {
-    bzla_node_release(bzla, h_it.bucket->data.as_ptr);
-    bzla_node_pair_delete(bzla, bzla_iter_hashptr_next(&h_it));
-  }
-  bzla_hashptr_table_delete(cache);
-
 #ifndef NDEBUG
   BZLA_RESET_STACK(lambdas);
   bzla_pputils_collect_lambdas(bzla, &lambdas);
@@ -129,7 +129,7 @@ bzla_merge_lambdas(Bzla *bzla)
     }
 
     /* found top lambda */
-    parent = bzla_node_real_addr(lambda->first_parent);
+    parent = bzla_node_get_first_parent(lambda);
     if (lambda->parents > 1
         || lambda->parents == 0
         /* case lambda->parents == 1 */
@@ -46,7 +46,7 @@ bzla_simplify(Bzla *bzla)
 #endif
 
   rounds = 0;
-  start  = bzla_util_time_stamp();
+  start  = bzla_util_monotonic_time();
 
   if (bzla->valid_assignments) bzla_reset_incremental_usage(bzla);
 
@@ -195,7 +195,7 @@ bzla_simplify(Bzla *bzla)
            || bzla->embedded_constraints->count);
 
 DONE:
-  delta = bzla_util_time_stamp() - start;
+  delta = bzla_util_monotonic_time() - start;
   bzla->time.simplify += delta;
   BZLA_MSG(bzla->msg, 1, "%u rewriting rounds in %.1f seconds", rounds, delta);
 
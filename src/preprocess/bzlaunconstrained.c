@@ -31,7 +31,7 @@ is_uc_write(BzlaNode *cond)
 
   if (cond->parents != 1) return false;
 
-  lambda = bzla_node_real_addr(cond->first_parent);
+  lambda = bzla_node_get_first_parent(cond);
   if (!bzla_node_is_lambda(lambda)) return false;
 
   return bzla_node_lambda_get_static_rho(lambda) != 0;
@@ -128,7 +128,7 @@ bzla_optimize_unconstrained(Bzla *bzla)
 
     if (cur->parents == 1)
     {
-      cur_parent = bzla_node_real_addr(cur->first_parent);
+      cur_parent = bzla_node_get_first_parent(cur);
       bzla_hashint_table_add(ucs, cur->id);
       BZLALOG(2, "found uc input %s", bzla_util_node2string(cur));
       // TODO (ma): why not just collect ufs and vars?
@@ -253,8 +253,8 @@ bzla_optimize_unconstrained(Bzla *bzla)
             assert(cur->parents <= 1);
             if (ucp[1]
                 /* only consider head lambda of curried lambdas */
-                && (!cur->first_parent
-                    || !bzla_node_is_lambda(cur->first_parent)))
+                && (!cur->parents
+                    || !bzla_node_is_lambda(bzla_node_get_first_parent(cur))))
               mark_uc(bzla, ucs, cur);
             break;
           default: break;
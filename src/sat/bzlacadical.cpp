@@ -0,0 +1,255 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * This file is part of Bitwuzla.
+ *
+ * Copyright (C) 2007-2022 by the authors listed in the AUTHORS file.
+ *
+ * See COPYING for more information on using this software.
+ */
+
+/*------------------------------------------------------------------------*/
+#ifdef BZLA_USE_CADICAL
+/*------------------------------------------------------------------------*/
+
+#include <cassert>
+
+#include "cadical.hpp"
+
+extern "C" {
+
+#include "bzlacore.h"
+#include "sat/bzlacadical.h"
+#include "utils/bzlaabort.h"
+
+/*------------------------------------------------------------------------*/
+
+/* Forwards CaDiCaL's termination checks to the SAT manager callback. */
+class BzlaCaDiCaLTerminator : public CaDiCaL::Terminator
+{
+ public:
+  bool terminate() override
+  {
+    return smgr && smgr->term.fun && smgr->term.fun(smgr->term.state);
+  }
+
+  BzlaSATMgr *smgr = nullptr;
+};
+
+struct BzlaCaDiCaL
+{
+  CaDiCaL::Solver solver;
+  BzlaCaDiCaLTerminator terminator;
+};
+
+/*------------------------------------------------------------------------*/
+
+static void *
+init(BzlaSATMgr *smgr)
+{
+  BzlaCaDiCaL *res = new BzlaCaDiCaL();
+  if (smgr->inc_required
+      && bzla_opt_get(smgr->bzla, BZLA_OPT_SAT_ENGINE_CADICAL_FREEZE))
+  {
+    res->solver.set("checkfrozen", 1);
+  }
+  res->solver.set("shrink", 0);
+  return res;
+}
+
+static void
+add(BzlaSATMgr *smgr, int32_t lit)
+{
+  BzlaCaDiCaL *slv = (BzlaCaDiCaL *) smgr->solver;
+  slv->solver.add(lit);
+}
+
+static void
+add_clauses(BzlaSATMgr *smgr, const int32_t *lits, size_t n)
+{
+  BzlaCaDiCaL *slv = (BzlaCaDiCaL *) smgr->solver;
+  for (size_t i = 0; i < n; i++) slv->solver.add(lits[i]);
+}
+
+static void
+assume(BzlaSATMgr *smgr, int32_t lit)
+{
+  BzlaCaDiCaL *slv = (BzlaCaDiCaL *) smgr->solver;
+  slv->solver.assume(lit);
+}
+
+static int32_t
+deref(BzlaSATMgr *smgr, int32_t lit)
+{
+  BzlaCaDiCaL *slv = (BzlaCaDiCaL *) smgr->solver;
+  int32_t val      = slv->solver.val(lit);
+  if (val > 0) return 1;
+  if (val < 0) return -1;
+  return 0;
+}
+
+static void
+enable_verbosity(BzlaSATMgr *smgr, int32_t level)
+{
+  BzlaCaDiCaL *slv = (BzlaCaDiCaL *) smgr->solver;
+  if (level <= 1)
+    slv->solver.set("quiet", 1);
+  else if (level >= 2)
+    slv->solver.set("verbose", level - 2);
+}
+
+static int32_t
+failed(BzlaSATMgr *smgr, int32_t lit)
+{
+  BzlaCaDiCaL *slv = (BzlaCaDiCaL *) smgr->solver;
+  return slv->solver.failed(lit);
+}
+
+static int32_t
+fixed(BzlaSATMgr *smgr, int32_t lit)
+{
+  BzlaCaDiCaL *slv = (BzlaCaDiCaL *) smgr->solver;
+  return slv->solver.fixed(lit);
+}
+
+static void
+phase(BzlaSATMgr *smgr, int32_t lit)
+{
+  BzlaCaDiCaL *slv = (BzlaCaDiCaL *) smgr->solver;
+  slv->solver.phase(lit);
+}
+
+static void
+reset(BzlaSATMgr *smgr)
+{
+  BzlaCaDiCaL *slv = (BzlaCaDiCaL *) smgr->solver;
+  delete slv;
+  smgr->solver = 0;
+}
+
+static int32_t
+sat(BzlaSATMgr *smgr, int32_t limit)
+{
+  BzlaCaDiCaL *slv = (BzlaCaDiCaL *) smgr->solver;
+  /* limit applies to the next call only, limit < 0 -> no limit */
+  if (limit >= 0) slv->solver.limit("conflicts", limit);
+  return slv->solver.solve();
+}
+
+static void
+stats(BzlaSATMgr *smgr)
+{
+  BzlaCaDiCaL *slv = (BzlaCaDiCaL *) smgr->solver;
+  slv->solver.statistics();
+}
+
+static void
+setterm(BzlaSATMgr *smgr)
+{
+  BzlaCaDiCaL *slv     = (BzlaCaDiCaL *) smgr->solver;
+  slv->terminator.smgr = smgr;
+  if (smgr->term.fun)
+    slv->solver.connect_terminator(&slv->terminator);
+  else
+    slv->solver.disconnect_terminator();
+}
+
+static void *
+clone(Bzla *bzla, BzlaSATMgr *smgr)
+{
+  (void) bzla;
+  BzlaCaDiCaL *slv = (BzlaCaDiCaL *) smgr->solver, *res;
+
+  /* not initialized yet */
+  if (!slv) return 0;
+
+  /* The copy shares the variable indices of the original, hence the CNF ids
+   * of the cloned AIG manager remain valid. Clauses, units, options and
+   * elimination witnesses are copied, frozen variables are not. The
+   * terminator of the clone is bound to the cloned SAT manager via 'setterm'
+   * before its first SAT call. */
+  res = new BzlaCaDiCaL();
+  slv->solver.copy(res->solver);
+  for (int32_t v = 1; v <= smgr->maxvar; v++)
+  {
+    if (slv->solver.frozen(v)) res->solver.freeze(v);
+  }
+  return res;
+}
+
+/*------------------------------------------------------------------------*/
+/* incremental API                                                        */
+/*------------------------------------------------------------------------*/
+
+static int32_t
+inc_max_var(BzlaSATMgr *smgr)
+{
+  int32_t var = smgr->maxvar + 1;
+  if (smgr->inc_required)
+  {
+    BzlaCaDiCaL *slv = (BzlaCaDiCaL *) smgr->solver;
+    slv->solver.freeze(var);
+  }
+  return var;
+}
+
+static void
+melt(BzlaSATMgr *smgr, int32_t lit)
+{
+  if (smgr->inc_required)
+  {
+    BzlaCaDiCaL *slv = (BzlaCaDiCaL *) smgr->solver;
+    slv->solver.melt(lit);
+  }
+}
+
+/*------------------------------------------------------------------------*/
+
+bool
+bzla_sat_enable_cadical(BzlaSATMgr *smgr)
+{
+  assert(smgr != NULL);
+
+  BZLA_ABORT(smgr->initialized,
+             "'bzla_sat_init' called before 'bzla_sat_enable_cadical'");
+
+  smgr->name = "CaDiCaL";
+
+  BZLA_CLR(&smgr->api);
+  smgr->api.add              = add;
+  smgr->api.add_clauses      = add_clauses;
+  smgr->api.assume           = assume;
+  smgr->api.clone            = clone;
+  smgr->api.deref            = deref;
+  smgr->api.enable_verbosity = enable_verbosity;
+  smgr->api.failed           = failed;
+  smgr->api.fixed            = fixed;
+  smgr->api.inc_max_var      = 0;
+  smgr->api.init             = init;
+  smgr->api.melt             = 0;
+  smgr->api.phase            = phase;
+  smgr->api.repr             = 0;
+  smgr->api.reset            = reset;
+  smgr->api.sat              = sat;
+  smgr->api.set_output       = 0;
+  smgr->api.set_prefix       = 0;
+  smgr->api.stats            = stats;
+  smgr->api.setterm          = setterm;
+
+  if (bzla_opt_get(smgr->bzla, BZLA_OPT_SAT_ENGINE_CADICAL_FREEZE))
+  {
+    smgr->api.inc_max_var = inc_max_var;
+    smgr->api.melt        = melt;
+  }
+  else
+  {
+    smgr->have_restore = true;
+  }
+
+  return true;
+}
+};
+
+/*------------------------------------------------------------------------*/
+#endif
+/*------------------------------------------------------------------------*/
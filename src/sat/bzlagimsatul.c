@@ -197,6 +197,7 @@ bzla_sat_enable_gimsatul(BzlaSATMgr *smgr)
   smgr->api.inc_max_var      = 0;
   smgr->api.init             = init;
   smgr->api.melt             = 0;
+  smgr->api.phase            = 0;
   smgr->api.repr             = 0;
   smgr->api.reset            = reset;
   smgr->api.sat              = sat;
@@ -37,6 +37,13 @@ add(BzlaSATMgr *smgr, int32_t lit)
   kissat_add(smgr->solver, lit);
 }
 
+static void
+add_clauses(BzlaSATMgr *smgr, const int32_t *lits, size_t n)
+{
+  size_t i;
+  for (i = 0; i < n; i++) kissat_add(smgr->solver, lits[i]);
+}
+
 static int32_t
 sat(BzlaSATMgr *smgr, int32_t limit)
 {
@@ -75,6 +82,7 @@ bzla_sat_enable_kissat(BzlaSATMgr *smgr)
 
   BZLA_CLR(&smgr->api);
   smgr->api.add              = add;
+  smgr->api.add_clauses      = add_clauses;
   smgr->api.assume           = 0;
   smgr->api.deref            = deref;
   smgr->api.enable_verbosity = 0;
@@ -83,6 +91,7 @@ bzla_sat_enable_kissat(BzlaSATMgr *smgr)
   smgr->api.inc_max_var      = 0;
   smgr->api.init             = init;
   smgr->api.melt             = 0;
+  smgr->api.phase            = 0;
   smgr->api.repr             = 0;
   smgr->api.reset            = reset;
   smgr->api.sat              = sat;
@@ -63,6 +63,14 @@ add(BzlaSATMgr *smgr, int32_t lit)
   lgladd(blgl->lgl, lit);
 }
 
+static void
+add_clauses(BzlaSATMgr *smgr, const int32_t *lits, size_t n)
+{
+  BzlaLGL *blgl = smgr->solver;
+  size_t i;
+  for (i = 0; i < n; i++) lgladd(blgl->lgl, lits[i]);
+}
+
 static int32_t
 sat(BzlaSATMgr *smgr, int32_t limit)
 {
@@ -263,6 +271,13 @@ fixed(BzlaSATMgr *smgr, int32_t lit)
   return lglfixed(blgl->lgl, lit);
 }
 
+static void
+phase(BzlaSATMgr *smgr, int32_t lit)
+{
+  BzlaLGL *blgl = smgr->solver;
+  lglsetphase(blgl->lgl, lit);
+}
+
 static void *
 clone(Bzla *bzla, BzlaSATMgr *smgr)
 {
@@ -313,6 +328,7 @@ bzla_sat_enable_lingeling(BzlaSATMgr *smgr)
 
   BZLA_CLR(&smgr->api);
   smgr->api.add              = add;
+  smgr->api.add_clauses      = add_clauses;
   smgr->api.assume           = assume;
   smgr->api.deref            = deref;
   smgr->api.enable_verbosity = enable_verbosity;
@@ -321,6 +337,7 @@ bzla_sat_enable_lingeling(BzlaSATMgr *smgr)
   smgr->api.inc_max_var      = inc_max_var;
   smgr->api.init             = init;
   smgr->api.melt             = melt;
+  smgr->api.phase            = phase;
   smgr->api.repr             = repr;
   smgr->api.reset            = reset;
   smgr->api.sat              = sat;
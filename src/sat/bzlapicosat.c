@@ -42,6 +42,13 @@ add(BzlaSATMgr *smgr, int32_t lit)
   (void) picosat_add(smgr->solver, lit);
 }
 
+static void
+add_clauses(BzlaSATMgr *smgr, const int32_t *lits, size_t n)
+{
+  size_t i;
+  for (i = 0; i < n; i++) (void) picosat_add(smgr->solver, lits[i]);
+}
+
 static int32_t
 sat(BzlaSATMgr *smgr, int32_t limit)
 {
@@ -97,6 +104,12 @@ fixed(BzlaSATMgr *smgr, int32_t lit)
   return picosat_deref_toplevel(smgr->solver, lit);
 }
 
+static void
+phase(BzlaSATMgr *smgr, int32_t lit)
+{
+  picosat_set_default_phase_lit(smgr->solver, lit, 1);
+}
+
 /*------------------------------------------------------------------------*/
 
 static void
@@ -125,6 +138,7 @@ bzla_sat_enable_picosat(BzlaSATMgr *smgr)
 
   BZLA_CLR(&smgr->api);
   smgr->api.add              = add;
+  smgr->api.add_clauses      = add_clauses;
   smgr->api.assume           = assume;
   smgr->api.deref            = deref;
   smgr->api.enable_verbosity = enable_verbosity;
@@ -133,6 +147,7 @@ bzla_sat_enable_picosat(BzlaSATMgr *smgr)
   smgr->api.inc_max_var      = inc_max_var;
   smgr->api.init             = init;
   smgr->api.melt             = 0;
+  smgr->api.phase            = phase;
   smgr->api.repr             = 0;
   smgr->api.reset            = reset;
   smgr->api.sat              = sat;
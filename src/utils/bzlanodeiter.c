@@ -14,6 +14,93 @@
 /* node iterators					                  */
 /*------------------------------------------------------------------------*/
 
+#ifdef BZLA_COMPACT_PARENTS
+
+/* Parent ids are stored as follows: non-apply parents first, ordered from the
+ * least recently added one, followed by the apply parents, ordered from the
+ * least recently added one. */
+
+static inline uint32_t
+num_non_apply_parents(const BzlaNode *exp)
+{
+  assert(exp->apply_parents <= exp->parents);
+  return exp->parents - exp->apply_parents;
+}
+
+static inline BzlaNode *
+get_parent(const BzlaNode *exp, uint32_t pos)
+{
+  assert(pos < exp->parents);
+  BzlaNode *res = BZLA_PEEK_STACK(exp->bzla->nodes_id_table,
+                                  exp->parent_ids[pos]);
+  assert(res);
+  assert(bzla_node_is_regular(res));
+  return res;
+}
+
+void
+bzla_iter_apply_parent_init(BzlaNodeIterator *it, const BzlaNode *exp)
+{
+  assert(it);
+  assert(exp);
+  it->exp = bzla_node_real_addr(exp);
+  it->pos = it->exp->parents;
+}
+
+bool
+bzla_iter_apply_parent_has_next(const BzlaNodeIterator *it)
+{
+  assert(it);
+  return it->pos > num_non_apply_parents(it->exp);
+}
+
+BzlaNode *
+bzla_iter_apply_parent_next(BzlaNodeIterator *it)
+{
+  BzlaNode *result;
+  assert(it);
+  assert(it->pos > num_non_apply_parents(it->exp));
+  result = get_parent(it->exp, --it->pos);
+  assert(bzla_node_is_apply(result));
+  return result;
+}
+
+/*------------------------------------------------------------------------*/
+
+void
+bzla_iter_parent_init(BzlaNodeIterator *it, const BzlaNode *exp)
+{
+  assert(it);
+  assert(exp);
+  it->exp = bzla_node_real_addr(exp);
+  it->pos = 0;
+}
+
+bool
+bzla_iter_parent_has_next(const BzlaNodeIterator *it)
+{
+  assert(it);
+  return it->pos < it->exp->parents;
+}
+
+BzlaNode *
+bzla_iter_parent_next(BzlaNodeIterator *it)
+{
+  assert(it);
+  assert(it->pos < it->exp->parents);
+
+  uint32_t n, pos;
+
+  /* non-apply parents from the most recently added one, then apply parents
+   * from the least recently added one (as with parent lists) */
+  n   = num_non_apply_parents(it->exp);
+  pos = it->pos < n ? n - 1 - it->pos : it->pos;
+  it->pos++;
+  return get_parent(it->exp, pos);
+}
+
+#else
+
 void
 bzla_iter_apply_parent_init(BzlaNodeIterator *it, const BzlaNode *exp)
 {
@@ -74,6 +161,8 @@ bzla_iter_parent_next(BzlaNodeIterator *it)
   return bzla_node_real_addr(result);
 }
 
+#endif
+
 /*------------------------------------------------------------------------*/
 
 void
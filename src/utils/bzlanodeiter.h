@@ -25,13 +25,18 @@ typedef struct BzlaNodeIterator
   uint32_t num_elements;
 #endif
   BzlaNode *cur;
+#ifdef BZLA_COMPACT_PARENTS
+  const BzlaNode *exp; /* required for parent iterators */
+#endif
 } BzlaNodeIterator;
 
+#ifndef BZLA_COMPACT_PARENTS
 #define BZLA_NEXT_PARENT(exp) \
-  (bzla_node_real_addr(exp)->next_parent[bzla_node_get_tag(exp)])
+  BZLA_NODE_NEXT_PARENT(bzla_node_real_addr(exp), bzla_node_get_tag(exp))
 
 #define BZLA_PREV_PARENT(exp) \
-  (bzla_node_real_addr(exp)->prev_parent[bzla_node_get_tag(exp)])
+  BZLA_NODE_PREV_PARENT(bzla_node_real_addr(exp), bzla_node_get_tag(exp))
+#endif
 
 void bzla_iter_apply_parent_init(BzlaNodeIterator *it, const BzlaNode *exp);
 bool bzla_iter_apply_parent_has_next(const BzlaNodeIterator *it);
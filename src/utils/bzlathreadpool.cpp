@@ -0,0 +1,152 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * This file is part of Bitwuzla.
+ *
+ * Copyright (C) 2007-2022 by the authors listed in the AUTHORS file.
+ *
+ * See COPYING for more information on using this software.
+ */
+
+extern "C" {
+#include "utils/bzlathreadpool.h"
+}
+
+#include <atomic>
+#include <cassert>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+struct BzlaThreadPool
+{
+  std::vector<std::thread> threads;
+  std::mutex mutex;
+  std::condition_variable cv_start;
+  std::condition_variable cv_done;
+  /* Incremented for every call to bzla_thread_pool_run, signals new jobs. */
+  uint64_t round = 0;
+  /* Number of worker threads that did not yet finish the current round. */
+  uint32_t num_active = 0;
+  bool stop           = false;
+
+  BzlaThreadPoolJob job = nullptr;
+  void *state           = nullptr;
+  uint32_t num_jobs     = 0;
+  std::atomic<uint32_t> next_job{0};
+};
+
+static void
+run_jobs(BzlaThreadPool *pool, uint32_t worker)
+{
+  uint32_t i;
+  while ((i = pool->next_job.fetch_add(1, std::memory_order_relaxed))
+         < pool->num_jobs)
+  {
+    pool->job(pool->state, i, worker);
+  }
+}
+
+static void
+worker_main(BzlaThreadPool *pool, uint32_t worker)
+{
+  uint64_t round = 0;
+
+  for (;;)
+  {
+    {
+      std::unique_lock<std::mutex> lock(pool->mutex);
+      pool->cv_start.wait(
+          lock, [pool, round]() { return pool->stop || pool->round != round; });
+      if (pool->stop)
+      {
+        return;
+      }
+      round = pool->round;
+    }
+    run_jobs(pool, worker);
+    {
+      std::lock_guard<std::mutex> lock(pool->mutex);
+      if (--pool->num_active == 0)
+      {
+        pool->cv_done.notify_one();
+      }
+    }
+  }
+}
+
+extern "C" {
+
+BzlaThreadPool *
+bzla_thread_pool_new(uint32_t num_threads)
+{
+  assert(num_threads > 0);
+
+  BzlaThreadPool *pool = new BzlaThreadPool();
+  for (uint32_t i = 1; i < num_threads; ++i)
+  {
+    pool->threads.emplace_back(worker_main, pool, i);
+  }
+  return pool;
+}
+
+void
+bzla_thread_pool_delete(BzlaThreadPool *pool)
+{
+  assert(pool);
+  {
+    std::lock_guard<std::mutex> lock(pool->mutex);
+    pool->stop = true;
+  }
+  pool->cv_start.notify_all();
+  for (std::thread &t : pool->threads)
+  {
+    t.join();
+  }
+  delete pool;
+}
+
+uint32_t
+bzla_thread_pool_get_num_threads(BzlaThreadPool *pool)
+{
+  assert(pool);
+  return pool->threads.size() + 1;
+}
+
+void
+bzla_thread_pool_run(BzlaThreadPool *pool,
+                     uint32_t num_jobs,
+                     BzlaThreadPoolJob job,
+                     void *state)
+{
+  assert(pool);
+  assert(job);
+
+  /* Not worth waking up the workers. */
+  if (pool->threads.empty() || num_jobs < 2)
+  {
+    for (uint32_t i = 0; i < num_jobs; ++i)
+    {
+      job(state, i, 0);
+    }
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(pool->mutex);
+    pool->job        = job;
+    pool->state      = state;
+    pool->num_jobs   = num_jobs;
+    pool->num_active = pool->threads.size();
+    pool->next_job.store(0, std::memory_order_relaxed);
+    pool->round += 1;
+  }
+  pool->cv_start.notify_all();
+  run_jobs(pool, 0);
+  {
+    std::unique_lock<std::mutex> lock(pool->mutex);
+    pool->cv_done.wait(lock, [pool]() { return pool->num_active == 0; });
+  }
+}
+}
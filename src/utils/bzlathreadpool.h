@@ -0,0 +1,49 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * This file is part of Bitwuzla.
+ *
+ * Copyright (C) 2007-2022 by the authors listed in the AUTHORS file.
+ *
+ * See COPYING for more information on using this software.
+ */
+
+#ifndef BZLATHREADPOOL_H_INCLUDED
+#define BZLATHREADPOOL_H_INCLUDED
+
+#include <stdint.h>
+
+typedef struct BzlaThreadPool BzlaThreadPool;
+
+/**
+ * A job of a thread pool, called with the 'state' given to
+ * bzla_thread_pool_run, the index 'idx' of the job and the index 'worker' of
+ * the calling thread (0 for the calling thread of bzla_thread_pool_run).
+ */
+typedef void (*BzlaThreadPoolJob)(void* state, uint32_t idx, uint32_t worker);
+
+/**
+ * Create a new thread pool with 'num_threads' threads in total, i.e., the
+ * thread calling bzla_thread_pool_run and 'num_threads' - 1 worker threads.
+ */
+BzlaThreadPool* bzla_thread_pool_new(uint32_t num_threads);
+
+/** Stop all worker threads and delete given thread pool. */
+void bzla_thread_pool_delete(BzlaThreadPool* pool);
+
+/** Get the total number of threads of given thread pool. */
+uint32_t bzla_thread_pool_get_num_threads(BzlaThreadPool* pool);
+
+/**
+ * Run jobs 0 to 'num_jobs' - 1 on all threads of the pool, including the
+ * calling thread, and wait until all jobs are done. Jobs are claimed in
+ * ascending order, but may finish in any order. Jobs must not access any
+ * shared state that is modified concurrently, in particular, they must not
+ * allocate memory via a memory manager that is shared between threads.
+ */
+void bzla_thread_pool_run(BzlaThreadPool* pool,
+                          uint32_t num_jobs,
+                          BzlaThreadPoolJob job,
+                          void* state);
+
+#endif
@@ -519,14 +519,22 @@ bzla_util_check_hex_to_bv(BzlaMemMgr *mm, const char *str, uint32_t bw)
 }
 
 /*------------------------------------------------------------------------*/
-#ifdef BZLA_TIME_STATISTICS
 
 #include <sys/resource.h>
-#include <sys/time.h>
 #include <time.h>
 
 double
-bzla_util_time_stamp(void)
+bzla_util_monotonic_time(void)
+{
+  struct timespec ts;
+  double res = 0;
+  if (!clock_gettime(CLOCK_MONOTONIC, &ts))
+    res += (double) ts.tv_sec + (double) ts.tv_nsec / 1000000000;
+  return res;
+}
+
+double
+bzla_util_process_time(void)
 {
   double res = 0;
   struct rusage u;
@@ -538,6 +546,16 @@ bzla_util_time_stamp(void)
   return res;
 }
 
+#ifdef BZLA_TIME_STATISTICS
+
+#include <sys/time.h>
+
+double
+bzla_util_time_stamp(void)
+{
+  return bzla_util_monotonic_time();
+}
+
 double
 bzla_util_process_time_thread(void)
 {
@@ -70,7 +70,15 @@ bool bzla_util_check_hex_to_bv(BzlaMemMgr *mm, const char *str, uint32_t bw);
 
 /*------------------------------------------------------------------------*/
 
+/* Monotonic wall-clock time in seconds. Cheap (no system call on most
+ * platforms), use for phase timers, also in hot paths. */
 double bzla_util_time_stamp(void);
+/* Monotonic wall-clock time in seconds, also available without time
+ * statistics. Use for the phase timers reported via --stats-json only. */
+double bzla_util_monotonic_time(void);
+/* CPU time of the process (all threads) in seconds, also available without
+ * time statistics. Requires a system call, use for reporting only. */
+double bzla_util_process_time(void);
 double bzla_util_process_time_thread(void);
 double bzla_util_current_time(void);
 
@@ -0,0 +1,12 @@
+(set-logic QF_UFBV)
+(declare-fun f ((_ BitVec 8)) (_ BitVec 8))
+(declare-fun x () (_ BitVec 8))
+(declare-fun y () (_ BitVec 8))
+(declare-fun c () Bool)
+(assert (= (f #x00) #x10))
+(assert (= (f #x01) #x11))
+(assert (= (f #x02) #x12))
+(assert (distinct (f x) (f (bvnot x))))
+(assert (distinct (f (concat #b1 ((_ extract 6 0) y))) (f (ite c #x00 #x02))))
+(assert (= (f (ite c #x00 #x02)) #x20))
+(check-sat)
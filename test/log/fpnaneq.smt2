@@ -0,0 +1,5 @@
+(set-logic QF_FP)
+(declare-const x (_ FloatingPoint 8 24))
+(declare-const y (_ FloatingPoint 8 24))
+(assert (and (fp.isNaN x) (fp.isNaN y) (distinct x y)))
+(check-sat)
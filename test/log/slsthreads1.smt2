@@ -0,0 +1,10 @@
+(set-logic QF_BV)
+(declare-fun x () (_ BitVec 16))
+(declare-fun y () (_ BitVec 16))
+(declare-fun z () (_ BitVec 16))
+(assert (= (bvadd (bvmul x y) z) #x1234))
+(assert (bvult x y))
+(assert (= (bvand z #x00ff) #x0034))
+(assert (not (= x #x0000)))
+(assert (bvult #x0010 x))
+(check-sat)
@@ -0,0 +1,166 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * This file is part of Bitwuzla.
+ *
+ * Copyright (C) 2007-2022 by the authors listed in the AUTHORS file.
+ *
+ * See COPYING for more information on using this software.
+ */
+
+#include "test.h"
+
+extern "C" {
+#include "bzlacore.h"
+#include "bzlaexp.h"
+#include "preprocess/bzlaack.h"
+}
+
+class TestAck : public TestBzla
+{
+ protected:
+  /* Assert f(a) < z for the arguments
+   *   a0 = 0, a1 = 1, a2 = 2, a3 = x, a4 = ~x,
+   *   a5 = concat(#b1, y[6:0]), a6 = ite(c, 0, 2)
+   * of uninterpreted function f of sort bv8 -> bv8. */
+  void assert_applies()
+  {
+    uint32_t i;
+    BzlaSortId bool_sort, sort1, sort8, tuple_sort, fun_sort;
+    BzlaNode *f, *c, *x, *y, *z, *one1, *zero, *two, *slice, *app, *ult;
+    BzlaNode *args[7];
+
+    bool_sort  = bzla_sort_bool(d_bzla);
+    sort1      = bzla_sort_bv(d_bzla, 1);
+    sort8      = bzla_sort_bv(d_bzla, 8);
+    tuple_sort = bzla_sort_tuple(d_bzla, &sort8, 1);
+    fun_sort   = bzla_sort_fun(d_bzla, tuple_sort, sort8);
+
+    f     = bzla_exp_uf(d_bzla, fun_sort, 0);
+    c     = bzla_exp_var(d_bzla, bool_sort, 0);
+    x     = bzla_exp_var(d_bzla, sort8, 0);
+    y     = bzla_exp_var(d_bzla, sort8, 0);
+    z     = bzla_exp_var(d_bzla, sort8, 0);
+    one1  = bzla_exp_bv_one(d_bzla, sort1);
+    zero  = bzla_exp_bv_zero(d_bzla, sort8);
+    two   = bzla_exp_bv_int(d_bzla, 2, sort8);
+    slice = bzla_exp_bv_slice(d_bzla, y, 6, 0);
+
+    args[0] = bzla_node_copy(d_bzla, zero);
+    args[1] = bzla_exp_bv_one(d_bzla, sort8);
+    args[2] = bzla_node_copy(d_bzla, two);
+    args[3] = bzla_node_copy(d_bzla, x);
+    args[4] = bzla_exp_bv_not(d_bzla, x);
+    args[5] = bzla_exp_bv_concat(d_bzla, one1, slice);
+    args[6] = bzla_exp_cond(d_bzla, c, zero, two);
+
+    for (i = 0; i < 7; i++)
+    {
+      app = bzla_exp_apply_n(d_bzla, f, &args[i], 1);
+      ult = bzla_exp_bv_ult(d_bzla, app, z);
+      bzla_assert_exp(d_bzla, ult);
+      bzla_node_release(d_bzla, ult);
+      bzla_node_release(d_bzla, app);
+      bzla_node_release(d_bzla, args[i]);
+    }
+
+    bzla_node_release(d_bzla, slice);
+    bzla_node_release(d_bzla, two);
+    bzla_node_release(d_bzla, zero);
+    bzla_node_release(d_bzla, one1);
+    bzla_node_release(d_bzla, z);
+    bzla_node_release(d_bzla, y);
+    bzla_node_release(d_bzla, x);
+    bzla_node_release(d_bzla, c);
+    bzla_node_release(d_bzla, f);
+    bzla_sort_release(d_bzla, fun_sort);
+    bzla_sort_release(d_bzla, tuple_sort);
+    bzla_sort_release(d_bzla, sort8);
+    bzla_sort_release(d_bzla, sort1);
+    bzla_sort_release(d_bzla, bool_sort);
+  }
+};
+
+TEST_F(TestAck, eager)
+{
+  assert_applies();
+  bzla_add_ackermann_constraints(d_bzla);
+  ASSERT_EQ(d_bzla->stats.ackermann_constraints, 21u);
+  ASSERT_EQ(d_bzla->stats.ackermann_constraints_skipped, 0u);
+  ASSERT_EQ(d_bzla->stats.ackermann_pairs_checked, 0u);
+}
+
+TEST_F(TestAck, sparse)
+{
+  bzla_opt_set(d_bzla, BZLA_OPT_PP_ACKERMANN_SPARSE, 1);
+  assert_applies();
+  bzla_add_ackermann_constraints(d_bzla);
+  /* bits 7 to 2 and bit 0 are fixed in at least half of the applies,
+   * buckets: {a0, a2, a6}, {a1}, wildcards: {a3, a4, a5}
+   * checked pairs: 3 within {a0, a2, a6}, 3 between wildcards and 12
+   * between wildcards and buckets (18)
+   * skipped pairs:
+   *   a1 vs. a0, a2, a6:     different buckets (3)
+   *   a0 vs. a2:             constant arguments (1)
+   *   a3 vs. a4:             x vs. ~x (1)
+   *   a5 vs. a0, a1, a2, a6: conflicting msb (4) */
+  ASSERT_EQ(d_bzla->stats.ackermann_constraints, 12u);
+  ASSERT_EQ(d_bzla->stats.ackermann_constraints_skipped, 9u);
+  ASSERT_EQ(d_bzla->stats.ackermann_pairs_checked, 18u);
+}
+
+TEST_F(TestAck, sparse_buckets)
+{
+  uint32_t i, n = 64;
+  BzlaSortId sort2, sort6, sort8, tuple_sort, fun_sort;
+  BzlaNode *f, *hi, *lo, *arg, *val, *app, *eq;
+
+  bzla_opt_set(d_bzla, BZLA_OPT_PP_ACKERMANN_SPARSE, 1);
+
+  sort2      = bzla_sort_bv(d_bzla, 2);
+  sort6      = bzla_sort_bv(d_bzla, 6);
+  sort8      = bzla_sort_bv(d_bzla, 8);
+  tuple_sort = bzla_sort_tuple(d_bzla, &sort8, 1);
+  fun_sort   = bzla_sort_fun(d_bzla, tuple_sort, sort8);
+  f          = bzla_exp_uf(d_bzla, fun_sort, 0);
+
+  /* f(concat(i, y_i)) = i for i = 0, ..., n - 1 with fresh y_i, and
+   * f(x) = 0, f(z) = 0 */
+  for (i = 0; i < n + 2; i++)
+  {
+    if (i < n)
+    {
+      hi  = bzla_exp_bv_int(d_bzla, i, sort6);
+      lo  = bzla_exp_var(d_bzla, sort2, 0);
+      arg = bzla_exp_bv_concat(d_bzla, hi, lo);
+      bzla_node_release(d_bzla, lo);
+      bzla_node_release(d_bzla, hi);
+    }
+    else
+    {
+      arg = bzla_exp_var(d_bzla, sort8, 0);
+    }
+    app = bzla_exp_apply_n(d_bzla, f, &arg, 1);
+    val = bzla_exp_bv_int(d_bzla, i < n ? i : 0, sort8);
+    eq  = bzla_exp_eq(d_bzla, app, val);
+    bzla_assert_exp(d_bzla, eq);
+    bzla_node_release(d_bzla, eq);
+    bzla_node_release(d_bzla, val);
+    bzla_node_release(d_bzla, app);
+    bzla_node_release(d_bzla, arg);
+  }
+
+  bzla_add_ackermann_constraints(d_bzla);
+  /* one bucket per i, only pairs with the two wildcards f(x) and f(z) are
+   * checked, which is linear in n */
+  ASSERT_EQ(d_bzla->stats.ackermann_pairs_checked, 2 * n + 1);
+  ASSERT_EQ(d_bzla->stats.ackermann_constraints, 2 * n + 1);
+  ASSERT_EQ(d_bzla->stats.ackermann_constraints_skipped, n * (n - 1) / 2);
+
+  bzla_node_release(d_bzla, f);
+  bzla_sort_release(d_bzla, fun_sort);
+  bzla_sort_release(d_bzla, tuple_sort);
+  bzla_sort_release(d_bzla, sort8);
+  bzla_sort_release(d_bzla, sort6);
+  bzla_sort_release(d_bzla, sort2);
+}
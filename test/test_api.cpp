@@ -3104,6 +3104,137 @@ TEST_F(TestApi, dump_formula1)
                "dumping in incremental mode is currently not supported");
 }
 
+TEST_F(TestApi, save_load_state)
+{
+  ASSERT_DEATH(bitwuzla_save_state(nullptr, stdout), d_error_not_null);
+  ASSERT_DEATH(bitwuzla_save_state(d_bzla, nullptr), d_error_not_null);
+  ASSERT_DEATH(bitwuzla_load_state(nullptr, stdin), d_error_not_null);
+  ASSERT_DEATH(bitwuzla_load_state(d_bzla, nullptr), d_error_not_null);
+
+  ASSERT_DEATH(bitwuzla_save_state(d_bzla, stdout), "not supported");
+  ASSERT_DEATH(bitwuzla_load_state(d_bzla, stdin), "without inputs");
+
+  FILE *file     = tmpfile();
+  Bitwuzla *bzla = bitwuzla_new();
+  bitwuzla_set_option(bzla, BITWUZLA_OPT_INCREMENTAL, 1);
+  const BitwuzlaSort *bv8 = bitwuzla_mk_bv_sort(bzla, 8);
+  const BitwuzlaSort *arr = bitwuzla_mk_array_sort(bzla, bv8, bv8);
+  const BitwuzlaTerm *x   = bitwuzla_mk_const(bzla, bv8, "x");
+  const BitwuzlaTerm *y   = bitwuzla_mk_const(bzla, bv8, "y");
+  const BitwuzlaTerm *a   = bitwuzla_mk_const(bzla, arr, "a");
+  const BitwuzlaTerm *one = bitwuzla_mk_bv_one(bzla, bv8);
+  const BitwuzlaTerm *store =
+      bitwuzla_mk_term3(bzla, BITWUZLA_KIND_ARRAY_STORE, a, x, y);
+  bitwuzla_assert(
+      bzla,
+      bitwuzla_mk_term2(bzla,
+                        BITWUZLA_KIND_EQUAL,
+                        x,
+                        bitwuzla_mk_term2(bzla, BITWUZLA_KIND_BV_ADD, y, one)));
+  bitwuzla_assert(
+      bzla,
+      bitwuzla_mk_term2(
+          bzla,
+          BITWUZLA_KIND_EQUAL,
+          y,
+          bitwuzla_mk_term2(bzla, BITWUZLA_KIND_ARRAY_SELECT, store, x)));
+  bitwuzla_push(bzla, 1);
+  bitwuzla_assert(bzla, bitwuzla_mk_term2(bzla, BITWUZLA_KIND_EQUAL, x, y));
+  ASSERT_EQ(bitwuzla_check_sat(bzla), BITWUZLA_UNSAT);
+  bitwuzla_save_state(bzla, file);
+
+  Bitwuzla *loaded = bitwuzla_new();
+  rewind(file);
+  bitwuzla_load_state(loaded, file);
+  ASSERT_EQ(bitwuzla_check_sat(loaded), BITWUZLA_UNSAT);
+  bitwuzla_pop(loaded, 1);
+  ASSERT_EQ(bitwuzla_check_sat(loaded), BITWUZLA_SAT);
+  ASSERT_DEATH(bitwuzla_load_state(loaded, stdin), "without inputs");
+  bitwuzla_delete(loaded);
+
+  loaded = bitwuzla_new();
+  rewind(file);
+  fputs("invalid", file);
+  rewind(file);
+  ASSERT_DEATH(bitwuzla_load_state(loaded, file), "invalid state file");
+  bitwuzla_delete(loaded);
+
+  bitwuzla_delete(bzla);
+  fclose(file);
+}
+
+TEST_F(TestApi, save_load_state_unsolved)
+{
+  uint32_t header[2];
+  FILE *file     = tmpfile();
+  Bitwuzla *bzla = bitwuzla_new();
+
+  /* without any terms, neither sorts nor nodes are saved */
+  bitwuzla_save_state(bzla, file);
+  rewind(file);
+  ASSERT_EQ(fread(header, sizeof(uint32_t), 2, file), 2u);
+  rewind(file);
+  Bitwuzla *loaded = bitwuzla_new();
+  bitwuzla_load_state(loaded, file);
+  ASSERT_EQ(bitwuzla_check_sat(loaded), BITWUZLA_SAT);
+  bitwuzla_delete(loaded);
+
+  /* variable substitutions are saved before they are applied */
+  const BitwuzlaSort *bv8 = bitwuzla_mk_bv_sort(bzla, 8);
+  const BitwuzlaSort *arr = bitwuzla_mk_array_sort(bzla, bv8, bv8);
+  const BitwuzlaTerm *x   = bitwuzla_mk_const(bzla, bv8, "x");
+  const BitwuzlaTerm *y   = bitwuzla_mk_const(bzla, bv8, "y");
+  const BitwuzlaTerm *a   = bitwuzla_mk_const(bzla, arr, "a");
+  const BitwuzlaTerm *b   = bitwuzla_mk_const(bzla, arr, "b");
+  const BitwuzlaTerm *one = bitwuzla_mk_bv_one(bzla, bv8);
+  const BitwuzlaTerm *store =
+      bitwuzla_mk_term3(bzla, BITWUZLA_KIND_ARRAY_STORE, b, x, y);
+  bitwuzla_assert(
+      bzla,
+      bitwuzla_mk_term2(bzla,
+                        BITWUZLA_KIND_EQUAL,
+                        x,
+                        bitwuzla_mk_term2(bzla, BITWUZLA_KIND_BV_ADD, y, one)));
+  bitwuzla_assert(bzla,
+                  bitwuzla_mk_term2(bzla, BITWUZLA_KIND_EQUAL, a, store));
+  bitwuzla_assert(
+      bzla,
+      bitwuzla_mk_term2(
+          bzla,
+          BITWUZLA_KIND_DISTINCT,
+          y,
+          bitwuzla_mk_term2(bzla, BITWUZLA_KIND_ARRAY_SELECT, a, y)));
+  rewind(file);
+  bitwuzla_save_state(bzla, file);
+  rewind(file);
+  loaded = bitwuzla_new();
+  bitwuzla_load_state(loaded, file);
+  ASSERT_EQ(bitwuzla_check_sat(bzla), BITWUZLA_SAT);
+  ASSERT_EQ(bitwuzla_check_sat(loaded), BITWUZLA_SAT);
+  bitwuzla_delete(loaded);
+
+  /* (bvand x y) with x of sort bv8 and y of sort bool */
+  std::vector<uint32_t> words = {
+      header[0], header[1],                     // magic, version
+      0,                                        // options
+      0, 0,                                     // inconsistent, push/pop
+      2, BZLA_BV_SORT, 8, BZLA_BOOL_SORT,       // sorts
+      3,                                        // nodes
+      BZLA_VAR_NODE, 0, 1, 0, 0,                // x
+      BZLA_VAR_NODE, 0, 2, 0, 0,                // y
+      BZLA_BV_AND_NODE, 0, 1, 2, 1, 2};         // (bvand x y)
+  rewind(file);
+  ASSERT_EQ(fwrite(words.data(), sizeof(uint32_t), words.size(), file),
+            words.size());
+  rewind(file);
+  loaded = bitwuzla_new();
+  ASSERT_DEATH(bitwuzla_load_state(loaded, file), "invalid state file");
+  bitwuzla_delete(loaded);
+
+  bitwuzla_delete(bzla);
+  fclose(file);
+}
+
 TEST_F(TestApi, parse)
 {
   bool is_smt2;
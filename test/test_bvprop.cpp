@@ -16,6 +16,7 @@ extern "C" {
 #include "bzlaaigvec.h"
 #include "bzlabvprop.h"
 #include "utils/bzlamem.h"
+#include "utils/bzlarng.h"
 #include "utils/bzlautil.h"
 }
 
@@ -77,10 +78,12 @@ class TestBvProp : public TestBvDomainCommon
     TestBvDomainCommon::SetUp();
     d_bzla  = bzla_new();
     d_avmgr = bzla_aigvec_mgr_new(d_bzla);
+    d_rng   = bzla_rng_new(d_mm, 0);
   }
 
   void TearDown() override
   {
+    bzla_rng_delete(d_rng);
     bzla_aigvec_mgr_delete(d_avmgr);
     bzla_delete(d_bzla);
     TestBvDomainCommon::TearDown();
@@ -3255,10 +3258,353 @@ class TestBvProp : public TestBvDomainCommon
     free_consts(1, num_consts_z, consts_z);
   }
 
+  /* Check that the word-level propagator of 'op' computes the same domains as
+   * its bit-vector counterpart on the given domains of width 'bw'. */
+  void check_word_binary(BvPropOp op,
+                         uint32_t bw,
+                         BzlaBvDomain *d_x,
+                         BzlaBvDomain *d_y,
+                         BzlaBvDomain *d_z)
+  {
+    bool res, res_w;
+    BzlaBvDomain *res_x = nullptr, *res_y = nullptr, *res_z = nullptr;
+    BzlaBvDomainWord w_x, w_y, w_z;
+
+    bzla_bvdomain_to_word(d_x, &w_x);
+    bzla_bvdomain_to_word(d_y, &w_y);
+    bzla_bvdomain_to_word(d_z, &w_z);
+
+    switch (op)
+    {
+      case TEST_BVPROP_ADD:
+        res   = bzla_bvprop_add(d_mm, d_x, d_y, d_z, &res_x, &res_y, &res_z);
+        res_w = bzla_bvprop_word_add(bw, &w_x, &w_y, &w_z);
+        break;
+      case TEST_BVPROP_AND:
+        res   = bzla_bvprop_and(d_mm, d_x, d_y, d_z, &res_x, &res_y, &res_z);
+        res_w = bzla_bvprop_word_and(bw, &w_x, &w_y, &w_z);
+        break;
+      case TEST_BVPROP_CONCAT:
+        res = bzla_bvprop_concat(d_mm, d_x, d_y, d_z, &res_x, &res_y, &res_z);
+        res_w = bzla_bvprop_word_concat(bzla_bvdomain_get_width(d_x),
+                                        bzla_bvdomain_get_width(d_y),
+                                        &w_x,
+                                        &w_y,
+                                        &w_z);
+        break;
+      case TEST_BVPROP_EQ:
+        res   = bzla_bvprop_eq(d_mm, d_x, d_y, d_z, &res_x, &res_y, &res_z);
+        res_w = bzla_bvprop_word_eq(bw, &w_x, &w_y, &w_z);
+        break;
+      case TEST_BVPROP_SLL:
+        res   = bzla_bvprop_sll(d_mm, d_x, d_y, d_z, &res_x, &res_y, &res_z);
+        res_w = bzla_bvprop_word_sll(bw, &w_x, &w_y, &w_z);
+        break;
+      case TEST_BVPROP_SRL:
+        res   = bzla_bvprop_srl(d_mm, d_x, d_y, d_z, &res_x, &res_y, &res_z);
+        res_w = bzla_bvprop_word_srl(bw, &w_x, &w_y, &w_z);
+        break;
+      default:
+        assert(op == TEST_BVPROP_ULT);
+        res   = bzla_bvprop_ult(d_mm, d_x, d_y, d_z, &res_x, &res_y, &res_z);
+        res_w = bzla_bvprop_word_ult(bw, &w_x, &w_y, &w_z);
+    }
+
+    ASSERT_EQ(res, res_w);
+    if (res)
+    {
+      check_word_result(res_x, &w_x);
+      check_word_result(res_y, &w_y);
+      check_word_result(res_z, &w_z);
+    }
+    /* concat does not create all result domains if propagation fails */
+    for (BzlaBvDomain *d : {res_x, res_y, res_z})
+    {
+      if (d) bzla_bvdomain_free(d_mm, d);
+    }
+  }
+
+  void check_word_slice(uint32_t bw,
+                        BzlaBvDomain *d_x,
+                        BzlaBvDomain *d_z,
+                        uint32_t upper,
+                        uint32_t lower)
+  {
+    bool res, res_w;
+    BzlaBvDomain *res_x, *res_z;
+    BzlaBvDomainWord w_x, w_z;
+
+    bzla_bvdomain_to_word(d_x, &w_x);
+    bzla_bvdomain_to_word(d_z, &w_z);
+
+    res   = bzla_bvprop_slice(d_mm, d_x, d_z, upper, lower, &res_x, &res_z);
+    res_w = bzla_bvprop_word_slice(bw, &w_x, &w_z, upper, lower);
+
+    ASSERT_EQ(res, res_w);
+    if (res)
+    {
+      check_word_result(res_x, &w_x);
+      check_word_result(res_z, &w_z);
+    }
+    TEST_BVPROP_RELEASE_RES_XZ;
+  }
+
+  void check_word_cond(uint32_t bw,
+                       BzlaBvDomain *d_c,
+                       BzlaBvDomain *d_x,
+                       BzlaBvDomain *d_y,
+                       BzlaBvDomain *d_z)
+  {
+    bool res, res_w;
+    BzlaBvDomain *res_c, *res_x, *res_y, *res_z;
+    BzlaBvDomainWord w_c, w_x, w_y, w_z;
+
+    bzla_bvdomain_to_word(d_c, &w_c);
+    bzla_bvdomain_to_word(d_x, &w_x);
+    bzla_bvdomain_to_word(d_y, &w_y);
+    bzla_bvdomain_to_word(d_z, &w_z);
+
+    res = bzla_bvprop_cond(
+        d_mm, d_x, d_y, d_z, d_c, &res_x, &res_y, &res_z, &res_c);
+    res_w = bzla_bvprop_word_cond(bw, &w_x, &w_y, &w_z, &w_c);
+
+    ASSERT_EQ(res, res_w);
+    if (res)
+    {
+      check_word_result(res_x, &w_x);
+      check_word_result(res_y, &w_y);
+      check_word_result(res_z, &w_z);
+      check_word_result(res_c, &w_c);
+    }
+    TEST_BVPROP_RELEASE_RES_XYZ;
+    bzla_bvdomain_free(d_mm, res_c);
+  }
+
+  /* Check the word-level propagators against their bit-vector counterparts
+   * on all domains of width 'bw'. */
+  void test_word_binary(BvPropOp op, uint32_t bw)
+  {
+    uint32_t num_consts, num_consts_z, bw_z;
+    char **consts, **consts_z;
+    BzlaBvDomain *d_x, *d_y, *d_z;
+
+    bw_z         = op == TEST_BVPROP_EQ || op == TEST_BVPROP_ULT ? 1 : bw;
+    num_consts   = generate_consts(bw, &consts);
+    num_consts_z = generate_consts(bw_z, &consts_z);
+
+    for (uint32_t i = 0; i < num_consts_z; i++)
+    {
+      d_z = bzla_bvdomain_new_from_char(d_mm, consts_z[i]);
+      for (uint32_t j = 0; j < num_consts; j++)
+      {
+        d_x = bzla_bvdomain_new_from_char(d_mm, consts[j]);
+        for (uint32_t k = 0; k < num_consts; k++)
+        {
+          d_y = bzla_bvdomain_new_from_char(d_mm, consts[k]);
+          check_word_binary(op, bw, d_x, d_y, d_z);
+          bzla_bvdomain_free(d_mm, d_y);
+        }
+        bzla_bvdomain_free(d_mm, d_x);
+      }
+      bzla_bvdomain_free(d_mm, d_z);
+    }
+    free_consts(bw, num_consts, consts);
+    free_consts(bw_z, num_consts_z, consts_z);
+  }
+
+  void test_word_slice(uint32_t bw)
+  {
+    uint32_t num_consts, num_consts_z;
+    char **consts, **consts_z;
+    BzlaBvDomain *d_x, *d_z;
+
+    num_consts = generate_consts(bw, &consts);
+    for (uint32_t lower = 0; lower < bw; lower++)
+    {
+      for (uint32_t upper = lower; upper < bw; upper++)
+      {
+        num_consts_z = generate_consts(upper - lower + 1, &consts_z);
+        for (uint32_t i = 0; i < num_consts; i++)
+        {
+          d_x = bzla_bvdomain_new_from_char(d_mm, consts[i]);
+          for (uint32_t j = 0; j < num_consts_z; j++)
+          {
+            d_z = bzla_bvdomain_new_from_char(d_mm, consts_z[j]);
+            check_word_slice(bw, d_x, d_z, upper, lower);
+            bzla_bvdomain_free(d_mm, d_z);
+          }
+          bzla_bvdomain_free(d_mm, d_x);
+        }
+        free_consts(upper - lower + 1, num_consts_z, consts_z);
+      }
+    }
+    free_consts(bw, num_consts, consts);
+  }
+
+  void test_word_concat(uint32_t bw)
+  {
+    uint32_t num_consts_x, num_consts_y, num_consts_z;
+    char **consts_x, **consts_y, **consts_z;
+    BzlaBvDomain *d_x, *d_y, *d_z;
+
+    num_consts_z = generate_consts(bw, &consts_z);
+    for (uint32_t bw_x = 1; bw_x < bw; bw_x++)
+    {
+      num_consts_x = generate_consts(bw_x, &consts_x);
+      num_consts_y = generate_consts(bw - bw_x, &consts_y);
+      for (uint32_t i = 0; i < num_consts_z; i++)
+      {
+        d_z = bzla_bvdomain_new_from_char(d_mm, consts_z[i]);
+        for (uint32_t j = 0; j < num_consts_x; j++)
+        {
+          d_x = bzla_bvdomain_new_from_char(d_mm, consts_x[j]);
+          for (uint32_t k = 0; k < num_consts_y; k++)
+          {
+            d_y = bzla_bvdomain_new_from_char(d_mm, consts_y[k]);
+            check_word_binary(TEST_BVPROP_CONCAT, bw, d_x, d_y, d_z);
+            bzla_bvdomain_free(d_mm, d_y);
+          }
+          bzla_bvdomain_free(d_mm, d_x);
+        }
+        bzla_bvdomain_free(d_mm, d_z);
+      }
+      free_consts(bw_x, num_consts_x, consts_x);
+      free_consts(bw - bw_x, num_consts_y, consts_y);
+    }
+    free_consts(bw, num_consts_z, consts_z);
+  }
+
+  void test_word_cond(uint32_t bw)
+  {
+    uint32_t num_consts, num_consts_c;
+    char **consts, **consts_c;
+    BzlaBvDomain *d_c, *d_x, *d_y, *d_z;
+
+    num_consts   = generate_consts(bw, &consts);
+    num_consts_c = generate_consts(1, &consts_c);
+
+    for (uint32_t c = 0; c < num_consts_c; c++)
+    {
+      d_c = bzla_bvdomain_new_from_char(d_mm, consts_c[c]);
+      for (uint32_t i = 0; i < num_consts; i++)
+      {
+        d_z = bzla_bvdomain_new_from_char(d_mm, consts[i]);
+        for (uint32_t j = 0; j < num_consts; j++)
+        {
+          d_x = bzla_bvdomain_new_from_char(d_mm, consts[j]);
+          for (uint32_t k = 0; k < num_consts; k++)
+          {
+            d_y = bzla_bvdomain_new_from_char(d_mm, consts[k]);
+            check_word_cond(bw, d_c, d_x, d_y, d_z);
+            bzla_bvdomain_free(d_mm, d_y);
+          }
+          bzla_bvdomain_free(d_mm, d_x);
+        }
+        bzla_bvdomain_free(d_mm, d_z);
+      }
+      bzla_bvdomain_free(d_mm, d_c);
+    }
+    free_consts(bw, num_consts, consts);
+    free_consts(1, num_consts_c, consts_c);
+  }
+
+  /* Create a random domain of width 'bw' with about one quarter, half or three
+   * quarters of its bits fixed. */
+  BzlaBvDomain *new_random_domain(uint32_t bw)
+  {
+    BzlaBitVector *val, *fixed, *tmp, *lo, *hi, *not_fixed;
+    BzlaBvDomain *res;
+
+    val   = bzla_bv_new_random(d_mm, d_rng, bw);
+    fixed = bzla_bv_new_random(d_mm, d_rng, bw);
+    tmp   = bzla_bv_new_random(d_mm, d_rng, bw);
+    switch (bzla_rng_pick_rand(d_rng, 0, 2))
+    {
+      case 0: lo = bzla_bv_and(d_mm, fixed, tmp); break;
+      case 1: lo = bzla_bv_copy(d_mm, fixed); break;
+      default: lo = bzla_bv_or(d_mm, fixed, tmp);
+    }
+    bzla_bv_free(d_mm, fixed);
+    bzla_bv_free(d_mm, tmp);
+    fixed     = lo;
+    not_fixed = bzla_bv_not(d_mm, fixed);
+    lo        = bzla_bv_and(d_mm, val, fixed);
+    hi        = bzla_bv_or(d_mm, val, not_fixed);
+    res       = bzla_bvdomain_new(d_mm, lo, hi);
+    bzla_bv_free(d_mm, val);
+    bzla_bv_free(d_mm, fixed);
+    bzla_bv_free(d_mm, not_fixed);
+    bzla_bv_free(d_mm, lo);
+    bzla_bv_free(d_mm, hi);
+    return res;
+  }
+
+  /* Check the word-level propagators against their bit-vector counterparts
+   * on random domains of width 'bw'. */
+  void test_word_random(uint32_t bw)
+  {
+    BvPropOp ops[] = {TEST_BVPROP_ADD,
+                      TEST_BVPROP_AND,
+                      TEST_BVPROP_EQ,
+                      TEST_BVPROP_SLL,
+                      TEST_BVPROP_SRL,
+                      TEST_BVPROP_ULT};
+    BzlaBvDomain *d_c, *d_x, *d_y, *d_z;
+    uint32_t upper, lower, bw_x;
+
+    for (uint32_t i = 0; i < 1000; i++)
+    {
+      d_x = new_random_domain(bw);
+      d_y = new_random_domain(bw);
+      for (BvPropOp op : ops)
+      {
+        d_z = new_random_domain(
+            op == TEST_BVPROP_EQ || op == TEST_BVPROP_ULT ? 1 : bw);
+        check_word_binary(op, bw, d_x, d_y, d_z);
+        bzla_bvdomain_free(d_mm, d_z);
+      }
+
+      d_c = new_random_domain(1);
+      d_z = new_random_domain(bw);
+      check_word_cond(bw, d_c, d_x, d_y, d_z);
+      bzla_bvdomain_free(d_mm, d_z);
+      bzla_bvdomain_free(d_mm, d_c);
+
+      lower = bzla_rng_pick_rand(d_rng, 0, bw - 1);
+      upper = bzla_rng_pick_rand(d_rng, lower, bw - 1);
+      d_z   = new_random_domain(upper - lower + 1);
+      check_word_slice(bw, d_x, d_z, upper, lower);
+      bzla_bvdomain_free(d_mm, d_z);
+      bzla_bvdomain_free(d_mm, d_y);
+      bzla_bvdomain_free(d_mm, d_x);
+
+      if (bw > 1)
+      {
+        bw_x = bzla_rng_pick_rand(d_rng, 1, bw - 1);
+        d_x  = new_random_domain(bw_x);
+        d_y  = new_random_domain(bw - bw_x);
+        d_z  = new_random_domain(bw);
+        check_word_binary(TEST_BVPROP_CONCAT, bw, d_x, d_y, d_z);
+        bzla_bvdomain_free(d_mm, d_z);
+        bzla_bvdomain_free(d_mm, d_y);
+        bzla_bvdomain_free(d_mm, d_x);
+      }
+    }
+  }
+
   Bzla *d_bzla           = nullptr;
   BzlaAIGVecMgr *d_avmgr = nullptr;
+  BzlaRNG *d_rng         = nullptr;
 
  private:
+  void check_word_result(BzlaBvDomain *d, BzlaBvDomainWord *w)
+  {
+    BzlaBvDomainWord d_w;
+    bzla_bvdomain_to_word(d, &d_w);
+    ASSERT_EQ(d_w.lo, w->lo);
+    ASSERT_EQ(d_w.hi, w->hi);
+  }
+
   void check_concat_result(BzlaBvDomain *d_x,
                            BzlaBvDomain *d_y,
                            BzlaBvDomain *d_z)
@@ -3440,3 +3786,30 @@ TEST_F(TestBvProp, urem)
   test_urem(3);
 #endif
 }
+
+TEST_F(TestBvProp, word)
+{
+  for (uint32_t bw = 1; bw <= 3; bw++)
+  {
+    test_word_binary(TEST_BVPROP_ADD, bw);
+    test_word_binary(TEST_BVPROP_AND, bw);
+    test_word_binary(TEST_BVPROP_EQ, bw);
+    test_word_binary(TEST_BVPROP_SLL, bw);
+    test_word_binary(TEST_BVPROP_SRL, bw);
+    test_word_binary(TEST_BVPROP_ULT, bw);
+    test_word_cond(bw);
+  }
+  for (uint32_t bw = 1; bw <= 4; bw++)
+  {
+    test_word_slice(bw);
+    test_word_concat(bw);
+  }
+}
+
+TEST_F(TestBvProp, word_random)
+{
+  for (uint32_t bw : {8, 31, 32, 33, 63, 64})
+  {
+    test_word_random(bw);
+  }
+}
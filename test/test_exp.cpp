@@ -14,6 +14,7 @@ extern "C" {
 #include "bzlacore.h"
 #include "bzlaexp.h"
 #include "dumper/bzladumpbtor.h"
+#include "utils/bzlanodeiter.h"
 }
 
 class TestExp : public TestBzla
@@ -973,3 +974,119 @@ TEST_F(TestExp, dec)
   bzla_node_release(d_bzla, exp2);
   bzla_node_release(d_bzla, exp3);
 }
+
+TEST_F(TestExp, parents)
+{
+  BzlaNode *x, *y, *f, *add, *mul, *slice, *app0, *app1, *args0, *args1;
+  BzlaSortId sort, dsort, fsort;
+  BzlaNodeIterator it;
+
+  sort  = bzla_sort_bv(d_bzla, 8);
+  dsort = bzla_sort_tuple(d_bzla, &sort, 1);
+  fsort = bzla_sort_fun(d_bzla, dsort, sort);
+
+  x     = bzla_exp_var(d_bzla, sort, "x");
+  y     = bzla_exp_var(d_bzla, sort, "y");
+  f     = bzla_exp_uf(d_bzla, fsort, "f");
+  args0 = bzla_exp_args(d_bzla, &x, 1);
+  app0  = bzla_exp_apply(d_bzla, f, args0);
+  add   = bzla_exp_bv_add(d_bzla, x, y);
+  args1 = bzla_exp_args(d_bzla, &y, 1);
+  app1  = bzla_exp_apply(d_bzla, f, args1);
+  mul   = bzla_exp_bv_mul(d_bzla, x, y);
+  slice = bzla_exp_bv_slice(d_bzla, x, 3, 1);
+
+  /* non-apply parents from the most recently added one */
+  ASSERT_EQ(x->parents, 4u);
+  ASSERT_EQ(bzla_node_get_first_parent(x), slice);
+  bzla_iter_parent_init(&it, x);
+  ASSERT_EQ(bzla_iter_parent_next(&it), slice);
+  ASSERT_EQ(bzla_iter_parent_next(&it), mul);
+  ASSERT_EQ(bzla_iter_parent_next(&it), add);
+  ASSERT_EQ(bzla_iter_parent_next(&it), args0);
+  ASSERT_FALSE(bzla_iter_parent_has_next(&it));
+
+  /* apply parents from the most recently added one */
+  ASSERT_EQ(f->parents, 2u);
+  bzla_iter_apply_parent_init(&it, f);
+  ASSERT_EQ(bzla_iter_apply_parent_next(&it), app1);
+  ASSERT_EQ(bzla_iter_apply_parent_next(&it), app0);
+  ASSERT_FALSE(bzla_iter_apply_parent_has_next(&it));
+
+  bzla_node_release(d_bzla, mul);
+  bzla_node_release(d_bzla, app0);
+  bzla_iter_parent_init(&it, x);
+  ASSERT_EQ(bzla_iter_parent_next(&it), slice);
+  ASSERT_EQ(bzla_iter_parent_next(&it), add);
+  ASSERT_EQ(bzla_iter_parent_next(&it), args0);
+  ASSERT_FALSE(bzla_iter_parent_has_next(&it));
+  bzla_iter_apply_parent_init(&it, f);
+  ASSERT_EQ(bzla_iter_apply_parent_next(&it), app1);
+  ASSERT_FALSE(bzla_iter_apply_parent_has_next(&it));
+
+  bzla_node_release(d_bzla, slice);
+  bzla_node_release(d_bzla, app1);
+  bzla_node_release(d_bzla, args1);
+  bzla_node_release(d_bzla, add);
+  bzla_node_release(d_bzla, args0);
+  ASSERT_EQ(x->parents, 0u);
+  ASSERT_EQ(bzla_node_get_first_parent(x), nullptr);
+  ASSERT_EQ(f->parents, 0u);
+
+  bzla_node_release(d_bzla, f);
+  bzla_node_release(d_bzla, y);
+  bzla_node_release(d_bzla, x);
+  bzla_sort_release(d_bzla, fsort);
+  bzla_sort_release(d_bzla, dsort);
+  bzla_sort_release(d_bzla, sort);
+}
+
+TEST_F(TestExp, unique_table)
+{
+  const uint32_t n = 32;
+  BzlaNodeUniqueTable *table = &d_bzla->nodes_unique_table;
+  BzlaNode *x, *exp, *slices[n][n];
+  BzlaSortId sort;
+  uint32_t i, j, num_elements;
+
+  sort         = bzla_sort_bv(d_bzla, n);
+  x            = bzla_exp_var(d_bzla, sort, "x");
+  num_elements = table->num_elements;
+
+  /* enlarges the table several times */
+  for (i = 0; i < n; i++)
+    for (j = 0; j <= i; j++)
+    {
+      slices[i][j] = bzla_exp_bv_slice(d_bzla, x, i, j);
+      ASSERT_LE(table->num_elements, table->size);
+    }
+
+  /* lookup while buckets of the previous table may not be moved yet */
+  for (i = 0; i < n; i++)
+    for (j = 0; j <= i; j++)
+    {
+      exp = bzla_exp_bv_slice(d_bzla, x, i, j);
+      ASSERT_EQ(exp, slices[i][j]);
+      bzla_node_release(d_bzla, exp);
+    }
+
+  for (i = 0; i < n; i++)
+    for (j = i % 2; j <= i; j += 2) bzla_node_release(d_bzla, slices[i][j]);
+  for (i = 0; i < n; i++)
+    for (j = i % 2; j <= i; j += 2)
+      slices[i][j] = bzla_exp_bv_slice(d_bzla, x, i, j);
+  for (i = 0; i < n; i++)
+    for (j = 0; j <= i; j++)
+    {
+      exp = bzla_exp_bv_slice(d_bzla, x, i, j);
+      ASSERT_EQ(exp, slices[i][j]);
+      bzla_node_release(d_bzla, exp);
+    }
+
+  for (i = 0; i < n; i++)
+    for (j = 0; j <= i; j++) bzla_node_release(d_bzla, slices[i][j]);
+  ASSERT_EQ(table->num_elements, num_elements);
+
+  bzla_node_release(d_bzla, x);
+  bzla_sort_release(d_bzla, sort);
+}
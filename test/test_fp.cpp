@@ -16,6 +16,8 @@ extern "C" {
 #include "bzlabv.h"
 #include "bzlaexp.h"
 #include "bzlafp.h"
+#include "bzlamodel.h"
+#include "bzlaslv.h"
 }
 
 class TestFp : public TestBitwuzla
@@ -1449,6 +1451,122 @@ TEST_F(TestFp, sort_rm)
   ASSERT_TRUE(bitwuzla_sort_is_rm(rm));
 }
 
+TEST_F(TestFpInternal, prop_engine)
+{
+  bzla_opt_set(d_bzla, BZLA_OPT_ENGINE, BZLA_ENGINE_PROP);
+  bzla_opt_set(d_bzla, BZLA_OPT_PRODUCE_MODELS, 1);
+
+  BzlaFloatingPoint *fpc =
+      bzla_fp_convert_from_real(d_bzla, d_f16, BZLA_RM_RNE, "2.5");
+  BzlaNode *rne = bzla_exp_rm_const(d_bzla, BZLA_RM_RNE);
+  BzlaNode *x   = bzla_exp_var(d_bzla, d_f16, "x");
+  BzlaNode *y   = bzla_exp_var(d_bzla, d_f16, "y");
+  BzlaNode *c   = bzla_exp_fp_const_fp(d_bzla, fpc);
+  BzlaNode *add = bzla_exp_fp_add(d_bzla, rne, x, y);
+  BzlaNode *eq  = bzla_exp_eq(d_bzla, add, c);
+  BzlaNode *lt  = bzla_exp_fp_lt(d_bzla, x, y);
+  BzlaNode *nrm = bzla_exp_fp_is_normal(d_bzla, x);
+
+  bzla_assert_exp(d_bzla, eq);
+  bzla_assert_exp(d_bzla, lt);
+  bzla_assert_exp(d_bzla, nrm);
+  ASSERT_EQ(bzla_check_sat(d_bzla, -1, -1), BZLA_RESULT_SAT);
+  /* solved natively by the prop engine, without falling back to fun */
+  ASSERT_EQ(d_bzla->slv->kind, BZLA_PROP_SOLVER_KIND);
+
+  BzlaFloatingPoint *fpx =
+      bzla_fp_from_bv(d_bzla, d_f16, bzla_model_get_bv(d_bzla, x));
+  BzlaFloatingPoint *fpy =
+      bzla_fp_from_bv(d_bzla, d_f16, bzla_model_get_bv(d_bzla, y));
+  BzlaFloatingPoint *fpadd = bzla_fp_add(d_bzla, BZLA_RM_RNE, fpx, fpy);
+  ASSERT_TRUE(bzla_fp_eq(d_bzla, fpadd, fpc));
+  ASSERT_TRUE(bzla_fp_lt(d_bzla, fpx, fpy));
+  ASSERT_TRUE(bzla_fp_is_normal(d_bzla, fpx));
+
+  bzla_fp_free(d_bzla, fpadd);
+  bzla_fp_free(d_bzla, fpy);
+  bzla_fp_free(d_bzla, fpx);
+  bzla_fp_free(d_bzla, fpc);
+  bzla_node_release(d_bzla, nrm);
+  bzla_node_release(d_bzla, lt);
+  bzla_node_release(d_bzla, eq);
+  bzla_node_release(d_bzla, add);
+  bzla_node_release(d_bzla, c);
+  bzla_node_release(d_bzla, y);
+  bzla_node_release(d_bzla, x);
+  bzla_node_release(d_bzla, rne);
+}
+
+TEST_F(TestFpInternal, prop_engine_fallback)
+{
+  bzla_opt_set(d_bzla, BZLA_OPT_ENGINE, BZLA_ENGINE_PROP);
+
+  BzlaNode *x   = bzla_exp_var(d_bzla, d_f16, "x");
+  BzlaNode *y   = bzla_exp_var(d_bzla, d_f16, "y");
+  BzlaNode *min = bzla_exp_fp_min(d_bzla, x, y);
+  BzlaNode *eq  = bzla_exp_eq(d_bzla, min, y);
+  BzlaNode *lt  = bzla_exp_fp_lt(d_bzla, x, y);
+
+  bzla_assert_exp(d_bzla, eq);
+  bzla_assert_exp(d_bzla, lt);
+  ASSERT_EQ(bzla_check_sat(d_bzla, -1, -1), BZLA_RESULT_UNSAT);
+  /* fp.min has no native value function, falls back to fun */
+  ASSERT_EQ(d_bzla->slv->kind, BZLA_FUN_SOLVER_KIND);
+
+  bzla_node_release(d_bzla, lt);
+  bzla_node_release(d_bzla, eq);
+  bzla_node_release(d_bzla, min);
+  bzla_node_release(d_bzla, y);
+  bzla_node_release(d_bzla, x);
+}
+
+TEST_F(TestFpInternal, sls_engine_fallback)
+{
+  bzla_opt_set(d_bzla, BZLA_OPT_ENGINE, BZLA_ENGINE_SLS);
+
+  BzlaNode *x   = bzla_exp_var(d_bzla, d_f16, "x");
+  BzlaNode *y   = bzla_exp_var(d_bzla, d_f16, "y");
+  BzlaNode *min = bzla_exp_fp_min(d_bzla, x, y);
+  BzlaNode *eq  = bzla_exp_eq(d_bzla, min, y);
+  BzlaNode *lt  = bzla_exp_fp_lt(d_bzla, x, y);
+
+  bzla_assert_exp(d_bzla, eq);
+  bzla_assert_exp(d_bzla, lt);
+  ASSERT_EQ(bzla_check_sat(d_bzla, -1, -1), BZLA_RESULT_UNSAT);
+  ASSERT_EQ(d_bzla->slv->kind, BZLA_FUN_SOLVER_KIND);
+
+  bzla_node_release(d_bzla, lt);
+  bzla_node_release(d_bzla, eq);
+  bzla_node_release(d_bzla, min);
+  bzla_node_release(d_bzla, y);
+  bzla_node_release(d_bzla, x);
+}
+
+TEST_F(TestFpInternal, prop_engine_nan)
+{
+  bzla_opt_set(d_bzla, BZLA_OPT_ENGINE, BZLA_ENGINE_PROP);
+  bzla_opt_set(d_bzla, BZLA_OPT_PROP_NPROPS, 1000);
+
+  BzlaNode *x    = bzla_exp_var(d_bzla, d_f16, "x");
+  BzlaNode *y    = bzla_exp_var(d_bzla, d_f16, "y");
+  BzlaNode *nanx = bzla_exp_fp_is_nan(d_bzla, x);
+  BzlaNode *nany = bzla_exp_fp_is_nan(d_bzla, y);
+  BzlaNode *ne   = bzla_exp_ne(d_bzla, x, y);
+
+  /* all NaNs are equal, the prop engine must not find a model */
+  bzla_assert_exp(d_bzla, nanx);
+  bzla_assert_exp(d_bzla, nany);
+  bzla_assert_exp(d_bzla, ne);
+  ASSERT_EQ(bzla_check_sat(d_bzla, -1, -1), BZLA_RESULT_UNKNOWN);
+  ASSERT_EQ(d_bzla->slv->kind, BZLA_PROP_SOLVER_KIND);
+
+  bzla_node_release(d_bzla, ne);
+  bzla_node_release(d_bzla, nany);
+  bzla_node_release(d_bzla, nanx);
+  bzla_node_release(d_bzla, y);
+  bzla_node_release(d_bzla, x);
+}
+
 TEST_F(TestFpInternal, fp_as_bv)
 {
   for (uint64_t i = 0; i < (1u << 5); ++i)
@@ -12,6 +12,7 @@
 
 extern "C" {
 #include "bzlabeta.h"
+#include "bzlaclone.h"
 #include "bzlacore.h"
 #include "bzlaexp.h"
 #include "utils/bzlamem.h"
@@ -108,7 +109,7 @@ class TestLambda : public TestBzla
       cur = bzla_node_real_addr(cur->e[1]);
     }
 
-    result = bzla_beta_reduce_full(bzla, lambda, 0);
+    result = bzla_beta_reduce_full(bzla, lambda);
 
     while (!BZLA_EMPTY_STACK(unassign))
     {
@@ -1131,7 +1132,7 @@ TEST_F(TestLambda, reduce_nested_lambdas_add1)
   bzla_node_release(d_bzla, result);
 
   BzlaNode *apply = bzla_exp_apply_n(d_bzla, fun, args, 2);
-  result          = bzla_beta_reduce_full(d_bzla, apply, 0);
+  result          = bzla_beta_reduce_full(d_bzla, apply);
   ASSERT_EQ(result, expected);
 
   bzla_node_release(d_bzla, apply);
@@ -1242,7 +1243,7 @@ TEST_F(TestLambda, reduce_nested_lambdas_const_n1000)
   bzla_node_release(d_bzla, result);
 
   BzlaNode *apply = bzla_exp_apply_n(d_bzla, fun, indices, nesting_lvl);
-  result          = bzla_beta_reduce_full(d_bzla, apply, 0);
+  result          = bzla_beta_reduce_full(d_bzla, apply);
   ASSERT_EQ(result, var);
 
   for (i = 0; i < nesting_lvl; i++)
@@ -1615,3 +1616,48 @@ TEST_F(TestLambda, define_fun)
   bzla_mem_free(d_bzla->mm, ands, size - sizeof(BzlaNode *));
   bzla_node_release(d_bzla, result);
 }
+
+/* (lambda x . (x + a)) (b), reduced twice */
+TEST_F(TestLambda, reduce_cached)
+{
+  BzlaNode *result, *result2;
+  BzlaNode *a, *b, *expected, *x, *add, *fun, *apply;
+  uint64_t num_get;
+  Bzla *clone;
+
+  bzla_opt_set(d_bzla, BZLA_OPT_RW_LEVEL, 0);
+
+  a        = bzla_exp_var(d_bzla, d_elem_sort, "a");
+  b        = bzla_exp_var(d_bzla, d_elem_sort, "b");
+  expected = bzla_exp_bv_add(d_bzla, b, a);
+  x        = bzla_exp_param(d_bzla, d_elem_sort, "x");
+  add      = bzla_exp_bv_add(d_bzla, x, a);
+  fun      = bzla_exp_fun(d_bzla, &x, 1, add);
+  apply    = bzla_exp_apply_n(d_bzla, fun, &b, 1);
+  ASSERT_TRUE(bzla_node_is_apply(apply));
+
+  num_get = d_bzla->beta_cache->num_get;
+  result  = bzla_beta_reduce_full(d_bzla, apply);
+  ASSERT_EQ(result, expected);
+  ASSERT_EQ(d_bzla->beta_cache->num_get, num_get);
+  result2 = bzla_beta_reduce_full(d_bzla, apply);
+  ASSERT_EQ(result2, expected);
+  ASSERT_EQ(d_bzla->beta_cache->num_get, num_get + 1);
+
+  /* caches are not copied when cloning the exp layer */
+  clone = bzla_clone_exp_layer(d_bzla, 0, true);
+  ASSERT_GT(d_bzla->beta_cache->count, 0u);
+  ASSERT_EQ(clone->beta_cache->count, 0u);
+  ASSERT_EQ(clone->rw_cache->cache->count, 0u);
+  bzla_delete(clone);
+
+  bzla_node_release(d_bzla, result2);
+  bzla_node_release(d_bzla, result);
+  bzla_node_release(d_bzla, apply);
+  bzla_node_release(d_bzla, fun);
+  bzla_node_release(d_bzla, add);
+  bzla_node_release(d_bzla, x);
+  bzla_node_release(d_bzla, expected);
+  bzla_node_release(d_bzla, b);
+  bzla_node_release(d_bzla, a);
+}
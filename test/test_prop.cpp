@@ -15,10 +15,13 @@ extern "C" {
 #include "bzlacore.h"
 #include "bzlaexp.h"
 #include "bzlainvutils.h"
+#include "bzlalsutils.h"
 #include "bzlamodel.h"
 #include "bzlanode.h"
 #include "bzlaproputils.h"
+#include "bzlaslsutils.h"
 #include "bzlaslvprop.h"
+#include "bzlaslvsls.h"
 #include "utils/bzlahashint.h"
 #include "utils/bzlautil.h"
 }
@@ -1296,6 +1299,458 @@ TEST_F(TestPropConst, complete_slice_const)
   prop_complete_slice(bzla_proputils_inv_slice_const);
 }
 
+TEST_F(TestPropConst, const_domains)
+{
+  uint32_t i, bw, domain_limit_reached;
+  uint64_t domain_props;
+  BzlaSortId sort;
+  BzlaNode *x, *one, *ones, *add, *eq;
+  BzlaBitVector *bv_x, *bv_ones, *bv_res;
+  BzlaBvDomain *d_x, *d_add;
+
+  bzla_opt_set(d_bzla, BZLA_OPT_PROP_CONST_DOMAINS, 1);
+
+  /* x + 1 = ~0, with word-level (bw = 4) and bit-vector level (bw = 65)
+   * domain propagation */
+  for (bw = 4; bw <= 65; bw += 61)
+  {
+    sort    = bzla_sort_bv(d_bzla, bw);
+    x       = bzla_exp_var(d_bzla, sort, 0);
+    one     = bzla_exp_bv_one(d_bzla, sort);
+    ones    = bzla_exp_bv_ones(d_bzla, sort);
+    add     = bzla_exp_bv_add(d_bzla, x, one);
+    eq      = bzla_exp_eq(d_bzla, add, ones);
+    bv_x    = bzla_bv_new(d_mm, bw);
+    bv_ones = bzla_bv_ones(d_mm, bw);
+    bv_res  = bzla_bv_dec(d_mm, bv_ones);
+
+    /* without limit, domains are propagated to a fixed point, with limit 1
+     * only the root is propagated */
+    for (i = 0; i < 2; i++)
+    {
+      bzla_opt_set(d_bzla, BZLA_OPT_PROP_CONST_DOMAINS_LIMIT, i);
+      bzla_assume_exp(d_bzla, eq);
+
+      clear_domains();
+      bzla_synthesize_exp(d_bzla, eq, 0);
+      bzla_prop_solver_init_domains(d_bzla, d_domains, eq);
+      bzla_prop_solver_propagate_domains(d_bzla, d_domains);
+      d_x = static_cast<BzlaBvDomain *>(
+          bzla_hashint_map_get(d_domains, bzla_node_real_addr(x)->id)->as_ptr);
+      d_add = static_cast<BzlaBvDomain *>(
+          bzla_hashint_map_get(d_domains, bzla_node_real_addr(add)->id)
+              ->as_ptr);
+      ASSERT_TRUE(bzla_bvdomain_is_fixed(d_mm, d_add));
+      ASSERT_EQ(bzla_bv_compare(d_add->lo, bv_ones), 0);
+      if (i == 0)
+      {
+        ASSERT_TRUE(bzla_bvdomain_is_fixed(d_mm, d_x));
+        ASSERT_EQ(bzla_bv_compare(d_x->lo, bv_res), 0);
+      }
+      else
+      {
+        ASSERT_FALSE(bzla_bvdomain_has_fixed_bits(d_mm, d_x));
+      }
+
+      domain_props         = d_slv->stats.domain_props;
+      domain_limit_reached = d_slv->stats.domain_limit_reached;
+      bzla_model_init_bv(d_bzla, &d_bzla->bv_model);
+      bzla_model_init_fun(d_bzla, &d_bzla->fun_model);
+      bzla_model_add_to_bv(d_bzla, d_bzla->bv_model, x, bv_x);
+      clear_domains();
+      ASSERT_EQ(bzla_prop_solver_sat(d_bzla), BZLA_RESULT_SAT);
+      if (i == 0)
+      {
+        ASSERT_GE(d_slv->stats.domain_props, domain_props + 2);
+        ASSERT_EQ(d_slv->stats.domain_limit_reached, domain_limit_reached);
+      }
+      else
+      {
+        ASSERT_EQ(d_slv->stats.domain_props, domain_props + 1);
+        ASSERT_EQ(d_slv->stats.domain_limit_reached, domain_limit_reached + 1);
+      }
+      bzla_reset_incremental_usage(d_bzla);
+    }
+
+    bzla_bv_free(d_mm, bv_res);
+    bzla_bv_free(d_mm, bv_ones);
+    bzla_bv_free(d_mm, bv_x);
+    bzla_node_release(d_bzla, eq);
+    bzla_node_release(d_bzla, add);
+    bzla_node_release(d_bzla, ones);
+    bzla_node_release(d_bzla, one);
+    bzla_node_release(d_bzla, x);
+    bzla_sort_release(d_bzla, sort);
+  }
+}
+
+TEST_F(TestPropConst, const_domains_conflict)
+{
+  uint32_t bw;
+  BzlaSortId sort;
+  BzlaNode *x, *y, *one, *two, *bvand, *eq_and, *eq_x;
+  BzlaIntHashTableIterator it;
+
+  bzla_opt_set(d_bzla, BZLA_OPT_PROP_CONST_DOMAINS, 1);
+
+  /* (x & y) = 1 and x = 2 are conflicting, which must not be propagated */
+  for (bw = 4; bw <= 65; bw += 61)
+  {
+    sort   = bzla_sort_bv(d_bzla, bw);
+    x      = bzla_exp_var(d_bzla, sort, 0);
+    y      = bzla_exp_var(d_bzla, sort, 0);
+    one    = bzla_exp_bv_one(d_bzla, sort);
+    two    = bzla_exp_bv_int(d_bzla, 2, sort);
+    bvand  = bzla_exp_bv_and(d_bzla, x, y);
+    eq_and = bzla_exp_eq(d_bzla, bvand, one);
+    eq_x   = bzla_exp_eq(d_bzla, x, two);
+
+    bzla_assume_exp(d_bzla, eq_and);
+    bzla_assume_exp(d_bzla, eq_x);
+    clear_domains();
+    bzla_synthesize_exp(d_bzla, eq_and, 0);
+    bzla_synthesize_exp(d_bzla, eq_x, 0);
+    bzla_prop_solver_init_domains(d_bzla, d_domains, eq_and);
+    bzla_prop_solver_init_domains(d_bzla, d_domains, eq_x);
+    bzla_prop_solver_propagate_domains(d_bzla, d_domains);
+    bzla_iter_hashint_init(&it, d_domains);
+    while (bzla_iter_hashint_has_next(&it))
+    {
+      BzlaHashTableData *data = bzla_iter_hashint_next_data(&it);
+      ASSERT_TRUE(bzla_bvdomain_is_valid(
+          d_mm, static_cast<BzlaBvDomain *>(data->as_ptr)));
+    }
+    clear_domains();
+    bzla_reset_incremental_usage(d_bzla);
+
+    bzla_node_release(d_bzla, eq_x);
+    bzla_node_release(d_bzla, eq_and);
+    bzla_node_release(d_bzla, bvand);
+    bzla_node_release(d_bzla, two);
+    bzla_node_release(d_bzla, one);
+    bzla_node_release(d_bzla, y);
+    bzla_node_release(d_bzla, x);
+    bzla_sort_release(d_bzla, sort);
+  }
+}
+
+TEST_F(TestPropConst, share_const_bits)
+{
+  BzlaSortId sort;
+  BzlaNode *x, *one, *ones, *add, *eq;
+  BzlaBitVector *bv_x;
+  BzlaSATMgr *smgr;
+
+  bzla_opt_set(d_bzla, BZLA_OPT_PROP_CONST_DOMAINS, 1);
+  bzla_opt_set(d_bzla, BZLA_OPT_LS_SHARE_CONST_BITS, 1);
+  smgr = bzla_get_sat_mgr(d_bzla);
+  bzla_sat_enable_solver(smgr);
+  bzla_sat_init(smgr);
+  /* terminate right after domain propagation */
+  bzla_set_term(d_bzla, [](void *) -> int32_t { return 1; }, nullptr);
+
+  /* x + 1 = ~0 */
+  sort = bzla_sort_bv(d_bzla, 4);
+  x    = bzla_exp_var(d_bzla, sort, 0);
+  one  = bzla_exp_bv_one(d_bzla, sort);
+  ones = bzla_exp_bv_ones(d_bzla, sort);
+  add  = bzla_exp_bv_add(d_bzla, x, one);
+  eq   = bzla_exp_eq(d_bzla, add, ones);
+  bv_x = bzla_bv_new(d_mm, 4);
+
+  bzla_assert_exp(d_bzla, eq);
+  bzla_model_init_bv(d_bzla, &d_bzla->bv_model);
+  bzla_model_init_fun(d_bzla, &d_bzla->fun_model);
+  bzla_model_add_to_bv(d_bzla, d_bzla->bv_model, x, bv_x);
+  ASSERT_EQ(bzla_prop_solver_sat(d_bzla), BZLA_RESULT_UNKNOWN);
+  /* all bits of x and x + 1 are fixed */
+  ASSERT_GE(d_slv->stats.shared_bits, 8u);
+
+  /* x = 1110 is the only solution */
+  bzla_set_term(d_bzla, nullptr, nullptr);
+  ASSERT_EQ(bzla_sat_check_sat(smgr, -1), BZLA_RESULT_SAT);
+  ASSERT_EQ(bzla_sat_deref(smgr, bzla_aig_get_cnf_id(x->av->aigs[0])), 1);
+  ASSERT_EQ(bzla_sat_deref(smgr, bzla_aig_get_cnf_id(x->av->aigs[3])), -1);
+
+  bzla_bv_free(d_mm, bv_x);
+  bzla_node_release(d_bzla, eq);
+  bzla_node_release(d_bzla, add);
+  bzla_node_release(d_bzla, ones);
+  bzla_node_release(d_bzla, one);
+  bzla_node_release(d_bzla, x);
+  bzla_sort_release(d_bzla, sort);
+}
+
+/* ========================================================================== */
+/* Undo log of tentative local search moves.                                  */
+/* ========================================================================== */
+
+class TestLsUndo : public TestBzla
+{
+ protected:
+  void SetUp() override
+  {
+    TestBzla::SetUp();
+
+    d_bzla->slv       = bzla_new_sls_solver(d_bzla);
+    d_bzla->slv->bzla = d_bzla;
+    d_slv             = BZLA_SLS_SOLVER(d_bzla);
+    d_slv->roots      = bzla_hashint_map_new(d_bzla->mm);
+    d_mm              = d_bzla->mm;
+
+    bzla_opt_set(d_bzla, BZLA_OPT_ENGINE, BZLA_ENGINE_SLS);
+    bzla_opt_set(d_bzla, BZLA_OPT_RW_LEVEL, 0);
+
+    /* x + y = x */
+    d_sort = bzla_sort_bv(d_bzla, 4);
+    d_x    = bzla_exp_var(d_bzla, d_sort, 0);
+    d_y    = bzla_exp_var(d_bzla, d_sort, 0);
+    d_add  = bzla_exp_bv_add(d_bzla, d_x, d_y);
+    d_eq   = bzla_exp_eq(d_bzla, d_add, d_x);
+    d_zero = bzla_bv_new(d_mm, 4);
+    d_one  = bzla_bv_one(d_mm, 4);
+  }
+
+  void TearDown() override
+  {
+    bzla_bv_free(d_mm, d_one);
+    bzla_bv_free(d_mm, d_zero);
+    bzla_node_release(d_bzla, d_eq);
+    bzla_node_release(d_bzla, d_add);
+    bzla_node_release(d_bzla, d_y);
+    bzla_node_release(d_bzla, d_x);
+    bzla_sort_release(d_bzla, d_sort);
+
+    TestBzla::TearDown();
+  }
+
+  /* Initialize the model with x = 0 and y = x + y = 'val_y', the model value
+   * of x + y = x is added by the cone update. */
+  void init_model(BzlaBitVector *val_y)
+  {
+    bzla_model_init_bv(d_bzla, &d_bzla->bv_model);
+    bzla_model_init_fun(d_bzla, &d_bzla->fun_model);
+    bzla_model_add_to_bv(d_bzla, d_bzla->bv_model, d_x, d_zero);
+    bzla_model_add_to_bv(d_bzla, d_bzla->bv_model, d_y, val_y);
+    bzla_model_add_to_bv(d_bzla, d_bzla->bv_model, d_add, val_y);
+  }
+
+  /* Check the given score of the formula against its recomputation. */
+  void check_score_formula(double weighted_score, uint32_t num_unsat)
+  {
+    double sc;
+    uint32_t n;
+
+    bzla_sls_solver_compute_score_formula(d_bzla, &sc, &n);
+    ASSERT_EQ(num_unsat, n);
+    ASSERT_DOUBLE_EQ(weighted_score, sc);
+  }
+
+  BzlaSLSSolver *d_slv = nullptr;
+  BzlaMemMgr *d_mm     = nullptr;
+  BzlaSortId d_sort;
+  BzlaNode *d_x, *d_y, *d_add, *d_eq;
+  BzlaBitVector *d_zero, *d_one;
+};
+
+TEST_F(TestLsUndo, update_cone)
+{
+  uint32_t count;
+  uint64_t updates = 0;
+  double time      = 0;
+  BzlaIntHashTable *exps;
+  BzlaLsUndoEntryStack undo;
+
+  init_model(d_zero);
+  count = d_bzla->bv_model->count;
+
+  exps = bzla_hashint_map_new(d_mm);
+  bzla_hashint_map_add(exps, d_x->id)->as_ptr = d_one;
+  BZLA_INIT_STACK(d_mm, undo);
+  bzla_lsutils_update_cone(d_bzla,
+                           d_bzla->bv_model,
+                           d_slv->roots,
+                           0,
+                           exps,
+                           false,
+                           &undo,
+                           &updates,
+                           &time,
+                           &time,
+                           &time,
+                           &time);
+  ASSERT_FALSE(BZLA_EMPTY_STACK(undo));
+  ASSERT_EQ(d_bzla->bv_model->count, count + 1);
+  ASSERT_TRUE(bzla_bv_is_one(bzla_model_get_bv(d_bzla, d_x)));
+  ASSERT_TRUE(bzla_bv_is_one(bzla_model_get_bv(d_bzla, d_add)));
+  ASSERT_TRUE(bzla_bv_is_true(bzla_model_get_bv(d_bzla, d_eq)));
+
+  bzla_lsutils_undo(d_bzla, d_bzla->bv_model, 0, &undo);
+  ASSERT_TRUE(BZLA_EMPTY_STACK(undo));
+  ASSERT_EQ(d_bzla->bv_model->count, count);
+  ASSERT_TRUE(bzla_bv_is_zero(bzla_model_get_bv(d_bzla, d_x)));
+  ASSERT_TRUE(bzla_bv_is_zero(bzla_model_get_bv(d_bzla, d_add)));
+
+  BZLA_RELEASE_STACK(undo);
+  bzla_hashint_map_delete(exps);
+}
+
+TEST_F(TestLsUndo, update_cone_discard)
+{
+  uint32_t num_unsat;
+  uint64_t updates = 0;
+  double time = 0, weighted_score;
+  BzlaIntHashTable *exps;
+  BzlaSLSConstrData *d;
+
+  /* x + y = x is asserted with weight 2 and unsatisfied for y = 1 */
+  bzla_assert_exp(d_bzla, d_eq);
+  init_model(d_one);
+  bzla_hashint_map_add(d_slv->roots, d_eq->id);
+  d_slv->weights = bzla_hashint_map_new(d_mm);
+  d_slv->score   = bzla_hashint_map_new(d_mm);
+  BZLA_CNEW(d_mm, d);
+  d->weight = 2;
+  bzla_hashint_map_add(d_slv->weights, d_eq->id)->as_ptr = d;
+  bzla_slsutils_compute_sls_scores(
+      d_bzla, d_bzla->bv_model, d_bzla->fun_model, d_slv->score);
+  bzla_sls_solver_compute_score_formula(d_bzla, &weighted_score, &num_unsat);
+  ASSERT_EQ(num_unsat, 1u);
+  ASSERT_LT(weighted_score, 2.0);
+
+  /* a tentative move that satisfies x + y = x, the maintained score is
+   * updated from the score changes in the undo log */
+  exps = bzla_hashint_map_new(d_mm);
+  bzla_hashint_map_add(exps, d_y->id)->as_ptr = d_zero;
+  bzla_lsutils_update_cone(d_bzla,
+                           d_bzla->bv_model,
+                           d_slv->roots,
+                           d_slv->score,
+                           exps,
+                           false,
+                           &d_slv->undo,
+                           &updates,
+                           &time,
+                           &time,
+                           &time,
+                           &time);
+  d_slv->weighted_score = weighted_score;
+  d_slv->num_unsat      = num_unsat;
+  bzla_sls_solver_update_score_formula(d_slv,
+                                       &d_slv->undo,
+                                       d_slv->score,
+                                       &d_slv->weighted_score,
+                                       &d_slv->num_unsat);
+  ASSERT_EQ(d_slv->num_unsat, 0u);
+  ASSERT_EQ(d_slv->weighted_score, 2.0);
+  check_score_formula(d_slv->weighted_score, d_slv->num_unsat);
+
+  /* undoing the move restores the previous scores */
+  bzla_lsutils_undo(d_bzla, d_bzla->bv_model, d_slv->score, &d_slv->undo);
+  ASSERT_TRUE(bzla_bv_is_one(bzla_model_get_bv(d_bzla, d_y)));
+  check_score_formula(weighted_score, num_unsat);
+
+  /* an actual move records its changes but keeps them */
+  d_slv->weighted_score = weighted_score;
+  d_slv->num_unsat      = num_unsat;
+  bzla_lsutils_update_cone(d_bzla,
+                           d_bzla->bv_model,
+                           d_slv->roots,
+                           d_slv->score,
+                           exps,
+                           true,
+                           &d_slv->undo,
+                           &updates,
+                           &time,
+                           &time,
+                           &time,
+                           &time);
+  bzla_sls_solver_update_score_formula(d_slv,
+                                       &d_slv->undo,
+                                       d_slv->score,
+                                       &d_slv->weighted_score,
+                                       &d_slv->num_unsat);
+  ASSERT_FALSE(BZLA_EMPTY_STACK(d_slv->undo));
+  bzla_lsutils_undo_discard(d_bzla, &d_slv->undo);
+  ASSERT_TRUE(BZLA_EMPTY_STACK(d_slv->undo));
+  ASSERT_TRUE(bzla_bv_is_zero(bzla_model_get_bv(d_bzla, d_y)));
+  ASSERT_TRUE(bzla_bv_is_zero(bzla_model_get_bv(d_bzla, d_add)));
+  ASSERT_EQ(d_slv->roots->count, 0u);
+  ASSERT_EQ(d_slv->num_unsat, 0u);
+  check_score_formula(d_slv->weighted_score, d_slv->num_unsat);
+
+  bzla_hashint_map_delete(exps);
+}
+
+TEST_F(TestLsUndo, compute_cone_delta)
+{
+  uint32_t count;
+  uint64_t updates = 0;
+  double sc;
+  BzlaIntHashTable *exps, *score, *delta_model, *delta_score;
+  BzlaLsUndoEntryStack log;
+
+  init_model(d_zero);
+  count = d_bzla->bv_model->count;
+
+  score = bzla_hashint_map_new(d_mm);
+  bzla_hashint_map_add(score, d_eq->id)->as_dbl  = 0.5;
+  bzla_hashint_map_add(score, -d_eq->id)->as_dbl = 1.0;
+
+  exps = bzla_hashint_map_new(d_mm);
+  bzla_hashint_map_add(exps, d_x->id)->as_ptr = d_one;
+  delta_model = bzla_hashint_map_new(d_mm);
+  delta_score = bzla_hashint_map_new(d_mm);
+  BZLA_INIT_STACK(d_mm, log);
+  ASSERT_TRUE(bzla_lsutils_compute_cone_delta(d_bzla,
+                                              d_mm,
+                                              d_bzla->bv_model,
+                                              score,
+                                              exps,
+                                              delta_model,
+                                              delta_score,
+                                              &log,
+                                              &updates));
+  ASSERT_EQ(updates, 3u);
+
+  /* the model and the scores are unchanged */
+  ASSERT_EQ(d_bzla->bv_model->count, count);
+  ASSERT_TRUE(bzla_bv_is_zero(bzla_model_get_bv(d_bzla, d_x)));
+  ASSERT_TRUE(bzla_bv_is_zero(bzla_model_get_bv(d_bzla, d_add)));
+  ASSERT_EQ(bzla_hashint_map_get(score, d_eq->id)->as_dbl, 0.5);
+
+  ASSERT_EQ(delta_model->count, 3u);
+  ASSERT_TRUE(bzla_bv_is_one(
+      (BzlaBitVector *) bzla_hashint_map_get(delta_model, d_x->id)->as_ptr));
+  ASSERT_TRUE(bzla_bv_is_one(
+      (BzlaBitVector *) bzla_hashint_map_get(delta_model, d_add->id)->as_ptr));
+  ASSERT_TRUE(bzla_bv_is_true(
+      (BzlaBitVector *) bzla_hashint_map_get(delta_model, d_eq->id)->as_ptr));
+  ASSERT_EQ(bzla_hashint_map_get(delta_score, d_eq->id)->as_dbl, 1.0);
+  ASSERT_EQ(bzla_hashint_map_get(delta_score, -d_eq->id)->as_dbl, 0.0);
+
+  /* the log records the previous scores */
+  ASSERT_EQ(BZLA_COUNT_STACK(log), 2u);
+  sc = 0;
+  for (BzlaLsUndoEntry *e = log.start; e < log.top; e++)
+  {
+    ASSERT_TRUE(e->is_score);
+    sc += e->score;
+  }
+  ASSERT_EQ(sc, 1.5);
+
+  bzla_lsutils_delta_reset(d_mm, delta_model, delta_score, &log);
+  ASSERT_EQ(delta_model->count, 0u);
+  ASSERT_EQ(delta_score->count, 0u);
+  ASSERT_TRUE(BZLA_EMPTY_STACK(log));
+
+  BZLA_RELEASE_STACK(log);
+  bzla_hashint_map_delete(delta_score);
+  bzla_hashint_map_delete(delta_model);
+  bzla_hashint_map_delete(exps);
+  bzla_hashint_map_delete(score);
+}
+
 /* -------------------------------------------------------------------------- */
 /* Inverse value computation with propagator domains, no const bits.          */
 /* -------------------------------------------------------------------------- */
@@ -42,3 +42,147 @@ TEST_F(TestSatMgr, next_cnf_id)
   ASSERT_EQ(bzla_sat_mgr_next_cnf_id(d_smgr), 4);
   bzla_sat_reset(d_smgr);
 }
+
+TEST_F(TestSatMgr, add_clauses)
+{
+  int32_t a, b, clauses;
+
+  bzla_sat_enable_solver(d_smgr);
+  bzla_sat_init(d_smgr);
+  a       = bzla_sat_mgr_next_cnf_id(d_smgr);
+  b       = bzla_sat_mgr_next_cnf_id(d_smgr);
+  clauses = d_smgr->clauses;
+
+  int32_t lits[] = {a, b, 0, -a, 0};
+  bzla_sat_add_clauses(d_smgr, lits, sizeof(lits) / sizeof(*lits));
+  ASSERT_EQ(d_smgr->clauses, clauses + 2);
+  ASSERT_EQ(bzla_sat_check_sat(d_smgr, -1), BZLA_RESULT_SAT);
+  ASSERT_EQ(bzla_sat_deref(d_smgr, a), -1);
+  ASSERT_EQ(bzla_sat_deref(d_smgr, b), 1);
+  bzla_sat_reset(d_smgr);
+}
+
+#ifdef BZLA_USE_CADICAL
+TEST_F(TestSatMgr, cadical_fixed)
+{
+  int32_t a, b;
+
+  bzla_opt_set(d_bzla, BZLA_OPT_SAT_ENGINE, BZLA_SAT_ENGINE_CADICAL);
+  bzla_sat_enable_solver(d_smgr);
+  bzla_sat_init(d_smgr);
+  a = bzla_sat_mgr_next_cnf_id(d_smgr);
+  b = bzla_sat_mgr_next_cnf_id(d_smgr);
+  bzla_sat_add(d_smgr, -a);
+  bzla_sat_add(d_smgr, 0);
+  bzla_sat_add(d_smgr, a);
+  bzla_sat_add(d_smgr, b);
+  bzla_sat_add(d_smgr, 0);
+  ASSERT_EQ(bzla_sat_check_sat(d_smgr, -1), BZLA_RESULT_SAT);
+  ASSERT_EQ(bzla_sat_fixed(d_smgr, d_smgr->true_lit), 1);
+  ASSERT_EQ(bzla_sat_fixed(d_smgr, a), -1);
+  ASSERT_EQ(bzla_sat_fixed(d_smgr, b), 1);
+  bzla_sat_reset(d_smgr);
+}
+
+TEST_F(TestSatMgr, cadical_limit)
+{
+  /* pigeon hole problem with 7 pigeons and 6 holes */
+  uint32_t i, j, k, n = 6;
+  int32_t p[7][6];
+
+  bzla_opt_set(d_bzla, BZLA_OPT_SAT_ENGINE, BZLA_SAT_ENGINE_CADICAL);
+  bzla_sat_enable_solver(d_smgr);
+  bzla_sat_init(d_smgr);
+  for (i = 0; i <= n; i++)
+  {
+    for (j = 0; j < n; j++)
+    {
+      p[i][j] = bzla_sat_mgr_next_cnf_id(d_smgr);
+    }
+  }
+  for (i = 0; i <= n; i++)
+  {
+    for (j = 0; j < n; j++)
+    {
+      bzla_sat_add(d_smgr, p[i][j]);
+    }
+    bzla_sat_add(d_smgr, 0);
+  }
+  for (j = 0; j < n; j++)
+  {
+    for (i = 0; i <= n; i++)
+    {
+      for (k = i + 1; k <= n; k++)
+      {
+        bzla_sat_add(d_smgr, -p[i][j]);
+        bzla_sat_add(d_smgr, -p[k][j]);
+        bzla_sat_add(d_smgr, 0);
+      }
+    }
+  }
+  ASSERT_EQ(bzla_sat_check_sat(d_smgr, 0), BZLA_RESULT_UNKNOWN);
+  ASSERT_EQ(bzla_sat_check_sat(d_smgr, -1), BZLA_RESULT_UNSAT);
+  bzla_sat_reset(d_smgr);
+}
+
+TEST_F(TestSatMgr, cadical_clone)
+{
+  int32_t a, b;
+  BzlaSATMgr *clone;
+
+  bzla_opt_set(d_bzla, BZLA_OPT_SAT_ENGINE, BZLA_SAT_ENGINE_CADICAL);
+  bzla_sat_enable_solver(d_smgr);
+  ASSERT_TRUE(bzla_sat_mgr_has_clone_support(d_smgr));
+  bzla_sat_init(d_smgr);
+  a = bzla_sat_mgr_next_cnf_id(d_smgr);
+  b = bzla_sat_mgr_next_cnf_id(d_smgr);
+  bzla_sat_add(d_smgr, a);
+  bzla_sat_add(d_smgr, b);
+  bzla_sat_add(d_smgr, 0);
+  ASSERT_EQ(bzla_sat_check_sat(d_smgr, -1), BZLA_RESULT_SAT);
+
+  clone = bzla_sat_mgr_clone(d_bzla, d_smgr);
+  ASSERT_EQ(clone->maxvar, d_smgr->maxvar);
+  ASSERT_EQ(clone->true_lit, d_smgr->true_lit);
+
+  /* clauses added to the clone do not affect the original */
+  bzla_sat_add(clone, -a);
+  bzla_sat_add(clone, 0);
+  bzla_sat_add(clone, -b);
+  bzla_sat_add(clone, 0);
+  ASSERT_EQ(bzla_sat_check_sat(clone, -1), BZLA_RESULT_UNSAT);
+  bzla_sat_assume(d_smgr, -a);
+  ASSERT_EQ(bzla_sat_check_sat(d_smgr, -1), BZLA_RESULT_SAT);
+  ASSERT_EQ(bzla_sat_deref(d_smgr, b), 1);
+
+  bzla_sat_reset(clone);
+  bzla_sat_mgr_delete(clone);
+  bzla_sat_reset(d_smgr);
+}
+
+TEST_F(TestSatMgr, cadical_phase)
+{
+  int32_t a, b;
+
+  bzla_opt_set(d_bzla, BZLA_OPT_SAT_ENGINE, BZLA_SAT_ENGINE_CADICAL);
+  bzla_sat_enable_solver(d_smgr);
+  bzla_sat_init(d_smgr);
+  a = bzla_sat_mgr_next_cnf_id(d_smgr);
+  b = bzla_sat_mgr_next_cnf_id(d_smgr);
+  bzla_sat_add(d_smgr, -a);
+  bzla_sat_add(d_smgr, -b);
+  bzla_sat_add(d_smgr, 0);
+
+  /* phases are hints only and do not affect the result */
+  bzla_sat_phase(d_smgr, a);
+  bzla_sat_phase(d_smgr, b);
+  ASSERT_EQ(bzla_sat_check_sat(d_smgr, -1), BZLA_RESULT_SAT);
+  ASSERT_TRUE(bzla_sat_deref(d_smgr, a) == -1
+              || bzla_sat_deref(d_smgr, b) == -1);
+  bzla_sat_phase(d_smgr, -a);
+  bzla_sat_assume(d_smgr, b);
+  ASSERT_EQ(bzla_sat_check_sat(d_smgr, -1), BZLA_RESULT_SAT);
+  ASSERT_EQ(bzla_sat_deref(d_smgr, a), -1);
+  bzla_sat_reset(d_smgr);
+}
+#endif
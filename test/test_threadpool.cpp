@@ -0,0 +1,85 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * This file is part of Bitwuzla.
+ *
+ * Copyright (C) 2007-2022 by the authors listed in the AUTHORS file.
+ *
+ * See COPYING for more information on using this software.
+ */
+
+#include <atomic>
+#include <vector>
+
+#include "test.h"
+
+extern "C" {
+#include "utils/bzlathreadpool.h"
+}
+
+class TestThreadPool : public TestCommon
+{
+ protected:
+  struct State
+  {
+    std::vector<uint32_t> results;
+    std::atomic<uint32_t> max_worker{0};
+  };
+
+  static void job(void *state, uint32_t idx, uint32_t worker)
+  {
+    State *s = static_cast<State *>(state);
+    uint32_t max;
+
+    s->results[idx] += idx * idx;
+    max = s->max_worker.load();
+    while (worker > max && !s->max_worker.compare_exchange_weak(max, worker))
+      ;
+  }
+};
+
+TEST_F(TestThreadPool, new_delete)
+{
+  BzlaThreadPool *pool = bzla_thread_pool_new(4);
+  ASSERT_EQ(bzla_thread_pool_get_num_threads(pool), 4u);
+  bzla_thread_pool_delete(pool);
+}
+
+TEST_F(TestThreadPool, run)
+{
+  uint32_t i, round, n = 1000;
+  State state;
+  BzlaThreadPool *pool = bzla_thread_pool_new(4);
+
+  state.results.resize(n, 0);
+  for (round = 1; round <= 3; round++)
+  {
+    bzla_thread_pool_run(pool, n, job, &state);
+    /* every job is run exactly once per round */
+    for (i = 0; i < n; i++)
+    {
+      ASSERT_EQ(state.results[i], round * i * i);
+    }
+  }
+  ASSERT_LT(state.max_worker.load(), 4u);
+
+  /* no jobs */
+  bzla_thread_pool_run(pool, 0, job, &state);
+  bzla_thread_pool_delete(pool);
+}
+
+TEST_F(TestThreadPool, run_single_thread)
+{
+  uint32_t i, n = 100;
+  State state;
+  BzlaThreadPool *pool = bzla_thread_pool_new(1);
+
+  state.results.resize(n, 0);
+  bzla_thread_pool_run(pool, n, job, &state);
+  for (i = 0; i < n; i++)
+  {
+    ASSERT_EQ(state.results[i], i * i);
+  }
+  ASSERT_EQ(state.max_worker.load(), 0u);
+  bzla_thread_pool_delete(pool);
+}